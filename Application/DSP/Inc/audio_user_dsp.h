@@ -6,11 +6,45 @@
 #include "user_lcd.h"
 
 #define NUMBER_OF_BANDS 8
+// left and right, each with its own state in every band
+#define DSP_CHANNELS 2
 
+// time constant of the digital volume ramp
+#define DSP_VOLUME_SMOOTHING_MS 5
+// the ramp ends this close to its target, under one lsb of a full scale sample
+#define DSP_VOLUME_SETTLED 1e-5f
+// frames the packet path filters at once, in float between the bands
+#define DSP_BLOCK_FRAMES 48
+// added to a boost when it sets the headroom: the peak may fall between the
+// points of the response, and a tone overshoots a little as it starts
+#define DSP_HEADROOM_MARGIN_DB 0.5f
+// requantisation the output starts with
+#define DSP_DITHER_DEFAULT DSP_DITHER_TPDF
 
-typedef struct BiquadFilter {
+
+// normalized by a0, what a preset stores for each band and sample rate
+typedef struct BiquadCoefficients {
   float b0, b1, b2, a1, a2;
+} BiquadCoefficients;
+
+// delay line of one channel through one band
+typedef struct BiquadState {
   float in_z1, in_z2, out_z1, out_z2;
+} BiquadState;
+
+// requantisation of the float output to 16 bits, once per sample
+typedef enum DspDither
+{
+  DSP_DITHER_OFF,                     // rounded to nearest, the error follows the signal
+  DSP_DITHER_TPDF,                    // triangular dither of +-1 lsb, white noise
+  DSP_DITHER_SHAPED_1,                // tpdf, error fed back through 1 - z^-1
+  DSP_DITHER_SHAPED_2,                // tpdf, error fed back through (1 - z^-1)^2
+  DSP_DITHER_MODES,
+} DspDither;
+
+typedef struct BiquadFilter {
+  BiquadCoefficients coefficients;
+  BiquadState state[DSP_CHANNELS];
   int32_t gain, frequency, bandwidth;
   bool isInitialized;
 } BiquadFilter;
@@ -22,12 +56,26 @@ void AudioUserDsp_ApplyFilterToSamples(
     int16_t (*rightChannelFilter)(int16_t, uint8_t),
     uint8_t filterIndex
     );
+void AudioUserDsp_ProcessPacket(uint8_t* dataPointer, uint32_t dataLength);
+void AudioUserDsp_FrameToSamples(uint8_t* framePointer, int16_t* leftSamplePointer, int16_t* rightSamplePointer);
+void AudioUserDsp_SamplesToFrame(uint8_t* framePointer, int16_t* leftSamplePointer, int16_t* rightSamplePointer);
 int16_t AudioUserDsp_ChangeAmplitude(int16_t sample, uint8_t filterIndex);
 int16_t AudioUserDsp_LowPassFilter(int16_t sample, uint8_t filterIndex);
 int16_t AudioUserDsp_BiquadFilter(int16_t sample, uint8_t filterIndex);
+int16_t AudioUserDsp_BiquadFilterRight(int16_t sample, uint8_t filterIndex);
 void AudioUserDsp_BiquadFilterConfig(BiquadFilter* filter, int16_t gain, int16_t frequency, int16_t bandwidth);
+void AudioUserDsp_BiquadCoefficients(BiquadCoefficients* coefficients, int16_t gain, int16_t frequency, int16_t bandwidth, uint32_t sampleRate);
+void AudioUserDsp_LoadCoefficients(const BiquadCoefficients* bank, const int16_t* gains, const int16_t* bandFrequencies, const int16_t* bandBandwidths);
 int16_t AudioUserDsp_CalculateGain(uint16_t sliderY, SliderKnob* sliderKnob);
+void AudioUserDsp_SetVolume(int32_t volumeDb256);
+void AudioUserDsp_SetMute(bool mute);
+void AudioUserDsp_SetHeadroom(float peakDb);
+void AudioUserDsp_SettleVolume(void);
+float AudioUserDsp_VolumeGain(void);
+void AudioUserDsp_SetDither(DspDither mode);
 
 extern BiquadFilter biquadFilters[NUMBER_OF_BANDS];
+// core cycles spent filtering the last usb packet, read by the telemetry
+extern volatile uint32_t dspPacketCycles;
 
 #endif // __AUDIO_USER_DSP_H__
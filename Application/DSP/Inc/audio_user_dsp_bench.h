@@ -0,0 +1,39 @@
+/**
+  ******************************************************************************
+  * @file    audio_user_dsp_bench.h
+  * @brief   Microbenchmark of the EQ kernels. Builds for the board (cycles read
+  *          from DWT, results sent on USART1 at boot) and for Linux
+  *          (Tools/DspBench). Results are printed as one JSON document.
+  ******************************************************************************
+  */
+
+// define to prevent recursive inclusion ---------------------------------------
+#ifndef __AUDIO_USER_DSP_BENCH_H__
+#define __AUDIO_USER_DSP_BENCH_H__
+
+// includes --------------------------------------------------------------------
+#include <stdint.h>
+
+// defines ---------------------------------------------------------------------
+
+// set to 1 to run the benchmark once at boot, before the USB stream can start
+#ifndef DSP_BENCHMARK
+#define DSP_BENCHMARK               0
+#endif
+
+// timed runs per case, the median is reported
+#define DSP_BENCH_REPETITIONS       31
+// usb packets processed by each timed run
+#define DSP_BENCH_PACKETS_PER_RUN   16
+// seed of the xorshift generator filling the input packets
+#define DSP_BENCH_SEED              0x2545F491u
+
+// typedefs --------------------------------------------------------------------
+
+// receives the JSON text, called once per line
+typedef void (*AudioUserDspBench_Writer)(const char* text, uint32_t length);
+
+// function prototypes ---------------------------------------------------------
+void AudioUserDspBench_Run(AudioUserDspBench_Writer writer);
+
+#endif // __AUDIO_USER_DSP_BENCH_H__
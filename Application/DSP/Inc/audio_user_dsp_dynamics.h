@@ -0,0 +1,58 @@
+/**
+  ******************************************************************************
+  * @file    audio_user_dsp_dynamics.h
+  * @brief   Dynamics of the EQ output, between the last band and the
+  *          requantisation: an RMS compressor and a look-ahead brickwall
+  *          limiter after it, each optional. Both compute their gain once per
+  *          block of DSP_DYNAMICS_BLOCK_FRAMES and interpolate it sample by
+  *          sample. The limiter delays the output by DSP_DYNAMICS_DELAY_FRAMES
+  *          and never lets a sample out above its ceiling.
+  ******************************************************************************
+  */
+
+// define to prevent recursive inclusion ---------------------------------------
+#ifndef __AUDIO_USER_DSP_DYNAMICS_H__
+#define __AUDIO_USER_DSP_DYNAMICS_H__
+
+// includes --------------------------------------------------------------------
+#include <stdbool.h>
+#include <stdint.h>
+
+// defines ---------------------------------------------------------------------
+// frames each gain is computed for, interpolated in between
+#define DSP_DYNAMICS_BLOCK_FRAMES       8
+// blocks the limiter sees ahead of the output, the length of its attack
+#define DSP_DYNAMICS_LOOKAHEAD_BLOCKS   8
+// latency of the limiter: the look-ahead and the block being interpolated
+#define DSP_DYNAMICS_DELAY_FRAMES       ((DSP_DYNAMICS_LOOKAHEAD_BLOCKS + 1) * DSP_DYNAMICS_BLOCK_FRAMES)
+
+// settings AudioUserDspDynamics_DefaultSettings gives, both stages off
+#define DSP_LIMITER_CEILING_DB          (-1.0f)
+#define DSP_LIMITER_RELEASE_MS          50.0f
+#define DSP_COMPRESSOR_THRESHOLD_DB     (-20.0f)
+#define DSP_COMPRESSOR_RATIO            3.0f
+#define DSP_COMPRESSOR_ATTACK_MS        5.0f
+#define DSP_COMPRESSOR_RELEASE_MS       100.0f
+#define DSP_COMPRESSOR_MAKEUP_DB        0.0f
+
+// typedefs --------------------------------------------------------------------
+typedef struct AudioUserDspDynamicsSettings
+{
+  bool  limiter;                      // delays the output by DSP_DYNAMICS_DELAY_FRAMES
+  float ceilingDb;                    // dBFS, highest sample the limiter lets out, up to 0
+  float limiterReleaseMs;             // time constant of the recovery of the limiter
+  bool  compressor;
+  float thresholdDb;                  // dBFS, of a sine with the rms compression starts at
+  float ratio;                        // above the threshold, dB in per dB out, at least 1
+  float attackMs;                     // time constants of the rms, rising and falling
+  float releaseMs;
+  float makeupDb;                     // gain after the compression, before the limiter
+} AudioUserDspDynamicsSettings;
+
+// function prototypes ---------------------------------------------------------
+void AudioUserDspDynamics_DefaultSettings(AudioUserDspDynamicsSettings* settings);
+bool AudioUserDspDynamics_Configure(const AudioUserDspDynamicsSettings* settings);
+void AudioUserDspDynamics_Reset(void);
+void AudioUserDspDynamics_Process(float* samples, uint32_t frames);
+
+#endif // __AUDIO_USER_DSP_DYNAMICS_H__
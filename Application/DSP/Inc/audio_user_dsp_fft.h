@@ -0,0 +1,30 @@
+/**
+  ******************************************************************************
+  * @file    audio_user_dsp_fft.h
+  * @brief   Float real FFT of the FIR convolution, DSP_FFT_SIZE points
+  *          transformed in place. A spectrum is packed in the same
+  *          DSP_FFT_SIZE floats: the real parts of DC and Nyquist first, then
+  *          the real and imaginary parts of bins 1 to DSP_FFT_SIZE / 2 - 1.
+  *          Neither direction scales, so the inverse of the forward is the
+  *          input times DSP_FFT_SIZE.
+  ******************************************************************************
+  */
+
+// define to prevent recursive inclusion ---------------------------------------
+#ifndef __AUDIO_USER_DSP_FFT_H__
+#define __AUDIO_USER_DSP_FFT_H__
+
+// includes --------------------------------------------------------------------
+#include <stdint.h>
+
+// defines ---------------------------------------------------------------------
+// real points, a power of 2
+#define DSP_FFT_SIZE      128
+#define DSP_FFT_HALF      (DSP_FFT_SIZE / 2)
+
+// function prototypes ---------------------------------------------------------
+void AudioUserDspFft_Init(void);
+void AudioUserDspFft_Forward(float* data);
+void AudioUserDspFft_Inverse(float* data);
+
+#endif // __AUDIO_USER_DSP_FFT_H__
@@ -0,0 +1,53 @@
+/**
+  ******************************************************************************
+  * @file    audio_user_dsp_fir.h
+  * @brief   Long FIR filters of the EQ input, one per channel, for room
+  *          correction a biquad cascade cannot express: uniformly partitioned
+  *          overlap-save convolution, one partition per packet. Filters of up
+  *          to DSP_FIR_MAX_TAPS taps, fewer once AudioUserDspFir_Calibrate has
+  *          measured what fits the USB interrupt; the output is
+  *          DSP_FIR_DELAY_FRAMES late
+  *          while a filter is loaded, whatever the length of the packets
+  *          around it. The spectra of the filters and the delay line of the
+  *          input spectra are in the external SDRAM the caller gives to
+  *          AudioUserDspFir_Init.
+  ******************************************************************************
+  */
+
+// define to prevent recursive inclusion ---------------------------------------
+#ifndef __AUDIO_USER_DSP_FIR_H__
+#define __AUDIO_USER_DSP_FIR_H__
+
+// includes --------------------------------------------------------------------
+#include "audio_user_dsp.h"
+#include "audio_user_dsp_fft.h"
+
+// defines ---------------------------------------------------------------------
+// frames of a partition, the frames of a packet at the nominal rate
+#define DSP_FIR_BLOCK_FRAMES    DSP_BLOCK_FRAMES
+// latency with a filter on either channel: the block being gathered
+#define DSP_FIR_DELAY_FRAMES    DSP_FIR_BLOCK_FRAMES
+// taps the memory holds; what the interrupt can afford is measured
+#define DSP_FIR_MAX_TAPS        16384
+#define DSP_FIR_PARTITIONS      ((DSP_FIR_MAX_TAPS + DSP_FIR_BLOCK_FRAMES - 1) / DSP_FIR_BLOCK_FRAMES)
+// bytes AudioUserDspFir_Init needs: the spectra of the filters and the delay
+// line, for each channel
+#define DSP_FIR_MEMORY_SIZE     (2 * DSP_CHANNELS * DSP_FIR_PARTITIONS * DSP_FFT_SIZE * 4)
+// share of a packet both channels may take in the USB interrupt, in percent;
+// the bands, the dynamics and the SDRAM traffic of the LTDC need the rest
+#define DSP_FIR_BUDGET_PERCENT  25
+
+// typedefs --------------------------------------------------------------------
+
+// a free running counter, in the unit of the budget
+typedef uint32_t (*AudioUserDspFir_Clock)(void);
+
+// function prototypes ---------------------------------------------------------
+void AudioUserDspFir_Init(void* memory);
+uint32_t AudioUserDspFir_Calibrate(AudioUserDspFir_Clock clock, uint32_t budget);
+uint32_t AudioUserDspFir_GetMaxTaps(void);
+bool AudioUserDspFir_Load(uint8_t channel, const float* taps, uint32_t count);
+void AudioUserDspFir_Reset(void);
+void AudioUserDspFir_Process(float* samples, uint32_t frames);
+
+#endif // __AUDIO_USER_DSP_FIR_H__
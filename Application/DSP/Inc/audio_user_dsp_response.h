@@ -0,0 +1,35 @@
+/**
+  ******************************************************************************
+  * @file    audio_user_dsp_response.h
+  * @brief   Magnitude response of the EQ, evaluated from the live coefficients
+  *          in biquadFilters at log spaced frequencies for the curve drawn
+  *          over the sliders. Each band keeps its response in dB and is only
+  *          evaluated again when its coefficients change; the curve is the
+  *          sum of the bands. Its peak sets the headroom of the output.
+  ******************************************************************************
+  */
+
+// define to prevent recursive inclusion ---------------------------------------
+#ifndef __AUDIO_USER_DSP_RESPONSE_H__
+#define __AUDIO_USER_DSP_RESPONSE_H__
+
+// includes --------------------------------------------------------------------
+#include <stdint.h>
+
+// defines ---------------------------------------------------------------------
+#define DSP_RESPONSE_POINTS         200
+// frequencies of the first and last point, log spaced in between
+#define DSP_RESPONSE_MIN_FREQUENCY  20.0f
+#define DSP_RESPONSE_MAX_FREQUENCY  20000.0f
+// floor of the magnitude, keeps a notch from taking the log of zero
+#define DSP_RESPONSE_MIN_DB         (-120.0f)
+
+// function prototypes ---------------------------------------------------------
+void         AudioUserDspResponse_Init(uint32_t sampleRate);
+void         AudioUserDspResponse_Invalidate(uint8_t bandMask);
+uint8_t      AudioUserDspResponse_Update(void);
+const float* AudioUserDspResponse_Magnitude(void);
+float        AudioUserDspResponse_Peak(void);
+float        AudioUserDspResponse_Frequency(uint16_t point);
+
+#endif // __AUDIO_USER_DSP_RESPONSE_H__
@@ -0,0 +1,34 @@
+/**
+  ******************************************************************************
+  * @file    eq_control.h
+  * @brief   EQ set from the host with the vendor requests of
+  *          eq_control_request.h. The USB interrupt takes the requests and
+  *          keeps the last set; the main loop computes its coefficients and
+  *          loads every band at once, between two packets, with
+  *          AudioUserDsp_LoadCoefficients. FIR taps are gathered in a buffer
+  *          the caller gives to EqControl_Init and loaded from the main loop
+  *          with AudioUserDspFir_Load. The dynamics are set from the main
+  *          loop too, with AudioUserDspDynamics_Configure.
+  ******************************************************************************
+  */
+
+// define to prevent recursive inclusion ---------------------------------------
+#ifndef __EQ_CONTROL_H__
+#define __EQ_CONTROL_H__
+
+// includes --------------------------------------------------------------------
+#include <stdbool.h>
+#include <stdint.h>
+#include "eq_control_request.h"
+
+// defines ---------------------------------------------------------------------
+// EqControl_Setup result for a request to stall
+#define EQ_CONTROL_STALL              (-1)
+
+// function prototypes ---------------------------------------------------------
+void    EqControl_Init(float* firTaps);
+int32_t EqControl_Setup(uint8_t request, bool deviceToHost, uint16_t value, uint16_t index, uint16_t length, uint8_t** data);
+void    EqControl_DataReceived(void);
+bool    EqControl_Process(void);
+
+#endif // __EQ_CONTROL_H__
@@ -0,0 +1,153 @@
+/**
+  ******************************************************************************
+  * @file    eq_control_request.h
+  * @brief   Wire format of the vendor control requests that set the EQ from
+  *          the host, shared by the firmware and the host tools
+  *          (Tools/EqControl, Tools/EqControlSim). Plain C, no HAL
+  *          dependency.
+  *
+  *          requests: bmRequestType vendor, recipient device; bRequest one of
+  *          EQ_CONTROL_REQ_*, the direction bit as listed. Every request has
+  *          a data stage of exactly the size of its structure. A request the
+  *          firmware cannot take is stalled at its setup stage; a set whose
+  *          data is out of range is acknowledged, then reads as
+  *          EQ_CONTROL_STATUS_REJECTED. All fields are little endian.
+  *
+  *          A FIR filter is sent in chunks of EQ_CONTROL_FIR_CHUNK_TAPS with
+  *          SET_FIR_TAPS, the last one padded, into a buffer of the board,
+  *          then LOAD_FIR loads the first tapCount taps of the buffer into a
+  *          channel. The chunks only fill the buffer and leave the status
+  *          alone; they are stalled while a load is pending. A filter is not
+  *          saved, the host loads it again after a reboot.
+  *
+  *          SET_DYNAMICS turns the compressor and the limiter of the output
+  *          on or off and sets them, in tenths of dB and in ms; it is not
+  *          saved either.
+  ******************************************************************************
+  */
+
+// define to prevent recursive inclusion ---------------------------------------
+#ifndef __EQ_CONTROL_REQUEST_H__
+#define __EQ_CONTROL_REQUEST_H__
+
+// includes --------------------------------------------------------------------
+#include <stdbool.h>
+#include <stdint.h>
+
+// defines ---------------------------------------------------------------------
+#define EQ_CONTROL_PROTOCOL_VERSION   2
+// same as usbd_desc.c
+#define EQ_CONTROL_VENDOR_ID          0x0483
+#define EQ_CONTROL_PRODUCT_ID         0x5730
+
+#define EQ_CONTROL_BANDS              8
+#define EQ_CONTROL_NAME_LENGTH        12
+#define EQ_CONTROL_CHANNELS           2
+#define EQ_CONTROL_FIR_CHUNK_TAPS     64
+
+// bRequest, host to device ones have bit 4 set
+#define EQ_CONTROL_REQ_IS_IN(request) (((request) & 0x10) == 0)
+// device to host
+#define EQ_CONTROL_REQ_GET_INFO       0x01  // EqControlInfo
+#define EQ_CONTROL_REQ_GET_BAND       0x02  // wIndex band, EqControlBand
+#define EQ_CONTROL_REQ_GET_STATUS     0x03  // EqControlStatus of the last set
+#define EQ_CONTROL_REQ_GET_DYNAMICS   0x04  // EqControlDynamics
+// host to device
+#define EQ_CONTROL_REQ_SET_BAND       0x11  // wIndex band, EqControlBand
+// wValue 0 applies the preset, 1 to slots - 1 also saves it to that slot
+#define EQ_CONTROL_REQ_SET_PRESET     0x12  // EqControlPreset
+// wIndex first tap, a multiple of EQ_CONTROL_FIR_CHUNK_TAPS
+#define EQ_CONTROL_REQ_SET_FIR_TAPS   0x13  // EqControlFirTaps
+#define EQ_CONTROL_REQ_LOAD_FIR       0x14  // EqControlFir
+#define EQ_CONTROL_REQ_SET_DYNAMICS   0x15  // EqControlDynamics
+
+// limits of a band, the range of the touch sliders for the gain
+#define EQ_CONTROL_GAIN_MIN           -15   // dB
+#define EQ_CONTROL_GAIN_MAX           15
+#define EQ_CONTROL_FREQUENCY_MIN      20    // Hz
+#define EQ_CONTROL_FREQUENCY_MAX      20000
+#define EQ_CONTROL_BANDWIDTH_MIN      1     // octaves
+#define EQ_CONTROL_BANDWIDTH_MAX      4
+
+// limits of the dynamics, 0.1 dB and ms
+#define EQ_CONTROL_DYNAMICS_LIMITER     0x01  // flags
+#define EQ_CONTROL_DYNAMICS_COMPRESSOR  0x02
+#define EQ_CONTROL_CEILING_MIN          -200
+#define EQ_CONTROL_CEILING_MAX          0
+#define EQ_CONTROL_THRESHOLD_MIN        -600
+#define EQ_CONTROL_THRESHOLD_MAX        0
+#define EQ_CONTROL_RATIO_MIN            10    // 0.1, 1:1
+#define EQ_CONTROL_RATIO_MAX            200
+#define EQ_CONTROL_MAKEUP_MIN           0
+#define EQ_CONTROL_MAKEUP_MAX           240
+#define EQ_CONTROL_TIME_MIN             1
+#define EQ_CONTROL_TIME_MAX             5000
+
+// typedefs --------------------------------------------------------------------
+typedef enum EqControlStatus
+{
+  EQ_CONTROL_STATUS_IDLE,             // nothing set since boot
+  EQ_CONTROL_STATUS_PENDING,          // taken, not in the filters yet
+  EQ_CONTROL_STATUS_APPLIED,          // in the filters, and queued for the flash if saved
+  EQ_CONTROL_STATUS_REJECTED,         // out of range, nothing changed
+} EqControlStatus;
+
+// one peaking band, in the units of the filters (audio_user_dsp.h)
+typedef struct __attribute__((packed)) EqControlBand
+{
+  int16_t gain;                       // dB
+  int16_t frequency;                  // center, Hz
+  int16_t bandwidth;                  // octaves
+} EqControlBand;
+
+typedef struct __attribute__((packed)) EqControlPreset
+{
+  uint8_t       version;              // EQ_CONTROL_PROTOCOL_VERSION
+  uint8_t       bandCount;            // EQ_CONTROL_BANDS
+  char          name[EQ_CONTROL_NAME_LENGTH]; // for a save, not terminated when full
+  EqControlBand bands[EQ_CONTROL_BANDS];
+} EqControlPreset;
+
+typedef struct __attribute__((packed)) EqControlFirTaps
+{
+  float taps[EQ_CONTROL_FIR_CHUNK_TAPS]; // 1 is unity gain
+} EqControlFirTaps;
+
+typedef struct __attribute__((packed)) EqControlFir
+{
+  uint8_t  version;                   // EQ_CONTROL_PROTOCOL_VERSION
+  uint8_t  channel;                   // 0 left, 1 right
+  uint16_t reserved;
+  uint32_t tapCount;                  // of the buffer, 0 removes the filter
+} EqControlFir;
+
+typedef struct __attribute__((packed)) EqControlDynamics
+{
+  uint8_t  flags;                     // EQ_CONTROL_DYNAMICS_*, the stages on
+  uint8_t  reserved;
+  int16_t  ceiling;                   // limiter, highest sample out, 0.1 dBFS
+  uint16_t limiterRelease;            // ms
+  int16_t  threshold;                 // compressor, rms of a sine, 0.1 dBFS
+  uint16_t ratio;                     // dB in per dB out above the threshold, 0.1
+  uint16_t attack;                    // ms
+  uint16_t release;                   // ms
+  int16_t  makeup;                    // gain after the compressor, 0.1 dB
+} EqControlDynamics;
+
+typedef struct __attribute__((packed)) EqControlInfo
+{
+  uint8_t  version;                   // EQ_CONTROL_PROTOCOL_VERSION
+  uint8_t  bandCount;
+  uint8_t  presetSlots;               // SET_PRESET saves to 1 to presetSlots - 1
+  uint8_t  reserved;
+  uint32_t sampleRate;                // the filters are computed for, Hz
+  uint32_t firMaxTaps;                // LOAD_FIR takes up to, 0 without a buffer
+} EqControlInfo;
+
+// function prototypes ---------------------------------------------------------
+bool EqControlRequest_IsValidBand(const EqControlBand* band);
+bool EqControlRequest_IsValidPreset(const EqControlPreset* preset);
+bool EqControlRequest_IsValidFir(const EqControlFir* fir, uint32_t maxTaps);
+bool EqControlRequest_IsValidDynamics(const EqControlDynamics* dynamics);
+
+#endif // __EQ_CONTROL_REQUEST_H__
@@ -1,12 +1,12 @@
 #include "audio_user_dsp.h"
+#include "audio_user_dsp_dynamics.h"
+#include "audio_user_dsp_fir.h"
 #include "usart.h"
 #include "usb_audio.h"
 #include <math.h>
+#include <string.h>
 extern UART_HandleTypeDef UART1_Handle;
 
-void AudioUserDsp_FrameToSamples(uint8_t*, int16_t* leftSamplePointer, int16_t* rightSamplePointer);
-void AudioUserDsp_SamplesToFrame(uint8_t*, int16_t* leftSamplePointer, int16_t* rightSamplePointer);
-
 uint32_t divider = 1;
 int16_t inconsistencies = 0;
 int16_t previousSample = 0;
@@ -19,8 +19,48 @@ extern float out_z2;
 
 #define DSP_SERIAL_BUFFER_SIZE 100
 #define PI 3.14159265358979323846f
+// per frame step of the volume ramp, 1 - exp(-1 / (tau * fs)) to first order
+#define DSP_VOLUME_SMOOTHING (1000.0f / (DSP_VOLUME_SMOOTHING_MS * USB_AUDIO_CONFIG_PLAY_DEF_FREQ))
+// two 16 bit uniforms of a random word summed, scaled to +-1 lsb
+#define DSP_DITHER_SCALE (1.0f / 65536.0f)
+#define DSP_DITHER_SEED 0x2545F491u
 
 BiquadFilter biquadFilters[NUMBER_OF_BANDS];
+volatile uint32_t dspPacketCycles = 0;
+
+// digital gain of the output: the target, the volume times the headroom, the
+// gain the last band applies, which follows it one frame at a time, and the
+// volume and headroom kept while muted
+static struct {
+  float target;
+  float current;
+  float level;
+  float headroom;
+  bool  muted;
+} volume = { 1.0f, 1.0f, 1.0f, 1.0f, false };
+
+// requantisation of the output: the mode, the last two rounding errors of each
+// channel and the xorshift state of the dither
+static struct {
+  DspDither mode;
+  float error[DSP_CHANNELS][2];
+  uint32_t random;
+} dither = { DSP_DITHER_DEFAULT, { { 0 } }, DSP_DITHER_SEED };
+
+// error feedback of each mode, the noise comes out through 1 - f1 z^-1 - f2 z^-2
+static const float ditherShapers[DSP_DITHER_MODES][2] = {
+  { 0.0f, 0.0f }, { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 2.0f, -1.0f },
+};
+
+// a packet between the bands, in float so a boost does not clip before the output
+static float block[2 * DSP_BLOCK_FRAMES];
+
+static inline float AudioUserDsp_BiquadSample(BiquadState* state, const BiquadCoefficients* coefficients, float sample);
+static inline int16_t AudioUserDsp_Saturate(float sample);
+static inline int16_t AudioUserDsp_Quantise(float sample, const float* shaper, float amplitude, uint32_t random, float* error);
+static inline uint32_t AudioUserDsp_Random(uint32_t* state);
+static void AudioUserDsp_ProcessBlock(uint8_t* framePointer, uint32_t frames);
+static void AudioUserDsp_BiquadBlock(BiquadState* state, const BiquadCoefficients* band, float* samples, uint32_t frames);
 
 void AudioUserDsp_ApplyFilterToSamples(uint8_t* dataPointer, uint32_t dataLength, int16_t (*leftChannelFilter)(int16_t, uint8_t), int16_t (*rightChannelFilter)(int16_t, uint8_t), uint8_t filterIndex)
 {
@@ -42,6 +82,220 @@ void AudioUserDsp_ApplyFilterToSamples(uint8_t* dataPointer, uint32_t dataLength
   }
 }
 
+// runs every EQ band over one usb packet, in place, the last one with the volume
+void AudioUserDsp_ProcessPacket(uint8_t* dataPointer, uint32_t dataLength)
+{
+  for (uint32_t offset = 0; offset + 4 <= dataLength; offset += 4 * DSP_BLOCK_FRAMES)
+  {
+    uint32_t frames = (dataLength - offset) / 4;
+
+    AudioUserDsp_ProcessBlock(dataPointer + offset, (frames < DSP_BLOCK_FRAMES) ? frames : DSP_BLOCK_FRAMES);
+  }
+}
+
+/**
+ * @brief  Filters frames through the FIR, every band in float, then through
+ *         the dynamics, and requantises once, at the output, with the dither
+ *         mode. The last band carries the volume and the headroom in
+ *         its feed forward coefficients: a steady gain costs three multiplies
+ *         per block, a ramp moves the gain and rescales them once per frame.
+ *         The last band is the 16 kHz one, its poles are far from DC so the
+ *         slow gain ramp comes out of the feedback unchanged.
+ * @param  framePointer: 16 bit stereo frames
+ * @param  frames: up to DSP_BLOCK_FRAMES
+ * @retval None
+ */
+static void AudioUserDsp_ProcessBlock(uint8_t* framePointer, uint32_t frames)
+{
+  BiquadFilter* filter = &biquadFilters[NUMBER_OF_BANDS - 1];
+  BiquadCoefficients scaled = filter->coefficients;
+  float gain = volume.current;
+  float target = volume.target;
+  const float* shaper = ditherShapers[dither.mode];
+  float amplitude = (dither.mode == DSP_DITHER_OFF) ? 0.0f : DSP_DITHER_SCALE;
+  uint32_t random = dither.random;
+  int16_t leftSample, rightSample;
+
+  // muted and settled: digital silence, not dither
+  if(gain == 0.0f && target == 0.0f)
+  {
+    amplitude = 0.0f;
+    memset(dither.error, 0, sizeof(dither.error));
+  }
+
+  for (uint32_t f = 0; f < frames; f++)
+  {
+    AudioUserDsp_FrameToSamples(framePointer + 4 * f, &leftSample, &rightSample);
+    block[2 * f] = leftSample;
+    block[2 * f + 1] = rightSample;
+  }
+
+  // room correction first, on the packet as the host sent it
+  AudioUserDspFir_Process(block, frames);
+
+  for (uint8_t i = 0; i < NUMBER_OF_BANDS - 1; i++)
+  {
+    AudioUserDsp_BiquadBlock(&biquadFilters[i].state[0], &biquadFilters[i].coefficients, block, frames);
+    AudioUserDsp_BiquadBlock(&biquadFilters[i].state[1], &biquadFilters[i].coefficients, block + 1, frames);
+  }
+
+  scaled.b0 = filter->coefficients.b0 * gain;
+  scaled.b1 = filter->coefficients.b1 * gain;
+  scaled.b2 = filter->coefficients.b2 * gain;
+
+  for (uint32_t f = 0; f < frames; f++)
+  {
+    if(gain != target)
+    {
+      gain += (target - gain) * DSP_VOLUME_SMOOTHING;
+      if(fabsf(target - gain) < DSP_VOLUME_SETTLED)
+        gain = target;
+
+      scaled.b0 = filter->coefficients.b0 * gain;
+      scaled.b1 = filter->coefficients.b1 * gain;
+      scaled.b2 = filter->coefficients.b2 * gain;
+    }
+
+    block[2 * f] = AudioUserDsp_BiquadSample(&filter->state[0], &scaled, block[2 * f]);
+    block[2 * f + 1] = AudioUserDsp_BiquadSample(&filter->state[1], &scaled, block[2 * f + 1]);
+  }
+
+  AudioUserDspDynamics_Process(block, frames);
+
+  for(uint32_t f = 0; f < frames; f++)
+  {
+    leftSample = AudioUserDsp_Quantise(block[2 * f], shaper, amplitude, AudioUserDsp_Random(&random), dither.error[0]);
+    rightSample = AudioUserDsp_Quantise(block[2 * f + 1], shaper, amplitude, AudioUserDsp_Random(&random), dither.error[1]);
+    AudioUserDsp_SamplesToFrame(framePointer + 4 * f, &leftSample, &rightSample);
+  }
+
+  volume.current = gain;
+  dither.random = random;
+}
+
+/**
+ * @brief  Runs one channel of a block of float stereo frames through one
+ *         band, without saturating. The state is kept in locals, the block
+ *         may alias it for the compiler.
+ * @param  state: of the band, for this channel
+ * @param  band: coefficients of the band
+ * @param  samples: first sample of the channel, filtered in place
+ * @param  frames: in the block, every other sample is filtered
+ * @retval None
+ */
+static void AudioUserDsp_BiquadBlock(BiquadState* state, const BiquadCoefficients* band, float* samples, uint32_t frames)
+{
+  const BiquadCoefficients coefficients = *band;
+  float inZ1 = state->in_z1, inZ2 = state->in_z2;
+  float outZ1 = state->out_z1, outZ2 = state->out_z2;
+
+  for (uint32_t i = 0; i < 2 * frames; i += 2)
+  {
+    double fInSample = samples[i];
+    double fOutSample =
+        coefficients.b0 * fInSample
+      + coefficients.b1 * inZ1
+      + coefficients.b2 * inZ2
+      - coefficients.a1 * outZ1
+      - coefficients.a2 * outZ2;
+
+    inZ2  = inZ1;
+    inZ1  = fInSample;
+    outZ2 = outZ1;
+    outZ1 = fOutSample;
+    samples[i] = outZ1;
+  }
+
+  state->in_z1 = inZ1;
+  state->in_z2 = inZ2;
+  state->out_z1 = outZ1;
+  state->out_z2 = outZ2;
+}
+
+/**
+ * @brief  Sets the digital volume. The gain ramps to it over a few
+ *         milliseconds of audio, unless muted.
+ * @param  volumeDb256: in 1/256 dB, 0 passes the EQ output unchanged
+ * @retval None
+ */
+void AudioUserDsp_SetVolume(int32_t volumeDb256)
+{
+  volume.level = powf(10.0f, volumeDb256 / (20.0f * 256.0f));
+  if(!volume.muted)
+    volume.target = volume.level * volume.headroom;
+}
+
+/**
+ * @brief  Ramps the digital gain to silence, or back to the volume.
+ * @param  mute: true to mute
+ * @retval None
+ */
+void AudioUserDsp_SetMute(bool mute)
+{
+  volume.muted = mute;
+  volume.target = mute ? 0.0f : volume.level * volume.headroom;
+}
+
+/**
+ * @brief  Attenuates the EQ by its largest boost and a margin, so a full
+ *         scale input reaches the output without clipping. Ramps like the
+ *         volume.
+ *         Called from the main loop.
+ * @param  peakDb: highest point of the magnitude response, a cut needs no
+ *         headroom
+ * @retval None
+ */
+void AudioUserDsp_SetHeadroom(float peakDb)
+{
+  float headroom = (peakDb > 0) ? powf(10.0f, -(peakDb + DSP_HEADROOM_MARGIN_DB) / 20.0f) : 1.0f;
+
+  // the USB interrupt sets the volume and mute
+  __disable_irq();
+  volume.headroom = headroom;
+  if(!volume.muted)
+    volume.target = volume.level * volume.headroom;
+  __enable_irq();
+}
+
+/**
+ * @brief  Selects how the output is requantised to 16 bits and clears the
+ *         error of the shaper.
+ * @param  mode: rounding, white TPDF dither or dither with a shaped error
+ * @retval None
+ */
+void AudioUserDsp_SetDither(DspDither mode)
+{
+  if(mode >= DSP_DITHER_MODES)
+    return;
+
+  // the USB interrupt requantises with it
+  __disable_irq();
+  dither.mode = mode;
+  memset(dither.error, 0, sizeof(dither.error));
+  __enable_irq();
+}
+
+/**
+ * @brief  Jumps to the target gain without a ramp, for a stream that starts
+ *         from silence.
+ * @param  None
+ * @retval None
+ */
+void AudioUserDsp_SettleVolume(void)
+{
+  volume.current = volume.target;
+}
+
+/**
+ * @brief  Gain the last band applied at the end of the last packet.
+ * @param  None
+ * @retval linear gain, 0 when muted
+ */
+float AudioUserDsp_VolumeGain(void)
+{
+  return volume.current;
+}
+
 void AudioUserDsp_FrameToSamples(uint8_t* framePointer, int16_t* leftSamplePointer, int16_t* rightSamplePointer)
 {
   *leftSamplePointer  = framePointer[1] * 256 + framePointer[0];
@@ -87,29 +341,99 @@ int16_t AudioUserDsp_LowPassFilter(int16_t sample, uint8_t filterIndex)
   return (int16_t)fOutSample;
 }
 
+// one left sample through a band, saturated to 16 bits
 int16_t AudioUserDsp_BiquadFilter(int16_t sample, uint8_t filterIndex)
 {
   BiquadFilter* filter = &biquadFilters[filterIndex];
 
-  double fInSample = (float)(sample);
+  return AudioUserDsp_Saturate(AudioUserDsp_BiquadSample(&filter->state[0], &filter->coefficients, sample));
+}
+
+// one right sample through a band, saturated to 16 bits
+int16_t AudioUserDsp_BiquadFilterRight(int16_t sample, uint8_t filterIndex)
+{
+  BiquadFilter* filter = &biquadFilters[filterIndex];
+
+  return AudioUserDsp_Saturate(AudioUserDsp_BiquadSample(&filter->state[1], &filter->coefficients, sample));
+}
+
+// one sample through the state of a channel, with the coefficients given
+static inline float AudioUserDsp_BiquadSample(BiquadState* state, const BiquadCoefficients* coefficients, float sample)
+{
+  double fInSample = sample;
   double fOutSample =
-      filter->b0 * fInSample
-    + filter->b1 * filter->in_z1
-    + filter->b2 * filter->in_z2
-    - filter->a1 * filter->out_z1
-    - filter->a2 * filter->out_z2;
-
-  filter->in_z2   = filter->in_z1;
-  filter->in_z1   = fInSample;
-  filter->out_z2  = filter->out_z1;
-  filter->out_z1  = fOutSample;
-
-  if(fOutSample > 32767)
-    fOutSample = 32767;
-  else if(fOutSample < -32768)
-    fOutSample = -32768;
+      coefficients->b0 * fInSample
+    + coefficients->b1 * state->in_z1
+    + coefficients->b2 * state->in_z2
+    - coefficients->a1 * state->out_z1
+    - coefficients->a2 * state->out_z2;
 
-  return (int16_t)fOutSample;
+  state->in_z2   = state->in_z1;
+  state->in_z1   = fInSample;
+  state->out_z2  = state->out_z1;
+  state->out_z1  = fOutSample;
+
+  return (float)fOutSample;
+}
+
+// clips and truncates a band to 16 bits, for the bands run one at a time
+static inline int16_t AudioUserDsp_Saturate(float sample)
+{
+  if(sample > 32767)
+    sample = 32767;
+  else if(sample < -32768)
+    sample = -32768;
+
+  return (int16_t)sample;
+}
+
+/**
+ * @brief  Requantises a float sample to 16 bits, the only clipping of the
+ *         packet path. The shaper feeds the rounding error back into the
+ *         next samples of the channel; a clipped sample feeds back only its
+ *         rounding, so the shaper stays stable on the rails.
+ * @param  sample: output of the last band
+ * @param  shaper: error feedback, two taps
+ * @param  amplitude: of the dither per unit of random, 0 for none
+ * @param  random: two 16 bit uniforms, one triangular dither value
+ * @param  error: last two errors of the channel, updated
+ * @retval the sample, saturated
+ */
+static inline int16_t AudioUserDsp_Quantise(float sample, const float* shaper, float amplitude, uint32_t random, float* error)
+{
+  float wanted = sample - shaper[0] * error[0] - shaper[1] * error[1];
+  float noise = ((int32_t)(random & 0xFFFF) + (int32_t)(random >> 16) - 0xFFFF) * amplitude;
+
+  if(wanted > 32767)
+    wanted = 32767;
+  else if(wanted < -32768)
+    wanted = -32768;
+
+  // offset to positive, so the truncating conversion rounds to nearest
+  int32_t quantised = (int32_t)(wanted + noise + 32768.5f) - 32768;
+
+  error[1] = error[0];
+  error[0] = quantised - wanted;
+
+  if(quantised > 32767)
+    quantised = 32767;
+  else if(quantised < -32768)
+    quantised = -32768;
+
+  return (int16_t)quantised;
+}
+
+// xorshift32, one word of dither per sample
+static inline uint32_t AudioUserDsp_Random(uint32_t* state)
+{
+  uint32_t x = *state;
+
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  *state = x;
+
+  return x;
 }
 
 int16_t AudioUserDsp_CalculateGain(uint16_t sliderY, SliderKnob* sliderKnob)
@@ -124,9 +448,34 @@ int16_t AudioUserDsp_CalculateGain(uint16_t sliderY, SliderKnob* sliderKnob)
 
 
 void AudioUserDsp_BiquadFilterConfig(BiquadFilter* filter, int16_t gain, int16_t frequency, int16_t bandwidth)
+{
+  AudioUserDsp_BiquadCoefficients(&filter->coefficients, gain, frequency, bandwidth, USB_AUDIO_CONFIG_PLAY_DEF_FREQ);
+
+  filter->gain = gain;
+  filter->frequency = frequency;
+  filter->bandwidth = bandwidth;
+  
+  if(!filter->isInitialized)
+  {
+    memset(filter->state, 0, sizeof(filter->state));
+    filter->isInitialized = true;
+  }
+}
+
+/**
+ * @brief  Computes the peaking filter of a band for a sample rate, without
+ *         touching the live filters.
+ * @param  coefficients: result, normalized by a0
+ * @param  gain: in dB
+ * @param  frequency: center frequency in Hz
+ * @param  bandwidth: in octaves
+ * @param  sampleRate: in Hz
+ * @retval None
+ */
+void AudioUserDsp_BiquadCoefficients(BiquadCoefficients* coefficients, int16_t gain, int16_t frequency, int16_t bandwidth, uint32_t sampleRate)
 {
   double A = pow(10.0, gain / 40.0);
-  double omega = 2.0 * PI * frequency / USB_AUDIO_CONFIG_PLAY_DEF_FREQ;
+  double omega = 2.0 * PI * frequency / sampleRate;
   double alpha = sin(omega) * sinh(log(2) / 2.0 * bandwidth * omega / sin(omega));
 
   double b0 = 1.0 + alpha * A;
@@ -136,22 +485,40 @@ void AudioUserDsp_BiquadFilterConfig(BiquadFilter* filter, int16_t gain, int16_t
   double a1 = -2.0 * cos(omega);
   double a2 = 1.0 - alpha / A;
 
-  filter->b0 = (float)(b0 / a0);
-  filter->b1 = (float)(b1 / a0);
-  filter->b2 = (float)(b2 / a0);
-  filter->a1 = (float)(a1 / a0);
-  filter->a2 = (float)(a2 / a0);
+  coefficients->b0 = (float)(b0 / a0);
+  coefficients->b1 = (float)(b1 / a0);
+  coefficients->b2 = (float)(b2 / a0);
+  coefficients->a1 = (float)(a1 / a0);
+  coefficients->a2 = (float)(a2 / a0);
+}
 
-  filter->gain = gain;
-  filter->frequency = frequency;
-  filter->bandwidth = bandwidth;
-  
-  if(!filter->isInitialized)
+/**
+ * @brief  Makes precomputed coefficients the live ones: a copy with the
+ *         interrupts masked, so the USB interrupt never filters a packet with
+ *         half of one set and half of another. No math.
+ * @param  bank: coefficients of each band, for the current sample rate
+ * @param  gains: gain of each band in dB, the sets were computed from
+ * @param  bandFrequencies: center frequency of each band in Hz
+ * @param  bandBandwidths: bandwidth of each band in octaves
+ * @retval None
+ */
+void AudioUserDsp_LoadCoefficients(const BiquadCoefficients* bank, const int16_t* gains, const int16_t* bandFrequencies, const int16_t* bandBandwidths)
+{
+  __disable_irq();
+  for(uint8_t i = 0; i < NUMBER_OF_BANDS; i++)
   {
-    filter->in_z1 = 0;
-    filter->in_z2 = 0;
-    filter->out_z1 = 0;
-    filter->out_z2 = 0;
-    filter->isInitialized = true;
+    BiquadFilter* filter = &biquadFilters[i];
+
+    memcpy(&filter->coefficients, &bank[i], sizeof(BiquadCoefficients));
+    filter->gain = gains[i];
+    filter->frequency = bandFrequencies[i];
+    filter->bandwidth = bandBandwidths[i];
+
+    if(!filter->isInitialized)
+    {
+      memset(filter->state, 0, sizeof(filter->state));
+      filter->isInitialized = true;
+    }
   }
+  __enable_irq();
 }
@@ -0,0 +1,575 @@
+/**
+  ******************************************************************************
+  * @file    audio_user_dsp_bench.c
+  * @brief   Microbenchmark of the EQ kernels: AudioUserDsp_ApplyFilterToSamples
+  *          for 1 to 8 bands with both channels filtered or only the left one,
+  *          the full AudioUserDsp_ProcessPacket path and the frame pack/unpack
+  *          helpers. Every run starts from the same pseudo random packets and
+  *          cleared filter state; the median of the runs is reported with its
+  *          spread so that results can be compared between commits.
+  *
+  *          The magnitude response of the EQ curve is timed per update, with
+  *          no band, one band and every band changed, and checked against a
+  *          double precision evaluation of the biquads on the unit circle.
+  *
+  *          A preset recall, precomputed coefficients copied into the
+  *          filters, is timed against recomputing every band from its gain,
+  *          what boot and undo did before the presets.
+  *
+  *          process_packet filters in float between the bands and saturates
+  *          once; apply_filter with every band in stereo is the same EQ
+  *          saturating after each band, what the packet path did before.
+  *
+  *          The digital volume is timed settled, folded into the last band
+  *          (process_packet), while it ramps, and against a separate gain
+  *          stage after the EQ, what folding it saves.
+  *
+  *          The requantisation of the output is timed in each dither mode;
+  *          process_packet and the other cases run with the default one.
+  *
+  *          The dynamics are timed with the limiter, the compressor and both
+  *          on, at their default settings; the other cases run without.
+  ******************************************************************************
+  */
+
+#include "audio_user_dsp_bench.h"
+#include "audio_user_dsp.h"
+#include "audio_user_dsp_dynamics.h"
+#include "audio_user_dsp_response.h"
+#include "usb_audio.h"
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#if defined(__arm__)
+#include "stm32f7xx.h"
+#else
+#include <time.h>
+#endif
+
+// private defines -------------------------------------------------------------
+#define DSP_BENCH_FRAME_SIZE        4
+#define DSP_BENCH_PACKET_SIZE       AUDIO_MS_PACKET_SIZE(USB_AUDIO_CONFIG_PLAY_DEF_FREQ, USB_AUDIO_CONFIG_PLAY_CHANNEL_COUNT, USB_AUDIO_CONFIG_PLAY_RES_BYTE)
+#define DSP_BENCH_FRAMES_PER_PACKET (DSP_BENCH_PACKET_SIZE / DSP_BENCH_FRAME_SIZE)
+#define DSP_BENCH_FRAMES_PER_RUN    (DSP_BENCH_FRAMES_PER_PACKET * DSP_BENCH_PACKETS_PER_RUN)
+#define DSP_BENCH_LINE_SIZE         192
+// volume the ramp case moves to from 0 dB, in 1/256 dB
+#define DSP_BENCH_RAMP_VOLUME       (-20 * 256)
+// gain of the separate stage, -6 dB
+#define DSP_BENCH_STAGE_GAIN        0.5f
+
+#if defined(__arm__)
+#define DSP_BENCH_PLATFORM          "cortex-m7"
+#elif defined(__x86_64__)
+#define DSP_BENCH_PLATFORM          "linux-x86_64"
+#else
+#define DSP_BENCH_PLATFORM          "host"
+#endif
+
+// private typedefs ------------------------------------------------------------
+typedef enum AudioUserDspBenchKernel
+{
+  DSP_BENCH_APPLY_FILTER,
+  DSP_BENCH_PROCESS_PACKET,
+  DSP_BENCH_FRAME_TO_SAMPLES,
+  DSP_BENCH_SAMPLES_TO_FRAME,
+  DSP_BENCH_RESPONSE_UPDATE,          // once per run, bands is the number changed
+  DSP_BENCH_PRESET_RECOMPUTE,         // once per packet, every band from its gain
+  DSP_BENCH_PRESET_LOAD,              // once per packet, every band copied
+  DSP_BENCH_VOLUME_RAMP,              // process_packet with the volume ramping
+  DSP_BENCH_VOLUME_STAGE,             // process_packet then a gain per sample
+  DSP_BENCH_DITHER,                   // process_packet in the dither mode of the case
+  DSP_BENCH_LIMITER,                  // process_packet with the dynamics stages on
+  DSP_BENCH_COMPRESSOR,
+  DSP_BENCH_DYNAMICS
+} AudioUserDspBenchKernel;
+
+typedef struct AudioUserDspBenchCase
+{
+  AudioUserDspBenchKernel kernel;
+  const char*             name;
+  bool                    bothChannels;
+  uint8_t                 bands;
+  DspDither               dither;
+} AudioUserDspBenchCase;
+
+// median, extremes and median absolute deviation of the runs, in thousandths
+typedef struct AudioUserDspBenchStats
+{
+  uint64_t median;
+  uint64_t min;
+  uint64_t max;
+  uint64_t mad;
+} AudioUserDspBenchStats;
+
+// private variables -----------------------------------------------------------
+static uint8_t  inputPackets[DSP_BENCH_PACKETS_PER_RUN * DSP_BENCH_PACKET_SIZE];
+static uint8_t  workPackets[DSP_BENCH_PACKETS_PER_RUN * DSP_BENCH_PACKET_SIZE];
+static uint64_t runTimes[DSP_BENCH_REPETITIONS];
+static uint64_t deviations[DSP_BENCH_REPETITIONS];
+static BiquadFilter savedFilters[NUMBER_OF_BANDS];
+// what a preset stores for the benchmark gains
+static BiquadCoefficients presetBank[NUMBER_OF_BANDS];
+
+// keeps the pack/unpack loops from being optimized away
+static volatile int32_t sampleSink;
+
+static const int16_t benchGains[NUMBER_OF_BANDS] = {6, -3, 4, -6, 3, -2, 5, -4};
+// slider limits on neighbouring bands, the steepest curve the UI can ask for
+static const int16_t extremeGains[NUMBER_OF_BANDS] = {15, -15, 15, -15, 15, -15, 15, -15};
+
+// external variables ----------------------------------------------------------
+extern int16_t frequencies[];
+extern int16_t bandwidths[];
+
+// private function declarations -----------------------------------------------
+static void     AudioUserDspBench_Print(AudioUserDspBench_Writer writer, const char* format, ...) __attribute__((format(printf, 2, 3)));
+static void     AudioUserDspBench_FillInput(void);
+static void     AudioUserDspBench_ResetFilters(void);
+static uint64_t AudioUserDspBench_TimeRun(const AudioUserDspBenchCase* benchCase);
+static void     AudioUserDspBench_RunKernel(const AudioUserDspBenchCase* benchCase);
+static void     AudioUserDspBench_ApplyGain(uint8_t* packet, float gain);
+static void     AudioUserDspBench_SetDynamics(bool limiter, bool compressor);
+static uint32_t AudioUserDspBench_CheckResponse(const int16_t* gains);
+static void     AudioUserDspBench_Summarize(uint64_t unitsPerSecond, uint32_t unitsPerRun, AudioUserDspBenchStats* stats);
+static void     AudioUserDspBench_PrintStats(AudioUserDspBench_Writer writer, const char* name, const AudioUserDspBenchStats* stats, const char* suffix);
+static void     AudioUserDspBench_Sort(uint64_t* values, uint32_t count);
+
+/**
+ * @brief  Runs every case and writes the results as JSON. Blocks for a few
+ *         seconds on the board; the EQ settings are restored afterwards.
+ * @param  writer: output of the JSON text
+ * @retval None
+ */
+void AudioUserDspBench_Run(AudioUserDspBench_Writer writer)
+{
+  AudioUserDspBenchCase cases[2 * NUMBER_OF_BANDS + 17];
+  uint32_t caseCount = 0;
+
+  for(uint8_t bands = 1; bands <= NUMBER_OF_BANDS; bands++)
+  {
+    cases[caseCount++] = (AudioUserDspBenchCase){ DSP_BENCH_APPLY_FILTER, "apply_filter", true, bands, DSP_DITHER_OFF };
+    cases[caseCount++] = (AudioUserDspBenchCase){ DSP_BENCH_APPLY_FILTER, "apply_filter", false, bands, DSP_DITHER_OFF };
+  }
+  cases[caseCount++] = (AudioUserDspBenchCase){ DSP_BENCH_PROCESS_PACKET, "process_packet", true, NUMBER_OF_BANDS, DSP_DITHER_OFF };
+  cases[caseCount++] = (AudioUserDspBenchCase){ DSP_BENCH_VOLUME_RAMP, "process_packet_volume_ramp", true, NUMBER_OF_BANDS, DSP_DITHER_OFF };
+  cases[caseCount++] = (AudioUserDspBenchCase){ DSP_BENCH_VOLUME_STAGE, "process_packet_volume_stage", true, NUMBER_OF_BANDS, DSP_DITHER_OFF };
+  cases[caseCount++] = (AudioUserDspBenchCase){ DSP_BENCH_DITHER, "process_packet_round", true, NUMBER_OF_BANDS, DSP_DITHER_OFF };
+  cases[caseCount++] = (AudioUserDspBenchCase){ DSP_BENCH_DITHER, "process_packet_tpdf", true, NUMBER_OF_BANDS, DSP_DITHER_TPDF };
+  cases[caseCount++] = (AudioUserDspBenchCase){ DSP_BENCH_DITHER, "process_packet_shaped_1", true, NUMBER_OF_BANDS, DSP_DITHER_SHAPED_1 };
+  cases[caseCount++] = (AudioUserDspBenchCase){ DSP_BENCH_DITHER, "process_packet_shaped_2", true, NUMBER_OF_BANDS, DSP_DITHER_SHAPED_2 };
+  cases[caseCount++] = (AudioUserDspBenchCase){ DSP_BENCH_LIMITER, "process_packet_limiter", true, NUMBER_OF_BANDS, DSP_DITHER_OFF };
+  cases[caseCount++] = (AudioUserDspBenchCase){ DSP_BENCH_COMPRESSOR, "process_packet_compressor", true, NUMBER_OF_BANDS, DSP_DITHER_OFF };
+  cases[caseCount++] = (AudioUserDspBenchCase){ DSP_BENCH_DYNAMICS, "process_packet_dynamics", true, NUMBER_OF_BANDS, DSP_DITHER_OFF };
+  cases[caseCount++] = (AudioUserDspBenchCase){ DSP_BENCH_FRAME_TO_SAMPLES, "frame_to_samples", true, 0, DSP_DITHER_OFF };
+  cases[caseCount++] = (AudioUserDspBenchCase){ DSP_BENCH_SAMPLES_TO_FRAME, "samples_to_frame", true, 0, DSP_DITHER_OFF };
+  cases[caseCount++] = (AudioUserDspBenchCase){ DSP_BENCH_RESPONSE_UPDATE, "response_update", false, 0, DSP_DITHER_OFF };
+  cases[caseCount++] = (AudioUserDspBenchCase){ DSP_BENCH_RESPONSE_UPDATE, "response_update", false, 1, DSP_DITHER_OFF };
+  cases[caseCount++] = (AudioUserDspBenchCase){ DSP_BENCH_RESPONSE_UPDATE, "response_update", false, NUMBER_OF_BANDS, DSP_DITHER_OFF };
+  cases[caseCount++] = (AudioUserDspBenchCase){ DSP_BENCH_PRESET_RECOMPUTE, "preset_recompute", false, NUMBER_OF_BANDS, DSP_DITHER_OFF };
+  cases[caseCount++] = (AudioUserDspBenchCase){ DSP_BENCH_PRESET_LOAD, "preset_load", false, NUMBER_OF_BANDS, DSP_DITHER_OFF };
+
+  memcpy(savedFilters, biquadFilters, sizeof(savedFilters));
+  for(uint8_t i = 0; i < NUMBER_OF_BANDS; i++)
+  {
+    AudioUserDsp_BiquadFilterConfig(&biquadFilters[i], benchGains[i], frequencies[i], bandwidths[i]);
+    AudioUserDsp_BiquadCoefficients(&presetBank[i], benchGains[i], frequencies[i], bandwidths[i], USB_AUDIO_CONFIG_PLAY_DEF_FREQ);
+  }
+
+  AudioUserDspBench_FillInput();
+  AudioUserDspResponse_Init(USB_AUDIO_CONFIG_PLAY_DEF_FREQ);
+  AudioUserDspResponse_Update();
+
+  AudioUserDspBench_Print(writer, "{\n  \"benchmark\": \"audio_user_dsp\",\n  \"platform\": \"%s\",\n", DSP_BENCH_PLATFORM);
+#if defined(__arm__)
+  AudioUserDspBench_Print(writer, "  \"core_clock_hz\": %lu,\n", (unsigned long)SystemCoreClock);
+#endif
+  AudioUserDspBench_Print(writer, "  \"frames_per_packet\": %u,\n  \"packets_per_run\": %u,\n  \"repetitions\": %u,\n  \"seed\": %lu,\n  \"results\": [\n",
+                          DSP_BENCH_FRAMES_PER_PACKET, DSP_BENCH_PACKETS_PER_RUN, DSP_BENCH_REPETITIONS, (unsigned long)DSP_BENCH_SEED);
+
+  for(uint32_t c = 0; c < caseCount; c++)
+  {
+    const AudioUserDspBenchCase* benchCase = &cases[c];
+    AudioUserDspBenchStats stats;
+
+    // one untimed run to warm the caches and branch predictors
+    AudioUserDspBench_TimeRun(benchCase);
+    for(uint32_t r = 0; r < DSP_BENCH_REPETITIONS; r++)
+      runTimes[r] = AudioUserDspBench_TimeRun(benchCase);
+
+    const char* suffix = (c + 1 < caseCount) ? "},\n" : "}\n";
+
+    if(benchCase->kernel == DSP_BENCH_RESPONSE_UPDATE)
+    {
+      AudioUserDspBench_Print(writer, "    {\"kernel\": \"%s\", \"points\": %u, \"bands\": %u, ",
+                              benchCase->name, DSP_RESPONSE_POINTS, benchCase->bands);
+#if defined(__arm__)
+      AudioUserDspBench_Summarize(SystemCoreClock, 1, &stats);
+      AudioUserDspBench_PrintStats(writer, "cycles_per_update", &stats, ", ");
+#endif
+      AudioUserDspBench_Summarize(1000000000ull, 1, &stats);
+      AudioUserDspBench_PrintStats(writer, "ns_per_update", &stats, suffix);
+      continue;
+    }
+
+    if(benchCase->kernel == DSP_BENCH_PRESET_RECOMPUTE || benchCase->kernel == DSP_BENCH_PRESET_LOAD)
+    {
+      AudioUserDspBench_Print(writer, "    {\"kernel\": \"%s\", \"bands\": %u, ", benchCase->name, benchCase->bands);
+#if defined(__arm__)
+      AudioUserDspBench_Summarize(SystemCoreClock, DSP_BENCH_PACKETS_PER_RUN, &stats);
+      AudioUserDspBench_PrintStats(writer, "cycles_per_recall", &stats, ", ");
+#endif
+      AudioUserDspBench_Summarize(1000000000ull, DSP_BENCH_PACKETS_PER_RUN, &stats);
+      AudioUserDspBench_PrintStats(writer, "ns_per_recall", &stats, suffix);
+      continue;
+    }
+
+    AudioUserDspBench_Print(writer, "    {\"kernel\": \"%s\", \"layout\": \"%s\", \"bands\": %u, ",
+                            benchCase->name, benchCase->bothChannels ? "stereo" : "left_only", benchCase->bands);
+#if defined(__arm__)
+    AudioUserDspBench_Summarize(SystemCoreClock, DSP_BENCH_FRAMES_PER_RUN, &stats);
+    AudioUserDspBench_PrintStats(writer, "cycles_per_frame", &stats, ", ");
+#endif
+    AudioUserDspBench_Summarize(1000000000ull, DSP_BENCH_FRAMES_PER_RUN, &stats);
+    AudioUserDspBench_PrintStats(writer, "ns_per_frame", &stats, suffix);
+  }
+
+  // worst deviation of the curve from the reference, in thousandths of a dB
+  uint32_t benchError = AudioUserDspBench_CheckResponse(benchGains);
+  uint32_t extremeError = AudioUserDspBench_CheckResponse(extremeGains);
+
+  AudioUserDspBench_Print(writer, "  ],\n  \"response_check\": {\"points\": %u, \"max_error_db\": %lu.%03lu, \"max_error_extreme_db\": %lu.%03lu}\n}\n",
+                          DSP_RESPONSE_POINTS, (unsigned long)(benchError / 1000), (unsigned long)(benchError % 1000),
+                          (unsigned long)(extremeError / 1000), (unsigned long)(extremeError % 1000));
+
+  memcpy(biquadFilters, savedFilters, sizeof(savedFilters));
+  AudioUserDsp_SetVolume(0);
+  AudioUserDsp_SettleVolume();
+  AudioUserDsp_SetDither(DSP_DITHER_DEFAULT);
+  AudioUserDspBench_SetDynamics(false, false);
+}
+
+/**
+ * @brief  Formats one piece of the output and hands it to the writer.
+ * @param  writer: output of the JSON text
+ * @param  format: printf format
+ * @retval None
+ */
+static void AudioUserDspBench_Print(AudioUserDspBench_Writer writer, const char* format, ...)
+{
+  char line[DSP_BENCH_LINE_SIZE];
+  va_list args;
+
+  va_start(args, format);
+  int length = vsnprintf(line, sizeof(line), format, args);
+  va_end(args);
+
+  if(length > (int)sizeof(line) - 1)
+    length = sizeof(line) - 1;
+  if(length > 0)
+    writer(line, (uint32_t)length);
+}
+
+/**
+ * @brief  Fills the input packets with noise from a fixed seed.
+ * @param  None
+ * @retval None
+ */
+static void AudioUserDspBench_FillInput(void)
+{
+  uint32_t state = DSP_BENCH_SEED;
+
+  for(uint32_t i = 0; i < sizeof(inputPackets); i += 2)
+  {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    // -12 dBFS keeps the boosted bands from clipping
+    int16_t sample = (int16_t)(state >> 16) / 4;
+    inputPackets[i]     = (uint16_t)sample % 256;
+    inputPackets[i + 1] = (uint16_t)sample / 256;
+  }
+}
+
+/**
+ * @brief  Clears the state of every band so each run filters the same way,
+ *         and settles the volume at 0 dB.
+ * @param  None
+ * @retval None
+ */
+static void AudioUserDspBench_ResetFilters(void)
+{
+  for(uint8_t i = 0; i < NUMBER_OF_BANDS; i++)
+    memset(biquadFilters[i].state, 0, sizeof(biquadFilters[i].state));
+  AudioUserDsp_SetVolume(0);
+  AudioUserDsp_SettleVolume();
+}
+
+/**
+ * @brief  Times one run of a case. On the board interrupts are masked while
+ *         the kernel runs so the USB and display interrupts do not show up in
+ *         the result.
+ * @param  benchCase: case to run
+ * @retval core cycles on the board, nanoseconds on the host
+ */
+static uint64_t AudioUserDspBench_TimeRun(const AudioUserDspBenchCase* benchCase)
+{
+  memcpy(workPackets, inputPackets, sizeof(workPackets));
+  AudioUserDspBench_ResetFilters();
+  // the ramp lasts longer than a run, every frame of it moves the gain
+  if(benchCase->kernel == DSP_BENCH_VOLUME_RAMP)
+    AudioUserDsp_SetVolume(DSP_BENCH_RAMP_VOLUME);
+  AudioUserDsp_SetDither((benchCase->kernel == DSP_BENCH_DITHER) ? benchCase->dither : DSP_DITHER_DEFAULT);
+  AudioUserDspBench_SetDynamics(benchCase->kernel == DSP_BENCH_LIMITER || benchCase->kernel == DSP_BENCH_DYNAMICS,
+                                benchCase->kernel == DSP_BENCH_COMPRESSOR || benchCase->kernel == DSP_BENCH_DYNAMICS);
+
+#if defined(__arm__)
+  uint32_t primask = __get_PRIMASK();
+  __disable_irq();
+  uint32_t start = DWT->CYCCNT;
+  AudioUserDspBench_RunKernel(benchCase);
+  uint32_t elapsed = DWT->CYCCNT - start;
+  __set_PRIMASK(primask);
+  return elapsed;
+#else
+  struct timespec start, end;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  AudioUserDspBench_RunKernel(benchCase);
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  return (uint64_t)(end.tv_sec - start.tv_sec) * 1000000000ull + end.tv_nsec - start.tv_nsec;
+#endif
+}
+
+/**
+ * @brief  Runs the kernel of a case over every work packet.
+ * @param  benchCase: case to run
+ * @retval None
+ */
+static void AudioUserDspBench_RunKernel(const AudioUserDspBenchCase* benchCase)
+{
+  int16_t leftSample = 0x1234;
+  int16_t rightSample = -0x1234;
+  int32_t sum = 0;
+
+  if(benchCase->kernel == DSP_BENCH_RESPONSE_UPDATE)
+  {
+    // the first bands go stale, as a slider move does to its band
+    AudioUserDspResponse_Invalidate((uint8_t)((1u << benchCase->bands) - 1));
+    sampleSink = AudioUserDspResponse_Update();
+    return;
+  }
+
+  for(uint32_t p = 0; p < DSP_BENCH_PACKETS_PER_RUN; p++)
+  {
+    uint8_t* packet = &workPackets[p * DSP_BENCH_PACKET_SIZE];
+
+    switch(benchCase->kernel)
+    {
+      case DSP_BENCH_APPLY_FILTER:
+        for(uint8_t i = 0; i < benchCase->bands; i++)
+          AudioUserDsp_ApplyFilterToSamples(packet, DSP_BENCH_PACKET_SIZE, AudioUserDsp_BiquadFilter,
+                                            benchCase->bothChannels ? AudioUserDsp_BiquadFilterRight : NULL, i);
+        break;
+
+      case DSP_BENCH_PROCESS_PACKET:
+      case DSP_BENCH_VOLUME_RAMP:
+      case DSP_BENCH_DITHER:
+      case DSP_BENCH_LIMITER:
+      case DSP_BENCH_COMPRESSOR:
+      case DSP_BENCH_DYNAMICS:
+        AudioUserDsp_ProcessPacket(packet, DSP_BENCH_PACKET_SIZE);
+        break;
+
+      case DSP_BENCH_VOLUME_STAGE:
+        AudioUserDsp_ProcessPacket(packet, DSP_BENCH_PACKET_SIZE);
+        AudioUserDspBench_ApplyGain(packet, DSP_BENCH_STAGE_GAIN);
+        break;
+
+      case DSP_BENCH_FRAME_TO_SAMPLES:
+        for(uint32_t i = 0; i < DSP_BENCH_PACKET_SIZE; i += DSP_BENCH_FRAME_SIZE)
+        {
+          AudioUserDsp_FrameToSamples(packet + i, &leftSample, &rightSample);
+          sum += leftSample + rightSample;
+        }
+        break;
+
+      case DSP_BENCH_SAMPLES_TO_FRAME:
+        for(uint32_t i = 0; i < DSP_BENCH_PACKET_SIZE; i += DSP_BENCH_FRAME_SIZE)
+        {
+          AudioUserDsp_SamplesToFrame(packet + i, &leftSample, &rightSample);
+          leftSample++;
+          rightSample--;
+        }
+        break;
+
+      case DSP_BENCH_PRESET_RECOMPUTE:
+        for(uint8_t i = 0; i < benchCase->bands; i++)
+          AudioUserDsp_BiquadFilterConfig(&biquadFilters[i], benchGains[i], frequencies[i], bandwidths[i]);
+        break;
+
+      case DSP_BENCH_PRESET_LOAD:
+        AudioUserDsp_LoadCoefficients(presetBank, benchGains, frequencies, bandwidths);
+        break;
+
+      case DSP_BENCH_RESPONSE_UPDATE:
+        break;
+    }
+  }
+
+  sampleSink = sum;
+}
+
+/**
+ * @brief  A volume stage of its own after the EQ: one multiply per sample,
+ *         the cost folding the volume into the last band avoids.
+ * @param  packet: 16 bit stereo frames, DSP_BENCH_PACKET_SIZE bytes
+ * @param  gain: linear
+ * @retval None
+ */
+static void AudioUserDspBench_ApplyGain(uint8_t* packet, float gain)
+{
+  int16_t leftSample, rightSample;
+
+  for(uint32_t i = 0; i < DSP_BENCH_PACKET_SIZE; i += DSP_BENCH_FRAME_SIZE)
+  {
+    AudioUserDsp_FrameToSamples(packet + i, &leftSample, &rightSample);
+    leftSample = (int16_t)(leftSample * gain);
+    rightSample = (int16_t)(rightSample * gain);
+    AudioUserDsp_SamplesToFrame(packet + i, &leftSample, &rightSample);
+  }
+}
+
+/**
+ * @brief  Configures the bands with some gains, updates the response and
+ *         compares it with the product of the biquads evaluated in double
+ *         precision at each point.
+ * @param  gains: gain of each band in dB
+ * @retval largest difference in thousandths of a dB
+ */
+static uint32_t AudioUserDspBench_CheckResponse(const int16_t* gains)
+{
+  double worst = 0;
+
+  for(uint8_t i = 0; i < NUMBER_OF_BANDS; i++)
+    AudioUserDsp_BiquadFilterConfig(&biquadFilters[i], gains[i], frequencies[i], bandwidths[i]);
+
+  AudioUserDspResponse_Update();
+  const float* magnitude = AudioUserDspResponse_Magnitude();
+
+  for(uint16_t p = 0; p < DSP_RESPONSE_POINTS; p++)
+  {
+    double frequency = DSP_RESPONSE_MIN_FREQUENCY * pow((double)DSP_RESPONSE_MAX_FREQUENCY / DSP_RESPONSE_MIN_FREQUENCY,
+                                                        (double)p / (DSP_RESPONSE_POINTS - 1));
+    double omega = 2.0 * 3.14159265358979323846 * frequency / USB_AUDIO_CONFIG_PLAY_DEF_FREQ;
+    double reference = 0;
+
+    for(uint8_t i = 0; i < NUMBER_OF_BANDS; i++)
+    {
+      const BiquadFilter* filter = &biquadFilters[i];
+      double numeratorReal = filter->coefficients.b0 + filter->coefficients.b1 * cos(omega) + filter->coefficients.b2 * cos(2 * omega);
+      double numeratorImag = -filter->coefficients.b1 * sin(omega) - filter->coefficients.b2 * sin(2 * omega);
+      double denominatorReal = 1.0 + filter->coefficients.a1 * cos(omega) + filter->coefficients.a2 * cos(2 * omega);
+      double denominatorImag = -filter->coefficients.a1 * sin(omega) - filter->coefficients.a2 * sin(2 * omega);
+
+      reference += 10.0 * log10((numeratorReal * numeratorReal + numeratorImag * numeratorImag) /
+                                (denominatorReal * denominatorReal + denominatorImag * denominatorImag));
+    }
+
+    if(fabs(magnitude[p] - reference) > worst)
+      worst = fabs(magnitude[p] - reference);
+  }
+
+  return (uint32_t)(worst * 1000 + 0.5);
+}
+
+/**
+ * @brief  Converts the run times to thousandths of a unit per frame, recall or
+ *         run, and reduces them to median, extremes and median absolute
+ *         deviation.
+ * @param  unitsPerSecond: unit of the result (core clock for cycles, 1e9 for ns)
+ * @param  unitsPerRun: frames or recalls per run, 1 for the kernels timed per call
+ * @param  stats: result
+ * @retval None
+ */
+static void AudioUserDspBench_Summarize(uint64_t unitsPerSecond, uint32_t unitsPerRun, AudioUserDspBenchStats* stats)
+{
+  uint64_t values[DSP_BENCH_REPETITIONS];
+#if defined(__arm__)
+  uint64_t timerPerSecond = SystemCoreClock;
+#else
+  uint64_t timerPerSecond = 1000000000ull;
+#endif
+
+  for(uint32_t r = 0; r < DSP_BENCH_REPETITIONS; r++)
+    values[r] = runTimes[r] * unitsPerSecond / timerPerSecond * 1000 / unitsPerRun;
+
+  AudioUserDspBench_Sort(values, DSP_BENCH_REPETITIONS);
+  stats->min = values[0];
+  stats->max = values[DSP_BENCH_REPETITIONS - 1];
+  stats->median = values[DSP_BENCH_REPETITIONS / 2];
+
+  for(uint32_t r = 0; r < DSP_BENCH_REPETITIONS; r++)
+    deviations[r] = (values[r] > stats->median) ? values[r] - stats->median : stats->median - values[r];
+
+  AudioUserDspBench_Sort(deviations, DSP_BENCH_REPETITIONS);
+  stats->mad = deviations[DSP_BENCH_REPETITIONS / 2];
+}
+
+/**
+ * @brief  Writes one statistics object, values with three decimals.
+ * @param  writer: output of the JSON text
+ * @param  name: JSON key
+ * @param  stats: values in thousandths
+ * @param  suffix: text following the object
+ * @retval None
+ */
+static void AudioUserDspBench_PrintStats(AudioUserDspBench_Writer writer, const char* name, const AudioUserDspBenchStats* stats, const char* suffix)
+{
+  // newlib-nano has no float printf, so the decimals are printed as integers
+  AudioUserDspBench_Print(writer, "\"%s\": {\"median\": %lu.%03lu, \"min\": %lu.%03lu, \"max\": %lu.%03lu, \"mad\": %lu.%03lu}%s", name,
+                          (unsigned long)(stats->median / 1000), (unsigned long)(stats->median % 1000),
+                          (unsigned long)(stats->min / 1000), (unsigned long)(stats->min % 1000),
+                          (unsigned long)(stats->max / 1000), (unsigned long)(stats->max % 1000),
+                          (unsigned long)(stats->mad / 1000), (unsigned long)(stats->mad % 1000),
+                          suffix);
+}
+
+/**
+ * @brief  Insertion sort, the arrays hold DSP_BENCH_REPETITIONS values.
+ * @param  values: array to sort in place
+ * @param  count: number of values
+ * @retval None
+ */
+static void AudioUserDspBench_Sort(uint64_t* values, uint32_t count)
+{
+  for(uint32_t i = 1; i < count; i++)
+  {
+    uint64_t value = values[i];
+    uint32_t j = i;
+    while(j > 0 && values[j - 1] > value)
+    {
+      values[j] = values[j - 1];
+      j--;
+    }
+    values[j] = value;
+  }
+}
+
+/**
+ * @brief  Turns the dynamics stages on or off at their default settings,
+ *         from unity gain.
+ * @param  limiter: on
+ * @param  compressor: on
+ * @retval None
+ */
+static void AudioUserDspBench_SetDynamics(bool limiter, bool compressor)
+{
+  AudioUserDspDynamicsSettings settings;
+
+  AudioUserDspDynamics_DefaultSettings(&settings);
+  settings.limiter = limiter;
+  settings.compressor = compressor;
+  AudioUserDspDynamics_Configure(&settings);
+  AudioUserDspDynamics_Reset();
+}
@@ -0,0 +1,311 @@
+/**
+  ******************************************************************************
+  * @file    audio_user_dsp_dynamics.c
+  * @brief   Compressor and look-ahead limiter of the EQ output, on float
+  *          stereo frames in the units of 16 bit samples.
+  *
+  *          The compressor follows the mean square of both channels with
+  *          its attack and release, one step per block, and turns it into a
+  *          gain for the next block; it has no look-ahead, the limiter
+  *          catches what gets past it.
+  *
+  *          The limiter keeps the peak of each block and, with a monotonic
+  *          deque, the highest of the last DSP_DYNAMICS_LOOKAHEAD_BLOCKS + 1
+  *          of them. The gain that takes that maximum to the ceiling drops at
+  *          once and recovers with the release; the gain applied at a block
+  *          boundary is the mean of its last DSP_DYNAMICS_LOOKAHEAD_BLOCKS
+  *          values. Each of those covers the two blocks next to the boundary,
+  *          so the mean does too, and so does the interpolation between two
+  *          boundaries: no sample comes out above the ceiling, and the gain
+  *          falls over the whole look-ahead instead of in one step.
+  *
+  *          Runs in the USB interrupt. Per frame the work is fixed; per block
+  *          it is at most a deque of DSP_DYNAMICS_LOOKAHEAD_BLOCKS + 1 entries,
+  *          a mean of DSP_DYNAMICS_LOOKAHEAD_BLOCKS and one powf.
+  ******************************************************************************
+  */
+
+#include "audio_user_dsp_dynamics.h"
+#include "usb_audio.h"
+#include "stm32f7xx_hal.h"
+#include <math.h>
+#include <string.h>
+
+// private defines -------------------------------------------------------------
+#define DSP_DYNAMICS_FULL_SCALE   32767.0f
+// peaks the limiter looks at for one boundary: the look-ahead and the block before
+#define DSP_DYNAMICS_WINDOW       (DSP_DYNAMICS_LOOKAHEAD_BLOCKS + 1)
+#define DSP_DYNAMICS_SAMPLE_RATE  USB_AUDIO_CONFIG_PLAY_DEF_FREQ
+
+// private typedefs ------------------------------------------------------------
+// what the interrupt runs with, derived from AudioUserDspDynamicsSettings
+typedef struct AudioUserDspDynamicsParameters
+{
+  bool  limiter;
+  float ceiling;                      // linear, in sample units
+  float limiterRelease;               // step of the recovery per block
+  bool  compressor;
+  float threshold;                    // mean square
+  float exponent;                     // of the mean square over the threshold
+  float attack;                       // steps of the mean square per block
+  float release;
+  float makeup;                       // linear
+} AudioUserDspDynamicsParameters;
+
+// private variables -----------------------------------------------------------
+static AudioUserDspDynamicsParameters parameters = { false };
+
+// the limiter delay line, stereo frames, the oldest at delayFrame
+static float    delayLine[2 * DSP_DYNAMICS_DELAY_FRAMES];
+static uint32_t delayFrame;
+static uint32_t blockFrame;           // frames into the block
+static float    blockPeak;            // after the compressor
+static float    blockPower;           // before the compressor, sum of squares
+
+// running maximum of the block peaks: decreasing values and their block numbers
+static float    dequePeaks[DSP_DYNAMICS_WINDOW];
+static uint32_t dequeBlocks[DSP_DYNAMICS_WINDOW];
+static uint32_t dequeFirst;
+static uint32_t dequeCount;
+static uint32_t blockNumber;
+
+static float    limiterEnvelope;      // recovers with the release, drops at once
+static float    limiterHistory[DSP_DYNAMICS_LOOKAHEAD_BLOCKS];
+static uint32_t limiterHistoryIndex;
+static float    limiterGain;          // interpolated over the block, to limiterEnd
+static float    limiterEnd;
+static float    limiterStep;
+
+static float    meanSquare;
+static float    compressorGain;
+static float    compressorEnd;
+static float    compressorStep;
+
+// private function declarations -----------------------------------------------
+static void  AudioUserDspDynamics_EndBlock(void);
+static float AudioUserDspDynamics_Peak(float peak);
+static float AudioUserDspDynamics_Step(float timeMs);
+
+/**
+ * @brief  Fills settings with the defaults, both stages off.
+ * @param  settings: result
+ * @retval None
+ */
+void AudioUserDspDynamics_DefaultSettings(AudioUserDspDynamicsSettings* settings)
+{
+  settings->limiter = false;
+  settings->ceilingDb = DSP_LIMITER_CEILING_DB;
+  settings->limiterReleaseMs = DSP_LIMITER_RELEASE_MS;
+  settings->compressor = false;
+  settings->thresholdDb = DSP_COMPRESSOR_THRESHOLD_DB;
+  settings->ratio = DSP_COMPRESSOR_RATIO;
+  settings->attackMs = DSP_COMPRESSOR_ATTACK_MS;
+  settings->releaseMs = DSP_COMPRESSOR_RELEASE_MS;
+  settings->makeupDb = DSP_COMPRESSOR_MAKEUP_DB;
+}
+
+/**
+ * @brief  Sets the stages and their parameters. Turning a stage on or off
+ *         starts both from unity gain and an empty delay line. Called from
+ *         the main loop.
+ * @param  settings: see AudioUserDspDynamicsSettings
+ * @retval false if a setting is out of range, nothing changed
+ */
+bool AudioUserDspDynamics_Configure(const AudioUserDspDynamicsSettings* settings)
+{
+  AudioUserDspDynamicsParameters next;
+
+  if(!(settings->ceilingDb <= 0.0f && settings->limiterReleaseMs > 0.0f && settings->ratio >= 1.0f &&
+       settings->attackMs > 0.0f && settings->releaseMs > 0.0f))
+    return false;
+
+  next.limiter = settings->limiter;
+  next.ceiling = DSP_DYNAMICS_FULL_SCALE * powf(10.0f, settings->ceilingDb / 20.0f);
+  next.limiterRelease = AudioUserDspDynamics_Step(settings->limiterReleaseMs);
+  next.compressor = settings->compressor;
+  // mean square of a sine at the threshold
+  next.threshold = powf(DSP_DYNAMICS_FULL_SCALE * powf(10.0f, settings->thresholdDb / 20.0f), 2.0f) / 2.0f;
+  next.exponent = (1.0f / settings->ratio - 1.0f) / 2.0f;
+  next.attack = AudioUserDspDynamics_Step(settings->attackMs);
+  next.release = AudioUserDspDynamics_Step(settings->releaseMs);
+  next.makeup = powf(10.0f, settings->makeupDb / 20.0f);
+
+  // the USB interrupt runs the stages
+  __disable_irq();
+  bool restart = next.limiter != parameters.limiter || next.compressor != parameters.compressor;
+  parameters = next;
+  if(restart)
+    AudioUserDspDynamics_Reset();
+  __enable_irq();
+
+  return true;
+}
+
+/**
+ * @brief  Clears the delay line and the detectors, unity gain. Called with
+ *         the interrupts masked, or by the USB interrupt.
+ * @param  None
+ * @retval None
+ */
+void AudioUserDspDynamics_Reset(void)
+{
+  memset(delayLine, 0, sizeof(delayLine));
+  delayFrame = 0;
+  blockFrame = 0;
+  blockPeak = 0;
+  blockPower = 0;
+
+  dequeFirst = 0;
+  dequeCount = 0;
+  blockNumber = 0;
+
+  limiterEnvelope = 1.0f;
+  for(uint32_t i = 0; i < DSP_DYNAMICS_LOOKAHEAD_BLOCKS; i++)
+    limiterHistory[i] = 1.0f;
+  limiterHistoryIndex = 0;
+  limiterGain = 1.0f;
+  limiterEnd = 1.0f;
+  limiterStep = 0;
+
+  meanSquare = 0;
+  compressorGain = parameters.makeup;
+  compressorEnd = parameters.makeup;
+  compressorStep = 0;
+}
+
+/**
+ * @brief  Runs the compressor and the limiter over stereo frames in place.
+ *         A block may span calls.
+ * @param  samples: interleaved left and right, the output of the last band
+ * @param  frames: stereo pairs in samples
+ * @retval None
+ */
+void AudioUserDspDynamics_Process(float* samples, uint32_t frames)
+{
+  if(!parameters.limiter && !parameters.compressor)
+    return;
+
+  for(uint32_t f = 0; f < frames; f++)
+  {
+    float left = samples[2 * f];
+    float right = samples[2 * f + 1];
+
+    blockPower += left * left + right * right;
+
+    if(parameters.compressor)
+    {
+      left *= compressorGain;
+      right *= compressorGain;
+      compressorGain += compressorStep;
+    }
+
+    if(parameters.limiter)
+    {
+      float* delayed = &delayLine[2 * delayFrame];
+
+      blockPeak = fmaxf(blockPeak, fmaxf(fabsf(left), fabsf(right)));
+      samples[2 * f] = delayed[0] * limiterGain;
+      samples[2 * f + 1] = delayed[1] * limiterGain;
+      delayed[0] = left;
+      delayed[1] = right;
+      limiterGain += limiterStep;
+      if(++delayFrame == DSP_DYNAMICS_DELAY_FRAMES)
+        delayFrame = 0;
+    }
+    else
+    {
+      samples[2 * f] = left;
+      samples[2 * f + 1] = right;
+    }
+
+    if(++blockFrame == DSP_DYNAMICS_BLOCK_FRAMES)
+      AudioUserDspDynamics_EndBlock();
+  }
+}
+
+/**
+ * @brief  Computes the gains the next block is interpolated to, from the
+ *         block that just ended.
+ * @param  None
+ * @retval None
+ */
+static void AudioUserDspDynamics_EndBlock(void)
+{
+  if(parameters.compressor)
+  {
+    float power = blockPower / (2 * DSP_DYNAMICS_BLOCK_FRAMES);
+    float target = parameters.makeup;
+
+    meanSquare += (power - meanSquare) * ((power > meanSquare) ? parameters.attack : parameters.release);
+    if(meanSquare > parameters.threshold)
+      target *= powf(meanSquare / parameters.threshold, parameters.exponent);
+
+    compressorGain = compressorEnd;
+    compressorEnd = target;
+    compressorStep = (target - compressorGain) / DSP_DYNAMICS_BLOCK_FRAMES;
+  }
+
+  if(parameters.limiter)
+  {
+    float peak = AudioUserDspDynamics_Peak(blockPeak);
+    float wanted = (peak > parameters.ceiling) ? parameters.ceiling / peak : 1.0f;
+    float sum = 0;
+
+    if(wanted < limiterEnvelope)
+      limiterEnvelope = wanted;
+    else
+      limiterEnvelope += (wanted - limiterEnvelope) * parameters.limiterRelease;
+
+    limiterHistory[limiterHistoryIndex] = limiterEnvelope;
+    if(++limiterHistoryIndex == DSP_DYNAMICS_LOOKAHEAD_BLOCKS)
+      limiterHistoryIndex = 0;
+    for(uint32_t i = 0; i < DSP_DYNAMICS_LOOKAHEAD_BLOCKS; i++)
+      sum += limiterHistory[i];
+
+    // the next output block starts where the last one was headed and ends
+    // at the gain of the boundary after it
+    limiterGain = limiterEnd;
+    limiterEnd = fminf(sum / DSP_DYNAMICS_LOOKAHEAD_BLOCKS, 1.0f);
+    limiterStep = (limiterEnd - limiterGain) / DSP_DYNAMICS_BLOCK_FRAMES;
+  }
+
+  blockFrame = 0;
+  blockPeak = 0;
+  blockPower = 0;
+}
+
+/**
+ * @brief  Adds the peak of a block to the window and returns the highest
+ *         peak in it. The front leaves first once it is out of the window,
+ *         so the new peak never takes its slot; peaks lower than a newer one
+ *         can never be the highest again and leave the deque. The front is
+ *         the maximum.
+ * @param  peak: of the block that just ended
+ * @retval highest of the last DSP_DYNAMICS_WINDOW peaks
+ */
+static float AudioUserDspDynamics_Peak(float peak)
+{
+  if(dequeCount > 0 && blockNumber - dequeBlocks[dequeFirst] >= DSP_DYNAMICS_WINDOW)
+  {
+    dequeFirst = (dequeFirst + 1) % DSP_DYNAMICS_WINDOW;
+    dequeCount--;
+  }
+
+  while(dequeCount > 0 && dequePeaks[(dequeFirst + dequeCount - 1) % DSP_DYNAMICS_WINDOW] <= peak)
+    dequeCount--;
+
+  uint32_t back = (dequeFirst + dequeCount) % DSP_DYNAMICS_WINDOW;
+  dequePeaks[back] = peak;
+  dequeBlocks[back] = blockNumber;
+  dequeCount++;
+  assert_param(dequeCount <= DSP_DYNAMICS_WINDOW);
+  blockNumber++;
+
+  return dequePeaks[dequeFirst];
+}
+
+// step per block of a one pole follower with a time constant
+static float AudioUserDspDynamics_Step(float timeMs)
+{
+  return 1.0f - expf(-1000.0f * DSP_DYNAMICS_BLOCK_FRAMES / (timeMs * DSP_DYNAMICS_SAMPLE_RATE));
+}
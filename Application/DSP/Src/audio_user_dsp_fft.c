@@ -0,0 +1,168 @@
+/**
+  ******************************************************************************
+  * @file    audio_user_dsp_fft.c
+  * @brief   Real FFT of DSP_FFT_SIZE points through a complex radix-2 FFT of
+  *          half the size. The even samples are the real parts and the odd
+  *          ones the imaginary parts, which is how the real data already
+  *          lies in memory; the spectra of the two halves are separated from
+  *          bins k and DSP_FFT_HALF - k of the complex result and combined
+  *          with the twiddles of the full size. The inverse undoes the split
+  *          and runs the complex FFT with the conjugate twiddles.
+  ******************************************************************************
+  */
+
+#include "audio_user_dsp_fft.h"
+#include <math.h>
+
+// private defines -------------------------------------------------------------
+#define DSP_FFT_PI    3.14159265358979323846
+
+// private variables -----------------------------------------------------------
+// cos and sin of 2 pi k / DSP_FFT_SIZE, the twiddle is cos - j sin; the
+// complex FFT uses every other one
+static float   twiddleCos[DSP_FFT_HALF];
+static float   twiddleSin[DSP_FFT_HALF];
+static uint8_t bitReverse[DSP_FFT_HALF];
+
+// private function declarations -----------------------------------------------
+static void AudioUserDspFft_Complex(float* data, float direction);
+
+/**
+ * @brief  Computes the twiddle and bit reversal tables.
+ * @param  None
+ * @retval None
+ */
+void AudioUserDspFft_Init(void)
+{
+  for(uint32_t k = 0; k < DSP_FFT_HALF; k++)
+  {
+    double angle = 2.0 * DSP_FFT_PI * k / DSP_FFT_SIZE;
+    uint32_t reversed = 0;
+
+    twiddleCos[k] = (float)cos(angle);
+    twiddleSin[k] = (float)sin(angle);
+
+    for(uint32_t bit = 1; bit < DSP_FFT_HALF; bit <<= 1)
+      reversed = (reversed << 1) | ((k & bit) ? 1 : 0);
+    bitReverse[k] = reversed;
+  }
+}
+
+/**
+ * @brief  Forward transform in place, X[k] = sum x[n] e^(-j 2 pi k n / N).
+ * @param  data: DSP_FFT_SIZE real points, the packed spectrum on return
+ * @retval None
+ */
+void AudioUserDspFft_Forward(float* data)
+{
+  AudioUserDspFft_Complex(data, 1.0f);
+
+  float re = data[0], im = data[1];
+  data[0] = re + im;
+  data[1] = re - im;
+
+  for(uint32_t k = 1; k <= DSP_FFT_HALF / 2; k++)
+  {
+    float* upper = &data[2 * k];
+    float* lower = &data[2 * (DSP_FFT_HALF - k)];
+    float c = twiddleCos[k], s = twiddleSin[k];
+
+    // spectra of the even and the odd samples at bin k
+    float evenRe = 0.5f * (upper[0] + lower[0]);
+    float evenIm = 0.5f * (upper[1] - lower[1]);
+    float oddRe = 0.5f * (upper[1] + lower[1]);
+    float oddIm = 0.5f * (lower[0] - upper[0]);
+
+    // the odd one rotated by the twiddle, and its mirror at DSP_FFT_HALF - k
+    float rotatedRe = oddRe * c + oddIm * s;
+    float rotatedIm = oddIm * c - oddRe * s;
+
+    upper[0] = evenRe + rotatedRe;
+    upper[1] = evenIm + rotatedIm;
+    lower[0] = evenRe - rotatedRe;
+    lower[1] = rotatedIm - evenIm;
+  }
+}
+
+/**
+ * @brief  Inverse transform in place, x[n] = sum X[k] e^(j 2 pi k n / N),
+ *         without the 1 / N.
+ * @param  data: a packed spectrum, DSP_FFT_SIZE real points on return
+ * @retval None
+ */
+void AudioUserDspFft_Inverse(float* data)
+{
+  float dc = data[0], nyquist = data[1];
+  data[0] = dc + nyquist;
+  data[1] = dc - nyquist;
+
+  for(uint32_t k = 1; k <= DSP_FFT_HALF / 2; k++)
+  {
+    float* upper = &data[2 * k];
+    float* lower = &data[2 * (DSP_FFT_HALF - k)];
+    float c = twiddleCos[k], s = twiddleSin[k];
+
+    // twice the spectra of the even and the odd samples, the odd one
+    // rotated back by the twiddle
+    float evenRe = upper[0] + lower[0];
+    float evenIm = upper[1] - lower[1];
+    float differenceRe = upper[0] - lower[0];
+    float differenceIm = upper[1] + lower[1];
+    float oddRe = differenceRe * c - differenceIm * s;
+    float oddIm = differenceRe * s + differenceIm * c;
+
+    upper[0] = evenRe - oddIm;
+    upper[1] = evenIm + oddRe;
+    lower[0] = evenRe + oddIm;
+    lower[1] = oddRe - evenIm;
+  }
+
+  AudioUserDspFft_Complex(data, -1.0f);
+}
+
+/**
+ * @brief  Complex radix-2 decimation in time FFT of DSP_FFT_HALF points in
+ *         place, unscaled.
+ * @param  data: interleaved real and imaginary parts
+ * @param  direction: 1 forward, -1 inverse
+ * @retval None
+ */
+static void AudioUserDspFft_Complex(float* data, float direction)
+{
+  for(uint32_t i = 0; i < DSP_FFT_HALF; i++)
+  {
+    uint32_t j = bitReverse[i];
+    if(i < j)
+    {
+      float re = data[2 * i], im = data[2 * i + 1];
+      data[2 * i] = data[2 * j];
+      data[2 * i + 1] = data[2 * j + 1];
+      data[2 * j] = re;
+      data[2 * j + 1] = im;
+    }
+  }
+
+  for(uint32_t span = 2; span <= DSP_FFT_HALF; span <<= 1)
+  {
+    uint32_t half = span / 2;
+    uint32_t step = DSP_FFT_SIZE / span;
+
+    for(uint32_t j = 0; j < half; j++)
+    {
+      float c = twiddleCos[j * step], s = direction * twiddleSin[j * step];
+
+      for(uint32_t i = j; i < DSP_FFT_HALF; i += span)
+      {
+        float* a = &data[2 * i];
+        float* b = &data[2 * (i + half)];
+        float re = b[0] * c + b[1] * s;
+        float im = b[1] * c - b[0] * s;
+
+        b[0] = a[0] - re;
+        b[1] = a[1] - im;
+        a[0] += re;
+        a[1] += im;
+      }
+    }
+  }
+}
@@ -0,0 +1,351 @@
+/**
+  ******************************************************************************
+  * @file    audio_user_dsp_fir.c
+  * @brief   Uniformly partitioned overlap-save convolution of the EQ input.
+  *
+  *          A filter is cut in partitions of DSP_FIR_BLOCK_FRAMES taps, each
+  *          zero padded to DSP_FFT_SIZE and kept as its spectrum. The input
+  *          is gathered in blocks of DSP_FIR_BLOCK_FRAMES, whatever the
+  *          length of the calls; for each block, the last DSP_FFT_SIZE input
+  *          samples of a channel are transformed into the newest slot of a
+  *          ring of spectra, the frequency domain delay line. Partition k
+  *          multiplies the spectrum of k blocks ago and the products are
+  *          summed, so a single inverse transform gives the whole
+  *          convolution. Of its output, the last DSP_FIR_BLOCK_FRAMES samples
+  *          are free of the circular wrap
+  *          (DSP_FFT_SIZE >= 2 * DSP_FIR_BLOCK_FRAMES - 1) and are the block
+  *          filtered; they go out while the next block comes in, so every
+  *          sample is DSP_FIR_DELAY_FRAMES late, on both channels.
+  *
+  *          Runs in the USB interrupt. Per block and channel the work is two
+  *          transforms and one complex multiply-add of DSP_FFT_HALF bins per
+  *          partition, reading two spectra from the SDRAM each. With packets
+  *          of DSP_FIR_BLOCK_FRAMES a block ends with each packet. The
+  *          partitions grow the SDRAM reads and the multiply-adds linearly and
+  *          soon outgrow the D-cache, so AudioUserDspFir_Calibrate times a
+  *          block on the board and caps the filters to what fits the budget.
+  ******************************************************************************
+  */
+
+#include "audio_user_dsp_fir.h"
+#include "stm32f7xx_hal.h"
+#include <string.h>
+
+#if DSP_FFT_SIZE < 2 * DSP_FIR_BLOCK_FRAMES - 1
+#error "DSP_FFT_SIZE too small for the partitions"
+#endif
+
+// private defines -------------------------------------------------------------
+// floats of the spectra of one channel, the filter or the delay line
+#define DSP_FIR_CHANNEL_FLOATS  (DSP_FIR_PARTITIONS * DSP_FFT_SIZE)
+// input samples before the packet the transform sees
+#define DSP_FIR_OVERLAP         (DSP_FFT_SIZE - DSP_FIR_BLOCK_FRAMES)
+// timed blocks of each length in AudioUserDspFir_Calibrate, the median is kept
+#define DSP_FIR_CALIBRATION_RUNS 9
+
+// private variables -----------------------------------------------------------
+// in the SDRAM, channel by channel and partition by partition, packed as
+// AudioUserDspFft_Forward leaves them; the filters are scaled by
+// 1 / DSP_FFT_SIZE for the inverse
+static float*   spectra;
+static float*   delayLine;
+// slot of the delay line the next packet goes in, the same for both channels
+static uint32_t head;
+// partitions of the filter of each channel, none passes it through
+static uint32_t partitions[DSP_CHANNELS];
+// slots written since the channel started, older ones are not summed
+static uint32_t filled[DSP_CHANNELS];
+// longest filter AudioUserDspFir_Load takes
+static uint32_t maxTaps;
+static float    history[DSP_CHANNELS][DSP_FFT_SIZE];
+// the block coming in and the filtered one going out, and the frames of both
+// done so far
+static float    pending[DSP_CHANNELS][DSP_FIR_BLOCK_FRAMES];
+static float    ready[DSP_CHANNELS][DSP_FIR_BLOCK_FRAMES];
+static uint32_t fill;
+static float    sum[DSP_FFT_SIZE];
+// the main loop transforms the partitions of a filter in its own buffer
+static float    partition[DSP_FFT_SIZE];
+
+// private function declarations -----------------------------------------------
+static void AudioUserDspFir_Block(void);
+static uint32_t AudioUserDspFir_TimeBlock(AudioUserDspFir_Clock clock, uint32_t count);
+static void AudioUserDspFir_Channel(uint8_t channel);
+static inline void AudioUserDspFir_MultiplyAdd(float* sum, const float* filter, const float* input);
+
+/**
+ * @brief  Takes the memory of the spectra, no filter loaded.
+ * @param  memory: DSP_FIR_MEMORY_SIZE bytes, 4 byte aligned
+ * @retval None
+ */
+void AudioUserDspFir_Init(void* memory)
+{
+  AudioUserDspFft_Init();
+
+  spectra = (float*)memory;
+  delayLine = spectra + DSP_CHANNELS * DSP_FIR_CHANNEL_FLOATS;
+  head = 0;
+  maxTaps = DSP_FIR_MAX_TAPS;
+  memset(partitions, 0, sizeof(partitions));
+  AudioUserDspFir_Reset();
+}
+
+/**
+ * @brief  Times a block of both channels with filters of one partition and
+ *         of DSP_FIR_PARTITIONS, and caps the filters AudioUserDspFir_Load
+ *         takes to the partitions that fit the budget, cost growing linearly
+ *         between the two. Clears the memory, no filter is loaded after.
+ *         Called from the main loop before the stream starts.
+ * @param  clock: counter the blocks are timed with
+ * @param  budget: counts of the clock a block may take
+ * @retval the taps that fit, 0 if not even one partition does
+ */
+uint32_t AudioUserDspFir_Calibrate(AudioUserDspFir_Clock clock, uint32_t budget)
+{
+  uint32_t shortest, longest, perPartition, fit;
+
+  if(spectra == NULL)
+    return 0;
+
+  // zero spectra take the same reads and multiply-adds as a real filter
+  memset(spectra, 0, DSP_FIR_MEMORY_SIZE);
+  shortest = AudioUserDspFir_TimeBlock(clock, 1);
+  longest = AudioUserDspFir_TimeBlock(clock, DSP_FIR_PARTITIONS);
+  perPartition = (longest > shortest) ? (longest - shortest) / (DSP_FIR_PARTITIONS - 1) : 0;
+
+  if(shortest > budget)
+    fit = 0;
+  else if(perPartition == 0)
+    fit = DSP_FIR_PARTITIONS;
+  else
+    fit = 1 + (budget - shortest) / perPartition;
+  if(fit > DSP_FIR_PARTITIONS)
+    fit = DSP_FIR_PARTITIONS;
+
+  maxTaps = (fit * DSP_FIR_BLOCK_FRAMES < DSP_FIR_MAX_TAPS) ? fit * DSP_FIR_BLOCK_FRAMES : DSP_FIR_MAX_TAPS;
+  head = 0;
+  memset(partitions, 0, sizeof(partitions));
+  AudioUserDspFir_Reset();
+  return maxTaps;
+}
+
+/**
+ * @brief  Longest filter AudioUserDspFir_Load takes.
+ * @param  None
+ * @retval taps, DSP_FIR_MAX_TAPS until AudioUserDspFir_Calibrate caps them
+ */
+uint32_t AudioUserDspFir_GetMaxTaps(void)
+{
+  return maxTaps;
+}
+
+/**
+ * @brief  Sets the filter of a channel. The channel passes through, delayed
+ *         if the other one has a filter, while the spectra are computed and
+ *         starts from silence after. Called from the main loop.
+ * @param  channel: 0 left, 1 right
+ * @param  taps: impulse response, 1 is unity gain
+ * @param  count: taps, up to AudioUserDspFir_GetMaxTaps; 0 removes the
+ *         filter
+ * @retval false without memory or if an argument is out of range, nothing
+ *         changed
+ */
+bool AudioUserDspFir_Load(uint8_t channel, const float* taps, uint32_t count)
+{
+  uint32_t used = (count + DSP_FIR_BLOCK_FRAMES - 1) / DSP_FIR_BLOCK_FRAMES;
+
+  if(spectra == NULL || channel >= DSP_CHANNELS || count > maxTaps)
+    return false;
+
+  // the USB interrupt leaves the spectra of a channel without partitions alone
+  __disable_irq();
+  partitions[channel] = 0;
+  __enable_irq();
+
+  for(uint32_t p = 0; p < used; p++)
+  {
+    float* spectrum = &spectra[channel * DSP_FIR_CHANNEL_FLOATS + p * DSP_FFT_SIZE];
+    uint32_t first = p * DSP_FIR_BLOCK_FRAMES;
+    uint32_t length = (count - first < DSP_FIR_BLOCK_FRAMES) ? count - first : DSP_FIR_BLOCK_FRAMES;
+
+    for(uint32_t n = 0; n < length; n++)
+      partition[n] = taps[first + n] / DSP_FFT_SIZE;
+    memset(&partition[length], 0, (DSP_FFT_SIZE - length) * sizeof(float));
+    AudioUserDspFft_Forward(partition);
+    memcpy(spectrum, partition, sizeof(partition));
+  }
+
+  __disable_irq();
+  // from the bypass the delay starts with a block of silence
+  if(partitions[1 - channel] == 0)
+  {
+    fill = 0;
+    memset(ready, 0, sizeof(ready));
+  }
+  partitions[channel] = used;
+  filled[channel] = 0;
+  memset(history[channel], 0, sizeof(history[channel]));
+  memset(pending[channel], 0, sizeof(pending[channel]));
+  __enable_irq();
+
+  return true;
+}
+
+/**
+ * @brief  Forgets the input, both channels start from silence; the filters
+ *         stay. Called with the interrupts masked, or by the USB interrupt.
+ * @param  None
+ * @retval None
+ */
+void AudioUserDspFir_Reset(void)
+{
+  memset(filled, 0, sizeof(filled));
+  memset(history, 0, sizeof(history));
+  memset(pending, 0, sizeof(pending));
+  memset(ready, 0, sizeof(ready));
+  fill = 0;
+}
+
+/**
+ * @brief  Filters stereo frames in place, DSP_FIR_DELAY_FRAMES late. A block
+ *         may span calls. Without a filter on either channel the frames pass
+ *         through, not delayed.
+ * @param  samples: interleaved left and right, in the units of 16 bit samples
+ * @param  frames: stereo pairs in samples
+ * @retval None
+ */
+void AudioUserDspFir_Process(float* samples, uint32_t frames)
+{
+  if(partitions[0] == 0 && partitions[1] == 0)
+    return;
+
+  for(uint32_t f = 0; f < frames; f++)
+  {
+    for(uint8_t channel = 0; channel < DSP_CHANNELS; channel++)
+    {
+      float sample = samples[2 * f + channel];
+
+      samples[2 * f + channel] = ready[channel][fill];
+      pending[channel][fill] = sample;
+    }
+
+    if(++fill == DSP_FIR_BLOCK_FRAMES)
+      AudioUserDspFir_Block();
+  }
+}
+
+/**
+ * @brief  Filters the block that just came in into the one that goes out
+ *         next; a channel without a filter is only delayed.
+ * @param  None
+ * @retval None
+ */
+static void AudioUserDspFir_Block(void)
+{
+  for(uint8_t channel = 0; channel < DSP_CHANNELS; channel++)
+  {
+    if(partitions[channel] != 0)
+      AudioUserDspFir_Channel(channel);
+    else
+      memcpy(ready[channel], pending[channel], sizeof(ready[channel]));
+  }
+
+  if(++head == DSP_FIR_PARTITIONS)
+    head = 0;
+  fill = 0;
+}
+
+/**
+ * @brief  Times AudioUserDspFir_Block with filters of count partitions on both
+ *         channels and the whole delay line summed, the worst case of that
+ *         length. The interrupts are masked around each run.
+ * @param  clock: counter the block is timed with
+ * @param  count: partitions of the filters
+ * @retval median of DSP_FIR_CALIBRATION_RUNS runs, in counts of the clock
+ */
+static uint32_t AudioUserDspFir_TimeBlock(AudioUserDspFir_Clock clock, uint32_t count)
+{
+  uint32_t runs[DSP_FIR_CALIBRATION_RUNS];
+
+  for(uint8_t channel = 0; channel < DSP_CHANNELS; channel++)
+  {
+    partitions[channel] = count;
+    filled[channel] = DSP_FIR_PARTITIONS;
+  }
+
+  for(uint32_t r = 0; r < DSP_FIR_CALIBRATION_RUNS; r++)
+  {
+    __disable_irq();
+    uint32_t start = clock();
+    AudioUserDspFir_Block();
+    uint32_t elapsed = clock() - start;
+    __enable_irq();
+
+    // insertion sort, runs[0..r] stay ordered
+    uint32_t i = r;
+    for(; i > 0 && runs[i - 1] > elapsed; i--)
+      runs[i] = runs[i - 1];
+    runs[i] = elapsed;
+  }
+
+  return runs[DSP_FIR_CALIBRATION_RUNS / 2];
+}
+
+/**
+ * @brief  Convolves the block of one channel with its filter.
+ * @param  channel: 0 left, 1 right
+ * @retval None
+ */
+static void AudioUserDspFir_Channel(uint8_t channel)
+{
+  float* input = history[channel];
+  const float* filter = &spectra[channel * DSP_FIR_CHANNEL_FLOATS];
+  float* line = &delayLine[channel * DSP_FIR_CHANNEL_FLOATS];
+  uint32_t count = partitions[channel];
+  uint32_t slot = head;
+
+  memmove(input, input + DSP_FIR_BLOCK_FRAMES, DSP_FIR_OVERLAP * sizeof(float));
+  memcpy(input + DSP_FIR_OVERLAP, pending[channel], sizeof(pending[channel]));
+
+  // transformed in internal RAM, written to the SDRAM once
+  memcpy(sum, input, sizeof(sum));
+  AudioUserDspFft_Forward(sum);
+  memcpy(&line[head * DSP_FFT_SIZE], sum, sizeof(sum));
+
+  if(filled[channel] < DSP_FIR_PARTITIONS)
+    filled[channel]++;
+  if(count > filled[channel])
+    count = filled[channel];
+
+  // the newest spectrum times the first partition, then back in time
+  memset(sum, 0, sizeof(sum));
+  for(uint32_t p = 0; p < count; p++)
+  {
+    AudioUserDspFir_MultiplyAdd(sum, &filter[p * DSP_FFT_SIZE], &line[slot * DSP_FFT_SIZE]);
+    slot = (slot == 0) ? DSP_FIR_PARTITIONS - 1 : slot - 1;
+  }
+
+  AudioUserDspFft_Inverse(sum);
+  memcpy(ready[channel], &sum[DSP_FIR_OVERLAP], sizeof(ready[channel]));
+}
+
+/**
+ * @brief  Adds the product of two packed spectra to a third.
+ * @param  sum: packed spectrum, accumulated
+ * @param  filter: packed spectrum of a partition
+ * @param  input: packed spectrum of the delay line
+ * @retval None
+ */
+static inline void AudioUserDspFir_MultiplyAdd(float* sum, const float* filter, const float* input)
+{
+  // DC and Nyquist are real
+  sum[0] += filter[0] * input[0];
+  sum[1] += filter[1] * input[1];
+
+  for(uint32_t i = 2; i < DSP_FFT_SIZE; i += 2)
+  {
+    float re = input[i], im = input[i + 1];
+    sum[i] += filter[i] * re - filter[i + 1] * im;
+    sum[i + 1] += filter[i] * im + filter[i + 1] * re;
+  }
+}
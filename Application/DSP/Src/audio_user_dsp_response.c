@@ -0,0 +1,202 @@
+/**
+  ******************************************************************************
+  * @file    audio_user_dsp_response.c
+  * @brief   Incremental evaluation of the EQ magnitude response. With
+  *          s = sin^2(w/2) the squared magnitude of one biquad is
+  *
+  *            |H|^2 = (n0 + n1 s + n2 s^2) / (d0 + d1 s + d2 s^2)
+  *
+  *          n0 = (b0 + b1 + b2)^2, n1 = -4 (b0 b1 + b1 b2 + 4 b0 b2),
+  *          n2 = 16 b0 b2 and likewise for the denominator with 1, a1, a2.
+  *          Unlike the cos w form this keeps its precision at the low end,
+  *          where w is tiny and the cos w terms would cancel in float. The
+  *          s table is computed once, a changed band costs a few multiplies
+  *          and one log per point.
+  *
+  *          Runs from the main loop; the USB interrupt may reconfigure a band
+  *          while it is read, which shows up as a change on the next update.
+  ******************************************************************************
+  */
+
+#include "audio_user_dsp_response.h"
+#include "audio_user_dsp.h"
+#include <math.h>
+
+// private defines -------------------------------------------------------------
+#if NUMBER_OF_BANDS > 8
+#error "the band masks are 8 bits wide"
+#endif
+
+#define DSP_RESPONSE_PI       3.14159265358979323846
+
+// private typedefs ------------------------------------------------------------
+typedef struct AudioUserDspResponseBand
+{
+  float b0, b1, b2, a1, a2;             // coefficients the response was evaluated for
+  bool  valid;
+  float magnitude[DSP_RESPONSE_POINTS]; // dB
+} AudioUserDspResponseBand;
+
+// private variables -----------------------------------------------------------
+static AudioUserDspResponseBand bands[NUMBER_OF_BANDS];
+static float sinSquared[DSP_RESPONSE_POINTS];   // sin^2(w/2) of each point
+static float magnitude[DSP_RESPONSE_POINTS];    // sum of the bands, dB
+static float peak = 0;                          // highest point of magnitude, dB
+
+// private function declarations -----------------------------------------------
+static void AudioUserDspResponse_EvaluateBand(AudioUserDspResponseBand* band);
+
+/**
+ * @brief  Computes the frequency table for a sample rate and clears the
+ *         cached responses, the next update evaluates every band.
+ * @param  sampleRate: in Hz
+ * @retval None
+ */
+void AudioUserDspResponse_Init(uint32_t sampleRate)
+{
+  for(uint16_t i = 0; i < DSP_RESPONSE_POINTS; i++)
+  {
+    double omega = 2.0 * DSP_RESPONSE_PI * AudioUserDspResponse_Frequency(i) / sampleRate;
+    double s = sin(omega / 2.0);
+    sinSquared[i] = (float)(s * s);
+    magnitude[i] = 0;
+  }
+  peak = 0;
+
+  AudioUserDspResponse_Invalidate(0xFF);
+}
+
+/**
+ * @brief  Forgets the cached response of some bands.
+ * @param  bandMask: one bit per band, bit 0 for band 0
+ * @retval None
+ */
+void AudioUserDspResponse_Invalidate(uint8_t bandMask)
+{
+  for(uint8_t i = 0; i < NUMBER_OF_BANDS; i++)
+  {
+    if(bandMask & (1u << i))
+      bands[i].valid = false;
+  }
+}
+
+/**
+ * @brief  Evaluates the bands whose coefficients changed since the last call
+ *         and sums the bands again if any did.
+ * @param  None
+ * @retval one bit per band evaluated, 0 if the response did not change
+ */
+uint8_t AudioUserDspResponse_Update(void)
+{
+  uint8_t changed = 0;
+
+  for(uint8_t i = 0; i < NUMBER_OF_BANDS; i++)
+  {
+    const BiquadFilter* filter = &biquadFilters[i];
+    AudioUserDspResponseBand* band = &bands[i];
+
+    if(band->valid && filter->coefficients.b0 == band->b0 && filter->coefficients.b1 == band->b1 && filter->coefficients.b2 == band->b2 &&
+       filter->coefficients.a1 == band->a1 && filter->coefficients.a2 == band->a2)
+      continue;
+
+    band->b0 = filter->coefficients.b0;
+    band->b1 = filter->coefficients.b1;
+    band->b2 = filter->coefficients.b2;
+    band->a1 = filter->coefficients.a1;
+    band->a2 = filter->coefficients.a2;
+    band->valid = true;
+
+    // a band that was never configured passes the signal unchanged
+    if(filter->isInitialized)
+      AudioUserDspResponse_EvaluateBand(band);
+    else
+    {
+      for(uint16_t p = 0; p < DSP_RESPONSE_POINTS; p++)
+        band->magnitude[p] = 0;
+    }
+
+    changed |= 1u << i;
+  }
+
+  if(changed == 0)
+    return 0;
+
+  peak = DSP_RESPONSE_MIN_DB;
+  for(uint16_t p = 0; p < DSP_RESPONSE_POINTS; p++)
+  {
+    float sum = 0;
+    for(uint8_t i = 0; i < NUMBER_OF_BANDS; i++)
+      sum += bands[i].magnitude[p];
+    magnitude[p] = sum;
+    if(sum > peak)
+      peak = sum;
+  }
+
+  return changed;
+}
+
+/**
+ * @brief  Magnitude of the whole EQ after the last update.
+ * @param  None
+ * @retval DSP_RESPONSE_POINTS values in dB, lowest frequency first
+ */
+const float* AudioUserDspResponse_Magnitude(void)
+{
+  return magnitude;
+}
+
+/**
+ * @brief  Largest gain of the whole EQ after the last update. The bands are
+ *         an octave wide or more, twenty points per octave find their peaks
+ *         within a few hundredths of a dB.
+ * @param  None
+ * @retval highest point of the magnitude in dB
+ */
+float AudioUserDspResponse_Peak(void)
+{
+  return peak;
+}
+
+/**
+ * @brief  Frequency of one point of the response.
+ * @param  point: 0 to DSP_RESPONSE_POINTS - 1
+ * @retval frequency in Hz
+ */
+float AudioUserDspResponse_Frequency(uint16_t point)
+{
+  return DSP_RESPONSE_MIN_FREQUENCY *
+         powf(DSP_RESPONSE_MAX_FREQUENCY / DSP_RESPONSE_MIN_FREQUENCY, (float)point / (DSP_RESPONSE_POINTS - 1));
+}
+
+/**
+ * @brief  Evaluates the response of one band from its copied coefficients.
+ *         The polynomial coefficients are formed in double, the sums of the
+ *         filter coefficients nearly cancel for bands low in frequency.
+ * @param  band: band to evaluate
+ * @retval None
+ */
+static void AudioUserDspResponse_EvaluateBand(AudioUserDspResponseBand* band)
+{
+  double b0 = band->b0, b1 = band->b1, b2 = band->b2;
+  double a1 = band->a1, a2 = band->a2;
+  double sumB = b0 + b1 + b2;
+  double sumA = 1.0 + a1 + a2;
+
+  float n0 = (float)(sumB * sumB);
+  float n1 = (float)(-4.0 * (b0 * b1 + b1 * b2 + 4.0 * b0 * b2));
+  float n2 = (float)(16.0 * b0 * b2);
+  float d0 = (float)(sumA * sumA);
+  float d1 = (float)(-4.0 * (a1 + a1 * a2 + 4.0 * a2));
+  float d2 = (float)(16.0 * a2);
+  float minPower = powf(10.0f, DSP_RESPONSE_MIN_DB / 10.0f);
+
+  for(uint16_t p = 0; p < DSP_RESPONSE_POINTS; p++)
+  {
+    float s = sinSquared[p];
+    float numerator = n0 + s * (n1 + s * n2);
+    float denominator = d0 + s * (d1 + s * d2);
+    float power = (denominator > 0) ? numerator / denominator : 0;
+
+    band->magnitude[p] = 10.0f * log10f((power > minPower) ? power : minPower);
+  }
+}
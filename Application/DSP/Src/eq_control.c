@@ -0,0 +1,357 @@
+/**
+  ******************************************************************************
+  * @file    eq_control.c
+  * @brief   EQ vendor requests: setup and data stages in the USB interrupt,
+  *          the coefficients, the FIR spectra and the dynamics in the main
+  *          loop.
+  ******************************************************************************
+  */
+
+#include "eq_control.h"
+#include "audio_user_dsp.h"
+#include "audio_user_dsp_dynamics.h"
+#include "audio_user_dsp_fir.h"
+#include "preset_store.h"
+#include "usb_audio.h"
+#include "stm32f7xx_hal.h"
+#include <string.h>
+
+// private defines -------------------------------------------------------------
+#define EQ_CONTROL_ALL_BANDS          ((1u << EQ_CONTROL_BANDS) - 1)
+
+_Static_assert(EQ_CONTROL_BANDS == NUMBER_OF_BANDS, "the requests carry every band of the filters");
+_Static_assert(EQ_CONTROL_NAME_LENGTH == PRESET_STORE_NAME_LENGTH, "a preset name is saved as sent");
+_Static_assert(EQ_CONTROL_CHANNELS == DSP_CHANNELS, "a FIR load names a channel of the filters");
+_Static_assert(DSP_FIR_MAX_TAPS % EQ_CONTROL_FIR_CHUNK_TAPS == 0, "the chunks fill the FIR buffer");
+
+// private typedefs ------------------------------------------------------------
+typedef union EqControlTransfer
+{
+  EqControlInfo     info;
+  EqControlBand     band;
+  EqControlPreset   preset;
+  EqControlFirTaps  firTaps;
+  EqControlFir      fir;
+  EqControlDynamics dynamics;
+  uint8_t           status;
+} EqControlTransfer;
+
+// private variables -----------------------------------------------------------
+// data stage of the current request, USB interrupt only
+static EqControlTransfer transfer;
+static uint8_t           transferRequest = 0;
+static uint16_t          transferValue = 0;
+static uint16_t          transferIndex = 0;
+
+// last set, written by the USB interrupt only while the status is not
+// pending, read by the main loop only while it is
+static EqControlPreset   pending;
+static uint8_t           pendingBands = 0;   // one bit per band the set changes
+static uint8_t           pendingSlot = 0;    // 0 if the set is not saved
+static EqControlFir      pendingFir;
+static EqControlDynamics pendingDynamics;
+static uint8_t           pendingRequest = 0; // the set request
+static volatile uint8_t  status = EQ_CONTROL_STATUS_IDLE;
+
+// dynamics in the filters, the defaults of audio_user_dsp_dynamics.h at boot;
+// written by the main loop with the interrupts masked
+static EqControlDynamics dynamics = {
+  .ceiling = (int16_t)(DSP_LIMITER_CEILING_DB * 10),
+  .limiterRelease = (uint16_t)DSP_LIMITER_RELEASE_MS,
+  .threshold = (int16_t)(DSP_COMPRESSOR_THRESHOLD_DB * 10),
+  .ratio = (uint16_t)(DSP_COMPRESSOR_RATIO * 10),
+  .attack = (uint16_t)DSP_COMPRESSOR_ATTACK_MS,
+  .release = (uint16_t)DSP_COMPRESSOR_RELEASE_MS,
+  .makeup = (int16_t)(DSP_COMPRESSOR_MAKEUP_DB * 10),
+};
+
+// DSP_FIR_MAX_TAPS taps, written by the USB interrupt only while the status
+// is not pending
+static float*            firTaps = NULL;
+
+extern int16_t frequencies[];
+extern int16_t bandwidths[];
+
+// private function declarations -----------------------------------------------
+static uint16_t EqControl_RequestSize(uint8_t request);
+static bool     EqControl_ApplyDynamics(void);
+
+/**
+ * @brief  Takes the buffer the FIR taps are gathered in. Without it the FIR
+ *         requests are stalled.
+ * @param  taps: DSP_FIR_MAX_TAPS floats
+ * @retval None
+ */
+void EqControl_Init(float* taps)
+{
+  firTaps = taps;
+}
+
+/**
+ * @brief  Setup stage of a vendor request, from the USB interrupt. Fills the
+ *         reply of a get; checks that a set can be taken.
+ * @param  request: bRequest, EQ_CONTROL_REQ_*
+ * @param  deviceToHost: direction bit of bmRequestType
+ * @param  value: wValue
+ * @param  index: wIndex
+ * @param  length: wLength
+ * @param  data: receives the buffer of the data stage
+ * @retval bytes of the data stage, EQ_CONTROL_STALL to refuse the request
+ */
+int32_t EqControl_Setup(uint8_t request, bool deviceToHost, uint16_t value, uint16_t index, uint16_t length, uint8_t** data)
+{
+  uint16_t size = EqControl_RequestSize(request);
+
+  if(size == 0 || deviceToHost != EQ_CONTROL_REQ_IS_IN(request))
+    return EQ_CONTROL_STALL;
+
+  // a get may ask for more than it is sent, a set is taken whole or not at all
+  if(deviceToHost ? length == 0 : length != size)
+    return EQ_CONTROL_STALL;
+
+  switch(request)
+  {
+    case EQ_CONTROL_REQ_GET_INFO:
+      transfer.info = (EqControlInfo){
+        .version = EQ_CONTROL_PROTOCOL_VERSION,
+        .bandCount = EQ_CONTROL_BANDS,
+        .presetSlots = PRESET_STORE_SLOTS,
+        .sampleRate = USB_AUDIO_CONFIG_PLAY_DEF_FREQ,
+        .firMaxTaps = (firTaps != NULL) ? AudioUserDspFir_GetMaxTaps() : 0,
+      };
+      break;
+
+    case EQ_CONTROL_REQ_GET_BAND:
+      if(index >= EQ_CONTROL_BANDS)
+        return EQ_CONTROL_STALL;
+      transfer.band.gain = biquadFilters[index].gain;
+      transfer.band.frequency = biquadFilters[index].frequency;
+      transfer.band.bandwidth = biquadFilters[index].bandwidth;
+      break;
+
+    case EQ_CONTROL_REQ_GET_STATUS:
+      transfer.status = status;
+      break;
+
+    case EQ_CONTROL_REQ_GET_DYNAMICS:
+      transfer.dynamics = dynamics;
+      break;
+
+    // the main loop has not taken the previous set yet
+    case EQ_CONTROL_REQ_SET_BAND:
+      if(index >= EQ_CONTROL_BANDS || status == EQ_CONTROL_STATUS_PENDING)
+        return EQ_CONTROL_STALL;
+      break;
+
+    // slot 0 is the working preset, written with the knobs by the save button
+    case EQ_CONTROL_REQ_SET_PRESET:
+      if(value >= PRESET_STORE_SLOTS || status == EQ_CONTROL_STATUS_PENDING)
+        return EQ_CONTROL_STALL;
+      break;
+
+    // the main loop reads the buffer while a load is pending
+    case EQ_CONTROL_REQ_SET_FIR_TAPS:
+      if(firTaps == NULL || index % EQ_CONTROL_FIR_CHUNK_TAPS != 0 || index >= DSP_FIR_MAX_TAPS ||
+         status == EQ_CONTROL_STATUS_PENDING)
+        return EQ_CONTROL_STALL;
+      break;
+
+    case EQ_CONTROL_REQ_LOAD_FIR:
+      if(firTaps == NULL || status == EQ_CONTROL_STATUS_PENDING)
+        return EQ_CONTROL_STALL;
+      break;
+
+    case EQ_CONTROL_REQ_SET_DYNAMICS:
+      if(status == EQ_CONTROL_STATUS_PENDING)
+        return EQ_CONTROL_STALL;
+      break;
+  }
+
+  transferRequest = request;
+  transferValue = value;
+  transferIndex = index;
+  *data = (uint8_t*)&transfer;
+
+  return (length < size) ? length : size;
+}
+
+/**
+ * @brief  End of the data stage of a set, from the USB interrupt. Keeps the
+ *         set for EqControl_Process, or rejects it if a value is out of
+ *         range.
+ * @param  None
+ * @retval None
+ */
+void EqControl_DataReceived(void)
+{
+  if(transferRequest == EQ_CONTROL_REQ_SET_BAND)
+  {
+    if(!EqControlRequest_IsValidBand(&transfer.band))
+    {
+      status = EQ_CONTROL_STATUS_REJECTED;
+      return;
+    }
+    pending.bands[transferIndex] = transfer.band;
+    pendingBands = 1u << transferIndex;
+    pendingSlot = 0;
+  }
+  else if(transferRequest == EQ_CONTROL_REQ_SET_PRESET)
+  {
+    if(!EqControlRequest_IsValidPreset(&transfer.preset))
+    {
+      status = EQ_CONTROL_STATUS_REJECTED;
+      return;
+    }
+    pending = transfer.preset;
+    pendingBands = EQ_CONTROL_ALL_BANDS;
+    pendingSlot = transferValue;
+  }
+  else if(transferRequest == EQ_CONTROL_REQ_SET_FIR_TAPS)
+  {
+    memcpy(&firTaps[transferIndex], transfer.firTaps.taps, sizeof(transfer.firTaps));
+    return;
+  }
+  else if(transferRequest == EQ_CONTROL_REQ_LOAD_FIR)
+  {
+    if(!EqControlRequest_IsValidFir(&transfer.fir, AudioUserDspFir_GetMaxTaps()))
+    {
+      status = EQ_CONTROL_STATUS_REJECTED;
+      return;
+    }
+    pendingFir = transfer.fir;
+  }
+  else if(transferRequest == EQ_CONTROL_REQ_SET_DYNAMICS)
+  {
+    if(!EqControlRequest_IsValidDynamics(&transfer.dynamics))
+    {
+      status = EQ_CONTROL_STATUS_REJECTED;
+      return;
+    }
+    pendingDynamics = transfer.dynamics;
+  }
+  else
+    return;
+
+  pendingRequest = transferRequest;
+
+  __DMB();
+  status = EQ_CONTROL_STATUS_PENDING;
+}
+
+/**
+ * @brief  Applies the last set: computes the coefficients of every band,
+ *         the ones it does not change from their live values, and loads
+ *         them together, so no packet is filtered with part of a preset.
+ *         Updates the band layout tables and queues a preset save. A FIR
+ *         load computes the spectra of the taps gathered instead, a
+ *         dynamics set configures the stages. Called from the main loop.
+ * @param  None
+ * @retval true if the bands changed, the knobs have to follow
+ */
+bool EqControl_Process(void)
+{
+  BiquadCoefficients bank[NUMBER_OF_BANDS];
+  int16_t gains[NUMBER_OF_BANDS];
+  int16_t bandFrequencies[NUMBER_OF_BANDS];
+  int16_t bandBandwidths[NUMBER_OF_BANDS];
+
+  if(status != EQ_CONTROL_STATUS_PENDING)
+    return false;
+  __DMB();
+
+  if(pendingRequest == EQ_CONTROL_REQ_LOAD_FIR)
+  {
+    bool loaded = AudioUserDspFir_Load(pendingFir.channel, firTaps, pendingFir.tapCount);
+
+    status = loaded ? EQ_CONTROL_STATUS_APPLIED : EQ_CONTROL_STATUS_REJECTED;
+    return false;
+  }
+  if(pendingRequest == EQ_CONTROL_REQ_SET_DYNAMICS)
+  {
+    status = EqControl_ApplyDynamics() ? EQ_CONTROL_STATUS_APPLIED : EQ_CONTROL_STATUS_REJECTED;
+    return false;
+  }
+
+  for(uint8_t i = 0; i < NUMBER_OF_BANDS; i++)
+  {
+    if(pendingBands & (1u << i))
+    {
+      gains[i] = pending.bands[i].gain;
+      bandFrequencies[i] = pending.bands[i].frequency;
+      bandBandwidths[i] = pending.bands[i].bandwidth;
+    }
+    else
+    {
+      gains[i] = biquadFilters[i].gain;
+      bandFrequencies[i] = biquadFilters[i].frequency;
+      bandBandwidths[i] = biquadFilters[i].bandwidth;
+    }
+    AudioUserDsp_BiquadCoefficients(&bank[i], gains[i], bandFrequencies[i], bandBandwidths[i], USB_AUDIO_CONFIG_PLAY_DEF_FREQ);
+  }
+
+  AudioUserDsp_LoadCoefficients(bank, gains, bandFrequencies, bandBandwidths);
+
+  // the reset button and the preset store take the layout from the tables
+  for(uint8_t i = 0; i < NUMBER_OF_BANDS; i++)
+  {
+    frequencies[i] = bandFrequencies[i];
+    bandwidths[i] = bandBandwidths[i];
+  }
+
+  if(pendingSlot != 0)
+    PresetStore_Save(pendingSlot, pending.name, gains);
+
+  status = EQ_CONTROL_STATUS_APPLIED;
+  return true;
+}
+
+/**
+ * @brief  Size of the data stage of a request.
+ * @param  request: bRequest
+ * @retval bytes, 0 for a request that does not exist
+ */
+static uint16_t EqControl_RequestSize(uint8_t request)
+{
+  switch(request)
+  {
+    case EQ_CONTROL_REQ_GET_INFO:     return sizeof(EqControlInfo);
+    case EQ_CONTROL_REQ_GET_BAND:     return sizeof(EqControlBand);
+    case EQ_CONTROL_REQ_GET_STATUS:   return sizeof(uint8_t);
+    case EQ_CONTROL_REQ_GET_DYNAMICS: return sizeof(EqControlDynamics);
+    case EQ_CONTROL_REQ_SET_BAND:     return sizeof(EqControlBand);
+    case EQ_CONTROL_REQ_SET_PRESET:   return sizeof(EqControlPreset);
+    case EQ_CONTROL_REQ_SET_FIR_TAPS: return sizeof(EqControlFirTaps);
+    case EQ_CONTROL_REQ_LOAD_FIR:     return sizeof(EqControlFir);
+    case EQ_CONTROL_REQ_SET_DYNAMICS: return sizeof(EqControlDynamics);
+    default:                          return 0;
+  }
+}
+
+/**
+ * @brief  Configures the dynamics with the pending set, from the main loop.
+ * @param  None
+ * @retval false if the stages refused the settings, nothing changed
+ */
+static bool EqControl_ApplyDynamics(void)
+{
+  AudioUserDspDynamicsSettings settings = {
+    .limiter = (pendingDynamics.flags & EQ_CONTROL_DYNAMICS_LIMITER) != 0,
+    .ceilingDb = pendingDynamics.ceiling / 10.0f,
+    .limiterReleaseMs = pendingDynamics.limiterRelease,
+    .compressor = (pendingDynamics.flags & EQ_CONTROL_DYNAMICS_COMPRESSOR) != 0,
+    .thresholdDb = pendingDynamics.threshold / 10.0f,
+    .ratio = pendingDynamics.ratio / 10.0f,
+    .attackMs = pendingDynamics.attack,
+    .releaseMs = pendingDynamics.release,
+    .makeupDb = pendingDynamics.makeup / 10.0f,
+  };
+
+  if(!AudioUserDspDynamics_Configure(&settings))
+    return false;
+
+  // a get from the USB interrupt reads it whole
+  __disable_irq();
+  dynamics = pendingDynamics;
+  __enable_irq();
+  return true;
+}
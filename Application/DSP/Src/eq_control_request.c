@@ -0,0 +1,72 @@
+/**
+  ******************************************************************************
+  * @file    eq_control_request.c
+  * @brief   Range checks of the EQ vendor requests, run by the firmware on
+  *          what it receives and by the host tool before it sends.
+  ******************************************************************************
+  */
+
+#include "eq_control_request.h"
+
+/**
+ * @brief  Tells whether a band is within the limits of the filters.
+ * @param  band: as received
+ * @retval true if every field is in range
+ */
+bool EqControlRequest_IsValidBand(const EqControlBand* band)
+{
+  return band->gain >= EQ_CONTROL_GAIN_MIN && band->gain <= EQ_CONTROL_GAIN_MAX &&
+         band->frequency >= EQ_CONTROL_FREQUENCY_MIN && band->frequency <= EQ_CONTROL_FREQUENCY_MAX &&
+         band->bandwidth >= EQ_CONTROL_BANDWIDTH_MIN && band->bandwidth <= EQ_CONTROL_BANDWIDTH_MAX;
+}
+
+/**
+ * @brief  Tells whether a preset is of this version, has every band and
+ *         every band is within the limits.
+ * @param  preset: as received
+ * @retval true if it can be applied as a whole
+ */
+bool EqControlRequest_IsValidPreset(const EqControlPreset* preset)
+{
+  if(preset->version != EQ_CONTROL_PROTOCOL_VERSION || preset->bandCount != EQ_CONTROL_BANDS)
+    return false;
+
+  for(uint8_t i = 0; i < EQ_CONTROL_BANDS; i++)
+  {
+    if(!EqControlRequest_IsValidBand(&preset->bands[i]))
+      return false;
+  }
+
+  return true;
+}
+
+/**
+ * @brief  Tells whether a FIR load is of this version, for a channel that
+ *         exists and within the taps the board takes.
+ * @param  fir: as received
+ * @param  maxTaps: firMaxTaps of the info
+ * @retval true if it can be loaded
+ */
+bool EqControlRequest_IsValidFir(const EqControlFir* fir, uint32_t maxTaps)
+{
+  return fir->version == EQ_CONTROL_PROTOCOL_VERSION && fir->channel < EQ_CONTROL_CHANNELS &&
+         fir->tapCount <= maxTaps;
+}
+
+/**
+ * @brief  Tells whether the dynamics are within the limits, whether their
+ *         stage is on or not.
+ * @param  dynamics: as received
+ * @retval true if they can be applied
+ */
+bool EqControlRequest_IsValidDynamics(const EqControlDynamics* dynamics)
+{
+  return (dynamics->flags & ~(EQ_CONTROL_DYNAMICS_LIMITER | EQ_CONTROL_DYNAMICS_COMPRESSOR)) == 0 &&
+         dynamics->ceiling >= EQ_CONTROL_CEILING_MIN && dynamics->ceiling <= EQ_CONTROL_CEILING_MAX &&
+         dynamics->threshold >= EQ_CONTROL_THRESHOLD_MIN && dynamics->threshold <= EQ_CONTROL_THRESHOLD_MAX &&
+         dynamics->ratio >= EQ_CONTROL_RATIO_MIN && dynamics->ratio <= EQ_CONTROL_RATIO_MAX &&
+         dynamics->makeup >= EQ_CONTROL_MAKEUP_MIN && dynamics->makeup <= EQ_CONTROL_MAKEUP_MAX &&
+         dynamics->limiterRelease >= EQ_CONTROL_TIME_MIN && dynamics->limiterRelease <= EQ_CONTROL_TIME_MAX &&
+         dynamics->attack >= EQ_CONTROL_TIME_MIN && dynamics->attack <= EQ_CONTROL_TIME_MAX &&
+         dynamics->release >= EQ_CONTROL_TIME_MIN && dynamics->release <= EQ_CONTROL_TIME_MAX;
+}
@@ -0,0 +1,86 @@
+/**
+  ******************************************************************************
+  * @file    flash_journal.h
+  * @brief   Append-only record journal over two flash sectors. A save
+  *          programs one small record after the last one; nothing is erased
+  *          until the active sector is full. Then the newest record of each
+  *          key is copied to the other sector, which is erased first, and
+  *          that sector becomes the active one. The sectors take turns, so
+  *          they wear evenly.
+  *
+  *          A record is a header (sequence, key, length, CRC-32) and its
+  *          payload, in whole slots of FLASH_JOURNAL_SLOT_SIZE bytes. The
+  *          header is programmed first, so the scan can step over a record
+  *          cut by a power loss. Slot 0 of a sector holds its own header
+  *          record, with the erase count of each sector, programmed last
+  *          when the sector is filled by a collection: a sector without one
+  *          is ignored.
+  *
+  *          Nothing waits for the flash. A save is queued in RAM, the newest
+  *          one per key, and FlashJournal_Process writes the queue one step
+  *          at a time: it starts an erase or a record and returns, and checks
+  *          it on a later call once the backend is idle. The sector a
+  *          collection leaves behind is erased then, so the next collection
+  *          does not wait for an erase. Erases can be held back while
+  *          they would stall the program, the records still go in.
+  *
+  *          Flash is read in place; erase and program come from the backend,
+  *          the last 512 KB of the flash on the board (flash_journal_stm32.c),
+  *          RAM on the host. A backend may finish an operation before its
+  *          start function returns.
+  ******************************************************************************
+  */
+
+// define to prevent recursive inclusion ---------------------------------------
+#ifndef __FLASH_JOURNAL_H__
+#define __FLASH_JOURNAL_H__
+
+// includes --------------------------------------------------------------------
+#include <stdbool.h>
+#include <stdint.h>
+
+// defines ---------------------------------------------------------------------
+#define FLASH_JOURNAL_SECTORS       2
+#define FLASH_JOURNAL_SECTOR_SIZE   (256 * 1024)
+// a cache line, the D-cache is invalidated per slot after programming
+#define FLASH_JOURNAL_SLOT_SIZE     32
+#define FLASH_JOURNAL_HEADER_SIZE   12
+// room for a preset with its coefficients for two sample rates
+#define FLASH_JOURNAL_MAX_PAYLOAD   (16 * FLASH_JOURNAL_SLOT_SIZE - FLASH_JOURNAL_HEADER_SIZE)
+// keys are 0 to FLASH_JOURNAL_MAX_KEYS - 1
+#define FLASH_JOURNAL_MAX_KEYS      8
+// below every audio and display interrupt
+#define FLASH_JOURNAL_IRQ_PREPRIO   14
+
+// typedefs --------------------------------------------------------------------
+typedef struct FlashJournalStats
+{
+  uint32_t appends;
+  uint32_t coalesced;                 // saves replaced by a newer one before written
+  uint32_t collections;
+  uint32_t failures;                  // erases or programs that did not verify
+  uint32_t skipped;                   // cut or corrupt records found by the scan
+  uint32_t eraseCount[FLASH_JOURNAL_SECTORS]; // over the life of each sector
+  uint32_t usedBytes;                 // of the active sector
+  int8_t   activeSector;              // -1 before the first append
+} FlashJournalStats;
+
+// function prototypes ---------------------------------------------------------
+void     FlashJournal_Init(void);
+bool     FlashJournal_Append(uint8_t key, const void* payload, uint16_t length);
+void     FlashJournal_Process(void);
+void     FlashJournal_HoldErase(bool hold);
+bool     FlashJournal_IsIdle(void);
+uint16_t FlashJournal_Read(uint8_t key, void* payload, uint16_t capacity);
+void     FlashJournal_GetStats(FlashJournalStats* stats);
+
+// backend, implemented by flash_journal_stm32.c; errors show when the core
+// reads the result back
+bool           FlashJournalBackend_Init(void);
+const uint8_t* FlashJournalBackend_Sector(uint8_t sector);
+void           FlashJournalBackend_StartErase(uint8_t sector);
+void           FlashJournalBackend_StartProgram(uint8_t sector, uint32_t offset, const uint32_t* words, uint32_t count);
+bool           FlashJournalBackend_IsBusy(void);
+void           FlashJournalBackend_IrqHandler(void);
+
+#endif // __FLASH_JOURNAL_H__
@@ -2,14 +2,22 @@
 #define __FLASH_PERSISTENCE_H
 
 // includes 
+#include <stdbool.h>
 #include <stdint.h>
 #include "stm32f7xx_hal.h"
 
+// start of the flash journal, where the old format kept its knob words
 #define FLASH_USER_START_ADDR 0x08180000
+// journal key of the knob positions, one uint16_t per slider; the presets
+// follow it, see preset_store.h
+#define FLASH_PERSISTENCE_KEY_KNOBS 0
 
 void FlashPersistence_Write();
+void FlashPersistence_Process();
+void FlashPersistence_SetStreaming(bool streaming);
 void FlashPersistence_Restore();
+void FlashPersistence_RecallCoefficients();
 uint16_t FlashPersistence_Read(uint8_t position);
 
 
-#endif // __FLASH_PERSISTENCE_H
\ No newline at end of file
+#endif // __FLASH_PERSISTENCE_H
@@ -0,0 +1,71 @@
+/**
+  ******************************************************************************
+  * @file    preset_store.h
+  * @brief   Named EQ presets, one flash journal record per slot. A preset
+  *          keeps its gains together with the biquad coefficients computed
+  *          from them for each sample rate the build plays, so a recall is a
+  *          copy into the live filters, without pow, sin or sinh. The journal
+  *          checks the record with its CRC-32.
+  *
+  *          The record starts with a version, and every version keeps the
+  *          fields up to the gains where they are. A record from an older
+  *          version, or computed for other sample rates or another band
+  *          layout, is recomputed from its gains when recalled and written
+  *          back, so it happens once. A record from a newer version is left
+  *          alone and the slot reads as empty.
+  ******************************************************************************
+  */
+
+// define to prevent recursive inclusion ---------------------------------------
+#ifndef __PRESET_STORE_H__
+#define __PRESET_STORE_H__
+
+// includes --------------------------------------------------------------------
+#include <stdbool.h>
+#include <stdint.h>
+#include "audio_user_dsp.h"
+#include "usb_audio.h"
+
+// defines ---------------------------------------------------------------------
+#define PRESET_STORE_VERSION        1
+// journal key of slot 0, key 0 holds the knob positions (flash_persistence.h)
+#define PRESET_STORE_FIRST_KEY      1
+#define PRESET_STORE_SLOTS          7
+// written by the save button and loaded at boot, the others are named presets
+#define PRESET_STORE_WORKING        0
+#define PRESET_STORE_NAME_LENGTH    12
+#define PRESET_STORE_RATES          USB_AUDIO_CONFIG_PLAY_FREQ_COUNT
+
+// typedefs --------------------------------------------------------------------
+typedef enum PresetStoreStatus
+{
+  PRESET_STORE_EMPTY,                 // nothing in the slot, or a newer version
+  PRESET_STORE_RECALLED,              // coefficients copied as stored
+  PRESET_STORE_MIGRATED,              // recomputed from the gains and saved again
+} PresetStoreStatus;
+
+typedef struct PresetCoefficients
+{
+  uint32_t           sampleRate;
+  BiquadCoefficients bands[NUMBER_OF_BANDS];
+} PresetCoefficients;
+
+// the record, as many coefficient sets as rateCount says
+typedef struct Preset
+{
+  uint16_t           version;
+  uint16_t           rateCount;
+  char               name[PRESET_STORE_NAME_LENGTH]; // not terminated when full
+  int16_t            gains[NUMBER_OF_BANDS];         // dB
+  // band layout the coefficients were computed for
+  int16_t            frequencies[NUMBER_OF_BANDS];
+  int16_t            bandwidths[NUMBER_OF_BANDS];
+  PresetCoefficients coefficients[PRESET_STORE_RATES];
+} Preset;
+
+// function prototypes ---------------------------------------------------------
+bool              PresetStore_Save(uint8_t slot, const char* name, const int16_t* gains);
+PresetStoreStatus PresetStore_Recall(uint8_t slot, uint32_t sampleRate, int16_t* gains);
+bool              PresetStore_Read(uint8_t slot, Preset* preset);
+
+#endif // __PRESET_STORE_H__
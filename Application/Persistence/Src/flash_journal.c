@@ -0,0 +1,549 @@
+/**
+  ******************************************************************************
+  * @file    flash_journal.c
+  * @brief   Record journal over two flash sectors. Hardware independent: the
+  *          sectors are read in place, erased and programmed by the backend.
+  *          Every record is checked once, by the scan at init; the newest
+  *          record of each key is then found from its offset. Writes run as
+  *          a sequence of steps, one flash operation each, see
+  *          FlashJournal_Advance.
+  ******************************************************************************
+  */
+
+#include "flash_journal.h"
+#include <stddef.h>
+#include <string.h>
+
+// private defines -------------------------------------------------------------
+#define FLASH_JOURNAL_KEY_SECTOR    0xFFF0      // header record of a sector
+#define FLASH_JOURNAL_NONE          0xFFFFFFFF  // offset of a key never written
+#define FLASH_JOURNAL_MAX_WORDS     ((FLASH_JOURNAL_HEADER_SIZE + FLASH_JOURNAL_MAX_PAYLOAD + 3) / 4)
+
+#if (FLASH_JOURNAL_SLOT_SIZE % 4) != 0 || FLASH_JOURNAL_SLOT_SIZE < FLASH_JOURNAL_HEADER_SIZE + 4
+#error "FLASH_JOURNAL_SLOT_SIZE must be whole words and hold a header and a word"
+#endif
+
+// private typedefs ------------------------------------------------------------
+typedef struct FlashJournalHeader
+{
+  uint32_t sequence;                  // one more than the record appended before
+  uint16_t key;
+  uint16_t length;                    // payload bytes
+  uint32_t crc;                       // CRC-32 of the fields above and the payload
+} FlashJournalHeader;
+
+// flash operation in progress
+typedef enum FlashJournalStep
+{
+  FLASH_JOURNAL_IDLE,
+  FLASH_JOURNAL_ERASE,                // the target of a collection
+  FLASH_JOURNAL_COPY,                 // a record into the target
+  FLASH_JOURNAL_SECTOR_HEADER,        // the header of the target, last
+  FLASH_JOURNAL_APPEND,               // a queued record
+  FLASH_JOURNAL_ERASE_SPARE,          // the sector the last collection left
+} FlashJournalStep;
+
+// private variables -----------------------------------------------------------
+static FlashJournalStats stats;
+static int8_t            active = -1;
+static uint32_t          freeOffset = 0;  // after the last record of the active sector
+static uint32_t          nextSequence = 0;
+// newest record of each key in the active sector
+static uint32_t          keyOffset[FLASH_JOURNAL_MAX_KEYS];
+static uint32_t          keySequence[FLASH_JOURNAL_MAX_KEYS];
+
+// saves not written yet, the newest per key
+static uint32_t          queued[FLASH_JOURNAL_MAX_KEYS][(FLASH_JOURNAL_MAX_PAYLOAD + 3) / 4];
+static uint16_t          queuedLength[FLASH_JOURNAL_MAX_KEYS];
+static uint8_t           queuedKeys = 0;  // one bit per key
+static bool              spareStale = false;
+// set while an erase would stall the program, see FlashJournal_HoldErase
+static volatile bool     eraseHeld = false;
+
+// the step in progress and what it programs, read by the backend until done
+static FlashJournalStep  step = FLASH_JOURNAL_IDLE;
+static uint32_t          words[FLASH_JOURNAL_MAX_WORDS];
+static uint8_t           stepSector;
+static uint32_t          stepOffset;
+static uint32_t          stepLength;      // bytes to read back
+static uint8_t           stepKey;
+// collection: next key to copy, where it goes, and the offsets in the target
+static uint8_t           copyKey;
+static uint32_t          copyOffset;
+static uint32_t          newOffset[FLASH_JOURNAL_MAX_KEYS];
+
+// private function declarations -----------------------------------------------
+static void     FlashJournal_Scan(uint8_t sector);
+static bool     FlashJournal_Advance(void);
+static bool     FlashJournal_StartNext(void);
+static bool     FlashJournal_StartCollect(uint8_t target);
+static bool     FlashJournal_StartCopy(void);
+static void     FlashJournal_StartErase(FlashJournalStep eraseStep, uint8_t sector);
+static void     FlashJournal_StartProgram(FlashJournalStep programStep, uint8_t sector, uint32_t offset, uint32_t length);
+static uint32_t FlashJournal_Build(uint16_t key, const void* payload, uint16_t length);
+static bool     FlashJournal_IsValid(const uint8_t* record, FlashJournalHeader* header);
+static bool     FlashJournal_IsErased(const uint8_t* data, uint32_t length);
+static uint32_t FlashJournal_Size(uint16_t length);
+static uint32_t FlashJournal_Crc32(uint32_t crc, const uint8_t* data, uint32_t length);
+
+/**
+ * @brief  Finds the active sector, the sector with a header and the highest
+ *         sequence, and scans its records once. Nothing is written: a blank
+ *         journal gets its first sector at the first append. Drops the
+ *         queue; the backend must be idle.
+ * @param  None
+ * @retval None
+ */
+void FlashJournal_Init(void)
+{
+  FlashJournalHeader header;
+  uint32_t sequence[FLASH_JOURNAL_SECTORS] = {0};
+
+  stats = (FlashJournalStats){0};
+  active = -1;
+  freeOffset = 0;
+  nextSequence = 0;
+  queuedKeys = 0;
+  spareStale = false;
+  step = FLASH_JOURNAL_IDLE;
+  for(uint8_t i = 0; i < FLASH_JOURNAL_MAX_KEYS; i++)
+    keyOffset[i] = FLASH_JOURNAL_NONE;
+
+  for(uint8_t s = 0; s < FLASH_JOURNAL_SECTORS; s++)
+  {
+    const uint8_t* sector = FlashJournalBackend_Sector(s);
+
+    if(!FlashJournal_IsValid(sector, &header) || header.key != FLASH_JOURNAL_KEY_SECTOR ||
+       header.length != sizeof(stats.eraseCount))
+      continue;
+
+    sequence[s] = header.sequence;
+    if(active < 0 || sequence[s] > sequence[active])
+      active = s;
+  }
+
+  if(active < 0)
+    return;
+
+  // the newest header has the counts of both sectors
+  memcpy(stats.eraseCount, FlashJournalBackend_Sector(active) + FLASH_JOURNAL_HEADER_SIZE, sizeof(stats.eraseCount));
+  nextSequence = sequence[active] + 1;
+  FlashJournal_Scan(active);
+
+  // left by a collection cut before the erase that follows it
+  spareStale = !FlashJournal_IsErased(FlashJournalBackend_Sector(1 - active), FLASH_JOURNAL_SECTOR_SIZE);
+}
+
+/**
+ * @brief  Queues a record and starts writing it unless a flash operation is
+ *         in progress. A record queued earlier for the key and not written
+ *         yet is replaced.
+ * @param  key: 0 to FLASH_JOURNAL_MAX_KEYS - 1
+ * @param  payload: record data, copied
+ * @param  length: bytes, at most FLASH_JOURNAL_MAX_PAYLOAD
+ * @retval false if the key or the length is out of range; a write that
+ *         fails later is counted in the stats, the last stored record stays
+ */
+bool FlashJournal_Append(uint8_t key, const void* payload, uint16_t length)
+{
+  if(key >= FLASH_JOURNAL_MAX_KEYS || length > FLASH_JOURNAL_MAX_PAYLOAD)
+    return false;
+
+  if(queuedKeys & (1 << key))
+    stats.coalesced++;
+
+  memcpy(queued[key], payload, length);
+  queuedLength[key] = length;
+  queuedKeys |= 1 << key;
+
+  FlashJournal_Process();
+  return true;
+}
+
+/**
+ * @brief  Checks the operation the backend finished and starts the next one,
+ *         until the backend is busy or nothing is left to write. Called from
+ *         the main loop; returns at once while the flash is busy.
+ * @param  None
+ * @retval None
+ */
+void FlashJournal_Process(void)
+{
+  while(!FlashJournalBackend_IsBusy() && FlashJournal_Advance())
+    ;
+}
+
+/**
+ * @brief  Holds the erases back, or lets them go. While held the journal
+ *         keeps appending to the active sector but starts no erase: the
+ *         spare sector stays stale, and a save that needs a collection into
+ *         a sector that is not blank stays queued. An erase in progress
+ *         ends. Kept by FlashJournal_Init; may be called from an interrupt.
+ * @param  hold: true to hold the erases
+ * @retval None
+ */
+void FlashJournal_HoldErase(bool hold)
+{
+  eraseHeld = hold;
+}
+
+// nothing queued and no flash operation in progress
+bool FlashJournal_IsIdle(void)
+{
+  return step == FLASH_JOURNAL_IDLE && queuedKeys == 0 && !spareStale && !FlashJournalBackend_IsBusy();
+}
+
+/**
+ * @brief  Newest record of a key, a queued one included.
+ * @param  key: 0 to FLASH_JOURNAL_MAX_KEYS - 1
+ * @param  payload: receives at most capacity bytes of it
+ * @param  capacity: size of payload
+ * @retval length of the record, 0 if there is none
+ */
+uint16_t FlashJournal_Read(uint8_t key, void* payload, uint16_t capacity)
+{
+  FlashJournalHeader header;
+  const uint8_t* record;
+
+  if(key >= FLASH_JOURNAL_MAX_KEYS)
+    return 0;
+
+  if(queuedKeys & (1 << key))
+  {
+    memcpy(payload, queued[key], (queuedLength[key] < capacity) ? queuedLength[key] : capacity);
+    return queuedLength[key];
+  }
+
+  // being programmed, the flash may hold part of it
+  if(step == FLASH_JOURNAL_APPEND && stepKey == key)
+    record = (const uint8_t*)words;
+  else if(active >= 0 && keyOffset[key] != FLASH_JOURNAL_NONE)
+    record = FlashJournalBackend_Sector(active) + keyOffset[key];
+  else
+    return 0;
+
+  memcpy(&header, record, FLASH_JOURNAL_HEADER_SIZE);
+  memcpy(payload, record + FLASH_JOURNAL_HEADER_SIZE, (header.length < capacity) ? header.length : capacity);
+
+  return header.length;
+}
+
+void FlashJournal_GetStats(FlashJournalStats* journalStats)
+{
+  *journalStats = stats;
+  journalStats->usedBytes = (active >= 0) ? freeOffset : 0;
+  journalStats->activeSector = active;
+}
+
+/**
+ * @brief  Walks the records of a sector up to the first erased slot. A
+ *         record that fails its check is skipped, by its length if that is
+ *         plausible, else by one slot.
+ * @param  sector: the active sector
+ * @retval None
+ */
+static void FlashJournal_Scan(uint8_t sector)
+{
+  const uint8_t* base = FlashJournalBackend_Sector(sector);
+  uint32_t offset = FLASH_JOURNAL_SLOT_SIZE;
+
+  while(offset < FLASH_JOURNAL_SECTOR_SIZE && !FlashJournal_IsErased(base + offset, FLASH_JOURNAL_SLOT_SIZE))
+  {
+    FlashJournalHeader header;
+    bool valid = FlashJournal_IsValid(base + offset, &header);
+    uint32_t size = (header.length <= FLASH_JOURNAL_MAX_PAYLOAD) ? FlashJournal_Size(header.length) : FLASH_JOURNAL_SLOT_SIZE;
+
+    if(valid && header.key < FLASH_JOURNAL_MAX_KEYS && offset + size <= FLASH_JOURNAL_SECTOR_SIZE)
+    {
+      if(keyOffset[header.key] == FLASH_JOURNAL_NONE || header.sequence > keySequence[header.key])
+      {
+        keyOffset[header.key] = offset;
+        keySequence[header.key] = header.sequence;
+      }
+      if(header.sequence >= nextSequence)
+        nextSequence = header.sequence + 1;
+    }
+    else
+      stats.skipped++;
+
+    offset += size;
+  }
+
+  freeOffset = (offset < FLASH_JOURNAL_SECTOR_SIZE) ? offset : FLASH_JOURNAL_SECTOR_SIZE;
+}
+
+/**
+ * @brief  Checks the step the backend finished, then starts the next one.
+ *         A collection is ERASE (unless the target is blank), one COPY per
+ *         key, then SECTOR_HEADER, which switches the active sector; a
+ *         queued record is one APPEND. A step that does not read back drops
+ *         what it was writing: a failed collection drops the queue.
+ * @param  None
+ * @retval false once idle
+ */
+static bool FlashJournal_Advance(void)
+{
+  const uint8_t* sector = FlashJournalBackend_Sector(stepSector);
+  FlashJournalStep done = step;
+  bool ok;
+
+  if(done == FLASH_JOURNAL_IDLE)
+    return FlashJournal_StartNext();
+
+  if(done == FLASH_JOURNAL_ERASE || done == FLASH_JOURNAL_ERASE_SPARE)
+    ok = FlashJournal_IsErased(sector, FLASH_JOURNAL_SECTOR_SIZE);
+  else
+    ok = memcmp(sector + stepOffset, words, stepLength) == 0;
+
+  step = FLASH_JOURNAL_IDLE;
+  if(!ok)
+  {
+    stats.failures++;
+    // not retried, the next collection erases the spare again
+    if(done == FLASH_JOURNAL_ERASE_SPARE)
+      spareStale = false;
+    else if(done != FLASH_JOURNAL_APPEND)
+      queuedKeys = 0;
+    return true;
+  }
+
+  switch(done)
+  {
+    case FLASH_JOURNAL_ERASE:
+    case FLASH_JOURNAL_COPY:
+      return FlashJournal_StartCopy();
+
+    case FLASH_JOURNAL_SECTOR_HEADER:
+      // the old sector is erased next, its header counted it already
+      if(active >= 0)
+      {
+        stats.eraseCount[active]++;
+        spareStale = true;
+      }
+      active = stepSector;
+      freeOffset = copyOffset;
+      memcpy(keyOffset, newOffset, sizeof(keyOffset));
+      break;
+
+    case FLASH_JOURNAL_APPEND:
+      keyOffset[stepKey] = stepOffset;
+      keySequence[stepKey] = words[0];   // the sequence opens the header
+      stats.appends++;
+      break;
+
+    case FLASH_JOURNAL_ERASE_SPARE:
+      spareStale = false;
+      break;
+
+    default:
+      break;
+  }
+
+  return true;
+}
+
+/**
+ * @brief  Starts the next write from idle: the lowest queued key, after a
+ *         collection if the active sector has no room for it; else the
+ *         erase of a stale spare sector, unless the erases are held.
+ * @param  None
+ * @retval false if there is nothing to do, or only what waits for an erase
+ */
+static bool FlashJournal_StartNext(void)
+{
+  uint8_t key = 0;
+
+  if(queuedKeys == 0)
+  {
+    if(!spareStale || eraseHeld)
+      return false;
+
+    FlashJournal_StartErase(FLASH_JOURNAL_ERASE_SPARE, 1 - active);
+    return true;
+  }
+
+  while(!(queuedKeys & (1 << key)))
+    key++;
+
+  uint32_t size = FlashJournal_Size(queuedLength[key]);
+
+  if(active < 0)
+    return FlashJournal_StartCollect(0);
+
+  if(freeOffset + size > FLASH_JOURNAL_SECTOR_SIZE)
+    return FlashJournal_StartCollect(1 - active);
+
+  // the slots are used even if programming fails, they are no longer erased
+  uint32_t length = FlashJournal_Build(key, queued[key], queuedLength[key]);
+  queuedKeys &= ~(1 << key);
+  stepKey = key;
+  FlashJournal_StartProgram(FLASH_JOURNAL_APPEND, active, freeOffset, length);
+  freeOffset += size;
+  return true;
+}
+
+/**
+ * @brief  Starts making a sector the active one: erases it unless blank,
+ *         then copies the newest record of each key from the active sector,
+ *         if any, then programs its header. A power loss before the header
+ *         leaves the old sector active. Waits while the erases are held
+ *         and the target needs one; a stale spare is known not to be blank.
+ * @param  target: sector to fill
+ * @retval false if it waits
+ */
+static bool FlashJournal_StartCollect(uint8_t target)
+{
+  if(eraseHeld && (spareStale || !FlashJournal_IsErased(FlashJournalBackend_Sector(target), FLASH_JOURNAL_SECTOR_SIZE)))
+    return false;
+
+  if(active >= 0)
+    stats.collections++;
+
+  stepSector = target;
+  copyKey = 0;
+  copyOffset = FLASH_JOURNAL_SLOT_SIZE;
+
+  if(!FlashJournal_IsErased(FlashJournalBackend_Sector(target), FLASH_JOURNAL_SECTOR_SIZE))
+  {
+    stats.eraseCount[target]++;
+    FlashJournal_StartErase(FLASH_JOURNAL_ERASE, target);
+    return true;
+  }
+
+  return FlashJournal_StartCopy();
+}
+
+/**
+ * @brief  Copies the next key of the collection into its target, as is,
+ *         sequence and CRC included; after the last key, programs the
+ *         header of the target.
+ * @param  None
+ * @retval true
+ */
+static bool FlashJournal_StartCopy(void)
+{
+  uint8_t target = stepSector;
+
+  while(copyKey < FLASH_JOURNAL_MAX_KEYS && (active < 0 || keyOffset[copyKey] == FLASH_JOURNAL_NONE))
+    newOffset[copyKey++] = FLASH_JOURNAL_NONE;
+
+  if(copyKey == FLASH_JOURNAL_MAX_KEYS)
+  {
+    uint32_t eraseCount[FLASH_JOURNAL_SECTORS];
+
+    // counting the erase of the sector left behind, which follows
+    memcpy(eraseCount, stats.eraseCount, sizeof(eraseCount));
+    if(active >= 0)
+      eraseCount[active]++;
+
+    uint32_t length = FlashJournal_Build(FLASH_JOURNAL_KEY_SECTOR, eraseCount, sizeof(eraseCount));
+    FlashJournal_StartProgram(FLASH_JOURNAL_SECTOR_HEADER, target, 0, length);
+    return true;
+  }
+
+  const uint8_t* record = FlashJournalBackend_Sector(active) + keyOffset[copyKey];
+  FlashJournalHeader header;
+  memcpy(&header, record, FLASH_JOURNAL_HEADER_SIZE);
+  uint32_t length = FLASH_JOURNAL_HEADER_SIZE + header.length;
+
+  memset(words, 0xFF, sizeof(words));
+  memcpy(words, record, length);
+  newOffset[copyKey++] = copyOffset;
+  FlashJournal_StartProgram(FLASH_JOURNAL_COPY, target, copyOffset, length);
+  copyOffset += FlashJournal_Size(header.length);
+  return true;
+}
+
+static void FlashJournal_StartErase(FlashJournalStep eraseStep, uint8_t sector)
+{
+  step = eraseStep;
+  stepSector = sector;
+  FlashJournalBackend_StartErase(sector);
+}
+
+static void FlashJournal_StartProgram(FlashJournalStep programStep, uint8_t sector, uint32_t offset, uint32_t length)
+{
+  step = programStep;
+  stepSector = sector;
+  stepOffset = offset;
+  stepLength = length;
+  FlashJournalBackend_StartProgram(sector, offset, words, (length + 3) / 4);
+}
+
+/**
+ * @brief  Builds a record with the next sequence in words, header first.
+ * @param  key: record key
+ * @param  payload, length: record data
+ * @retval bytes of the record
+ */
+static uint32_t FlashJournal_Build(uint16_t key, const void* payload, uint16_t length)
+{
+  uint8_t* bytes = (uint8_t*)words;
+  FlashJournalHeader header = { nextSequence++, key, length, 0 };
+
+  memset(words, 0xFF, sizeof(words));
+  memcpy(bytes + FLASH_JOURNAL_HEADER_SIZE, payload, length);
+  header.crc = FlashJournal_Crc32(0, (const uint8_t*)&header, offsetof(FlashJournalHeader, crc));
+  header.crc = FlashJournal_Crc32(header.crc, bytes + FLASH_JOURNAL_HEADER_SIZE, length);
+  memcpy(bytes, &header, FLASH_JOURNAL_HEADER_SIZE);
+
+  return FLASH_JOURNAL_HEADER_SIZE + length;
+}
+
+/**
+ * @brief  Checks the length and the CRC of a record.
+ * @param  record: in flash
+ * @param  header: receives its header, even if invalid
+ * @retval true if the record is whole
+ */
+static bool FlashJournal_IsValid(const uint8_t* record, FlashJournalHeader* header)
+{
+  memcpy(header, record, FLASH_JOURNAL_HEADER_SIZE);
+
+  if(header->length > FLASH_JOURNAL_MAX_PAYLOAD)
+    return false;
+
+  uint32_t crc = FlashJournal_Crc32(0, record, offsetof(FlashJournalHeader, crc));
+  crc = FlashJournal_Crc32(crc, record + FLASH_JOURNAL_HEADER_SIZE, header->length);
+  return crc == header->crc;
+}
+
+static bool FlashJournal_IsErased(const uint8_t* data, uint32_t length)
+{
+  const uint32_t* words = (const uint32_t*)data;
+
+  for(uint32_t i = 0; i < length / 4; i++)
+  {
+    if(words[i] != 0xFFFFFFFF)
+      return false;
+  }
+
+  return true;
+}
+
+// bytes taken by a record, in whole slots
+static uint32_t FlashJournal_Size(uint16_t length)
+{
+  return (FLASH_JOURNAL_HEADER_SIZE + length + FLASH_JOURNAL_SLOT_SIZE - 1) / FLASH_JOURNAL_SLOT_SIZE * FLASH_JOURNAL_SLOT_SIZE;
+}
+
+/**
+ * @brief  CRC-32 (poly 0xEDB88320 reflected, init and final xor 0xFFFFFFFF),
+ *         bitwise to stay small; records are short.
+ * @param  crc: 0, or the CRC of the data before
+ * @param  data: bytes to check
+ * @param  length: number of bytes
+ * @retval crc
+ */
+static uint32_t FlashJournal_Crc32(uint32_t crc, const uint8_t* data, uint32_t length)
+{
+  crc = ~crc;
+  for(uint32_t i = 0; i < length; i++)
+  {
+    crc ^= data[i];
+    for(uint8_t bit = 0; bit < 8; bit++)
+      crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+  }
+
+  return ~crc;
+}
@@ -0,0 +1,180 @@
+/**
+  ******************************************************************************
+  * @file    flash_journal_stm32.c
+  * @brief   Board backend of the flash journal: the last 512 KB of the flash,
+  *          out of the 1 MB the linker script gives the program.
+  *
+  *          With the nDBANK option bit cleared the 2 MB flash is two banks
+  *          of 1 MB: the program runs from bank 1 and the journal is in
+  *          bank 2, sectors 20 to 23 of 128 KB, two per journal sector.
+  *          Bank 1 keeps serving fetches while bank 2 erases or programs,
+  *          so no interrupt waits for the flash. The option bit is set with
+  *          STM32CubeProgrammer before the program is loaded; the firmware
+  *          does not change it, the other layout needs a mass erase.
+  *
+  *          In single bank mode (the factory setting) the journal is sectors
+  *          10 and 11 of 256 KB, and any fetch stalls while the flash is
+  *          busy: up to 16 us per word, about a second per erase. Records
+  *          are a few hundred words, but an erase would stall a stream, so
+  *          flash_persistence.c holds the erases while one is open.
+  *
+  *          Both modes run from the flash interrupt: an erase with
+  *          HAL_FLASHEx_Erase_IT, a record one word per interrupt, so the
+  *          main loop never waits either. The flash is cacheable, so the
+  *          lines of what changed are invalidated when it is done.
+  ******************************************************************************
+  */
+
+#include "flash_journal.h"
+#include "stm32f7xx_hal.h"
+
+// private defines -------------------------------------------------------------
+#define FLASH_JOURNAL_ADDRESS       0x08180000
+#define FLASH_JOURNAL_SINGLE_SECTOR FLASH_SECTOR_10
+#define FLASH_JOURNAL_DUAL_SECTOR   FLASH_SECTOR_20
+// physical sectors per journal sector in dual bank mode
+#define FLASH_JOURNAL_DUAL_SECTORS  (FLASH_JOURNAL_SECTOR_SIZE / (128 * 1024))
+
+// private variables -----------------------------------------------------------
+static bool              dualBank = false;
+static volatile bool     busy = false;
+// operation in progress, written before it starts, read by the interrupt
+static uint32_t          operationAddress;
+static uint32_t          operationLength;
+static const uint32_t*   programWords;
+static uint32_t          programIndex;
+static volatile bool     operationEnded;
+static volatile bool     operationFailed;
+
+// private function declarations -----------------------------------------------
+static void FlashJournal_ProgramWord(void);
+static void FlashJournal_Finish(void);
+
+/**
+ * @brief  Reads the bank mode and enables the flash interrupt.
+ * @param  None
+ * @retval true in dual bank mode, where the journal never stalls the program
+ */
+bool FlashJournalBackend_Init(void)
+{
+  dualBank = (FLASH->OPTCR & FLASH_OPTCR_nDBANK) == 0;
+
+  HAL_NVIC_SetPriority(FLASH_IRQn, FLASH_JOURNAL_IRQ_PREPRIO, 0);
+  HAL_NVIC_EnableIRQ(FLASH_IRQn);
+
+  return dualBank;
+}
+
+const uint8_t* FlashJournalBackend_Sector(uint8_t sector)
+{
+  return (const uint8_t*)(FLASH_JOURNAL_ADDRESS + sector * FLASH_JOURNAL_SECTOR_SIZE);
+}
+
+/**
+ * @brief  Starts erasing a sector; the flash interrupt ends it.
+ * @param  sector: journal sector, 0 or 1
+ * @retval None
+ */
+void FlashJournalBackend_StartErase(uint8_t sector)
+{
+  FLASH_EraseInitTypeDef eraseInit = {0};
+
+  eraseInit.TypeErase = FLASH_TYPEERASE_SECTORS;
+  eraseInit.Sector = dualBank ? FLASH_JOURNAL_DUAL_SECTOR + sector * FLASH_JOURNAL_DUAL_SECTORS :
+    FLASH_JOURNAL_SINGLE_SECTOR + sector;
+  eraseInit.NbSectors = dualBank ? FLASH_JOURNAL_DUAL_SECTORS : 1;
+  eraseInit.VoltageRange = FLASH_VOLTAGE_RANGE_3;
+
+  operationAddress = (uint32_t)FlashJournalBackend_Sector(sector);
+  operationLength = FLASH_JOURNAL_SECTOR_SIZE;
+  programWords = NULL;
+  operationEnded = false;
+  operationFailed = false;
+  busy = true;
+
+  HAL_FLASH_Unlock();
+  if(HAL_FLASHEx_Erase_IT(&eraseInit) != HAL_OK)
+    FlashJournal_Finish();
+}
+
+/**
+ * @brief  Starts programming words in order, one per flash interrupt.
+ * @param  sector: journal sector, 0 or 1
+ * @param  offset: in the sector, word aligned
+ * @param  words: data, must stay valid until the backend is idle
+ * @param  count: number of words
+ * @retval None
+ */
+void FlashJournalBackend_StartProgram(uint8_t sector, uint32_t offset, const uint32_t* words, uint32_t count)
+{
+  operationAddress = (uint32_t)FlashJournalBackend_Sector(sector) + offset;
+  operationLength = 4 * count;
+  programWords = words;
+  programIndex = 0;
+  busy = true;
+
+  HAL_FLASH_Unlock();
+  FlashJournal_ProgramWord();
+}
+
+bool FlashJournalBackend_IsBusy(void)
+{
+  return busy;
+}
+
+/**
+ * @brief  Flash interrupt: lets the HAL end the operation, then programs the
+ *         next word or releases the flash.
+ * @param  None
+ * @retval None
+ */
+void FlashJournalBackend_IrqHandler(void)
+{
+  HAL_FLASH_IRQHandler();
+
+  if(!operationEnded)
+    return;
+
+  if(programWords != NULL && !operationFailed && ++programIndex < operationLength / 4)
+    FlashJournal_ProgramWord();
+  else
+    FlashJournal_Finish();
+}
+
+/**
+ * @brief  Called by HAL_FLASH_IRQHandler after each sector of an erase and
+ *         after a word.
+ * @param  returnValue: 0xFFFFFFFF once the last sector of an erase is done
+ * @retval None
+ */
+void HAL_FLASH_EndOfOperationCallback(uint32_t returnValue)
+{
+  if(programWords != NULL || returnValue == 0xFFFFFFFF)
+    operationEnded = true;
+}
+
+void HAL_FLASH_OperationErrorCallback(uint32_t returnValue)
+{
+  (void)returnValue;
+  operationFailed = true;
+  operationEnded = true;
+}
+
+static void FlashJournal_ProgramWord(void)
+{
+  operationEnded = false;
+  operationFailed = false;
+
+  if(HAL_FLASH_Program_IT(FLASH_TYPEPROGRAM_WORD, operationAddress + 4 * programIndex, programWords[programIndex]) != HAL_OK)
+    FlashJournal_Finish();
+}
+
+// the core reads the result back once busy is cleared
+static void FlashJournal_Finish(void)
+{
+  uint32_t start = operationAddress & ~31u;
+
+  HAL_FLASH_Lock();
+  SCB_InvalidateDCache_by_Addr((uint32_t*)start, (int32_t)(operationAddress + operationLength - start));
+  busy = false;
+}
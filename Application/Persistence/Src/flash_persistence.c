@@ -1,36 +1,138 @@
 #include "flash_persistence.h"
+#include "flash_journal.h"
+#include "preset_store.h"
+#include "audio_user_dsp.h"
 #include "user_lcd.h"
-#include "usbd_core.h"
-extern USBD_HandleTypeDef USBD_Device;
+#include "logger.h"
+#include <string.h>
+
+// knob positions of the last save, what undo goes back to
+static uint16_t savedPositions[NUMBER_OF_SLIDER_BUTTONS];
+// journal failures already logged
+static uint32_t loggedFailures = 0;
+// the flash stalls the program while it erases, see flash_journal_stm32.c
+static bool singleBank = false;
+
+/**
+ * @brief  Queues the knob positions and the working preset, with its
+ *         coefficients, as new journal records; the flash interrupt and
+ *         FlashPersistence_Process write them. Returns at once, even when
+ *         the journal erases.
+ * @param  None
+ * @retval None
+ */
 void FlashPersistence_Write()
 {
-  FLASH_EraseInitTypeDef eraseInitStruct;
-  eraseInitStruct.TypeErase = FLASH_TYPEERASE_SECTORS;
-  eraseInitStruct.Sector = FLASH_SECTOR_10;
-  eraseInitStruct.NbSectors = 1;
-  eraseInitStruct.VoltageRange = FLASH_VOLTAGE_RANGE_3;
-  uint32_t sectorError = 0;
-    
-  USBD_LL_Suspend(&USBD_Device);
-  USBD_Stop(&USBD_Device);
-  HAL_FLASH_Unlock();
-  HAL_FLASHEx_Erase(&eraseInitStruct, &sectorError);
+  int16_t gains[NUMBER_OF_BANDS];
+
   for(uint32_t i = 0; i < NUMBER_OF_SLIDER_BUTTONS; i++)
   {
-    HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD, FLASH_USER_START_ADDR + i*4, sliderKnobs[i].knobY);
+    savedPositions[i] = sliderKnobs[i].knobY;
+    gains[i] = AudioUserDsp_CalculateGain(i, &sliderKnobs[i]);
+  }
+
+  FlashJournal_Append(FLASH_PERSISTENCE_KEY_KNOBS, savedPositions, sizeof(savedPositions));
+  PresetStore_Save(PRESET_STORE_WORKING, "", gains);
+}
+
+/**
+ * @brief  Moves the journal on to its next flash operation once the last one
+ *         is done, and logs the writes that failed. Main loop task.
+ * @param  None
+ * @retval None
+ */
+void FlashPersistence_Process()
+{
+  FlashJournalStats stats;
+
+  FlashJournal_Process();
+
+  FlashJournal_GetStats(&stats);
+  if(stats.failures != loggedFailures)
+  {
+    LOG("\r\nflash: save failed\r\n");
+    loggedFailures = stats.failures;
   }
-  HAL_FLASH_Lock();
-  USBD_LL_Resume(&USBD_Device);
-  USBD_Start(&USBD_Device);
 }
 
+/**
+ * @brief  Holds the journal erases while a stream is open in single bank
+ *         mode, where an erase stalls the audio interrupt for about a
+ *         second; they run once the stream stops. Saves keep going to the
+ *         active sector meanwhile. Called by the speaker node, from the USB
+ *         interrupt.
+ * @param  streaming: true from AUDIO_SpeakerStart to AUDIO_SpeakerStop
+ * @retval None
+ */
+void FlashPersistence_SetStreaming(bool streaming)
+{
+  FlashJournal_HoldErase(singleBank && streaming);
+}
+
+/**
+ * @brief  Loads the knob positions of the last save and copies the
+ *         coefficients of the working preset into the filters. A board saved
+ *         with the old format has its 8 words at the start of the first
+ *         journal sector, taken if they are all on the sliders; without
+ *         either the knobs go to 0 dB. A save from before the presets, or
+ *         cut between its two records, has no working preset for the knobs:
+ *         it is computed once and saved.
+ * @param  None
+ * @retval None
+ */
 void FlashPersistence_Restore()
 {
+  int16_t gains[NUMBER_OF_BANDS];
+  int16_t presetGains[NUMBER_OF_BANDS];
+
+  singleBank = !FlashJournalBackend_Init();
+  if(singleBank)
+    LOG("\r\nflash: single bank, erases wait for the stream to stop\r\n");
+
+  FlashJournal_Init();
+  loggedFailures = 0;
+
+  if(FlashJournal_Read(FLASH_PERSISTENCE_KEY_KNOBS, savedPositions, sizeof(savedPositions)) != sizeof(savedPositions))
+  {
+    const uint32_t* legacy = (const uint32_t*)FlashJournalBackend_Sector(0);
+    bool onSliders = true;
+
+    for(uint32_t i = 0; i < NUMBER_OF_SLIDER_BUTTONS; i++)
+      onSliders &= legacy[i] >= sliderKnobs[i].sliderY && legacy[i] <= sliderKnobs[i].sliderY + sliderKnobs[i].sliderHeight;
+
+    for(uint32_t i = 0; i < NUMBER_OF_SLIDER_BUTTONS; i++)
+      savedPositions[i] = onSliders ? legacy[i] : LCD_TranslateGainToKnobPosition(i, 0);
+  }
+
   for(uint32_t i = 0; i < NUMBER_OF_SLIDER_BUTTONS; i++)
-    sliderKnobs[i].knobY = *(volatile int32_t*)(FLASH_USER_START_ADDR + i*4);
+  {
+    sliderKnobs[i].knobY = savedPositions[i];
+    gains[i] = AudioUserDsp_CalculateGain(i, &sliderKnobs[i]);
+  }
+
+  if(PresetStore_Recall(PRESET_STORE_WORKING, USB_AUDIO_CONFIG_PLAY_DEF_FREQ, presetGains) == PRESET_STORE_EMPTY ||
+     memcmp(presetGains, gains, sizeof(gains)) != 0)
+  {
+    LOG("\r\nflash: computing the working preset\r\n");
+    PresetStore_Save(PRESET_STORE_WORKING, "", gains);
+    PresetStore_Recall(PRESET_STORE_WORKING, USB_AUDIO_CONFIG_PLAY_DEF_FREQ, presetGains);
+  }
+}
+
+/**
+ * @brief  Copies the coefficients of the last save into the filters, what
+ *         undo does with the knobs. No math.
+ * @param  None
+ * @retval None
+ */
+void FlashPersistence_RecallCoefficients()
+{
+  int16_t gains[NUMBER_OF_BANDS];
+
+  PresetStore_Recall(PRESET_STORE_WORKING, USB_AUDIO_CONFIG_PLAY_DEF_FREQ, gains);
 }
 
 uint16_t FlashPersistence_Read(uint8_t position)
 {
-  return *(volatile int32_t*)(FLASH_USER_START_ADDR + position * 4);
+  return savedPositions[position];
 }
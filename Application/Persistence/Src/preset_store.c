@@ -0,0 +1,212 @@
+/**
+  ******************************************************************************
+  * @file    preset_store.c
+  * @brief   EQ presets in the flash journal. The transcendental math runs
+  *          when a preset is saved or migrated, never when it is recalled.
+  ******************************************************************************
+  */
+
+#include "preset_store.h"
+#include "flash_journal.h"
+#include <stddef.h>
+#include <string.h>
+
+// private defines -------------------------------------------------------------
+#define PRESET_STORE_HEADER_SIZE    offsetof(Preset, coefficients)
+#define PRESET_STORE_SIZE(rates)    (PRESET_STORE_HEADER_SIZE + (rates) * sizeof(PresetCoefficients))
+
+#if PRESET_STORE_FIRST_KEY + PRESET_STORE_SLOTS > FLASH_JOURNAL_MAX_KEYS
+#error "the preset slots must fit in the journal keys"
+#endif
+
+_Static_assert(sizeof(Preset) <= FLASH_JOURNAL_MAX_PAYLOAD,
+               "a preset for every enabled sample rate must fit in a journal record");
+
+// private variables -----------------------------------------------------------
+// the sample rates the build plays, in the order of the descriptor
+static const uint32_t presetRates[PRESET_STORE_RATES] = {
+#if USB_AUDIO_CONFIG_PLAY_USE_FREQ_8_K
+  USB_AUDIO_CONFIG_FREQ_8_K,
+#endif
+#if USB_AUDIO_CONFIG_PLAY_USE_FREQ_16_K
+  USB_AUDIO_CONFIG_FREQ_16_K,
+#endif
+#if USB_AUDIO_CONFIG_PLAY_USE_FREQ_32_K
+  USB_AUDIO_CONFIG_FREQ_32_K,
+#endif
+#if USB_AUDIO_CONFIG_PLAY_USE_FREQ_44_1_K
+  USB_AUDIO_CONFIG_FREQ_44_1_K,
+#endif
+#if USB_AUDIO_CONFIG_PLAY_USE_FREQ_48_K
+  USB_AUDIO_CONFIG_FREQ_48_K,
+#endif
+#if USB_AUDIO_CONFIG_PLAY_USE_FREQ_96_K
+  USB_AUDIO_CONFIG_FREQ_96_K,
+#endif
+#if USB_AUDIO_CONFIG_PLAY_USE_FREQ_192_K
+  USB_AUDIO_CONFIG_FREQ_192_K,
+#endif
+};
+
+// record being built or recalled, too big for the stack of a task
+static Preset preset;
+
+extern int16_t frequencies[];
+extern int16_t bandwidths[];
+
+// private function declarations -----------------------------------------------
+static uint16_t PresetStore_Load(uint8_t slot, Preset* target);
+static void PresetStore_Compute(Preset* target);
+static bool PresetStore_IsCurrent(const Preset* source, uint16_t length);
+
+/**
+ * @brief  Computes the coefficients of a preset for every sample rate and
+ *         queues it in the journal.
+ * @param  slot: 0 to PRESET_STORE_SLOTS - 1
+ * @param  name: up to PRESET_STORE_NAME_LENGTH characters
+ * @param  gains: gain of each band in dB
+ * @retval false if the slot does not exist
+ */
+bool PresetStore_Save(uint8_t slot, const char* name, const int16_t* gains)
+{
+  if(slot >= PRESET_STORE_SLOTS)
+    return false;
+
+  memset(&preset, 0, sizeof(preset));
+  for(uint32_t i = 0; i < PRESET_STORE_NAME_LENGTH && name[i] != '\0'; i++)
+    preset.name[i] = name[i];
+  memcpy(preset.gains, gains, sizeof(preset.gains));
+  PresetStore_Compute(&preset);
+
+  return FlashJournal_Append(PRESET_STORE_FIRST_KEY + slot, &preset, PRESET_STORE_SIZE(PRESET_STORE_RATES));
+}
+
+/**
+ * @brief  Loads a preset into the live filters. The coefficients for the
+ *         sample rate are copied as stored; a record that does not match the
+ *         build is recomputed first and saved again.
+ * @param  slot: 0 to PRESET_STORE_SLOTS - 1
+ * @param  sampleRate: of the stream, in Hz
+ * @param  gains: receives the gain of each band in dB, unless empty
+ * @retval what was done
+ */
+PresetStoreStatus PresetStore_Recall(uint8_t slot, uint32_t sampleRate, int16_t* gains)
+{
+  PresetStoreStatus status = PRESET_STORE_RECALLED;
+  const PresetCoefficients* bank = NULL;
+  uint16_t length = PresetStore_Load(slot, &preset);
+
+  if(length == 0)
+    return PRESET_STORE_EMPTY;
+
+  if(!PresetStore_IsCurrent(&preset, length))
+  {
+    PresetStore_Compute(&preset);
+    FlashJournal_Append(PRESET_STORE_FIRST_KEY + slot, &preset, PRESET_STORE_SIZE(PRESET_STORE_RATES));
+    status = PRESET_STORE_MIGRATED;
+  }
+
+  for(uint32_t r = 0; r < PRESET_STORE_RATES; r++)
+  {
+    if(preset.coefficients[r].sampleRate == sampleRate)
+      bank = &preset.coefficients[r];
+  }
+
+  // a rate the build does not play, only a caller mistake gets here
+  if(bank == NULL)
+  {
+    bank = &preset.coefficients[0];
+    for(uint8_t i = 0; i < NUMBER_OF_BANDS; i++)
+      AudioUserDsp_BiquadCoefficients(&preset.coefficients[0].bands[i], preset.gains[i], frequencies[i], bandwidths[i], sampleRate);
+  }
+
+  AudioUserDsp_LoadCoefficients(bank->bands, preset.gains, preset.frequencies, preset.bandwidths);
+  memcpy(gains, preset.gains, sizeof(preset.gains));
+
+  return status;
+}
+
+/**
+ * @brief  Reads the record of a slot as stored, without recomputing it.
+ * @param  slot: 0 to PRESET_STORE_SLOTS - 1
+ * @param  target: receives the record; the coefficient sets past rateCount,
+ *         or past what the build has room for, are not filled
+ * @retval false if the slot is empty, the record is cut short or it comes
+ *         from a newer version
+ */
+bool PresetStore_Read(uint8_t slot, Preset* target)
+{
+  return PresetStore_Load(slot, target) != 0;
+}
+
+/**
+ * @brief  Reads the record of a slot and checks that this version can use it.
+ * @param  slot: 0 to PRESET_STORE_SLOTS - 1
+ * @param  target: receives the record
+ * @retval its length in the journal, 0 if PresetStore_Read would fail
+ */
+static uint16_t PresetStore_Load(uint8_t slot, Preset* target)
+{
+  if(slot >= PRESET_STORE_SLOTS)
+    return 0;
+
+  uint16_t length = FlashJournal_Read(PRESET_STORE_FIRST_KEY + slot, target, sizeof(Preset));
+
+  if(length < PRESET_STORE_HEADER_SIZE || target->version < 1 || target->version > PRESET_STORE_VERSION)
+    return 0;
+
+  return length;
+}
+
+/**
+ * @brief  Sets the version, the band layout and the coefficients of every
+ *         sample rate from the gains.
+ * @param  target: preset with its name and gains set
+ * @retval None
+ */
+static void PresetStore_Compute(Preset* target)
+{
+  target->version = PRESET_STORE_VERSION;
+  target->rateCount = PRESET_STORE_RATES;
+
+  for(uint8_t i = 0; i < NUMBER_OF_BANDS; i++)
+  {
+    target->frequencies[i] = frequencies[i];
+    target->bandwidths[i] = bandwidths[i];
+  }
+
+  for(uint32_t r = 0; r < PRESET_STORE_RATES; r++)
+  {
+    target->coefficients[r].sampleRate = presetRates[r];
+    for(uint8_t i = 0; i < NUMBER_OF_BANDS; i++)
+      AudioUserDsp_BiquadCoefficients(&target->coefficients[r].bands[i], target->gains[i], frequencies[i], bandwidths[i], presetRates[r]);
+  }
+}
+
+/**
+ * @brief  Tells whether a record can be recalled as stored: this version,
+ *         the sample rates of the build in its order and the band layout.
+ * @param  source: the record
+ * @param  length: its length in the journal
+ * @retval true if it needs no recomputing
+ */
+static bool PresetStore_IsCurrent(const Preset* source, uint16_t length)
+{
+  if(source->version != PRESET_STORE_VERSION || source->rateCount != PRESET_STORE_RATES ||
+     length != PRESET_STORE_SIZE(PRESET_STORE_RATES))
+    return false;
+
+  for(uint32_t r = 0; r < PRESET_STORE_RATES; r++)
+  {
+    if(source->coefficients[r].sampleRate != presetRates[r])
+      return false;
+  }
+
+  for(uint8_t i = 0; i < NUMBER_OF_BANDS; i++)
+  {
+    if(source->frequencies[i] != frequencies[i] || source->bandwidths[i] != bandwidths[i])
+      return false;
+  }
+
+  return true;
+}
@@ -0,0 +1,72 @@
+/**
+  ******************************************************************************
+  * @file    scheduler.h
+  * @brief   Cooperative scheduler of the main loop. Timed tasks (periodic or
+  *          one-shot) run when their due time has passed, background tasks
+  *          run on every pass; when no timed task is due the core sleeps until
+  *          the next interrupt. Each task keeps its release jitter, run time
+  *          and deadline overruns, the scheduler its idle time.
+  *
+  *          The clock and the sleep come from the backend, SysTick and __WFI
+  *          on the board (scheduler_systick.c), a virtual clock on the host.
+  ******************************************************************************
+  */
+
+// define to prevent recursive inclusion ---------------------------------------
+#ifndef __SCHEDULER_H__
+#define __SCHEDULER_H__
+
+// includes --------------------------------------------------------------------
+#include <stdbool.h>
+#include <stdint.h>
+
+// defines ---------------------------------------------------------------------
+#define SCHEDULER_MAX_TASKS       12
+#define SCHEDULER_INVALID_TASK    (-1)
+
+// typedefs --------------------------------------------------------------------
+typedef void (*SchedulerFunction)(void);
+
+typedef enum SchedulerTaskType
+{
+  SCHEDULER_TASK_FREE,
+  SCHEDULER_TASK_PERIODIC,
+  SCHEDULER_TASK_ONE_SHOT,
+  SCHEDULER_TASK_BACKGROUND           // every pass, not timed
+} SchedulerTaskType;
+
+typedef struct SchedulerTaskStats
+{
+  const char*       name;
+  SchedulerTaskType type;
+  uint32_t          runs;
+  uint32_t          overruns;         // finished after their deadline
+  uint32_t          jitterMaxUs;      // latest start after the due time
+  uint32_t          jitterTotalUs;    // for the mean
+  uint32_t          runMaxUs;
+} SchedulerTaskStats;
+
+typedef struct SchedulerStats
+{
+  uint32_t passes;
+  uint32_t sleeps;
+  uint64_t idleUs;                    // asleep, with the interrupts that wake the core
+  uint64_t totalUs;                   // since Scheduler_Init or the last reset
+} SchedulerStats;
+
+// function prototypes ---------------------------------------------------------
+void   Scheduler_Init(void);
+int8_t Scheduler_AddPeriodic(const char* name, SchedulerFunction function, uint32_t periodMs, uint32_t deadlineMs);
+int8_t Scheduler_AddOneShot(const char* name, SchedulerFunction function, uint32_t delayMs);
+int8_t Scheduler_AddBackground(const char* name, SchedulerFunction function);
+void   Scheduler_Remove(int8_t task);
+void   Scheduler_Run(void);
+void   Scheduler_GetStats(SchedulerStats* stats);
+bool   Scheduler_GetTaskStats(int8_t task, SchedulerTaskStats* stats);
+void   Scheduler_ResetStats(void);
+
+// backend, implemented by scheduler_systick.c
+uint32_t SchedulerBackend_Now(void);
+void     SchedulerBackend_Sleep(void);
+
+#endif // __SCHEDULER_H__
@@ -0,0 +1,272 @@
+/**
+  ******************************************************************************
+  * @file    scheduler.c
+  * @brief   Task table and main loop pass of the cooperative scheduler.
+  *          Hardware independent, the time comes from SchedulerBackend_Now in
+  *          microseconds (wrapping) and SchedulerBackend_Sleep returns at the
+  *          next interrupt. Tasks are added and removed from the main loop
+  *          only.
+  ******************************************************************************
+  */
+
+#include "scheduler.h"
+
+// private defines -------------------------------------------------------------
+#define SCHEDULER_US_PER_MS 1000
+
+// private typedefs ------------------------------------------------------------
+typedef struct SchedulerTask
+{
+  SchedulerFunction  function;
+  uint32_t           dueUs;
+  uint32_t           periodUs;
+  uint32_t           deadlineUs;      // after the due time, 0 for none
+  SchedulerTaskStats stats;
+} SchedulerTask;
+
+// private variables -----------------------------------------------------------
+static SchedulerTask  tasks[SCHEDULER_MAX_TASKS];
+static SchedulerStats schedulerStats;
+static uint32_t       lastPassUs = 0;
+
+// private function declarations -----------------------------------------------
+static int8_t Scheduler_Add(const char* name, SchedulerTaskType type, SchedulerFunction function,
+                            uint32_t delayUs, uint32_t periodUs, uint32_t deadlineUs);
+static void   Scheduler_RunTask(SchedulerTask* task, uint32_t startUs);
+static bool   Scheduler_IsDue(const SchedulerTask* task, uint32_t nowUs);
+
+/**
+ * @brief  Empties the task table and the statistics.
+ * @param  None
+ * @retval None
+ */
+void Scheduler_Init(void)
+{
+  for(uint8_t i = 0; i < SCHEDULER_MAX_TASKS; i++)
+    tasks[i] = (SchedulerTask){0};
+
+  lastPassUs = SchedulerBackend_Now();
+  Scheduler_ResetStats();
+}
+
+/**
+ * @brief  Adds a task run every periodMs, the first time periodMs from now.
+ * @param  name: static string, for the statistics
+ * @param  function: task body, must return quickly
+ * @param  periodMs: period
+ * @param  deadlineMs: the task overruns if it ends later than that after its
+ *         due time, 0 to use the period
+ * @retval task handle, SCHEDULER_INVALID_TASK if the table is full
+ */
+int8_t Scheduler_AddPeriodic(const char* name, SchedulerFunction function, uint32_t periodMs, uint32_t deadlineMs)
+{
+  if(periodMs == 0)
+    return SCHEDULER_INVALID_TASK;
+
+  if(deadlineMs == 0)
+    deadlineMs = periodMs;
+
+  return Scheduler_Add(name, SCHEDULER_TASK_PERIODIC, function, periodMs * SCHEDULER_US_PER_MS,
+                       periodMs * SCHEDULER_US_PER_MS, deadlineMs * SCHEDULER_US_PER_MS);
+}
+
+/**
+ * @brief  Adds a task run once, delayMs from now. Its slot is freed after.
+ * @param  name: static string, for the statistics
+ * @param  function: task body
+ * @param  delayMs: delay, 0 for the next pass
+ * @retval task handle, SCHEDULER_INVALID_TASK if the table is full
+ */
+int8_t Scheduler_AddOneShot(const char* name, SchedulerFunction function, uint32_t delayMs)
+{
+  return Scheduler_Add(name, SCHEDULER_TASK_ONE_SHOT, function, delayMs * SCHEDULER_US_PER_MS, 0, 0);
+}
+
+/**
+ * @brief  Adds a task run on every pass, for work driven by interrupts that
+ *         has to follow them closely (DMA completions).
+ * @param  name: static string, for the statistics
+ * @param  function: task body, must return at once when it has nothing to do
+ * @retval task handle, SCHEDULER_INVALID_TASK if the table is full
+ */
+int8_t Scheduler_AddBackground(const char* name, SchedulerFunction function)
+{
+  return Scheduler_Add(name, SCHEDULER_TASK_BACKGROUND, function, 0, 0, 0);
+}
+
+/**
+ * @brief  Removes a task, e.g. a one-shot that is no longer needed.
+ * @param  task: handle from one of the Scheduler_Add functions
+ * @retval None
+ */
+void Scheduler_Remove(int8_t task)
+{
+  if(task >= 0 && task < SCHEDULER_MAX_TASKS)
+    tasks[task].stats.type = SCHEDULER_TASK_FREE;
+}
+
+/**
+ * @brief  One pass of the main loop: runs the background tasks, then the
+ *         timed tasks that are due, in table order. Sleeps until the next
+ *         interrupt if no timed task is due after that. The SysTick
+ *         interrupt bounds the sleep to one millisecond.
+ * @param  None
+ * @retval None
+ */
+void Scheduler_Run(void)
+{
+  uint32_t nowUs = SchedulerBackend_Now();
+  bool due = false;
+
+  schedulerStats.passes++;
+  schedulerStats.totalUs += nowUs - lastPassUs;
+  lastPassUs = nowUs;
+
+  for(uint8_t i = 0; i < SCHEDULER_MAX_TASKS; i++)
+  {
+    if(tasks[i].stats.type == SCHEDULER_TASK_BACKGROUND)
+      Scheduler_RunTask(&tasks[i], SchedulerBackend_Now());
+  }
+
+  for(uint8_t i = 0; i < SCHEDULER_MAX_TASKS; i++)
+  {
+    nowUs = SchedulerBackend_Now();
+    if(Scheduler_IsDue(&tasks[i], nowUs))
+      Scheduler_RunTask(&tasks[i], nowUs);
+  }
+
+  nowUs = SchedulerBackend_Now();
+  for(uint8_t i = 0; i < SCHEDULER_MAX_TASKS && !due; i++)
+    due = Scheduler_IsDue(&tasks[i], nowUs);
+
+  if(due)
+    return;
+
+  schedulerStats.sleeps++;
+  SchedulerBackend_Sleep();
+  schedulerStats.idleUs += SchedulerBackend_Now() - nowUs;
+}
+
+/**
+ * @brief  Copies the scheduler statistics.
+ * @param  stats: receives the statistics
+ * @retval None
+ */
+void Scheduler_GetStats(SchedulerStats* stats)
+{
+  *stats = schedulerStats;
+}
+
+/**
+ * @brief  Copies the statistics of one task.
+ * @param  task: task handle
+ * @param  stats: receives the statistics
+ * @retval false if there is no such task
+ */
+bool Scheduler_GetTaskStats(int8_t task, SchedulerTaskStats* stats)
+{
+  if(task < 0 || task >= SCHEDULER_MAX_TASKS || tasks[task].stats.type == SCHEDULER_TASK_FREE)
+    return false;
+
+  *stats = tasks[task].stats;
+  return true;
+}
+
+/**
+ * @brief  Clears the statistics of the scheduler and of every task.
+ * @param  None
+ * @retval None
+ */
+void Scheduler_ResetStats(void)
+{
+  schedulerStats = (SchedulerStats){0};
+
+  for(uint8_t i = 0; i < SCHEDULER_MAX_TASKS; i++)
+  {
+    SchedulerTaskStats* stats = &tasks[i].stats;
+    *stats = (SchedulerTaskStats){ .name = stats->name, .type = stats->type };
+  }
+}
+
+static int8_t Scheduler_Add(const char* name, SchedulerTaskType type, SchedulerFunction function,
+                            uint32_t delayUs, uint32_t periodUs, uint32_t deadlineUs)
+{
+  // due times on whole milliseconds, where the SysTick interrupt wakes the core
+  uint32_t nowUs = SchedulerBackend_Now();
+  nowUs -= nowUs % SCHEDULER_US_PER_MS;
+
+  for(uint8_t i = 0; i < SCHEDULER_MAX_TASKS; i++)
+  {
+    if(tasks[i].stats.type != SCHEDULER_TASK_FREE)
+      continue;
+
+    tasks[i] = (SchedulerTask){
+      .function = function,
+      .dueUs = nowUs + delayUs,
+      .periodUs = periodUs,
+      .deadlineUs = deadlineUs,
+      .stats = { .name = name, .type = type }
+    };
+    return i;
+  }
+
+  return SCHEDULER_INVALID_TASK;
+}
+
+/**
+ * @brief  Runs a task and updates its statistics and due time. A periodic
+ *         task that fell more than a period behind skips the missed periods
+ *         instead of running back to back.
+ * @param  task: task to run
+ * @param  startUs: current time
+ * @retval None
+ */
+static void Scheduler_RunTask(SchedulerTask* task, uint32_t startUs)
+{
+  SchedulerTaskStats* stats = &task->stats;
+  SchedulerTaskType type = stats->type;
+
+  task->function();
+
+  uint32_t endUs = SchedulerBackend_Now();
+  uint32_t runUs = endUs - startUs;
+
+  // the slot is kept while running so the body can add a one-shot elsewhere
+  if(type == SCHEDULER_TASK_ONE_SHOT)
+  {
+    stats->type = SCHEDULER_TASK_FREE;
+    return;
+  }
+
+  stats->runs++;
+  if(runUs > stats->runMaxUs)
+    stats->runMaxUs = runUs;
+
+  if(type == SCHEDULER_TASK_BACKGROUND)
+    return;
+
+  uint32_t jitterUs = startUs - task->dueUs;
+  stats->jitterTotalUs += jitterUs;
+  if(jitterUs > stats->jitterMaxUs)
+    stats->jitterMaxUs = jitterUs;
+
+  if(task->deadlineUs != 0 && endUs - task->dueUs > task->deadlineUs)
+    stats->overruns++;
+
+  if(type == SCHEDULER_TASK_PERIODIC)
+  {
+    task->dueUs += task->periodUs;
+    while((int32_t)(endUs - task->dueUs) >= (int32_t)task->periodUs)
+      task->dueUs += task->periodUs;
+  }
+}
+
+static bool Scheduler_IsDue(const SchedulerTask* task, uint32_t nowUs)
+{
+  SchedulerTaskType type = task->stats.type;
+
+  if(type != SCHEDULER_TASK_PERIODIC && type != SCHEDULER_TASK_ONE_SHOT)
+    return false;
+
+  return (int32_t)(nowUs - task->dueUs) >= 0;
+}
@@ -0,0 +1,42 @@
+/**
+  ******************************************************************************
+  * @file    scheduler_systick.c
+  * @brief   Board backend of the scheduler: microseconds from the HAL tick
+  *          and the SysTick counter, sleep with __WFI. The core wakes on the
+  *          next interrupt, at the latest the 1 ms SysTick.
+  ******************************************************************************
+  */
+
+#include "scheduler.h"
+#include "stm32f7xx_hal.h"
+
+/**
+ * @brief  Current time in microseconds, wraps after 71 minutes like the
+ *         HAL tick multiplied by 1000.
+ * @param  None
+ * @retval time, us
+ */
+uint32_t SchedulerBackend_Now(void)
+{
+  uint32_t tick, counter;
+
+  // the SysTick interrupt may come between the two reads
+  do
+  {
+    tick = HAL_GetTick();
+    counter = SysTick->VAL;
+  } while(tick != HAL_GetTick());
+
+  return tick * 1000 + (SysTick->LOAD - counter) / (SystemCoreClock / 1000000);
+}
+
+/**
+ * @brief  Sleeps until the next interrupt.
+ * @param  None
+ * @retval None
+ */
+void SchedulerBackend_Sleep(void)
+{
+  __DSB();
+  __WFI();
+}
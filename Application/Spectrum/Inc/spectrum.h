@@ -0,0 +1,53 @@
+/**
+  ******************************************************************************
+  * @file    spectrum.h
+  * @brief   Spectrum analyzer. The USB input node copies each packet, after
+  *          the EQ, into a tap buffer as mono samples; the main loop takes the
+  *          latest SPECTRUM_FFT_SIZE of them, windows them, transforms them
+  *          and groups the bins into log spaced bars in dBFS.
+  *
+  *          The tap is single producer, single consumer and never blocks the
+  *          writer: a reader that was overtaken while copying drops its frame.
+  ******************************************************************************
+  */
+
+// define to prevent recursive inclusion ---------------------------------------
+#ifndef __SPECTRUM_H__
+#define __SPECTRUM_H__
+
+// includes --------------------------------------------------------------------
+#include "spectrum_fft.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// defines ---------------------------------------------------------------------
+#define SPECTRUM_BARS             32
+// frequencies of the lower edge of the first bar and the upper edge of the last
+#define SPECTRUM_MIN_FREQUENCY    50.0f
+#define SPECTRUM_MAX_FREQUENCY    20000.0f
+// bottom of the scale and how fast a bar falls, a rising bar jumps at once
+#define SPECTRUM_MIN_DB           (-72.0f)
+#define SPECTRUM_FALL_DB          1.5f
+
+// tap samples, twice the FFT so the writer has a transform worth of slack
+#define SPECTRUM_TAP_SIZE         (2 * SPECTRUM_FFT_SIZE)
+// 16 bit stereo, as the USB input node receives it
+#define SPECTRUM_TAP_FRAME_SIZE   4
+
+// typedefs --------------------------------------------------------------------
+typedef struct SpectrumStats
+{
+  uint32_t frames;                // transformed
+  uint32_t tornFrames;            // dropped, the tap overtook the copy
+  uint32_t idleFrames;            // no new samples, the bars only fell
+} SpectrumStats;
+
+// function prototypes ---------------------------------------------------------
+void         Spectrum_Init(uint32_t sampleRate);
+void         Spectrum_SetEnabled(bool enabled);
+void         Spectrum_TapWrite(const uint8_t* packet, uint32_t length);
+bool         Spectrum_Process(void);
+const float* Spectrum_Bars(void);
+void         Spectrum_GetStats(SpectrumStats* stats);
+
+#endif // __SPECTRUM_H__
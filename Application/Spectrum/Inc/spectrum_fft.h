@@ -0,0 +1,34 @@
+/**
+  ******************************************************************************
+  * @file    spectrum_fft.h
+  * @brief   Fixed point radix-4 FFT of the spectrum analyzer. Q31 complex
+  *          data, transformed in place; every stage divides by 4, so the
+  *          result is the DFT divided by SPECTRUM_FFT_SIZE and cannot
+  *          overflow for inputs of magnitude below 1.
+  ******************************************************************************
+  */
+
+// define to prevent recursive inclusion ---------------------------------------
+#ifndef __SPECTRUM_FFT_H__
+#define __SPECTRUM_FFT_H__
+
+// includes --------------------------------------------------------------------
+#include <stdint.h>
+
+// defines ---------------------------------------------------------------------
+// a power of 4
+#define SPECTRUM_FFT_SIZE     1024
+#define SPECTRUM_FFT_STAGES   5
+
+// typedefs --------------------------------------------------------------------
+typedef struct SpectrumComplex
+{
+  int32_t re;
+  int32_t im;
+} SpectrumComplex;
+
+// function prototypes ---------------------------------------------------------
+void SpectrumFft_Init(void);
+void SpectrumFft_Forward(SpectrumComplex* data);
+
+#endif // __SPECTRUM_FFT_H__
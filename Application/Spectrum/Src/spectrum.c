@@ -0,0 +1,221 @@
+/**
+  ******************************************************************************
+  * @file    spectrum.c
+  * @brief   Tap buffer, windowing and bar grouping of the spectrum analyzer.
+  *          Hardware independent. Spectrum_TapWrite runs in the USB interrupt
+  *          and costs a mono mix and a store per frame while the analyzer is
+  *          shown, nothing otherwise. Spectrum_Process runs from the main loop
+  *          at the display rate; frames it does not get to are simply not
+  *          computed.
+  *
+  *          A full scale sine reads 0 dBFS: the Hann window halves it and the
+  *          FFT scaling leaves half of the rest in each of its two bins, so
+  *          its bin has a magnitude of 1/4 in Q31.
+  ******************************************************************************
+  */
+
+#include "spectrum.h"
+#include <math.h>
+
+// private defines -------------------------------------------------------------
+#define SPECTRUM_TAP_MASK       (SPECTRUM_TAP_SIZE - 1)
+#define SPECTRUM_PI             3.14159265358979323846
+// 10 log10 of the power of a full scale sine's bin, (2^31 / 4)^2
+#define SPECTRUM_FULL_SCALE_DB  (10.0f * 58.0f * 0.30103f)
+
+// private variables -----------------------------------------------------------
+static int16_t          tap[SPECTRUM_TAP_SIZE];
+static uint32_t         tapWritten = 0;       // samples ever written, published last
+static volatile bool    tapEnabled = false;
+static uint32_t         enabledAt = 0;        // tapWritten when enabled
+static uint32_t         lastWritten = 0;      // tapWritten of the last transform
+
+static int16_t          window[SPECTRUM_FFT_SIZE];   // Hann, Q15
+static SpectrumComplex  work[SPECTRUM_FFT_SIZE];
+static uint16_t         barFirstBin[SPECTRUM_BARS];
+static uint16_t         barEndBin[SPECTRUM_BARS];    // one past the last bin
+static float            bars[SPECTRUM_BARS];         // dBFS
+static SpectrumStats    spectrumStats;
+
+// private function declarations -----------------------------------------------
+static bool Spectrum_Fall(void);
+
+/**
+ * @brief  Computes the window, the FFT twiddles and the bins of each bar.
+ *         Bars narrower than a bin at the low end repeat the same bin.
+ * @param  sampleRate: of the tapped stream, in Hz
+ * @retval None
+ */
+void Spectrum_Init(uint32_t sampleRate)
+{
+  float binsPerHz = (float)SPECTRUM_FFT_SIZE / sampleRate;
+
+  SpectrumFft_Init();
+
+  for(uint32_t i = 0; i < SPECTRUM_FFT_SIZE; i++)
+    window[i] = (int16_t)lround(32767.0 * (0.5 - 0.5 * cos(2.0 * SPECTRUM_PI * i / SPECTRUM_FFT_SIZE)));
+
+  for(uint8_t b = 0; b < SPECTRUM_BARS; b++)
+  {
+    float ratio = SPECTRUM_MAX_FREQUENCY / SPECTRUM_MIN_FREQUENCY;
+    uint16_t first = (uint16_t)lroundf(SPECTRUM_MIN_FREQUENCY * powf(ratio, (float)b / SPECTRUM_BARS) * binsPerHz);
+    uint16_t end = (uint16_t)lroundf(SPECTRUM_MIN_FREQUENCY * powf(ratio, (float)(b + 1) / SPECTRUM_BARS) * binsPerHz);
+
+    if(first < 1)
+      first = 1;
+    if(first > SPECTRUM_FFT_SIZE / 2)
+      first = SPECTRUM_FFT_SIZE / 2;
+    if(end <= first)
+      end = first + 1;
+    if(end > SPECTRUM_FFT_SIZE / 2 + 1)
+      end = SPECTRUM_FFT_SIZE / 2 + 1;
+
+    barFirstBin[b] = first;
+    barEndBin[b] = end;
+    bars[b] = SPECTRUM_MIN_DB;
+  }
+
+  spectrumStats = (SpectrumStats){0};
+}
+
+/**
+ * @brief  Starts or stops the tap. A transform needs a full FFT of samples
+ *         written after the start.
+ * @param  enabled: true while the analyzer is shown
+ * @retval None
+ */
+void Spectrum_SetEnabled(bool enabled)
+{
+  if(enabled && !tapEnabled)
+  {
+    enabledAt = __atomic_load_n(&tapWritten, __ATOMIC_ACQUIRE);
+    lastWritten = enabledAt;
+  }
+
+  tapEnabled = enabled;
+}
+
+/**
+ * @brief  Appends one packet to the tap as mono samples. Called from the USB
+ *         interrupt after the EQ; the only writer of the tap.
+ * @param  packet: 16 bit stereo frames
+ * @param  length: bytes in packet
+ * @retval None
+ */
+void Spectrum_TapWrite(const uint8_t* packet, uint32_t length)
+{
+  if(!tapEnabled)
+    return;
+
+  uint32_t written = tapWritten;
+
+  for(uint32_t i = 0; i + SPECTRUM_TAP_FRAME_SIZE <= length; i += SPECTRUM_TAP_FRAME_SIZE)
+  {
+    int16_t left = (int16_t)(packet[i] | (packet[i + 1] << 8));
+    int16_t right = (int16_t)(packet[i + 2] | (packet[i + 3] << 8));
+    tap[written++ & SPECTRUM_TAP_MASK] = (int16_t)((left + right) / 2);
+  }
+
+  // the samples are in place before the reader can see the new count
+  __atomic_store_n(&tapWritten, written, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief  Transforms the latest samples and updates the bars. Without new
+ *         samples the bars only fall; a frame the tap overtook is dropped.
+ * @param  None
+ * @retval true if the bars changed
+ */
+bool Spectrum_Process(void)
+{
+  if(!tapEnabled)
+    return false;
+
+  uint32_t written = __atomic_load_n(&tapWritten, __ATOMIC_ACQUIRE);
+
+  if(written == lastWritten || written - enabledAt < SPECTRUM_FFT_SIZE)
+  {
+    spectrumStats.idleFrames++;
+    return Spectrum_Fall();
+  }
+
+  uint32_t start = written - SPECTRUM_FFT_SIZE;
+  lastWritten = written;
+
+  for(uint32_t i = 0; i < SPECTRUM_FFT_SIZE; i++)
+  {
+    // Q15 sample times Q15 window, doubled to Q31
+    work[i].re = tap[(start + i) & SPECTRUM_TAP_MASK] * window[i] * 2;
+    work[i].im = 0;
+  }
+
+  // the writer wraps onto the oldest sample copied after SPECTRUM_TAP_SIZE
+  if(__atomic_load_n(&tapWritten, __ATOMIC_ACQUIRE) - start > SPECTRUM_TAP_SIZE)
+  {
+    spectrumStats.tornFrames++;
+    return false;
+  }
+
+  SpectrumFft_Forward(work);
+
+  for(uint8_t b = 0; b < SPECTRUM_BARS; b++)
+  {
+    uint64_t peak = 0;
+
+    for(uint16_t k = barFirstBin[b]; k < barEndBin[b]; k++)
+    {
+      uint64_t power = (uint64_t)((int64_t)work[k].re * work[k].re) + (uint64_t)((int64_t)work[k].im * work[k].im);
+      if(power > peak)
+        peak = power;
+    }
+
+    float level = (peak > 0) ? 10.0f * log10f((float)peak) - SPECTRUM_FULL_SCALE_DB : SPECTRUM_MIN_DB;
+    float fallen = bars[b] - SPECTRUM_FALL_DB;
+
+    if(level < fallen)
+      level = fallen;
+    bars[b] = (level > SPECTRUM_MIN_DB) ? level : SPECTRUM_MIN_DB;
+  }
+
+  spectrumStats.frames++;
+  return true;
+}
+
+/**
+ * @brief  Level of each bar after the last frame.
+ * @param  None
+ * @retval SPECTRUM_BARS values in dBFS, SPECTRUM_MIN_DB to about 0, lowest
+ *         frequency first
+ */
+const float* Spectrum_Bars(void)
+{
+  return bars;
+}
+
+/**
+ * @brief  Copies the frame counters.
+ * @param  stats: receives the counters
+ * @retval None
+ */
+void Spectrum_GetStats(SpectrumStats* stats)
+{
+  *stats = spectrumStats;
+}
+
+static bool Spectrum_Fall(void)
+{
+  bool changed = false;
+
+  for(uint8_t b = 0; b < SPECTRUM_BARS; b++)
+  {
+    if(bars[b] <= SPECTRUM_MIN_DB)
+      continue;
+
+    bars[b] -= SPECTRUM_FALL_DB;
+    if(bars[b] < SPECTRUM_MIN_DB)
+      bars[b] = SPECTRUM_MIN_DB;
+    changed = true;
+  }
+
+  return changed;
+}
@@ -0,0 +1,131 @@
+/**
+  ******************************************************************************
+  * @file    spectrum_fft.c
+  * @brief   Radix-4 decimation in frequency FFT on Q31 data. Each butterfly
+  *          takes four points a quarter of the span apart, scales them by 1/4
+  *          and rotates three of its outputs by the twiddles; the outputs of
+  *          the last stage are in base 4 digit reversed order and are put back
+  *          in place at the end. Products are 32 x 32 -> 64 bit, single cycle
+  *          SMULL on the Cortex-M7.
+  ******************************************************************************
+  */
+
+#include "spectrum_fft.h"
+#include <math.h>
+
+// private defines -------------------------------------------------------------
+#define SPECTRUM_FFT_TWIDDLES   (3 * SPECTRUM_FFT_SIZE / 4)
+#define SPECTRUM_FFT_PI         3.14159265358979323846
+
+// private variables -----------------------------------------------------------
+// cos and sin of 2 pi k / N in Q31, the twiddle is cos - j sin
+static int32_t twiddleCos[SPECTRUM_FFT_TWIDDLES];
+static int32_t twiddleSin[SPECTRUM_FFT_TWIDDLES];
+
+// private function declarations -----------------------------------------------
+static int32_t  SpectrumFft_ToQ31(double value);
+static uint32_t SpectrumFft_DigitReverse(uint32_t index);
+
+/**
+ * @brief  Computes the twiddle table.
+ * @param  None
+ * @retval None
+ */
+void SpectrumFft_Init(void)
+{
+  for(uint32_t k = 0; k < SPECTRUM_FFT_TWIDDLES; k++)
+  {
+    double angle = 2.0 * SPECTRUM_FFT_PI * k / SPECTRUM_FFT_SIZE;
+    twiddleCos[k] = SpectrumFft_ToQ31(cos(angle));
+    twiddleSin[k] = SpectrumFft_ToQ31(sin(angle));
+  }
+}
+
+/**
+ * @brief  Forward transform in place, X[k] = sum x[n] e^(-j 2 pi k n / N) / N.
+ * @param  data: SPECTRUM_FFT_SIZE points, magnitudes below 1 in Q31
+ * @retval None
+ */
+void SpectrumFft_Forward(SpectrumComplex* data)
+{
+  uint32_t span = SPECTRUM_FFT_SIZE;
+  uint32_t step = 1;
+
+  for(uint8_t stage = 0; stage < SPECTRUM_FFT_STAGES; stage++)
+  {
+    uint32_t quarter = span / 4;
+
+    for(uint32_t j = 0; j < quarter; j++)
+    {
+      int64_t c1 = twiddleCos[j * step], s1 = twiddleSin[j * step];
+      int64_t c2 = twiddleCos[2 * j * step], s2 = twiddleSin[2 * j * step];
+      int64_t c3 = twiddleCos[3 * j * step], s3 = twiddleSin[3 * j * step];
+
+      for(uint32_t i = j; i < SPECTRUM_FFT_SIZE; i += span)
+      {
+        SpectrumComplex* a = &data[i];
+        SpectrumComplex* b = a + quarter;
+        SpectrumComplex* c = b + quarter;
+        SpectrumComplex* d = c + quarter;
+
+        int32_t t0re = (a->re >> 2) + (c->re >> 2), t0im = (a->im >> 2) + (c->im >> 2);
+        int32_t t1re = (a->re >> 2) - (c->re >> 2), t1im = (a->im >> 2) - (c->im >> 2);
+        int32_t t2re = (b->re >> 2) + (d->re >> 2), t2im = (b->im >> 2) + (d->im >> 2);
+        int32_t t3re = (b->re >> 2) - (d->re >> 2), t3im = (b->im >> 2) - (d->im >> 2);
+
+        // outputs 0 to 3 of the four point DFT, 1 and 3 turn t3 by -j and +j
+        int64_t r1re = t1re + t3im, r1im = t1im - t3re;
+        int64_t r2re = t0re - t2re, r2im = t0im - t2im;
+        int64_t r3re = t1re - t3im, r3im = t1im + t3re;
+
+        a->re = t0re + t2re;
+        a->im = t0im + t2im;
+        b->re = (int32_t)((r1re * c1 + r1im * s1) >> 31);
+        b->im = (int32_t)((r1im * c1 - r1re * s1) >> 31);
+        c->re = (int32_t)((r2re * c2 + r2im * s2) >> 31);
+        c->im = (int32_t)((r2im * c2 - r2re * s2) >> 31);
+        d->re = (int32_t)((r3re * c3 + r3im * s3) >> 31);
+        d->im = (int32_t)((r3im * c3 - r3re * s3) >> 31);
+      }
+    }
+
+    span = quarter;
+    step *= 4;
+  }
+
+  for(uint32_t i = 0; i < SPECTRUM_FFT_SIZE; i++)
+  {
+    uint32_t reversed = SpectrumFft_DigitReverse(i);
+
+    if(reversed > i)
+    {
+      SpectrumComplex swap = data[i];
+      data[i] = data[reversed];
+      data[reversed] = swap;
+    }
+  }
+}
+
+static int32_t SpectrumFft_ToQ31(double value)
+{
+  double scaled = value * 2147483648.0;
+
+  if(scaled >= 2147483647.0)
+    return INT32_MAX;
+  if(scaled <= -2147483648.0)
+    return INT32_MIN;
+  return (int32_t)lround(scaled);
+}
+
+static uint32_t SpectrumFft_DigitReverse(uint32_t index)
+{
+  uint32_t reversed = 0;
+
+  for(uint8_t digit = 0; digit < SPECTRUM_FFT_STAGES; digit++)
+  {
+    reversed = (reversed << 2) | (index & 3);
+    index >>= 2;
+  }
+
+  return reversed;
+}
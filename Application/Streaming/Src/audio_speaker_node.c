@@ -22,6 +22,11 @@
 #include "usbd_audio.h"
 #include "audio_speaker_node.h"
 #include "usb_audio.h"
+#include "boot_time.h"
+#include "audio_user_dsp.h"
+#include "audio_user_dsp_dynamics.h"
+#include "audio_user_dsp_fir.h"
+#include "flash_persistence.h"
 
 /* Private defines -----------------------------------------------------------*/
 #define SPEAKER_CMD_STOP                1
@@ -29,6 +34,10 @@
 #define SPEAKER_CMD_CHANGE_FREQUENCE    4
 #define VOLUME_DB_256_TO_PERCENT(volume_db_256) ((uint8_t)((((int)(volume_db_256) - VOLUME_SPEAKER_MIN_DB_256)*100)/\
                                                           (VOLUME_SPEAKER_MAX_DB_256 - VOLUME_SPEAKER_MIN_DB_256)))
+/* the codec follows the volume in steps this large, the digital gain of the EQ fills in between */
+#define VOLUME_CODEC_STEP_DB_256        (6*256)
+/* the codec keeps its level while the volume stays this close below it, so small moves never reach the i2c bus */
+#define VOLUME_CODEC_WINDOW_DB_256      (2*VOLUME_CODEC_STEP_DB_256)
 
 #if USB_AUDIO_CONFIG_PLAY_RES_BIT == 24
 #if USB_AUDIO_CONFIG_PLAY_USE_FREQ_44_1_K
@@ -64,6 +73,7 @@ static int8_t  AUDIO_SpeakerChangeFrequency( uint32_t node_handle);
 static int8_t  AUDIO_SpeakerMute( uint16_t channel_number,  uint8_t mute , uint32_t node_handle);
 static int8_t  AUDIO_SpeakerSetVolume( uint16_t channel_number,  int volume ,  uint32_t node_handle);
 static void    AUDIO_SpeakerInitInjectionsParams( AUDIO_SpeakerNode_t* speaker);
+static int     AUDIO_SpeakerCodecLevel(int volume_db_256);
 #if USB_AUDIO_CONFIG_PLAY_RES_BIT == 24 
 static void AUDIO_DoPadding_24_32(AUDIO_CircularBuffer_t *buff_src,  uint8_t *data_dest ,  int size);
 #endif /* USB_AUDIO_CONFIG_PLAY_RES_BIT == 24   */
@@ -91,6 +101,8 @@ extern __IO uint32_t uwTick;
 
 /* Private variables -----------------------------------------------------------*/
 static AUDIO_SpeakerNode_t *AUDIO_SpeakerHandler = 0;
+/* volume the codec is set to, a multiple of VOLUME_CODEC_STEP_DB_256 */
+static int AUDIO_SpeakerCodecVolume = VOLUME_SPEAKER_DEFAULT_DB_256;
 #ifdef DEBUG_SPEAKER_NODE
 static AUDIO_SpeakerNodeBufferStats_t AUDIO_SpeakerDebugStats[SPEAKER_DEBUG_BUFFER_SIZE];
 static  int AUDIO_SpeakerDebugStats_count =0;
@@ -135,8 +147,10 @@ static  int AUDIO_SpeakerDebugStats_count =0;
   speaker->SpeakerGetReadCount    = AUDIO_SpeakerGetLastReadCount;
 
   BSP_AUDIO_OUT_Init_Ext(OUTPUT_DEVICE_AUTO, VOLUME_DB_256_TO_PERCENT(VOLUME_SPEAKER_DEFAULT_DB_256), speaker->node.audio_description->frequency, audio_description->resolution << 3);
+  AUDIO_SpeakerCodecVolume = VOLUME_SPEAKER_DEFAULT_DB_256;
   BSP_AUDIO_OUT_Play((uint16_t *)speaker->specific.data, speaker->specific.data_size);
   AUDIO_SpeakerHandler = speaker;
+  BootTime_Mark(BOOT_TIME_CODEC);
   return 0;
 }
 
@@ -180,7 +194,8 @@ void BSP_AUDIO_OUT_TransferComplete_CallBack(void)
      AUDIO_SpeakerInitInjectionsParams(AUDIO_SpeakerHandler);
      BSP_AUDIO_OUT_SetFrequency(AUDIO_SpeakerHandler->node.audio_description->frequency);
 #if !USE_AUDIO_TIMER_VOLUME_CTRL
-     BSP_AUDIO_OUT_SetMute(AUDIO_SpeakerHandler->node.audio_description->audio_mute);
+     /* the host mute is digital, the codec is only muted around the change */
+     BSP_AUDIO_OUT_SetMute(AUDIO_MUTE_OFF);
 #endif /*USE_AUDIO_TIMER_VOLUME_CTRL*/
      AUDIO_SpeakerHandler->specific.cmd = 0;
    }
@@ -319,6 +334,7 @@ static int8_t  AUDIO_SpeakerDeInit(uint32_t node_handle)
     BSP_AUDIO_OUT_DeInit();
     speaker->node.state = AUDIO_NODE_OFF;
   }
+  FlashPersistence_SetStreaming(false);
   AUDIO_SpeakerHandler = 0;
   return 0;
 }
@@ -339,7 +355,15 @@ static int8_t  AUDIO_SpeakerStart(AUDIO_CircularBuffer_t* buffer,  uint32_t node
   speaker->specific.cmd = 0;
   AUDIO_SpeakerMute(0, speaker->node.audio_description->audio_mute, node_handle);
   AUDIO_SpeakerSetVolume(0, speaker->node.audio_description->audio_volume_db_256, node_handle);
+  /* the stream starts from silence, no ramp is needed, and the limiter
+     and the FIR hold nothing of the last one */
+  AudioUserDsp_SettleVolume();
+  AudioUserDspDynamics_Reset();
+  AudioUserDspFir_Reset();
+  /* a flash erase would stall the stream in single bank mode */
+  FlashPersistence_SetStreaming(true);
   speaker->node.state = AUDIO_NODE_STARTED;
+  BootTime_Mark(BOOT_TIME_FIRST_AUDIO);
   return 0;
 }
 
@@ -355,6 +379,7 @@ static int8_t  AUDIO_SpeakerStop( uint32_t node_handle)
 
   speaker = (AUDIO_SpeakerNode_t*)node_handle;
   speaker->specific.cmd |= SPEAKER_CMD_STOP;
+  FlashPersistence_SetStreaming(false);
 
   return 0;
 }
@@ -405,7 +430,8 @@ static void  AUDIO_SpeakerInitInjectionsParams( AUDIO_SpeakerNode_t* speaker)
  }
  /**
   * @brief  AUDIO_SpeakerMute
-  *         set Mute value to speaker
+  *         set Mute value to speaker. The mute is a ramp of the digital gain,
+  *         the codec is left playing.
   * @param  channel_number(IN): channel number
 * @param  mute(IN): mute value (0 : mute , 1 unmute)
   * @param  node_handle(IN): speaker node handle must be Started
@@ -418,18 +444,17 @@ static int8_t  AUDIO_SpeakerMute( uint16_t channel_number,  uint8_t mute , uint3
 
   speaker = (AUDIO_SpeakerNode_t*)node_handle;
   speaker->node.audio_description->audio_mute = mute;
-  speaker->specific.cmd = (speaker->specific.cmd&(~SPEAKER_CMD_MUTE_FIRST))|SPEAKER_CMD_MUTE_UNMUTE;
-
-#else
-  BSP_AUDIO_OUT_SetMute(mute);
 #endif /* USE_AUDIO_TIMER_VOLUME_CTRL */
+  AudioUserDsp_SetMute(mute != 0);
 
   return 0;
 }
 
  /**
   * @brief  AUDIO_SpeakerSetVolume
-  *         set Volume value to speaker
+  *         set Volume value to speaker. The digital gain of the EQ takes the
+  *         1/256 dB steps; the codec is only written when the volume leaves
+  *         the window below its level.
   * @param  channel_number(IN): channel number
   * @param  volume_db_256(IN):  volume value in db
   * @param  node_handle(IN):    speaker node handle must be Started
@@ -437,18 +462,58 @@ static int8_t  AUDIO_SpeakerMute( uint16_t channel_number,  uint8_t mute , uint3
   */ 
 static int8_t  AUDIO_SpeakerSetVolume( uint16_t channel_number,  int volume_db_256 ,  uint32_t node_handle)
 {
+  int codec_db_256 = AUDIO_SpeakerCodecVolume;
+
+  if((volume_db_256 > codec_db_256)||(volume_db_256 <= codec_db_256 - VOLUME_CODEC_WINDOW_DB_256))
+  {
+    codec_db_256 = AUDIO_SpeakerCodecLevel(volume_db_256);
+  }
+  AudioUserDsp_SetVolume(volume_db_256 - codec_db_256);
+
+  if(codec_db_256 == AUDIO_SpeakerCodecVolume)
+  {
+    return 0;
+  }
+  AUDIO_SpeakerCodecVolume = codec_db_256;
+
 #if USE_AUDIO_TIMER_VOLUME_CTRL
   AUDIO_SpeakerNode_t* speaker;
   
   speaker = (AUDIO_SpeakerNode_t*)node_handle;
   speaker->node.audio_description->audio_volume_db_256 = volume_db_256;
-  speaker->specific.cmd  |= (SPEAKER_CMD_MUTE_FIRST|SPEAKER_CMD_CHANGE_VOLUME);
+  speaker->specific.cmd  |= SPEAKER_CMD_CHANGE_VOLUME;
 #else
-  BSP_AUDIO_OUT_SetVolume(VOLUME_DB_256_TO_PERCENT(volume_db_256));
+  BSP_AUDIO_OUT_SetVolume(VOLUME_DB_256_TO_PERCENT(codec_db_256));
 #endif /* USE_AUDIO_TIMER_VOLUME_CTRL */
   return 0;
 }      
 
+ /**
+  * @brief  AUDIO_SpeakerCodecLevel
+  *         codec level for a volume: the step at or above it, so the digital
+  *         gain only ever attenuates and cannot clip
+  * @param  volume_db_256(IN):  volume value in db
+  * @retval codec volume in db, a multiple of VOLUME_CODEC_STEP_DB_256
+  */ 
+static int  AUDIO_SpeakerCodecLevel(int volume_db_256)
+{
+  int level_db_256;
+
+  if(volume_db_256 > 0)
+  {
+    level_db_256 = ((volume_db_256 + VOLUME_CODEC_STEP_DB_256 - 1)/VOLUME_CODEC_STEP_DB_256)*VOLUME_CODEC_STEP_DB_256;
+  }
+  else
+  {
+    level_db_256 = -((-volume_db_256)/VOLUME_CODEC_STEP_DB_256)*VOLUME_CODEC_STEP_DB_256;
+  }
+  if(level_db_256 > VOLUME_SPEAKER_MAX_DB_256)
+  {
+    level_db_256 = VOLUME_SPEAKER_MAX_DB_256;
+  }
+  return level_db_256;
+}
+
 #if USE_AUDIO_TIMER_VOLUME_CTRL
 /**
   * @brief  Period elapsed callback in non blocking mode
@@ -459,22 +524,12 @@ void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim)
 {
   if((AUDIO_SpeakerHandler)&&(AUDIO_SpeakerHandler->node.state != AUDIO_NODE_OFF))
   {
-    /* Handle volume Commands here */
+    /* Handle volume Commands here, the codec step only: mute is digital */
     if(AUDIO_SpeakerHandler->specific.cmd & SPEAKER_CMD_CHANGE_VOLUME)
     {
-      if((AUDIO_SpeakerHandler->specific.cmd & SPEAKER_CMD_MUTE_FIRST)&&(AUDIO_SpeakerHandler->specific.cmd&SPEAKER_CMD_MUTE_UNMUTE))
-      {
-        //BSP_AUDIO_OUT_SetMute(AUDIO_SpeakerHandler->node.audio_description->audio_mute);
-        AUDIO_SpeakerHandler->specific.cmd&=~SPEAKER_CMD_MUTE_UNMUTE;
-      }
-      BSP_AUDIO_OUT_SetVolume(VOLUME_DB_256_TO_PERCENT(AUDIO_SpeakerHandler->node.audio_description->audio_volume_db_256));
+      BSP_AUDIO_OUT_SetVolume(VOLUME_DB_256_TO_PERCENT(AUDIO_SpeakerCodecVolume));
       AUDIO_SpeakerHandler->specific.cmd&=~SPEAKER_CMD_CHANGE_VOLUME;
     }
-    if(AUDIO_SpeakerHandler->specific.cmd&SPEAKER_CMD_MUTE_UNMUTE)
-    {
-      BSP_AUDIO_OUT_SetMute(AUDIO_SpeakerHandler->node.audio_description->audio_mute);
-      AUDIO_SpeakerHandler->specific.cmd&=~SPEAKER_CMD_MUTE_UNMUTE;
-    }
   }
 }
 #endif /* USE_AUDIO_TIMER_VOLUME_CTRL */
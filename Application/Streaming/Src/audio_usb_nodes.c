@@ -22,6 +22,8 @@
 #include "audio_usb_nodes.h"
 #include "user_lcd.h"
 #include "usart.h"
+#include "spectrum.h"
+#include "touch_input.h"
 
 
 /* External variables --------------------------------------------------------*/
@@ -401,12 +403,19 @@ static int8_t USB_AudioStreamingInputDataReceived(uint16_t data_len, uint32_t no
       sliderKnobs[i].isPressed = false;
       int16_t newGain = AudioUserDsp_CalculateGain(i, &sliderKnobs[i]);
       if(newGain != biquadFilters[i].gain)
+      {
         AudioUserDsp_BiquadFilterConfig(&biquadFilters[i], newGain, biquadFilters[i].frequency, biquadFilters[i].bandwidth);
+        TouchInput_RecordLatency((DWT->CYCCNT - sliderKnobs[i].touchCycles) / (SystemCoreClock / 1000000));
+      }
     }
   }
  
-  for (int8_t i = 0; i < 8; i++)
-    AudioUserDsp_ApplyFilterToSamples(newDataPointer, data_len, AudioUserDsp_BiquadFilter, AudioUserDsp_BiquadFilter, i);
+  uint32_t dspStartCycle = DWT->CYCCNT;
+  AudioUserDsp_ProcessPacket(newDataPointer, data_len);
+  dspPacketCycles = DWT->CYCCNT - dspStartCycle;
+
+  // what is about to be played, for the analyzer when it is shown
+  Spectrum_TapWrite(newDataPointer, data_len);
 
   buffer->wr_ptr += data_len; // increments buffer
 
@@ -22,6 +22,9 @@
 #include "usb_audio.h"
 #include "audio_speaker_node.h"
 #include "audio_sessions_usb.h"
+#include "logger.h"
+#include "telemetry.h"
+#include "audio_user_dsp.h"
 
 
 #if USE_USB_AUDIO_PLAYBACK
@@ -52,6 +55,7 @@ static int8_t  USB_AudioPlaybackSessionCallback(AUDIO_SessionEvent_t  event,
 #if USE_AUDIO_PLAYBACK_USB_FEEDBACK
 static uint32_t   USB_AudioPlaybackGetFeedback( uint32_t session_handle );
 static void  AUDIO_USB_Session_Sof_Received(uint32_t session_handle );
+static void  USB_AudioPlaybackPublishTelemetry(AUDIO_USBSession_t *session);
 #endif  /* USE_AUDIO_PLAYBACK_USB_FEEDBACK */
 
 /* Private variables ---------------------------------------------------------*/
@@ -65,7 +69,12 @@ static AUDIO_SpeakerNode_t PlaybackSpeakerOutputNode;
 /* Playback synchronization : frequency estimation */
 static uint8_t PlaybackSynchroFirstSofReceived = 0;
 static uint32_t PlaybackSynchroEstimatedCodecFrequency = 0;
+/* last value sent on the feedback endpoint, reported by the telemetry */
+static uint32_t PlaybackLastFeedback = 0;
 #endif  /* USE_AUDIO_PLAYBACK_USB_FEEDBACK */
+/* playback ring errors since boot, reported by the telemetry */
+static uint32_t PlaybackOverrunCount = 0;
+static uint32_t PlaybackUnderrunCount = 0;
 
 /* Private functions ---------------------------------------------------------*/
 
@@ -312,6 +321,15 @@ static int8_t  USB_AudioPlaybackSessionCallback(AUDIO_SessionEvent_t  event, AUD
   case AUDIO_OVERRUN:
   case AUDIO_UNDERRUN:
     {
+     if(event == AUDIO_OVERRUN)
+     {
+       PlaybackOverrunCount++;
+     }
+     else
+     {
+       PlaybackUnderrunCount++;
+     }
+     LOG_RATE_LIMITED(1000, "\r\n[playback] %s\r\n", (uint32_t)((event == AUDIO_OVERRUN) ? "overrun" : "underrun"));
      /* restart input and stop output */
      PlaybackSpeakerOutputNode.SpeakerStop((uint32_t)&PlaybackSpeakerOutputNode);
 #if USE_AUDIO_PLAYBACK_USB_FEEDBACK
@@ -384,11 +402,13 @@ static int8_t  USB_AudioPlaybackGetState(uint32_t session_handle)
   */
 static uint32_t   USB_AudioPlaybackGetFeedback( uint32_t session_handle )
 {
+ uint32_t feedback = PlaybackAudioDescription.frequency;
+
  if((PlaybackSpeakerOutputNode.node.state == AUDIO_NODE_STARTED))
   {
     if(PlaybackSynchroEstimatedCodecFrequency)
     {
-      return PlaybackSynchroEstimatedCodecFrequency ;
+      feedback = PlaybackSynchroEstimatedCodecFrequency ;
     }
     else
     {
@@ -398,15 +418,16 @@ static uint32_t   USB_AudioPlaybackGetFeedback( uint32_t session_handle )
      wr_distance=AUDIO_BUFFER_FREE_SIZE(buffer);
      if(wr_distance <= (buffer->size>>2))
      {
-       return PlaybackAudioDescription.frequency - 1000;
+       feedback = PlaybackAudioDescription.frequency - 1000;
      }
-     if( wr_distance >= (buffer->size - (buffer->size>>2)))
+     else if( wr_distance >= (buffer->size - (buffer->size>>2)))
      {
-       return PlaybackAudioDescription.frequency + 1000;
+       feedback = PlaybackAudioDescription.frequency + 1000;
      }
     }
   }
- return PlaybackAudioDescription.frequency;
+ PlaybackLastFeedback = feedback;
+ return feedback;
 }
 
 /**
@@ -467,7 +488,31 @@ static void  AUDIO_USB_Session_Sof_Received(uint32_t session_handle )
   {
     PlaybackSynchroFirstSofReceived = 0;
   }
+  USB_AudioPlaybackPublishTelemetry(session);
  }
+
+/**
+  * @brief  USB_AudioPlaybackPublishTelemetry
+  *         hands the playback state to the telemetry, once per SOF
+  * @param  session: playback session
+  * @retval  : 
+  */
+static void  USB_AudioPlaybackPublishTelemetry(AUDIO_USBSession_t *session)
+{
+  TelemetryPlaybackSample sample;
+
+  sample.tick                    = HAL_GetTick();
+  sample.feedback                = PlaybackLastFeedback;
+  sample.estimatedCodecFrequency = PlaybackSynchroEstimatedCodecFrequency;
+  sample.overruns                = PlaybackOverrunCount;
+  sample.underruns               = PlaybackUnderrunCount;
+  sample.dspCycles               = dspPacketCycles;
+  sample.dspCyclesMax            = 0;
+  sample.cyclesPerPacket         = 0;
+  sample.bufferFill              = AUDIO_BUFFER_FILLED_SIZE(&session->buffer);
+  sample.bufferSize              = session->buffer.size;
+  Telemetry_PublishPlayback(&sample);
+}
 #endif /* USE_AUDIO_PLAYBACK_USB_FEEDBACK */
   
 #endif /*USE_USB_AUDIO_PLAYBACK*/
@@ -0,0 +1,43 @@
+/**
+  ******************************************************************************
+  * @file    boot_time.h
+  * @brief   Timestamps of the startup steps, from the DWT cycle counter. Each
+  *          mark keeps the time it was first reached, so the report in the
+  *          main loop can tell how long the board took to play sound and to
+  *          answer touch. Times count from HAL_Init, when SysTick starts.
+  ******************************************************************************
+  */
+
+// define to prevent recursive inclusion ---------------------------------------
+#ifndef __BOOT_TIME_H__
+#define __BOOT_TIME_H__
+
+// includes --------------------------------------------------------------------
+#include <stdbool.h>
+#include <stdint.h>
+
+// defines ---------------------------------------------------------------------
+// time to first sound the startup is built for
+#define BOOT_TIME_AUDIO_TARGET_US   300000
+
+// typedefs --------------------------------------------------------------------
+// in the order of the init graph in main.c
+typedef enum BootTimeMark
+{
+  BOOT_TIME_SDRAM,                    // external RAM usable
+  BOOT_TIME_RESTORED,                 // EQ filters loaded from the flash journal
+  BOOT_TIME_USB_STARTED,              // pull-up on, enumeration is up to the host
+  BOOT_TIME_CODEC,                    // configuration set, the SAI plays silence
+  BOOT_TIME_FIRST_AUDIO,              // the host started the stream
+  BOOT_TIME_LCD,                      // startup screen shown
+  BOOT_TIME_UI,                       // touch controller up, the UI answers
+  BOOT_TIME_MARKS,
+} BootTimeMark;
+
+// function prototypes ---------------------------------------------------------
+void     BootTime_Init(void);
+void     BootTime_Mark(BootTimeMark mark);
+bool     BootTime_IsReached(BootTimeMark mark);
+uint32_t BootTime_Us(BootTimeMark mark);
+
+#endif // __BOOT_TIME_H__
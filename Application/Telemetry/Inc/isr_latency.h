@@ -0,0 +1,40 @@
+/**
+  ******************************************************************************
+  * @file    isr_latency.h
+  * @brief   Lateness of the periodic audio interrupts, from the DWT cycle
+  *          counter at their entry. The events come at a fixed period, so an
+  *          interval longer than the mean is time the interrupt waited:
+  *          for higher priorities, or for the flash. Intervals that overlap
+  *          a flash operation of the journal are also counted apart.
+  ******************************************************************************
+  */
+
+// define to prevent recursive inclusion ---------------------------------------
+#ifndef __ISR_LATENCY_H__
+#define __ISR_LATENCY_H__
+
+// includes --------------------------------------------------------------------
+#include <stdint.h>
+
+// typedefs --------------------------------------------------------------------
+typedef enum IsrLatencySource
+{
+  ISR_LATENCY_USB_SOF,                // USB start of frame, every 1 ms
+  ISR_LATENCY_SAI_DMA,                // SAI transmit DMA, half and full buffer
+  ISR_LATENCY_SOURCES,
+} IsrLatencySource;
+
+typedef struct IsrLatencyStats
+{
+  uint32_t intervals;
+  uint32_t periodUs;                  // mean interval
+  uint32_t lateMaxUs;                 // longest interval past the mean
+  uint32_t flashIntervals;            // of them, during a flash operation
+  uint32_t flashLateMaxUs;
+} IsrLatencyStats;
+
+// function prototypes ---------------------------------------------------------
+void IsrLatency_Mark(IsrLatencySource source);
+void IsrLatency_GetStats(IsrLatencySource source, IsrLatencyStats* stats);
+
+#endif // __ISR_LATENCY_H__
@@ -0,0 +1,29 @@
+/**
+  ******************************************************************************
+  * @file    telemetry.h
+  * @brief   Streaming playback telemetry over USART1.
+  *          The audio interrupts publish the latest sample (a copy of a few
+  *          words), the main loop encodes and sends it at the configured rate.
+  ******************************************************************************
+  */
+
+// define to prevent recursive inclusion ---------------------------------------
+#ifndef __TELEMETRY_H__
+#define __TELEMETRY_H__
+
+// includes --------------------------------------------------------------------
+#include "telemetry_frame.h"
+
+// defines ---------------------------------------------------------------------
+
+// frames per second sent on USART1, 0 disables the stream
+#define TELEMETRY_DEFAULT_RATE_HZ   20
+#define TELEMETRY_MAX_RATE_HZ       200
+
+// function prototypes ---------------------------------------------------------
+void Telemetry_Init(void);
+void Telemetry_SetRate(uint32_t rateHz);
+void Telemetry_PublishPlayback(const TelemetryPlaybackSample* sample);
+void Telemetry_Process(void);
+
+#endif // __TELEMETRY_H__
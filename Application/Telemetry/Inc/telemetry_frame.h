@@ -0,0 +1,60 @@
+/**
+  ******************************************************************************
+  * @file    telemetry_frame.h
+  * @brief   Wire format of the telemetry stream, shared by the firmware and the
+  *          host decoder (Tools/Telemetry). Plain C, no HAL dependency.
+  *
+  *          frame on the line: 0x00 | COBS(header | payload | CRC16) | 0x00
+  *          all fields are little endian, the CRC is CRC-16/CCITT-FALSE over
+  *          header and payload.
+  ******************************************************************************
+  */
+
+// define to prevent recursive inclusion ---------------------------------------
+#ifndef __TELEMETRY_FRAME_H__
+#define __TELEMETRY_FRAME_H__
+
+// includes --------------------------------------------------------------------
+#include <stdint.h>
+#include <stdbool.h>
+
+// defines ---------------------------------------------------------------------
+#define TELEMETRY_PROTOCOL_VERSION    1
+#define TELEMETRY_FRAME_DELIMITER     0x00
+
+#define TELEMETRY_TYPE_PLAYBACK       0x01
+
+// worst case COBS overhead is one byte per 254 plus the two delimiters
+#define TELEMETRY_MAX_PAYLOAD_SIZE    64
+#define TELEMETRY_MAX_RAW_SIZE        (sizeof(TelemetryFrameHeader) + TELEMETRY_MAX_PAYLOAD_SIZE + 2)
+#define TELEMETRY_MAX_FRAME_SIZE      (TELEMETRY_MAX_RAW_SIZE + TELEMETRY_MAX_RAW_SIZE / 254 + 1 + 2)
+
+// typedefs --------------------------------------------------------------------
+typedef struct __attribute__((packed)) TelemetryFrameHeader
+{
+  uint8_t  version;
+  uint8_t  type;
+  uint16_t sequence;  // incremented per frame, gaps show lost frames
+} TelemetryFrameHeader;
+
+// payload of TELEMETRY_TYPE_PLAYBACK
+typedef struct __attribute__((packed)) TelemetryPlaybackSample
+{
+  uint32_t tick;                     // HAL tick (ms) when the sample was published
+  uint32_t feedback;                 // last value returned by USB_AudioPlaybackGetFeedback (Hz)
+  uint32_t estimatedCodecFrequency;  // PlaybackSynchroEstimatedCodecFrequency (Hz), 0 while unknown
+  uint32_t overruns;                 // playback ring overruns since boot
+  uint32_t underruns;                // playback ring underruns since boot
+  uint32_t dspCycles;                // cycles spent in the EQ for the last USB packet
+  uint32_t dspCyclesMax;             // worst packet since the previous frame
+  uint32_t cyclesPerPacket;          // core cycles available per 1 ms packet
+  uint16_t bufferFill;               // bytes waiting in the playback ring
+  uint16_t bufferSize;               // usable size of the playback ring
+} TelemetryPlaybackSample;
+
+// function prototypes ---------------------------------------------------------
+uint16_t TelemetryFrame_Crc16(const uint8_t* data, uint32_t length);
+uint32_t TelemetryFrame_Encode(uint8_t type, uint16_t sequence, const void* payload, uint32_t payloadLength, uint8_t* frame);
+int32_t  TelemetryFrame_Decode(const uint8_t* encoded, uint32_t encodedLength, TelemetryFrameHeader* header, void* payload, uint32_t payloadCapacity);
+
+#endif // __TELEMETRY_FRAME_H__
@@ -0,0 +1,87 @@
+/**
+  ******************************************************************************
+  * @file    boot_time.c
+  * @brief   Timestamps of the startup steps. Starts the DWT cycle counter
+  *          that the telemetry and the interrupt latency stats also read.
+  ******************************************************************************
+  */
+
+#include "boot_time.h"
+#include "stm32f7xx_hal.h"
+
+// private defines -------------------------------------------------------------
+// the cycle counter wraps after 21 s at 200 MHz, later marks use the tick
+#define BOOT_TIME_CYCLES_MAX_MS     10000
+
+// private typedefs ------------------------------------------------------------
+typedef struct BootTimeStamp
+{
+  volatile bool reached;              // set last, the fields are valid after it
+  uint32_t      cycles;               // since BootTime_Init
+  uint32_t      tick;                 // HAL tick
+} BootTimeStamp;
+
+// private variables -----------------------------------------------------------
+static BootTimeStamp stamps[BOOT_TIME_MARKS];
+static uint32_t      initTick = 0;
+
+/**
+ * @brief  Starts the DWT cycle counter from 0. Called once, right after the
+ *         system clock is set, before any other user of the counter.
+ * @param  None
+ * @retval None
+ */
+void BootTime_Init(void)
+{
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+  initTick = HAL_GetTick();
+}
+
+/**
+ * @brief  Records the time a step is reached; later calls are ignored. Safe
+ *         from interrupts as long as one mark is only set from one place.
+ * @param  mark: step
+ * @retval None
+ */
+void BootTime_Mark(BootTimeMark mark)
+{
+  BootTimeStamp* stamp = &stamps[mark];
+
+  if(stamp->reached)
+    return;
+
+  stamp->cycles = DWT->CYCCNT;
+  stamp->tick = HAL_GetTick();
+  __DMB();
+  stamp->reached = true;
+}
+
+/**
+ * @brief  Tells whether a step was reached.
+ * @param  mark: step
+ * @retval true once BootTime_Mark was called for it
+ */
+bool BootTime_IsReached(BootTimeMark mark)
+{
+  return stamps[mark].reached;
+}
+
+/**
+ * @brief  Time from HAL_Init to a step.
+ * @param  mark: step
+ * @retval microseconds, 0 if the step was not reached
+ */
+uint32_t BootTime_Us(BootTimeMark mark)
+{
+  const BootTimeStamp* stamp = &stamps[mark];
+
+  if(!stamp->reached)
+    return 0;
+
+  if(stamp->tick - initTick >= BOOT_TIME_CYCLES_MAX_MS)
+    return stamp->tick * 1000;
+
+  return initTick * 1000 + stamp->cycles / (SystemCoreClock / 1000000);
+}
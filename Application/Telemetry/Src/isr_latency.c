@@ -0,0 +1,98 @@
+/**
+  ******************************************************************************
+  * @file    isr_latency.c
+  * @brief   Lateness of the periodic audio interrupts. Uses the DWT cycle
+  *          counter started by BootTime_Init.
+  ******************************************************************************
+  */
+
+#include "isr_latency.h"
+#include "flash_journal.h"
+#include "stm32f7xx_hal.h"
+
+// private defines -------------------------------------------------------------
+// a longer interval is a stop of the stream or of USB, not a delay
+#define ISR_LATENCY_GAP_MS  100
+
+// private typedefs ------------------------------------------------------------
+typedef struct IsrLatencyCounter
+{
+  uint32_t lastCycles;                // 0 before the first mark
+  bool     lastFlashBusy;
+  uint32_t intervals;
+  uint64_t totalCycles;
+  uint32_t maxCycles;
+  uint32_t flashIntervals;
+  uint32_t flashMaxCycles;
+} IsrLatencyCounter;
+
+// private variables -----------------------------------------------------------
+static IsrLatencyCounter counters[ISR_LATENCY_SOURCES];
+
+/**
+ * @brief  Records the interval since the last entry of the interrupt. Called
+ *         first thing in it; one source must not be marked from two
+ *         priorities.
+ * @param  source: interrupt
+ * @retval None
+ */
+void IsrLatency_Mark(IsrLatencySource source)
+{
+  IsrLatencyCounter* counter = &counters[source];
+  uint32_t cycles = DWT->CYCCNT;
+  bool flashBusy = FlashJournalBackend_IsBusy();
+
+  uint32_t interval = cycles - counter->lastCycles;
+
+  if(counter->lastCycles != 0 && interval < SystemCoreClock / 1000 * ISR_LATENCY_GAP_MS)
+  {
+    counter->intervals++;
+    counter->totalCycles += interval;
+    if(interval > counter->maxCycles)
+      counter->maxCycles = interval;
+
+    if(flashBusy || counter->lastFlashBusy)
+    {
+      counter->flashIntervals++;
+      if(interval > counter->flashMaxCycles)
+        counter->flashMaxCycles = interval;
+    }
+  }
+
+  counter->lastCycles = cycles;
+  counter->lastFlashBusy = flashBusy;
+}
+
+/**
+ * @brief  Returns the stats since the last call, then clears them.
+ * @param  source: interrupt
+ * @param  stats: output, all 0 if the interrupt did not run
+ * @retval None
+ */
+void IsrLatency_GetStats(IsrLatencySource source, IsrLatencyStats* stats)
+{
+  IsrLatencyCounter counter;
+  uint32_t cyclesPerUs = SystemCoreClock / 1000000;
+
+  __disable_irq();
+  counter = counters[source];
+  counters[source].intervals = 0;
+  counters[source].totalCycles = 0;
+  counters[source].maxCycles = 0;
+  counters[source].flashIntervals = 0;
+  counters[source].flashMaxCycles = 0;
+  __enable_irq();
+
+  *stats = (IsrLatencyStats){0};
+  if(counter.intervals == 0)
+    return;
+
+  uint32_t period = (uint32_t)(counter.totalCycles / counter.intervals);
+
+  stats->intervals = counter.intervals;
+  stats->periodUs = period / cyclesPerUs;
+  stats->lateMaxUs = (counter.maxCycles - period) / cyclesPerUs;
+  stats->flashIntervals = counter.flashIntervals;
+  if(counter.flashIntervals > 0 && counter.flashMaxCycles > period)
+    stats->flashLateMaxUs = (counter.flashMaxCycles - period) / cyclesPerUs;
+}
@@ -0,0 +1,137 @@
+/**
+  ******************************************************************************
+  * @file    telemetry.c
+  * @brief   Streaming playback telemetry over USART1.
+  ******************************************************************************
+  */
+
+#include "telemetry.h"
+#include "usart.h"
+
+// private defines -------------------------------------------------------------
+#define TELEMETRY_CACHE_LINE_SIZE 32
+
+// private variables -----------------------------------------------------------
+
+// latest sample, guarded by a sequence counter that is odd while it is written
+static TelemetryPlaybackSample latestSample;
+static volatile uint32_t latestSequence = 0;
+static volatile uint32_t pendingDspCyclesMax = 0;
+
+static uint32_t framePeriodMs   = 0;
+static uint32_t lastFrameTick   = 0;
+static uint16_t frameSequence   = 0;
+
+static uint8_t frameBuffer[TELEMETRY_MAX_FRAME_SIZE] __attribute__((aligned(TELEMETRY_CACHE_LINE_SIZE)));
+
+// private function declarations -----------------------------------------------
+static void Telemetry_KeepDspCyclesMax(uint32_t cyclesMax);
+
+/**
+ * @brief  Sets the default frame rate. The DSP load is read from the DWT
+ *         cycle counter, started by BootTime_Init.
+ * @param  None
+ * @retval None
+ */
+void Telemetry_Init(void)
+{
+  Telemetry_SetRate(TELEMETRY_DEFAULT_RATE_HZ);
+}
+
+/**
+ * @brief  Changes the number of frames sent per second.
+ * @param  rateHz: 0 stops the stream, capped to TELEMETRY_MAX_RATE_HZ
+ * @retval None
+ */
+void Telemetry_SetRate(uint32_t rateHz)
+{
+  if(rateHz > TELEMETRY_MAX_RATE_HZ)
+    rateHz = TELEMETRY_MAX_RATE_HZ;
+
+  framePeriodMs = (rateHz == 0) ? 0 : 1000 / rateHz;
+}
+
+/**
+ * @brief  Stores the latest playback sample. Called from the audio interrupts:
+ *         only copies the sample, encoding happens in Telemetry_Process.
+ *         Must not be called from two interrupt priorities at once.
+ * @param  sample: values to publish
+ * @retval None
+ */
+void Telemetry_PublishPlayback(const TelemetryPlaybackSample* sample)
+{
+  if(sample->dspCycles > pendingDspCyclesMax)
+    pendingDspCyclesMax = sample->dspCycles;
+
+  latestSequence++;
+  __DMB();
+  latestSample = *sample;
+  __DMB();
+  latestSequence++;
+}
+
+/**
+ * @brief  Sends one frame when the period has elapsed and USART1 is free.
+ *         Called from the main loop.
+ * @param  None
+ * @retval None
+ */
+void Telemetry_Process(void)
+{
+  TelemetryPlaybackSample sample;
+  uint32_t sequence;
+
+  if(framePeriodMs == 0 || HAL_GetTick() - lastFrameTick < framePeriodMs)
+    return;
+
+  if(USART1_IsTransmitting())
+    return;
+
+  // retries while an interrupt is in the middle of publishing
+  do
+  {
+    sequence = latestSequence;
+    __DMB();
+    sample = latestSample;
+    __DMB();
+  } while((sequence & 1) || sequence != latestSequence);
+
+  // nothing published yet
+  if(sequence == 0)
+    return;
+
+  // taken and cleared in one exclusive access (LDREX/STREX), a larger value
+  // the audio interrupts store in between makes it retry instead of being lost
+  sample.dspCyclesMax = __atomic_exchange_n(&pendingDspCyclesMax, 0, __ATOMIC_RELAXED);
+  sample.cyclesPerPacket = SystemCoreClock / 1000;
+
+  uint32_t length = TelemetryFrame_Encode(TELEMETRY_TYPE_PLAYBACK, frameSequence, &sample, sizeof(sample), frameBuffer);
+
+  SCB_CleanDCache_by_Addr((uint32_t*)frameBuffer, (length + TELEMETRY_CACHE_LINE_SIZE - 1) & ~(TELEMETRY_CACHE_LINE_SIZE - 1));
+  if(USART1_TransmitDMA(frameBuffer, length))
+  {
+    frameSequence++;
+    lastFrameTick = HAL_GetTick();
+  }
+  else
+  {
+    Telemetry_KeepDspCyclesMax(sample.dspCyclesMax);
+  }
+}
+
+/**
+ * @brief  Puts back the maximum of a frame that was not sent, unless the audio
+ *         interrupts have stored a larger one since.
+ * @param  cyclesMax: maximum taken for the frame
+ * @retval None
+ */
+static void Telemetry_KeepDspCyclesMax(uint32_t cyclesMax)
+{
+  uint32_t pending = pendingDspCyclesMax;
+
+  while(cyclesMax > pending)
+  {
+    if(__atomic_compare_exchange_n(&pendingDspCyclesMax, &pending, cyclesMax, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+      break;
+  }
+}
@@ -0,0 +1,172 @@
+/**
+  ******************************************************************************
+  * @file    telemetry_frame.c
+  * @brief   COBS framing and CRC of the telemetry stream.
+  ******************************************************************************
+  */
+
+#include "telemetry_frame.h"
+#include <string.h>
+
+// private function declarations -----------------------------------------------
+static uint32_t TelemetryFrame_CobsEncode(const uint8_t* input, uint32_t length, uint8_t* output);
+static int32_t  TelemetryFrame_CobsDecode(const uint8_t* input, uint32_t length, uint8_t* output, uint32_t capacity);
+
+/**
+ * @brief  CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF), bitwise to stay small.
+ * @param  data: bytes to check
+ * @param  length: number of bytes
+ * @retval crc
+ */
+uint16_t TelemetryFrame_Crc16(const uint8_t* data, uint32_t length)
+{
+  uint16_t crc = 0xFFFF;
+
+  for(uint32_t i = 0; i < length; i++)
+  {
+    crc ^= (uint16_t)data[i] << 8;
+    for(uint8_t bit = 0; bit < 8; bit++)
+      crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+  }
+
+  return crc;
+}
+
+/**
+ * @brief  Builds a complete frame, delimiters included.
+ * @param  type: TELEMETRY_TYPE_*
+ * @param  sequence: frame counter
+ * @param  payload: payload bytes, at most TELEMETRY_MAX_PAYLOAD_SIZE
+ * @param  payloadLength: payload size
+ * @param  frame: output, at least TELEMETRY_MAX_FRAME_SIZE bytes
+ * @retval number of bytes to send, 0 if the payload is too large
+ */
+uint32_t TelemetryFrame_Encode(uint8_t type, uint16_t sequence, const void* payload, uint32_t payloadLength, uint8_t* frame)
+{
+  uint8_t raw[TELEMETRY_MAX_RAW_SIZE];
+  TelemetryFrameHeader header = { TELEMETRY_PROTOCOL_VERSION, type, sequence };
+
+  if(payloadLength > TELEMETRY_MAX_PAYLOAD_SIZE)
+    return 0;
+
+  memcpy(raw, &header, sizeof(header));
+  memcpy(raw + sizeof(header), payload, payloadLength);
+
+  uint32_t rawLength = sizeof(header) + payloadLength;
+  uint16_t crc = TelemetryFrame_Crc16(raw, rawLength);
+  raw[rawLength++] = crc & 0xFF;
+  raw[rawLength++] = crc >> 8;
+
+  // the leading delimiter ends any log text sent before the frame
+  uint32_t length = 0;
+  frame[length++] = TELEMETRY_FRAME_DELIMITER;
+  length += TelemetryFrame_CobsEncode(raw, rawLength, frame + length);
+  frame[length++] = TELEMETRY_FRAME_DELIMITER;
+
+  return length;
+}
+
+/**
+ * @brief  Decodes the bytes found between two delimiters.
+ * @param  encoded: COBS data without delimiters
+ * @param  encodedLength: number of bytes
+ * @param  header: decoded header
+ * @param  payload: decoded payload
+ * @param  payloadCapacity: size of payload
+ * @retval payload length, or -1 if the data is not a valid frame
+ */
+int32_t TelemetryFrame_Decode(const uint8_t* encoded, uint32_t encodedLength, TelemetryFrameHeader* header, void* payload, uint32_t payloadCapacity)
+{
+  uint8_t raw[TELEMETRY_MAX_RAW_SIZE];
+
+  int32_t rawLength = TelemetryFrame_CobsDecode(encoded, encodedLength, raw, sizeof(raw));
+  if(rawLength < (int32_t)(sizeof(TelemetryFrameHeader) + 2))
+    return -1;
+
+  rawLength -= 2;
+  uint16_t crc = raw[rawLength] | (raw[rawLength + 1] << 8);
+  if(crc != TelemetryFrame_Crc16(raw, rawLength))
+    return -1;
+
+  memcpy(header, raw, sizeof(TelemetryFrameHeader));
+  if(header->version != TELEMETRY_PROTOCOL_VERSION)
+    return -1;
+
+  uint32_t payloadLength = rawLength - sizeof(TelemetryFrameHeader);
+  if(payloadLength > payloadCapacity)
+    return -1;
+
+  memcpy(payload, raw + sizeof(TelemetryFrameHeader), payloadLength);
+  return payloadLength;
+}
+
+/**
+ * @brief  Consistent overhead byte stuffing, removes every zero from the data.
+ * @param  input: raw bytes
+ * @param  length: number of raw bytes
+ * @param  output: at least length + length / 254 + 1 bytes
+ * @retval encoded length
+ */
+static uint32_t TelemetryFrame_CobsEncode(const uint8_t* input, uint32_t length, uint8_t* output)
+{
+  uint32_t codeIndex = 0;
+  uint32_t outIndex = 1;
+  uint8_t code = 1;
+
+  for(uint32_t i = 0; i < length; i++)
+  {
+    if(input[i] != 0)
+    {
+      output[outIndex++] = input[i];
+      code++;
+    }
+
+    if(input[i] == 0 || code == 0xFF)
+    {
+      output[codeIndex] = code;
+      codeIndex = outIndex++;
+      code = 1;
+    }
+  }
+
+  output[codeIndex] = code;
+  return outIndex;
+}
+
+/**
+ * @brief  Reverses TelemetryFrame_CobsEncode.
+ * @param  input: encoded bytes without delimiters
+ * @param  length: number of encoded bytes
+ * @param  output: decoded bytes
+ * @param  capacity: size of output
+ * @retval decoded length, or -1 on malformed input
+ */
+static int32_t TelemetryFrame_CobsDecode(const uint8_t* input, uint32_t length, uint8_t* output, uint32_t capacity)
+{
+  uint32_t inIndex = 0;
+  uint32_t outIndex = 0;
+
+  while(inIndex < length)
+  {
+    uint8_t code = input[inIndex++];
+    if(code == 0 || inIndex + code - 1 > length)
+      return -1;
+
+    for(uint8_t i = 1; i < code; i++)
+    {
+      if(outIndex >= capacity)
+        return -1;
+      output[outIndex++] = input[inIndex++];
+    }
+
+    // a full block carries no implicit zero, neither does the last one
+    if(code != 0xFF && inIndex < length)
+    {
+      if(outIndex >= capacity)
+        return -1;
+      output[outIndex++] = 0;
+    }
+  }
+
+  return outIndex;
+}
@@ -0,0 +1,158 @@
+/**
+  ******************************************************************************
+  * @file    lcd_compositor.h
+  * @brief   Retained-mode drawing for the LCD. Widgets mark the rectangles
+  *          they cover as dirty; once per frame the dirty rectangles are
+  *          coalesced and the scene is rendered again, clipped to each of them,
+  *          into a queue of fills and blits that DMA2D executes from its
+  *          interrupt while the main loop goes on. Drawing goes to a back
+  *          buffer which LTDC shows from the next vertical blanking.
+  ******************************************************************************
+  */
+
+// define to prevent recursive inclusion ---------------------------------------
+#ifndef __LCD_COMPOSITOR_H__
+#define __LCD_COMPOSITOR_H__
+
+// includes --------------------------------------------------------------------
+#include "stm32f769i_discovery_lcd.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// defines ---------------------------------------------------------------------
+#define LCD_COMPOSITOR_WIDTH            800
+#define LCD_COMPOSITOR_HEIGHT           480
+// fully transparent ARGB8888, LCD_COLOR_TRANSPARENT of the BSP is opaque black
+#define LCD_COMPOSITOR_TRANSPARENT      0x00000000
+
+// dirty rectangles kept per frame, beyond that the closest ones are merged
+#define LCD_COMPOSITOR_MAX_DIRTY_RECTS  16
+// fills and blits queued per frame, a full queue is executed before going on
+#define LCD_COMPOSITOR_MAX_OPS          256
+// pixels rasterized by the CPU (text, circles) per frame
+#define LCD_COMPOSITOR_STAGING_PIXELS   (64 * 1024)
+// pixels of the sprites rendered at startup
+#define LCD_COMPOSITOR_ATLAS_PIXELS     (128 * 1024)
+
+#define LCD_DMA2D_IRQ_PREPRIO           13
+#define LCD_LTDC_IRQ_PREPRIO            13
+
+// AHB cycles DMA2D waits between two accesses, leaves SDRAM and bus matrix
+// time to the LTDC scanout (92 MB/s at 60 Hz) and the audio DMA
+#define LCD_DMA2D_DEAD_TIME             4
+
+// typedefs --------------------------------------------------------------------
+typedef struct LcdRect
+{
+  int16_t x;
+  int16_t y;
+  int16_t width;
+  int16_t height;
+} LcdRect;
+
+typedef enum LcdCompositorOpType
+{
+  LCD_COMPOSITOR_FILL,            // register to memory
+  LCD_COMPOSITOR_COPY,            // ARGB8888 to ARGB8888
+  LCD_COMPOSITOR_CONVERT_RGB565,  // RGB565 to ARGB8888
+  LCD_COMPOSITOR_BLEND,           // ARGB8888 blended over the destination
+  LCD_COMPOSITOR_CONVERT_L8,      // 8 bit CLUT indices to ARGB8888
+  LCD_COMPOSITOR_CONVERT_L4       // 4 bit CLUT indices to ARGB8888, even offsets and widths
+} LcdCompositorOpType;
+
+typedef struct LcdCompositorOp
+{
+  LcdCompositorOpType type;
+  uint32_t            color;            // fill color
+  const void*         source;           // first source pixel
+  uint16_t            sourcePitch;      // source pixels per line
+  uint32_t*           destination;      // first destination pixel
+  uint16_t            destinationPitch; // destination pixels per line
+  uint16_t            width;
+  uint16_t            height;
+  const uint32_t*     clut;             // ARGB8888 colors of the L8 and L4 indices
+  uint16_t            clutSize;
+} LcdCompositorOp;
+
+// image rendered once into the atlas and blitted from there
+typedef struct LcdSprite
+{
+  const uint32_t* pixels;           // ARGB8888, width per line, NULL if not rendered
+  int16_t         width;
+  int16_t         height;
+  bool            opaque;           // copied as is, otherwise blended
+} LcdSprite;
+
+// image asset made by Tools/ImageAsset
+typedef enum LcdImageFormat
+{
+  LCD_IMAGE_L8,                     // one CLUT index per pixel
+  LCD_IMAGE_L4,                     // two per byte, first pixel in the low nibble, lines padded to even
+  LCD_IMAGE_RLE8                    // run-length encoded L8, unpacked into the atlas before drawing
+} LcdImageFormat;
+
+typedef struct LcdImage
+{
+  LcdImageFormat  format;
+  int16_t         width;
+  int16_t         height;
+  const uint32_t* clut;             // ARGB8888, opaque
+  uint16_t        clutSize;         // up to 256 colors, 16 for L4
+  const uint8_t*  data;
+  uint32_t        dataSize;
+} LcdImage;
+
+typedef struct LcdCompositorStats
+{
+  uint32_t frames;
+  uint32_t swaps;                   // buffers shown by LTDC
+  uint32_t rects;                   // dirty rectangles rendered, after merging
+  uint32_t dirtyPixels;             // area of those rectangles
+  uint32_t ops;                     // fills and blits executed
+  uint32_t culledOps;               // dropped because an opaque op covered them
+  uint32_t pixelsWritten;           // destination pixels touched by the ops
+  uint32_t syncPixels;              // copied from the front buffer to keep the back one current
+  uint32_t sdramBytes;              // SDRAM read and written by the ops
+  uint32_t queueStalls;             // times the queue or staging area filled up
+  uint32_t clutLoads;               // DMA2D CLUT reloads for L8 and L4 images
+  uint32_t transferErrors;
+  uint32_t underruns;               // LTDC FIFO underruns, the scanout was starved of SDRAM
+} LcdCompositorStats;
+
+// draws the whole scene, the compositor clips it to the rectangle being redrawn
+typedef void (*LcdCompositor_RenderCallback)(void);
+
+// function prototypes ---------------------------------------------------------
+void LcdCompositor_Init(uint32_t* frontBuffer, uint32_t* backBuffer, uint32_t* staging, uint32_t* atlas, LcdCompositor_RenderCallback render);
+void LcdCompositor_Invalidate(int16_t x, int16_t y, int16_t width, int16_t height);
+void LcdCompositor_InvalidateAll(void);
+bool LcdCompositor_Flush(void);
+bool LcdCompositor_IsBusy(void);
+void LcdCompositor_WaitIdle(void);
+void LcdCompositor_GetStats(LcdCompositorStats* stats);
+
+// sprites, rendered with the drawing functions between begin and end
+bool LcdCompositor_BeginSprite(LcdSprite* sprite, int16_t width, int16_t height, bool opaque);
+void LcdCompositor_EndSprite(void);
+bool LcdCompositor_UnpackImage(const LcdImage* packed, LcdImage* unpacked);
+
+// drawing, only valid from the render callback or while rendering a sprite
+bool LcdCompositor_IsVisible(int16_t x, int16_t y, int16_t width, int16_t height);
+void LcdCompositor_FillRect(int16_t x, int16_t y, int16_t width, int16_t height, uint32_t color);
+void LcdCompositor_FillCircle(int16_t x, int16_t y, int16_t radius, uint32_t color);
+void LcdCompositor_DrawString(int16_t x, int16_t y, const char* text, sFONT* font, uint32_t textColor, uint32_t backColor, Text_AlignModeTypdef mode);
+void LcdCompositor_DrawImageRgb565(const uint8_t* image, int16_t x, int16_t y, int16_t width, int16_t height);
+void LcdCompositor_DrawImage(const LcdImage* image, int16_t x, int16_t y);
+void LcdCompositor_DrawSprite(const LcdSprite* sprite, int16_t x, int16_t y);
+
+// backend, DMA2D and LTDC on the board (lcd_compositor_dma2d.c)
+void LcdCompositorBackend_Init(void);
+bool LcdCompositorBackend_Start(const LcdCompositorOp* op);
+bool LcdCompositorBackend_Present(uint32_t* buffer);
+void LcdCompositor_TransferComplete(bool failed);
+void LcdCompositor_PresentComplete(void);
+void LcdCompositor_Underrun(void);
+void LcdCompositor_Dma2dIrqHandler(void);
+void LcdCompositor_LtdcIrqHandler(void);
+
+#endif // __LCD_COMPOSITOR_H__
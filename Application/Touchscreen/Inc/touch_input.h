@@ -0,0 +1,111 @@
+/**
+  ******************************************************************************
+  * @file    touch_input.h
+  * @brief   Event-driven touch input. The FT6x06 interrupt line starts an
+  *          interrupt-mode I2C read of the touch registers; the reports are
+  *          timestamped into a queue and turned into press, move and release
+  *          events, debounced in milliseconds, when the main loop asks.
+  *
+  *          Each report holds up to two points. A point follows the finger
+  *          with the same controller touch ID, so every event says which
+  *          finger it belongs to whatever order the points come in.
+  ******************************************************************************
+  */
+
+// define to prevent recursive inclusion ---------------------------------------
+#ifndef __TOUCH_INPUT_H__
+#define __TOUCH_INPUT_H__
+
+// includes --------------------------------------------------------------------
+#include <stdbool.h>
+#include <stdint.h>
+
+// defines ---------------------------------------------------------------------
+// reports waiting for the main loop, power of two
+#define TOUCH_REPORT_QUEUE_SIZE   16
+// points the FT6x06 reports at once
+#define TOUCH_MAX_POINTS          2
+
+// a lift only counts once no contact came back for that long
+#define TOUCH_DEBOUNCE_MS         30
+// without reports for that long the finger is taken as lifted
+#define TOUCH_RELEASE_TIMEOUT_MS  100
+// moves shorter than that (|dx| + |dy|) are sensor jitter, as in the BSP
+#define TOUCH_JITTER_PIXELS       5
+
+// above USB, whose interrupt may write to the audio codec on the same bus
+// and would otherwise wait on a read it preempted
+#define TOUCH_I2C_IRQ_PREPRIO     2
+
+// typedefs --------------------------------------------------------------------
+typedef enum TouchEventType
+{
+  TOUCH_EVENT_DOWN,
+  TOUCH_EVENT_MOVE,
+  TOUCH_EVENT_UP
+} TouchEventType;
+
+typedef struct TouchEvent
+{
+  TouchEventType type;
+  uint8_t        finger;              // 0 to TOUCH_MAX_POINTS - 1
+  uint16_t       x;
+  uint16_t       y;
+  uint32_t       timestamp;           // HAL tick of the report, in ms
+  uint32_t       cycles;              // DWT cycle count of the report
+} TouchEvent;
+
+typedef struct TouchPoint
+{
+  uint8_t  id;                        // controller touch ID
+  uint16_t x;
+  uint16_t y;
+} TouchPoint;
+
+// one read of the touch registers, in screen coordinates; no points means
+// no contact
+typedef struct TouchReport
+{
+  uint8_t    points;
+  TouchPoint point[TOUCH_MAX_POINTS];
+  uint32_t   timestamp;               // HAL tick of the interrupt, in ms
+  uint32_t   cycles;                  // DWT cycle count of the interrupt
+} TouchReport;
+
+typedef struct TouchInputStats
+{
+  uint32_t interrupts;                // FT6x06 interrupt line edges
+  uint32_t reads;                     // I2C reads completed
+  uint32_t busyRetries;               // reads postponed, the bus was in use
+  uint32_t errors;                    // I2C errors
+  uint32_t dropped;                   // reports lost, the queue was full
+  uint32_t bounces;                   // contacts back within the debounce time
+  uint32_t unassigned;                // points with no finger free to follow them
+} TouchInputStats;
+
+// from the touch interrupt to the EQ coefficients the touch changed, written
+// by the USB interrupt
+typedef struct TouchLatencyStats
+{
+  uint32_t updates;
+  uint32_t totalUs;
+  uint32_t maxUs;
+} TouchLatencyStats;
+
+// variables -------------------------------------------------------------------
+extern TouchInputStats   touchInputStats;
+extern TouchLatencyStats touchLatencyStats;
+
+// function prototypes ---------------------------------------------------------
+void TouchInput_Reset(void);
+bool TouchInput_PostReport(const TouchReport* report);
+bool TouchInput_GetEvent(TouchEvent* event, uint32_t now);
+void TouchInput_RecordLatency(uint32_t latencyUs);
+
+// FT6x06 on the board (touch_input_ft6x06.c)
+bool TouchInput_Init(void);
+void TouchInput_Process(void);
+void TouchInput_I2cEventIrqHandler(void);
+void TouchInput_I2cErrorIrqHandler(void);
+
+#endif // __TOUCH_INPUT_H__
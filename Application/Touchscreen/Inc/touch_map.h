@@ -0,0 +1,57 @@
+/**
+  ******************************************************************************
+  * @file    touch_map.h
+  * @brief   Hit testing of touches against the widgets. The screen is cut
+  *          into square cells, each listing the few widgets that overlap it,
+  *          so finding the widget under a point costs a cell lookup and at
+  *          most TOUCH_MAP_CELL_WIDGETS rectangle tests, however many widgets
+  *          there are.
+  *
+  *          A finger that presses a slider keeps it until lifted, even once
+  *          it leaves the track, so two fingers drag two sliders at once.
+  ******************************************************************************
+  */
+
+// define to prevent recursive inclusion ---------------------------------------
+#ifndef __TOUCH_MAP_H__
+#define __TOUCH_MAP_H__
+
+// includes --------------------------------------------------------------------
+#include "touch_input.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// defines ---------------------------------------------------------------------
+#define TOUCH_MAP_WIDTH           800
+#define TOUCH_MAP_HEIGHT          480
+#define TOUCH_MAP_MAX_WIDGETS     16
+// cells of 32 x 32 pixels
+#define TOUCH_MAP_CELL_SHIFT      5
+#define TOUCH_MAP_CELL_WIDGETS    3
+
+// typedefs --------------------------------------------------------------------
+typedef enum TouchWidgetType
+{
+  TOUCH_WIDGET_CIRCLE_BUTTON,
+  TOUCH_WIDGET_RECTANGLE_BUTTON,
+  TOUCH_WIDGET_SLIDER
+} TouchWidgetType;
+
+// area that takes touches, x and y included, x + width and y + height not
+typedef struct TouchWidget
+{
+  TouchWidgetType type;
+  uint8_t         index;              // in the array of widgets of its type
+  uint16_t        x;
+  uint16_t        y;
+  uint16_t        width;
+  uint16_t        height;
+} TouchWidget;
+
+// function prototypes ---------------------------------------------------------
+void               TouchMap_Reset(void);
+bool               TouchMap_Add(TouchWidgetType type, uint8_t index, uint16_t x, uint16_t y, uint16_t width, uint16_t height);
+const TouchWidget* TouchMap_Find(uint16_t x, uint16_t y);
+const TouchWidget* TouchMap_Route(const TouchEvent* event);
+
+#endif // __TOUCH_MAP_H__
@@ -3,6 +3,7 @@
 
 // includes ----------------------------------------------------------
 #include "stm32f769i_discovery_lcd.h"
+#include "lcd_compositor.h"
 #include <stdbool.h>
 
 
@@ -21,7 +22,7 @@
 
 #define INTERNAL_BUFFER_START_ADDRESS LCD_BG_LAYER_ADDRESS + (LCD_SCREEN_WIDTH * LCD_SCREEN_HEIGHT * ARGB8888_BYTE_PER_PIXEL)
 
-#define NUMBER_OF_CIRCLE_BUTTONS 1
+#define NUMBER_OF_CIRCLE_BUTTONS 2
 #define NUMBER_OF_INCREMENT_BUTTONS 1
 #define NUMBER_OF_SLIDER_BUTTONS 8
 
@@ -38,7 +39,8 @@ typedef struct CircleButton
     bool isPressed;
     bool isIndependent;
     bool isActive;
-    uint32_t debounceTimer;
+    uint32_t debounceTimer; // HAL tick of the last toggle
+    LcdSprite sprites[2]; // released and pressed, rendered by LCD_Init
 } CircleButtonTypeDef;
 
 typedef struct RectangleButton
@@ -52,6 +54,7 @@ typedef struct RectangleButton
     char* text;
     bool isPressed;
     bool isActive;
+    LcdSprite sprites[2]; // inactive and active, rendered by LCD_Init
 } RectangleButton;
 
 typedef struct IncrementButton
@@ -77,20 +80,23 @@ typedef struct SliderKnob
     uint16_t knobY;
     uint16_t knobRadius;
     bool isPressed;
-    uint32_t debounceCount;
-    uint32_t debouceLimit;
+    uint32_t touchCycles; // DWT cycle count of the touch that set isPressed
 } SliderKnob;
 
 // function prototypes -----------------------------------------------
 void LCD_Init(void);
+void LCD_Process(void);
 void LCD_UpdateWatchdog(uint32_t* watchdogCounter);
 void LCD_UpdateButton(uint8_t buttonIndex, bool isPressed, bool shouldToggleOtherButtons);
 void LCD_DisplayKnob(uint8_t knobIndex, uint16_t newKnobY);
-void BSP_LCD_DrawPicture(const uint8_t* image, uint32_t width, uint32_t height, uint32_t xPosition, uint32_t yPosition);
-int16_t LCD_TranslateGainToKnobPosition(uint8_t knobIndex, uint16_t gain);
+int16_t LCD_TranslateGainToKnobPosition(uint8_t knobIndex, int16_t gain);
 void LCD_UpdateRectangleButton(RectangleButton* button);
 void LCD_UpdateState();
 void LCD_InitSlider(uint8_t knobIndex);
+void LCD_UpdateResponseCurve(const float* magnitude);
+void LCD_UpdateSpectrum(const float* bars);
+bool LCD_IsSpectrumShown(void);
+bool LCD_AddTouchWidgets(void);
 
 
 extern CircleButtonTypeDef circleButtons[];
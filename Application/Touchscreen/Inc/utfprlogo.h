@@ -1,4756 +1,693 @@
+// generated by Tools/ImageAsset from Application/Touchscreen/Assets/utfprlogo.png, do not edit
+#ifndef __UTFPR_LOGO_H__
+#define __UTFPR_LOGO_H__
+
+#include "lcd_compositor.h"
+
 #define UTFPR_LOGO_WIDTH (350)
 #define UTFPR_LOGO_HEIGHT (139)
-const unsigned char utfprlogo[] = ("\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\272\326y\316y\316y\316y\316y\316y\316y\316y\316"
-                                   "y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316\272\326\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\276\367y\316y\316y\316y\316y\316"
-                                   "y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316"
-                                   "y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316"
-                                   "y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316"
-                                   "y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316"
-                                   "y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316"
-                                   "y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316"
-                                   "y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316"
-                                   "y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316"
-                                   "y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316"
-                                   "y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316y\316\333"
-                                   "\336\337\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\236\367\350A\303\030\303\030\303\030\303\030"
-                                   "\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303"
-                                   "\030\303\030\303\030\303\030\303\030\303\030\307\071\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377y\316\303\030\303\030\303\030\303\030\303\030\303\030\303\030"
-                                   "\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303"
-                                   "\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030"
-                                   "\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303"
-                                   "\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030"
-                                   "\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303"
-                                   "\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030"
-                                   "\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303"
-                                   "\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030"
-                                   "\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303"
-                                   "\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030"
-                                   "\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303"
-                                   "\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030"
-                                   "\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303"
-                                   "\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030"
-                                   "\212R]\357\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\236\367\350A\303\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\303\030\307\071\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377y\316\303\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030"
-                                   "\212R]\357\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\236\367\350A\303\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\303\030\307\071\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377y\316\303\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030"
-                                   "\212R]\357\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\236\367\350A\303\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\303\030\307\071\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377y\316\303\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030"
-                                   "\212R]\357\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\236\367\350A\303\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\303\030\307\071\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377y\316\303\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030"
-                                   "\212R]\357\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\236\367\350A\303\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\303\030\307\071\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377y\316\303\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030"
-                                   "\212R]\357\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\236\367\350A\303\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\303\030\307\071\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377y\316\303\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030"
-                                   "\212R]\357\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\236\367\350A\303\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\303\030\307\071\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377y\316\303\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030"
-                                   "\212R]\357\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\236\367\350A\303\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\303\030\307\071\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377y\316\303\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030"
-                                   "\212R]\357\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\236\367\350A\303\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\303\030\307\071\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377y\316\303\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030"
-                                   "\212R]\357\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\236\367\350A\303\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\303\030\307\071\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377y\316\303\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030"
-                                   "\212R]\357\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\236\367\350A\303\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\303\030\307\071\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377y\316\303\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030"
-                                   "\212R]\357\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\236\367\350A\303\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\303\030\307\071\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377y\316\303\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030"
-                                   "\212R]\357\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\236\367\350A\303\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\303\030\307\071\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377y\316\303\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030"
-                                   "\212R]\357\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\236\367\350A\303\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\303\030\307\071\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377y\316\303\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030"
-                                   "\212R]\357\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\236\367\350A\303\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\303\030\307\071\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377y\316\303\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\303\030\303\030\303\030\303\030\303\030\303\030"
-                                   "\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303"
-                                   "\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\303\030"
-                                   "\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303"
-                                   "\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030"
-                                   "\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303"
-                                   "\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030"
-                                   "\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303"
-                                   "\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030"
-                                   "\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303"
-                                   "\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030"
-                                   "\212R]\357\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\236\367\350A\303\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\303\030\307\071\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377y\316\303\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030f)iJiJiJiJiJiJiJiJiJiJiJiJiJiJiJiJiJiJiJiJiJiJiJi"
-                                   "J\206\061\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\207\061iJiJiJiJiJiJiJiJiJiJiJiJiJiJiJiJiJiJiJiJiJiJiJiJiJiJiJiJiJi"
-                                   "JiJiJiJiJiJiJiJiJiJiJiJiJiJiJiJiJiJiJiJiJiJiJiJiJiJiJiJiJiJiJiJiJiJiJiJiJ"
-                                   "iJiJiJiJiJiJiJiJiJiJiJiJiJiJiJiJiJiJiJ\257{}\357\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\236\367"
-                                   "\350A\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\307"
-                                   "\071\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377y\316\303\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030mk]\357]\357]\357"
-                                   "]\357]\357]\357]\357]\357]\357]\357]\357]\357]\357]\357]\357]\357]\357]\357"
-                                   "]\357]\357]\357]\357]\357=\357\060\204\303\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\303\030Q\214=\357]\357]\357]\357]\357]\357]\357"
-                                   "]\357]\357]\357]\357]\357]\357]\357]\357]\357]\357]\357]\357]\357]\357]\357"
-                                   "]\357]\357]\357]\357]\357]\357]\357]\357]\357]\357]\357]\357]\357]\357]\357"
-                                   "]\357]\357]\357]\357]\357]\357]\357]\357]\357]\357]\357]\357]\357]\357]\357"
-                                   "]\357]\357]\357]\357]\357]\357]\357]\357]\357]\357]\357]\357]\357]\357]\357"
-                                   "]\357]\357]\357]\357]\357]\357]\357]\357]\357]\357]\357]\357]\357]\357]\357"
-                                   "]\357]\357]\357}\357\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\236\367\350A\303\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\307\071\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377y\316\303\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\216s\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377q\214\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\303\030\262\224\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\236\367\350A\303\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\307\071\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377y\316\303\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\216s\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377q\214\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\303\030\262\224\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\236\367\350A\303\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\307\071\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377y\316\303\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\216s\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377q\214\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\303\030\262\224\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\236\367\350A\303\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\307\071\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377y\316\303\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\216s\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377q\214\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\303\030\262\224\377\377\377\377\377\377\377\377-\377\352\376\352\376\352\376"
-                                   "\352\376\352\376\352\376\352\376\352\376\352\376\352\376\352\376\352\376\352"
-                                   "\376\352\376\352\376\352\376\352\376\352\376\352\376\352\376\352\376\352\376"
-                                   "\352\376\352\376\352\376\352\376\352\376\352\376\352\376\352\376\352\376\352"
-                                   "\376\352\376\352\376\352\376\352\376\352\376\352\376\352\376\352\376\352\376"
-                                   "\352\376\352\376\352\376\352\376\352\376\352\376\352\376\352\376\352\376\352"
-                                   "\376\352\376\352\376\352\376\352\376\352\376\352\376\352\376\352\376\352\376"
-                                   "\352\376\352\376\352\376\352\376\352\376\352\376\352\376\352\376\352\376\352"
-                                   "\376\352\376\352\376\352\376\352\376\352\376\352\376\352\376\352\376\352\376"
-                                   "\352\376t\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\236\367\350A\303\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\303\030\307\071\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377y\316\303\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\216s\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "q\214\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303"
-                                   "\030\262\224\377\377\377\377\377\377\377\377\304\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376\200"
-                                   "\376O\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\236\367\350A\303\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\303\030\307\071\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377y\316\303\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\216s\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "q\214\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303"
-                                   "\030\262\224\377\377\377\377\377\377\377\377\304\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "O\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\236\367\350A\303\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\303\030\307\071\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377y\316\303\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\216s\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "q\214\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303"
-                                   "\030\262\224\377\377\377\377\377\377\377\377\304\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "O\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\236\367\350A\303\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\303\030\307\071\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377y\316\303\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\216s\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "q\214\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303"
-                                   "\030\262\224\377\377\377\377\377\377\377\377\304\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "O\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\236\367\350A\303\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\303\030\307\071\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377y\316\303\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\216s\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "q\214\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303"
-                                   "\030\262\224\377\377\377\377\377\377\377\377\304\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "O\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\236\367\350A\303\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\303\030\307\071\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377y\316\303\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\216s\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "q\214\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303"
-                                   "\030\262\224\377\377\377\377\377\377\377\377\304\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "O\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\236\367\350A\303\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\303\030\307\071\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377y\316\303\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\216s\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "q\214\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303"
-                                   "\030\262\224\377\377\377\377\377\377\377\377\304\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "O\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\236\367\350A\303\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\303\030\307\071\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377y\316\303\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\216s\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "q\214\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303"
-                                   "\030\262\224\377\377\377\377\377\377\377\377\304\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "O\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\236\367\350A\303\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\303\030\307\071\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377y\316\303\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\216s\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "q\214\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303"
-                                   "\030\262\224\377\377\377\377\377\377\377\377\304\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "O\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\236\367\350A\303\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\303\030\307\071\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377y\316\303\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\216s\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "q\214\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303"
-                                   "\030\262\224\377\377\377\377\377\377\377\377\304\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "O\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\236\367\350A\303\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\303\030\307\071\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377y\316\303\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\216s\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "q\214\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303"
-                                   "\030\262\224\377\377\377\377\377\377\377\377\304\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "O\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\236\367\350A\303\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\303\030\307\071\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377y\316\303\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\216s\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "q\214\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303"
-                                   "\030\262\224\377\377\377\377\377\377\377\377\304\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "O\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\236\367\350A\303\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\303\030\307\071\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377y\316\303\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\216s\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "q\214\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303"
-                                   "\030\262\224\377\377\377\377\377\377\377\377\304\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "O\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\236\367\350A\303\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\303\030\307\071\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377y\316\303\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\216s\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "q\214\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303"
-                                   "\030\262\224\377\377\377\377\377\377\377\377\304\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "O\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\236\367\350A\303\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\303\030\307\071\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377y\316\303\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\216s\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "q\214\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303"
-                                   "\030\262\224\377\377\377\377\377\377\377\377\304\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "O\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\236\367\350A\303\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\303\030\307\071\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377y\316\303\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\216s\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "q\214\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303"
-                                   "\030\262\224\377\377\377\377\377\377\377\377\304\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376\200\376\200\376\200\376\200\376\200\376\200\376\200\376\200\376\200"
-                                   "\376\200\376\200\376\200\376\200\376\200\376\200\376\200\376\200\376\200\376"
-                                   "\200\376\200\376\200\376\200\376\200\376\200\376\200\376\200\376\200\376\200"
-                                   "\376\200\376\200\376\200\376\200\376\200\376\200\376\200\376\200\376\200\376"
-                                   "\200\376\200\376\200\376\200\376\200\376\200\376\200\376\200\376\200\376\200"
-                                   "\376\200\376\200\376\200\376\200\376\200\376\200\376\200\376\200\376\200\376"
-                                   "\200\376\200\376\240\376O\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\236\367\350A"
-                                   "\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\307\071"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377y\316\303\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\216s\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377q\214\303\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\303\030\262\224\377\377\377\377\377\377\377\377\304\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376O\377P\377P\377P\377P\377P\377P\377P\377P\377"
-                                   "P\377P\377P\377P\377P\377P\377P\377P\377P\377P\377P\377P\377P\377P\377P\377"
-                                   "P\377P\377P\377P\377P\377P\377P\377P\377P\377P\377P\377P\377P\377P\377P\377"
-                                   "P\377P\377P\377P\377P\377P\377P\377P\377P\377P\377P\377P\377P\377P\377P\377"
-                                   "P\377P\377P\377P\377P\377\270\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\236\367\350"
-                                   "A\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\307\071"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377y\316\303\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\216s\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377q\214\303\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\303\030\262\224\377\377\377\377\377\377\377\377\304\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376\200\376\334\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\236\367\350A\303\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\303\030\307\071\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377y"
-                                   "\316\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\216s\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377q\214\303\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\262\224\377\377\377\377"
-                                   "\377\377\377\377\304\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376\200\376\334\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\236\367\350A\303\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\303\030\307\071\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377y\316\303\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\216s\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "q\214\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303"
-                                   "\030\262\224\377\377\377\377\377\377\377\377\304\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "\200\376\334\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\236\367\350A"
-                                   "\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\307\071"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377y\316\303\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\216s\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377q\214\303\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\303\030\262\224\377\377\377\377\377\377\377\377\304\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376\200\376\334\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\236\367\350A\303\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\303\030\307\071\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377y"
-                                   "\316\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\216s\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377q\214\303\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\262\224\377\377\377\377"
-                                   "\377\377\377\377\304\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376\200\376\334\377\377\377"
-                                   "\377\377\377\377\276\367\323\234\323\234\323\234\323\234\323\234\323\234\323"
-                                   "\234\323\234\323\234\323\234\323\234\323\234\323\234\323\234\323\234\323\234"
-                                   "\323\234\323\234\323\234\323\234\323\234\323\234\323\234\323\234\323\234\323"
-                                   "\234\323\234\323\234\323\234\323\234\323\234\323\234\323\234\323\234\323\234"
-                                   "\323\234\323\234\323\234\323\234\323\234\323\234\323\234\323\234\323\234\323"
-                                   "\234\323\234\323\234\323\234\323\234\323\234\323\234\323\234\323\234\323\234"
-                                   "Y\316\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377<\347"
-                                   "-k\014c\014c\014c\014c\014c\014c\014c\014c\014c\014c\014c\014c\014c\014c\014c\014c\014c\014"
-                                   "c\014c\014c\014c\014cMk\256s\020\204\262\224\323\234\323\234\323\234\323\234\024"
-                                   "\245\070\306\034\347<\347\337\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\222\224\014c\014c\014c\014c\014c\014c\014c\014c\014c\014c\014c\014c\014"
-                                   "c\014c\014c\014c\014c\014c\014c\014c\014c\014c\014c\014c\014c\014c\014c\014cMk\257{\222\224"
-                                   "\323\234\323\234\323\234U\255\232\326\034\347}\357\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\236\367\350A\303\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\303\030\307\071\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377y\316\303\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\216s\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377q"
-                                   "\214\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303"
-                                   "\030\262\224\377\377\377\377\377\377\377\377\304\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "\200\376\334\377\377\377\377\377\377\377]\357\303\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030Q\214\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\333\336\004!\303\030\303"
-                                   "\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030"
-                                   "\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\303\030"
-                                   "\344\040\247\061\212R\065\255\276\367\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\014"
-                                   "c\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303"
-                                   "\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030"
-                                   "\303\030\303\030\303\030\303\030\303\030\303\030\303\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\303\030\303\030\303\030%)\350\071nk\064\245\276\367\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\236\367\350A\303\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\303\030\307\071\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377y"
-                                   "\316\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\216s\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377q\214\303\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\262\224\377\377\377\377"
-                                   "\377\377\377\377\304\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376\200\376\334\377\377\377"
-                                   "\377\377\377\377]\357\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\303\030Q\214\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\333\336\004!\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\303\030\303\030"
-                                   "E)\061\204\333\336\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\014c\303\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\303\030\303\030\303\030\303\030%)\317{\030\306\337\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\236\367\350A"
-                                   "\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\307\071"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377y\316\303\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\216s\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377q\214\303\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\303\030\262\224\377\377\377\377\377\377\377\377\304\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376\200\376\334\377\377\377\377\377\377\377]\357\303"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\303\030Q\214\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\333\336\004!\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\303\030\307\071\226"
-                                   "\265\337\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\014c\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\303\030%)q\214<\347\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\236\367\350A\303\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\303\030\307\071\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377y\316\303\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\216s\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377q"
-                                   "\214\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303"
-                                   "\030\262\224\377\377\377\377\377\377\377\377\304\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "\200\376\334\377\377\377\377\377\377\377]\357\303\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030Q\214\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\333\336\004!\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\343\030ns]\357\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\014c\303\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\303\030\350A\272\326\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\236\367\350A\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\303\030\307\071\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377y"
-                                   "\316\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\216s\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377q\214\303\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\262\224\377\377\377\377"
-                                   "\377\377\377\377\304\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376\200\376\334\377\377\377"
-                                   "\377\377\377\377]\357\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\303\030Q\214\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\333\336\004!\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\303\030\212R}\357\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\014c\303\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\307\071"
-                                   "\373\336\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\236\367\350A"
-                                   "\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\307\071"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377y\316\303\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\216s\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377q\214\303\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\303\030\262\224\377\377\377\377\377\377\377\377\304\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376\200\376\334\377\377\377\377\377\377\377]\357\303"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\303\030Q\214\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\333\336\004!\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\303\030IJ\337\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\014c\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\303\030IJ\034\347\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\236\367\350A\303\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\303\030\307\071\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377y\316\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\216s\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377q\214\303\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\262\224\377"
-                                   "\377\377\377\377\377\377\377\304\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376\200\376\334\377"
-                                   "\377\377\377\377\377\377]\357\303\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\303\030Q\214\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\333\336\004!\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\317{\337\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\014c\303\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\303\030iJ\236\367\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\236\367\350"
-                                   "A\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\307\071"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377y\316\303\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\216s\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377q\214\303\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\303\030\262\224\377\377\377\377\377\377\377\377\304\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376\200\376\334\377\377\377\377\377\377\377]\357\303"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\303\030Q\214\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\333\336\004!\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\004!\327\275\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\014c\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\343\030U\255\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\236\367\350A\303\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\303\030\307\071\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377y\316\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\216s\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377q\214\303\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\262\224\377"
-                                   "\377\377\377\377\377\377\377\304\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376\200\376\334\377"
-                                   "\377\377\377\377\377\377]\357\303\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\303\030Q\214\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\333\336\004!\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\247\071<\347"
-                                   "\377\377\377\377\377\377\377\377\377\377\014c\303\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\307\071\333\336\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\236\367\350A"
-                                   "\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\307\071"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377y\316\303\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\216s\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377q\214\303\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\303\030\262\224\377\377\377\377\377\377\377\377\304\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376\200\376\334\377\377\377\377\377\377\377]\357\303"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\303\030Q\214\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\333\336\004!\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303"
-                                   "\030\303\030\303\030\243\030\243\030\243\030\243\030\243\030\303\030\303\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\303\030\363\234\377\377\377\377\377\377\377"
-                                   "\377\377\377\014c\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\303\030\303\030\303\030\303\030\303\030\303\030"
-                                   "\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\303\030\303\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030Q\214"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\236\367\350A\303\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\303\030\307\071\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377y\316\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\216s\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377q\214"
-                                   "\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030"
-                                   "\262\224\377\377\377\377\377\377\377\377\304\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "\200\376\334\377\377\377\377\377\377\377]\357\303\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030Q\214\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\333\336\004!\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\343\030"
-                                   "y\316\272\326\273\336\273\336\273\336\273\336\273\336\070\306\030\306\226\265"
-                                   "\263\234r\214\061\204\020\204\020\204)Jf\061\303\030\303\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\350A\377\377\377\377\377\377\377\377\377\377\014c\303\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\317"
-                                   "{\273\336\273\336\273\336\273\336\273\336\273\336\273\336\273\336\273\336"
-                                   "\273\336\273\336Y\316\030\306\030\306u\255\323\234\222\224\061\214\020\204ns\247"
-                                   "\061\303\030\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\303\030\350A\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\236\367\350A\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\303\030\307\071\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377y\316\303"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\216"
-                                   "s\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377q\214\303\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\303\030\262\224\377\377\377\377"
-                                   "\377\377\377\377\304\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376\200\376\334\377\377\377"
-                                   "\377\377\377\377]\357\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\303\030Q\214\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\333\336\004!\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\344\030\236\367\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\276\367Y\316nsE)\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\344\030"
-                                   "\367\275\377\377\377\377\377\377\377\377\014c\303\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030q\214\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\337\377"
-                                   "\070\306,c\343\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\303\030\367\275\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\236\367"
-                                   "\350A\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\307"
-                                   "\071\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377y\316\303\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\216s\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377q\214\303\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\303\030\262\224\377\377\377\377\377\377\377\377\304"
-                                   "\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376\200\376\334\377\377\377\377\377\377\377]\357"
-                                   "\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\303\030Q\214\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\333\336\004!\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\344\030\236\367\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\337\377U\255%)\303\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\257{\377\377\377"
-                                   "\377\377\377\377\377\014c\303\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\303\030q\214\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\236\367\360"
-                                   "\203\343\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\303\030\317{\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\236\367\350A\303"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\307\071\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377y\316\303\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\216s\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377q\214\303\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\303\030\262\224\377\377\377\377\377\377\377\377\304\376`"
-                                   "\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376\200\376\334\377\377\377\377\377\377\377]\357\303"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\303\030Q\214\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\333\336\004!\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\344\030\236\367\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\070\306\004!\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\350A\377\377\377"
-                                   "\377\377\377\377\377\014c\303\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\303\030q\214\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\353Z\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\303\030)J\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\236\367\350A\303\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\307\071\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377y\316\303\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\216s\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377q\214\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\303\030\262\224\377\377\377\377\377\377\377\377\304\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376\200\376\334\377\377\377\377\377\377\377]\357\303\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030Q\214\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\333\336\004!\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\344\030"
-                                   "\236\367\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\262\224\303\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\303\030\377\377\377\377\377\377"
-                                   "\377\377\014c\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\303\030q\214\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377Y\316"
-                                   "f\061\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\303\030f\061\276\367\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\236\367\350A\303\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\303\030\307\071\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377y\316\303\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\216s\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "q\214\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303"
-                                   "\030\262\224\377\377\377\377\377\377\377\377\304\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "\200\376\334\377\377\377\377\377\377\377]\357\303\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\303\030\303\030\303\030\303\030\303\030"
-                                   "\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303"
-                                   "\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030"
-                                   "\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030Q\214\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\333\336\004!\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\344\030"
-                                   "\236\367\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377}\357\212R\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\303\030\272\326\377\377\377\377\377\377"
-                                   "\014c\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\303\030q\214\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\276\367ns\303"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\303\030]\357\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\236\367\350A\303\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\303\030\307\071\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377y\316\303\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\216s\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377q"
-                                   "\214\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303"
-                                   "\030\262\224\377\377\377\377\377\377\377\377\304\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "\200\376\334\377\377\377\377\377\377\377]\357\303\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\014c\216s\216s\216s\216s\216s\216s\216"
-                                   "s\216s\216s\216s\216s\216s\216s\216s\216s\216s\216s\216s\216s\216s\216s\216"
-                                   "s\216s\216s\216s\216s\216s\216s\216s\216s\216s\216s\216s\266\265\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\333\336\004!\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\344\030"
-                                   "\236\367\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377U\255\303\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\303\030\327\275\377\377\377\377\377"
-                                   "\377\014c\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\303\030q\214\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377Q"
-                                   "\214\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\303\030]\357\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\236\367\350A\303\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\303\030\307\071\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377y\316\303\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\216s\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "q\214\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303"
-                                   "\030\262\224\377\377\377\377\377\377\377\377\304\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "\200\376\334\377\377\377\377\377\377\377]\357\303\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\333\336\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\333\336\004!\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\344\030\236\367\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\071\306\344\040\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030"
-                                   "\327\275\377\377\377\377\377\377\014c\303\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\303\030q\214\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\071\316\303\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\303\030]\357\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\236\367"
-                                   "\350A\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\307"
-                                   "\071\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377y\316\303\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\216s\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377q\214\303\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\303\030\262\224\377\377\377\377\377\377\377\377\304"
-                                   "\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376\200\376\334\377\377\377\377\377\377\377]\357"
-                                   "\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\333\336"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\333\336\004!\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\344\030\236\367\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "<\347\206\061\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\303\030\327\275\377\377\377\377\377\377\014c\303\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030q\214\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377y\316\303\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030]\357\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\236\367\350A\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\303\030\307\071\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377y"
-                                   "\316\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\216s\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377q\214\303\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\262\224\377\377\377\377"
-                                   "\377\377\377\377\304\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376\200\376\334\377\377\377"
-                                   "\377\377\377\377]\357\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\333\336\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\333\336\004!\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\344"
-                                   "\030\236\367\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377<\347\206\061\303\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\303\030\327\275\377\377\377\377"
-                                   "\377\377\014c\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\303\030q\214\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "u\255\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\303\030]\357\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\236\367\350A\303\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\303\030f\061\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377y\316\303\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\216s\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "q\214\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303"
-                                   "\030\262\224\377\377\377\377\377\377\377\377\304\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "\200\376\334\377\377\377\377\377\377\377]\357\303\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\333\336\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\333\336\004!\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\344\030\236\367\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\034\347f\061\303\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\327"
-                                   "\275\377\377\377\377\377\377\014c\303\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\303\030q\214\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377Q\214\303\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\303\030\206\061\337\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\236\367\350"
-                                   "A\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030f\061\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377y\316\303\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\216s\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377q\214\303\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\303\030\262\224\377\377\377\377\377\377\377\377\304\376`"
-                                   "\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376\200\376\334\377\377\377\377\377\377\377]\357\303"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\333\336\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\333\336\004!\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\344\030\236\367\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\367\275\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\303\030\327\275\377\377\377\377\377\377\014c\303\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030q\214"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377]\357\212R\303\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030)J\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\236\367\350A\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\303\030f\061\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377y\316"
-                                   "\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\216s\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377q\214\303\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\262\224\377\377\377\377"
-                                   "\377\377\377\377\304\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376\200\376\334\377\377\377"
-                                   "\377\377\377\377]\357\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\333\336\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\333\336\004!\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\344"
-                                   "\030\236\367\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377Q\214\303\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\303\030\030\306\377\377\377\377\377"
-                                   "\377\014c\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\303\030q\214\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377u\255\004!\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\303\030\357{\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\236\367\350A\303\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\303\030f\061\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\030\306\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\216s\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377q\214"
-                                   "\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030"
-                                   "\262\224\377\377\377\377\377\377\377\377\304\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "\200\376\334\377\377\377\377\377\377\377]\357\303\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\333\336\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\333\336\004!\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\344\030\236\367\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\272\326\207\061\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030"
-                                   "\276\367\377\377\377\377\377\377\014c\303\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\303\030q\214\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\236\367\247\071\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\303\030Y\316\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\236\367\350"
-                                   "A\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030E)\337\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\061\214\303\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\216s\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377q\214\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\303\030\262\224\377\377\377\377\377\377\377\377\304\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376\200\376\334\377\377\377\377\377\377\377]\357\303\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\333\336\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\333\336\004!\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\344\030\236\367\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377ns\303\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030%)\377\377\377\377\377\377\377\377\014c\303\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030q\214\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\272\326IJ\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\303\030\010B\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\236"
-                                   "\367\350A\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\303\030\232\326\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377Mk\303\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\216s\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377q\214\303\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\303\030\262\224\377\377\377\377\377\377\377\377\304"
-                                   "\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376\200\376\334\377\377\377\377\377\377\377]\357"
-                                   "\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\333\336"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\333\336\004!\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\344\030\236\367\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\323\234\344\040"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\303\030\313Z\377\377\377\377\377\377\377\377\014c\303\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030q\214\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\337"
-                                   "\377\333\336\222\224\307\071\303\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\222\224\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\236\367\350A\303\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\303\030\327\275\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377-"
-                                   "k\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\216s\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377q\214\303\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\262\224\377\377\377\377"
-                                   "\377\377\377\377\304\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376\200\376\334\377\377\377"
-                                   "\377\377\377\377]\357\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\333\336\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\333\336\004!\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\344"
-                                   "\030\236\367\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377}"
-                                   "\357\256s\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\303\030U\255\377\377\377\377\377\377\377\377"
-                                   "\014c\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\303\030jR\020\204\020\204\020\204\020\204\020\204\020\204\020\204\020\204\020"
-                                   "\204\020\204\020\204\020\204\020\204\020\204\020\204\020\204\020\204jR\307\071\206"
-                                   "\061\304\030\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030jJ]\357\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\236\367\350A\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\303\030U\255\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377~\367\010B\303\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\257{\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377q\214\303\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\303\030\262\224\377\377\377\377\377\377\377\377"
-                                   "\304\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376\200\376\334\377\377\377\377\377\377\377"
-                                   "]\357\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\333"
-                                   "\336\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\333\336\004!\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\344\030~\357\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\337\377\337\377\337\377\373\336Y\316Q\214\247\061\303\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030f\061}\357\377\377\377\377\377\377\377\377\014c\303\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\303\030\303\030\303\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\303\030\004!\327\275\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\236\367"
-                                   "\350A\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303"
-                                   "\030\014c\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377<\347\206\061\303\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\364\234\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377q\214\303\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\303\030\262\224\377\377\377\377\377\377\377\377\304\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376\200\376\334\377\377\377\377\377\377\377]\357\303"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\333\336\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\333\336\004!\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\303\030\262\224\323\234\323\234"
-                                   "\323\234\323\234\323\234\323\234\323\234\323\234\323\234\263\234\061\214\353"
-                                   "Z\010B\010B%)\343\030\303\030\303\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\360{\377\377"
-                                   "\377\377\377\377\377\377\377\377\014c\303\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\343"
-                                   "\030\257{\337\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\276\367)B\303\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\252R\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377z\326\004!\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\303\030\327\275\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377q\214\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\303\030\262\224\377\377\377\377\377\377\377\377\304\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376\200\376\334\377\377\377\377\377\377\377]\357\303\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\333\336\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\333\336\004!\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\303\030\303\030\303\030\303\030\303\030\303\030\303"
-                                   "\030\303\030\303\030\303\030\303\030\303\030\303\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\303\030f\061\333\336\377\377\377\377\377\377"
-                                   "\377\377\377\377\014c\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030-c}\357\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377Mk\303\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\004!\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\327\275\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\303\030\327\275\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377q\214"
-                                   "\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030"
-                                   "\262\224\377\377\377\377\377\377\377\377\304\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "\200\376\334\377\377\377\377\377\377\377]\357\303\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\333\336\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\333\336\004!\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\303\030\061\214\337\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\014c\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\303\030\253Z\034\347\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\256s\303\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\272\326\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\317{\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\303\030\327\275\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "q\214\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303"
-                                   "\030\262\224\377\377\377\377\377\377\377\377\304\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "\200\376\334\377\377\377\377\377\377\377]\357\303\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\333\336\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\333\336\004!\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\303\030\212R\276\367\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\014c\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\303\030\344\040Q\214\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\257{\303\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\064\245\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\212R\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\303\030%)y\316\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377q\214"
-                                   "\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030"
-                                   "\262\224\377\377\377\377\377\377\377\377\304\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "\200\376\334\377\377\377\377\377\377\377]\357\303\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\333\336\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\333\336\004!\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030E)\373\336\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\014c\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\303\030\243\030\004!\353Zy\316\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\263\234\344\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\303\030\216s\337\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377}"
-                                   "\357%)\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\303\030)J<\347\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377q\214\303\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\262\224\377\377"
-                                   "\377\377\377\377\377\377\304\376`\376`\376`\376`\376`\376`\376`\376`\376`"
-                                   "\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376\200\376\334\377"
-                                   "\377\377\377\377\377\377]\357\303\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\333\336\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\333\336\004"
-                                   "!\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\004!\266\265\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\014c\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030E)\313Z\226"
-                                   "\265\236\367\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\267\275\005!\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\010B\034\347\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\363\234\303\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030"
-                                   "jJ]\357\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377q\214\303\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\262\224\377\377\377\377"
-                                   "\377\377\377\377\304\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376\200\376\334\377\377\377"
-                                   "\377\377\377\377]\357\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\333\336\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\333\336\004!\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030)J\071\306\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\014c\303\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030%!\010B\216su\255\333\336\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\232\326\206\061\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\344\040\024\245\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\212R\303\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\357{\337\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377q\214\303\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\303\030\262\224\377\377\377\377\377"
-                                   "\377\377\377\304\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376\200\376\334\377\377\377\377"
-                                   "\377\377\377]\357\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\333\336\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\333\336\004!\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\303\030\303\030\313Z\333\336\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\014c\303"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\303\030\303\030\303\030\303\030\303\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\303\030\212R\272\326<\347\337\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\337\377)J\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\303\030\253Z\337\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\034\347\303\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030"
-                                   "q\214\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377q\214\303\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\262\224\377\377"
-                                   "\377\377\377\377\377\377\304\376`\376`\376`\376`\376`\376`\376`\376`\376`"
-                                   "\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376\200\376\334\377"
-                                   "\377\377\377\377\377\377]\357\303\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\333\336\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\333\336\004"
-                                   "!\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\303\030\247\071\323\234\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\014c\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030%)\247\071\247\061\247\071E)\343\030\303\030\303\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\303\030\313Z<\347\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\256s\303\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\303\030\004!\070\306\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\257{\303\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030Y\316"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377q\214\303\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\262\224\377\377\377\377"
-                                   "\377\377\377\377\304\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376\200\376\334\377\377\377"
-                                   "\377\377\377\377]\357\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\333\336\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\333\336\004!\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\303\030\303\030E)\212R\065\255\236\367\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\014c\303"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\303\030q\214\377\377\377\377\377\377\276\367=\347\034\347\373\336\064\245\216"
-                                   "s\307\071\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\303\030e)\262\224\276\367\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\323\234\303\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\354b\337\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\373\336%)\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030E)\034\347\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377q\214\303\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\303\030\262\224\377\377\377\377\377"
-                                   "\377\377\377\304\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376\200\376\334\377\377\377\377"
-                                   "\377\377\377]\357\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\333\336\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\333\336\004!\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303"
-                                   "\030\303\030\303\030\303\030\303\030\303\030\344\040\344\040\344\040\206\061\010B\353"
-                                   "ZQ\214\370\305\276\367\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\014c\303"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\303\030q\214\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\272\326\014c\344\040\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\344\030\061\214~\367\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\232\326\303\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\344\040\226\265\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\337\377-c\303\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030IJ\276\367"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377q\214\303\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\262\224\377\377\377\377"
-                                   "\377\377\377\377\304\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376\200\376\334\377\377\377"
-                                   "\377\377\377\377]\357\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\333\336\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\333\336\004!\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303"
-                                   "\030\262\224\323\234\323\234\323\234\323\234\323\234\323\234\323\234\323\234"
-                                   "\323\234\323\234\323\234\323\234\323\234\024\245\030\306\272\326\273\326\273"
-                                   "\326]\357\337\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\014c\303\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\303\030q\214\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\337\377\024\245\303\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\303\030\313Z\236\367\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\276"
-                                   "\367%)\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\303\030IJ\276\367\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\370\305"
-                                   "%)\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\303\030\257{\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "q\214\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303"
-                                   "\030\262\224\377\377\377\377\377\377\377\377\304\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "\200\376\334\377\377\377\377\377\377\377]\357\303\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\333\336\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\333\336\004!\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\344\030\236\367\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\014c\303\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030q\214\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\337"
-                                   "\377\262\224\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\303\030\014c\236\367\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\014c\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\303\030\357{\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377<\347\206\061\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\004!\266\265\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377q\214\303\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\303\030\262\224\377\377\377\377\377\377\377\377\304\376`"
-                                   "\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376\200\376\334\377\377\377\377\377\377\377]\357\303"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\333\336\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\333\336\004!\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\344\030\236\367\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\014c\303"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\303\030q\214\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\317{\303\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303"
-                                   "\030\317{\337\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\030\306\303\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\303\030\020\204\337\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\333\336jR\303\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030IJ\276\367"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377q\214\303\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\262\224\377\377"
-                                   "\377\377\377\377\377\377\304\376`\376`\376`\376`\376`\376`\376`\376`\376`"
-                                   "\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376\200\376\334\377"
-                                   "\377\377\377\377\377\377]\357\303\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\333\336\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\333\336\004"
-                                   "!\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\344\030\236\367\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\014c\303\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\303\030q\214\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\337\377\014c\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\303\030ns\337\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\276\367\247\071\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\303\030\364\244\337\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377}\357\212R\303\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\303\030Q\214\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377q\214\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\303\030\262\224\377\377\377\377\377\377\377\377\304\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376\200\376\334\377\377\377\377\377\377\377]\357\303\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\333\336\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\333\336\004!\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\344\030\236\367\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\014c\303\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030q\214\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\232\326\206\061\303\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030%!\367\275"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\360\203\303\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\344\040"
-                                   "Q\214\276\367\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377<\347jR\303"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\344\040\272\326\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377q\214\303\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\303\030\262\224\377\377\377\377\377\377\377\377\304"
-                                   "\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376\200\376\334\377\377\377\377\377\377\377]\357"
-                                   "\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\333\336"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\333\336\004!\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\344\030\236\367\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\014c\303"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\303\030q\214\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377U\255\344\040\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\303\030\010B\333\336\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\232\326\004!\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\343\030\354b\333\336\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\337\377"
-                                   "U\255\307\071\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\303\030\014c\337\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377q\214\303\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\262\224\377\377\377\377"
-                                   "\377\377\377\377\304\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376\200\376\334\377\377\377"
-                                   "\377\377\377\377]\357\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\333\336\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\333\336\004!\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\344"
-                                   "\030\236\367\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\014c\303\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\303\030q\214\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\337\377ns\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\303\030\354b\337\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\337\377\014c\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\344\040\222\224]\357"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\071\306\253Z\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\232\326\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377q\214\303"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\262"
-                                   "\224\377\377\377\377\377\377\377\377\304\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376\200"
-                                   "\376\334\377\377\377\377\377\377\377]\357\303\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\333\336\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\333\336\004!\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\344\030\236\367\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\014c\303\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030q\214\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377}\357f)\303\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030"
-                                   "\363\234\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\333\336E)\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\303\030\004!\014c\024\245\232\326}\357\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\337\377\034\347\367\275Q\214"
-                                   "\010B\303\030\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\014c\337\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377q\214"
-                                   "\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030"
-                                   "\262\224\377\377\377\377\377\377\377\377\304\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "\200\376\334\377\377\377\377\377\377\377]\357\303\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\333\336\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\333\336\004!\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\344\030\236\367\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\014c\303\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030q\214\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\232\326\344\040\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\343\030\272\326\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\216s\303\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\303\030\303\030f\061\253Z\357{\263\234"
-                                   "\370\275\030\306\030\306\030\306\030\306\030\306\267\275\020\204\216s\350A\004!\303"
-                                   "\030\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030%)\370\275\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "q\214\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303"
-                                   "\030\262\224\377\377\377\377\377\377\377\377\304\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "\200\376\334\377\377\377\377\377\377\377]\357\303\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\333\336\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\333\336\004!\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\344\030\236\367\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\014c\303\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030q\214\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\337\377\257{\303\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\303\030Mk\276\367\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\374\336\010B\303\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\303\030\303\030\303\030\303\030\303"
-                                   "\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030Q\214\337\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377q\214\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\303\030\262\224\377\377\377\377\377\377\377\377\304\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376\200\376\334\377\377\377\377\377\377\377]\357\303\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\333\336\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\333\336\004!\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\344\030\236\367\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\014c\303\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030q\214\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\236\367IJ\303\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\344\040\363\234\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\266\265\303\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\310\071"
-                                   "]\357\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377q\214\303\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\303\030\262\224\377\377\377\377\377\377\377\377\304\376`"
-                                   "\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376\200\376\334\377\377\377\377\377\377\377]\357\303"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\333\336\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\333\336\004!\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\344\030\236\367\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\014c\303"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\303\030q\214\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\367\275\004!\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\303\030\247\071\034\347\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377Mk\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "E)\266\265\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377q\214\303\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\303\030\262\224\377\377\377\377\377\377\377\377"
-                                   "\304\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376\200\376\334\377\377\377\377\377\377\377"
-                                   "]\357\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\333"
-                                   "\336\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\333\336\004!\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\344\030\236\367\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\014"
-                                   "c\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\303\030q\214\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\360\203\303\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\060\204\337"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\276\367)B\303\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\303\030\222\224\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377q\214\303\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\262\224\377\377\377\377"
-                                   "\377\377\377\377\304\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376\200\376\334\377\377\377"
-                                   "\377\377\377\377]\357\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\333\336\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\333\336\004!\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\344"
-                                   "\030\236\367\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\014c\303\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\303\030q\214\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\236\367)J\303\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\004!\266\265\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\373\336IJ\303\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\303\030\061\204\337\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377q\214\303"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\262"
-                                   "\224\377\377\377\377\377\377\377\377\304\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376\200"
-                                   "\376\334\377\377\377\377\377\377\377]\357\303\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\333\336\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\333\336\004!\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\344\030\236\367\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\014c\303\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030q\214\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\367\275f\061\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\303\030\010B\276\367\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\272"
-                                   "\326f\061\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\303\030\256s\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377q\214\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\303\030\262\224\377\377\377\377\377\377\377\377\304\376`\376`\376`"
-                                   "\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376\200\376\334\377\377\377\377\377\377\377]\357\303\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\333\336\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\333\336\004!\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\344\030\236\367\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\014c\303\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030q\214"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\222\224\303\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\317{\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\070\306)J\303\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\344\030Q\214\236\367\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377q\214\303\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\303\030\262\224\377\377\377\377\377\377\377\377\304"
-                                   "\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376\200\376\334\377\377\377\377\377\377\377]\357"
-                                   "\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\333\336"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\333\336\004!\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\344\030\236\367\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\014c\303"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\303\030q\214\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\236\367\350A\303\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030"
-                                   "%!\232\326\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377}\357\247\071\303\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\344\030Q\214\337\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377q\214\303\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\262\224\377\377\377\377"
-                                   "\377\377\377\377\304\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376\200\376\334\377\377\377"
-                                   "\377\377\377\377]\357\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\333\336\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\333\336\004!\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\344"
-                                   "\030\236\367\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\014c\303\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\303\030q\214\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377Y"
-                                   "\316\005!\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\303\030\354b\337\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\236\367ns\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\303\030\327"
-                                   "\275\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377q"
-                                   "\214\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303"
-                                   "\030\262\224\377\377\377\377\377\377\377\377\304\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "\200\376\334\377\377\377\377\377\377\377]\357\303\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\333\336\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\333\336\004!\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\344\030\236\367\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\014c\303\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030q\214\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377Q\214\303\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\344\040\263\234\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\276\367u\255\247\071\303\030\303\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303"
-                                   "\030\344\040\212R\333\336\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377q\214\303\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\303\030\262\224\377\377\377\377\377\377\377\377\304\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376\200\376\334\377\377\377\377\377\377\377]\357\303"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\333\336\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\333\336\004!\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\344\030\236\367\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\014c\303"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\303\030q\214\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377]\357\313Z\303\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\303\030\206\061\333\336\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377<\347nk%!\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\303\030\206\061U\255\276\367\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377q\214\303\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\262\224\377\377\377\377"
-                                   "\377\377\377\377\304\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376\200\376\334\377\377\377"
-                                   "\377\377\377\377]\357\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\333\336\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\333\336\004!\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\344"
-                                   "\030\236\367\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\014c\303\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\303\030q\214\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\232\326%)\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\303\030\014c\337\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\337\377\232\326,c\344\040\303\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\303\030\303\030f\061\263\224\034\347\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "q\214\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303"
-                                   "\030\262\224\377\377\377\377\377\377\377\377\304\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "\200\376\334\377\377\377\377\377\377\377]\357\303\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\333\336\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\333\336\004!\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\344\030\236\367\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\014c\303\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030q\214\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\061\214\344\040\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\344"
-                                   "\030\266\265\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\236\367\327\275\313Z\344\040\303\030\303\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\303\030\303\030\207\061\020\204\333\336\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377q\214\303\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\303\030\262\224\377\377\377\377\377\377"
-                                   "\377\377\304\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376\200\376\334\377\377\377\377\377\377"
-                                   "\377]\357\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\333\336\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\333\336\004!\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\344\030\236\367\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\014c\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\303\030q\214\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "]\357\212R\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\303\030IJ\276\367\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377}\357\364\234\350\071\303"
-                                   "\030\243\030\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\303\030\303\030\243\030\303\030-c\367\275"
-                                   "\337\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377q\214\303"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\262"
-                                   "\224\377\377\377\377\377\377\377\377\304\376`\376`\376`\376`\376`\376`\376"
-                                   "`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376`\376\200"
-                                   "\376\334\377\377\377\377\377\377\377]\357\303\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\333\336\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\333\336\004!\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030"
-                                   "\303\030\303\030\344\040\236\367\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\014c\303\030\303\030\303\030\303\030\303"
-                                   "\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030r\224\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\272\326\344\040\303\030\303"
-                                   "\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030"
-                                   "\303\030\303\030\256s\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\276\367\232\326\263\234\354b\206"
-                                   "\061%)\303\030\303\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030"
-                                   "\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243"
-                                   "\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\243\030\303\030\343\030"
-                                   "f\061)JnsU\255=\357\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\323\234\206\061\206\061\206\061\206\061\206\061\206\061"
-                                   "\206\061\206\061\206\061\206\061\206\061\206\061\206\061\206\061\206\061\206\061\206"
-                                   "\061\206\061\206\061\206\061\206\061\363\234\377\377\377\377\377\377\377\377\346"
-                                   "\376\303\376\303\376\303\376\303\376\303\376\303\376\303\376\303\376\303\376"
-                                   "\303\376\303\376\303\376\303\376\303\376\303\376\303\376\303\376\303\376\303"
-                                   "\376\303\376\343\376\335\377\377\377\377\377\377\377]\357\206\061f\061f\061f"
-                                   "\061f\061f\061f\061f\061f\061f\061f\061f\061f\061f\061f\061f\061f\061f\061f\061f\061\373\336"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\034\347\354b\313Z\313Z\313Z\313Z\313Z\313"
-                                   "Z\313Z\313Z\313Z\313Z\313Z\313Z\276\367\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377q\214\313Z\313Z\313Z\313Z"
-                                   "\313Z\313Z\313Z\313Z\313Z\313Z\313Z\313Zu\255\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377r\224\313Z\313Z\313Z\313Z\313"
-                                   "Z\313Z\313Z\313Z\313Z\313Z\313Z\313Z\313Z\313Z\353Z}\357\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\272\326\266\265\061\214\253Z\010B%)\004!\344\040\303\030"
-                                   "\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\303"
-                                   "\030\303\030\303\030\303\030\303\030\303\030\303\030\303\030\004!\004!\247\071(B\216s\262"
-                                   "\224Y\316}\357\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377<\347\232\326\232\326\232\326"
-                                   "\232\326\232\326\232\326\232\326\232\326\232\326\232\326\232\326\232\326\232"
-                                   "\326\232\326\232\326\232\326\232\326\232\326\232\326\232\326\232\326]\357"
-                                   "\377\377\377\377\377\377\377\377\271\377\270\377\270\377\270\377\270\377\270"
-                                   "\377\270\377\270\377\270\377\270\377\270\377\270\377\270\377\270\377\270\377"
-                                   "\270\377\270\377\270\377\270\377\270\377\270\377\270\377\377\377\377\377\377"
-                                   "\377\377\377\337\377y\316Y\316Y\316Y\316Y\316Y\316Y\316Y\316Y\316Y\316Y\316"
-                                   "Y\316Y\316Y\316Y\316Y\316Y\316Y\316Y\316Y\316\276\367\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\337\377\034\347\333\336Y\316\364\244\364\234\323\234\317{\354Z\353Z\353"
-                                   "Z\353Z\353Z\353Z\353Z\353Z\353Z\353Z-kQ\214\363\234\364\244\024\245\333\336"
-                                   "\333\336}\357\337\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\337\377\236\367\236\367\236\367\236\367\236\367\236\367\236\367\236\367"
-                                   "\236\367\236\367\276\367\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\337\377\276\367\337\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\276\367\337\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377U\255Mku\255\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\232\326Mk\064\245\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377]\357\350"
-                                   "\071\317{\276\367\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\236\367Mk-c}\357\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\337\377\373\336\034"
-                                   "\347\377\377\377\377\377\377}\357\333\336\337\377\377\377]\357\333\336\236"
-                                   "\367\377\377\377\377\377\377\034\347\034\347\377\377\236\367\333\336}\357}\357"
-                                   "\333\336]\357\377\377\377\377\377\377\377\377\373\336\373\336\337\377\034\347"
-                                   "\333\336\333\336\333\336\333\336\333\336\333\336\377\377\276\367\333\336\333"
-                                   "\336\333\336\333\336\034\347}\357\337\377\377\377\377\377\377\377\236\367\267"
-                                   "\265\065\255\226\265\236\367\377\377\377\377\337\377\333\336<\347\377\377\236"
-                                   "\367\333\336\333\336\333\336\374\336}\357\337\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\236\367\333\336<\347\377\377\377\377\377\377\377\377]\357"
-                                   "\333\336\333\336\333\336\034\347}\357\377\377\377\377\377\377\337\377\333\336"
-                                   "\333\336\333\336\333\336\333\336\333\336\034\347\377\377\377\377\377\377\377"
-                                   "\377}\357\333\336\333\336\333\336\333\336\333\336\333\336\034\347\337\377\373"
-                                   "\336\333\336\333\336\333\336\333\336\333\336\034\347\337\377\377\377\377\377"
-                                   "\377\377\232\326\064\245\226\265=\357\377\377\377\377\377\377\034\347\333\336"
-                                   "\337\377\377\377\377\377\377\377\374\346\034\347\377\377\377\377\377\377\276"
-                                   "\367y\316\065\245u\255]\357\377\377\377\377\377\377\337\377}\357\236\367\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\337\377Y\316mk\263\234"
-                                   "\034\347\377\377\377\377\377\377\377\377\377\377\337\377\034\347U\255\064\245"
-                                   "\370\305\276\367\377\377\377\377\377\377\034\347\373\336\377\377\377\377\377"
-                                   "\377\337\377Y\316\065\245v\265}\357\377\377\377\377\377\377\377\377\377\377"
-                                   "\337\377\333\336\034\347\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\276\367\333\336\333\336\333\336\333\336\333\336\333\336\337\377\236\367"
-                                   "\333\336\333\336\333\336\333\336\333\336\333\336]\357\377\377]\357\333\336"
-                                   "\333\336\333\336\034\347}\357\377\377\377\377\377\377\276\367\333\336\333\336"
-                                   "\333\336\333\336\333\336\333\336<\347\377\377\236\367\333\336\333\336\333"
-                                   "\336\333\336\034\347\236\367\377\377\377\377\377\377\377\377\377\377\236\367"
-                                   "\333\336]\357\377\377\377\377\377\377\377\377\236\367]\357\337\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\276\367\333\336\333"
-                                   "\336\333\336\373\336]\357\337\377\377\377\377\377\377\377\377\377\377\377"
-                                   "=\357U\255\065\245\070\306\337\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\337\377\333\336\333\336\333\336\373\336<\347\236\367\377\377\377\377"
-                                   "\377\377\377\377\034\347\333\336}\357\377\377\377\377\377\377\337\377\373\336"
-                                   "\333\336\333\336\333\336\373\336]\357\337\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\034\347\333\336\276\367\377\377\377\377\377\377\337\377\333\336"
-                                   "\034\347\377\377\377\377\377\377\276\367\333\336\236\367\377\377\377\377\377"
-                                   "\377\236\367v\265Y\316\337\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\333\336%))J\377\377\377\377\377\377q\214\344\030z\316"
-                                   "\377\377\216s\303\030\216s\377\377\377\377\236\367\350A)J\337\377\024\245\303"
-                                   "\030Q\214\064\245\303\030\216s\377\377\377\377\377\377\034\347\344\040\350A\236"
-                                   "\367)J\303\030\303\030\303\030\303\030\303\030\303\030\337\377\327\275\303\030\303"
-                                   "\030\303\030\303\030\303\030\303\030Q\214\276\367\377\377\232\326\307\071\303\030"
-                                   "\243\030\243\030\247\071Y\316\377\377y\316\304\030\212R\377\377v\265\303\030\303"
-                                   "\030\303\030\303\030\344\030\216s\377\377\377\377\377\377\377\377\377\377\020\204"
-                                   "\303\030\010B\276\367\377\377\377\377\377\377\216s\303\030\303\030\303\030\303"
-                                   "\030%)\061\204\337\377\377\377\034\347\303\030\303\030\303\030\303\030\303\030\303"
-                                   "\030)B\377\377\377\377\377\377\377\377\323\234\303\030\303\030\303\030\303\030"
-                                   "\303\030\303\030IJ]\357f)\303\030\303\030\303\030\303\030\303\030\307\071<\347\377"
-                                   "\377}\357,c\303\030\243\030\243\030%)\222\224\377\377\377\377)J\303\030\357{\377"
-                                   "\377\377\377}\357\247\071)J\377\377\377\377\333\336IJ\303\030\243\030\243\030"
-                                   "\004!\061\214\276\367\377\377\030\306\303\030\014c\236\367\377\377\377\377\377\377"
-                                   "\377\377\377\377~\367\212R\303\030\243\030\243\030\303\030\317{\236\367\377\377"
-                                   "\377\377\337\377\020\204\303\030\243\030\243\030\303\030\206\061\333\336\377\377"
-                                   "\337\377)Jf\061\377\377\377\377]\357\354b\303\030\243\030\243\030f\061U\255\377"
-                                   "\377\377\377\377\377\377\377\363\234\303\030\206\061y\316\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\266\265\303\030\303\030\303\030\303\030\303\030\303"
-                                   "\030z\316\024\245\303\030\303\030\303\030\303\030\303\030\303\030-k\337\377Mk\303"
-                                   "\030\303\030\303\030\303\030\303\030\222\224\276\367\377\377\327\275\303\030\303"
-                                   "\030\303\030\303\030\303\030\303\030\014c\377\377U\255\303\030\303\030\303\030\303"
-                                   "\030\303\030f\061\024\245\377\377\377\377\377\377\377\377\317{\303\030)J\276\367"
-                                   "\377\377\377\377\377\377\216s\303\030\226\265\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\327\275\303\030\303\030\303\030\303\030\303\030"
-                                   "\212R<\347\377\377\377\377\337\377\263\234\004!\243\030\243\030\303\030)J\272\326"
-                                   "\377\377\377\377\377\377\377\377\377\377]\357\303\030\303\030\303\030\303\030"
-                                   "\303\030%)\272\326\377\377\377\377\236\367f\061\303\030Mk\337\377\377\377\377"
-                                   "\377\333\336f\061\303\030\303\030\303\030\303\030\303\030iJ]\357\377\377\377\377"
-                                   "\377\377\034\347f\061\303\030\323\234\377\377\377\377\377\377\272\326\303\030"
-                                   "E)\327\275\377\377\377\377\266\265\303\030\024\245\377\377\377\377\377\377\327"
-                                   "\275\303\030\303\030\266\265\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\333\336%))J\377\377\377\377\377\377q\214\344\030\232\326\377"
-                                   "\377\216s\243\030\303\030\071\316\377\377\236\367\350AIJ\337\377\024\245\303\030"
-                                   "Q\214~\367E)\247\071\333\336\377\377\377\377\364\244\303\030\061\214\377\377"
-                                   ")J%)\226\265\226\265\226\265\226\265\266\265\377\377\327\275\303\030IJu\255"
-                                   "\226\265\363\234\350A\303\030\226\265\377\377IJ%!\323\234\266\265\263\234\343"
-                                   "\030\307\071\236\367z\316\303\030\252R\377\377\226\265\303\030\357{\226\265\024"
-                                   "\245\253R\344\030\353Z\337\377\377\377\377\377\373\336\350A\303\030\303\030\266"
-                                   "\265\377\377\377\377\377\377\216s\303\030Q\214\226\265\262\224)J\303\030\222"
-                                   "\224\337\377\034\347\243\030)J\226\265\226\265\226\265\226\265\030\306\377\377"
-                                   "\377\377\377\377\377\377\373\336\266\265\226\265)J\303\030\064\245\226\265\070"
-                                   "\306\276\367f\061f\061U\255\226\265\226\265\226\265\370\305\337\377\276\367"
-                                   "\014c\303\030mk\266\265\363\234\247\071\304\030\327\275\377\377IJ\243\030\303\030"
-                                   "\232\326\377\377}\357\307\071)J\377\377<\347\307\071\004!\257{\266\265U\255)J"
-                                   "\303\030nk\337\377\030\306\343\030\014c\236\367\377\377\377\377\377\377\377\377"
-                                   "\276\367\212R\344\040\014c\226\265\226\265\253R\303\030\313Z\337\377\377\377"
-                                   "\020\204\343\030IJU\255\266\265\216s\303\030\010B}\357\337\377)Jf\061\337\377\236"
-                                   "\367IJ\344\030\360\203\266\265\323\234E)\304\030\373\336\377\377\377\377\236"
-                                   "\367iJ\303\030\343\030\360{\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\267\275\303\030jR\226\265\226\265\226\265\266\265}\357\024\245\303\030\253Z"
-                                   "\226\265\226\265\226\265\226\265y\316\377\377mk\344\040\060\204\226\265\323"
-                                   "\234\307\071\303\030\256s\337\377\327\275\303\030)J\226\265\226\265\226\265\226"
-                                   "\265y\316\377\377u\255\303\030\061\214\226\265\226\265\060\204%)%)}\357\377\377"
-                                   "\377\377\333\336\350\071\243\030\303\030\367\275\377\377\377\377\377\377\216"
-                                   "s\243\030\226\265\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\327\275\303\030IJ\226\265\064\245Mk\344\040jR\276\367\377\377\323\234\343"
-                                   "\030)J\024\245\266\265\020\204%!\206\061y\316\377\377\377\377\377\377\377\377"
-                                   "]\357\303\030\350Au\255v\255nk\303\030IJ]\357\377\377\226\265\303\030\344\040"
-                                   "f\061\034\347\377\377\377\377\333\336f\061\344\040\323\234\226\265\226\265\252"
-                                   "R\303\030\360{\377\377\377\377\377\377r\224\344\040\004!\247\071\236\367\377\377"
-                                   "\377\377\333\336\303\030\303\030)J}\357\377\377\327\275\303\030\024\245\377\377"
-                                   "\377\377\377\377\014c\303\030\303\030\313Z\337\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\333\336%))J\377\377\377\377\377\377q\214\344"
-                                   "\030\232\326\377\377\216s\303\030\303\030jR\276\367\236\367\350AIJ\337\377\024"
-                                   "\245\303\030Q\214\377\377\216s\343\030\323\234\377\377\377\377IJ\344\030\030\306"
-                                   "\377\377)Jf\061\337\377\377\377\377\377\377\377\377\377\377\377\327\275\303"
-                                   "\030\014c\236\367\377\377\377\377\323\234\303\030\222\224\337\377E)F)Y\316\236"
-                                   "\367\337\377Mk\256s]\357z\316\303\030\252R\377\377\226\265\344\030u\255\377"
-                                   "\377\377\377=\357\307\071\344\040]\357\377\377\377\377\024\245\004!Mk\303\030\313"
-                                   "Z\276\367\377\377\377\377\216s\303\030\370\305\377\377\377\377y\316f))J\034"
-                                   "\347\034\347\303\030\353Z\337\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\337\377\354Z\344\030]\357\377\377\377"
-                                   "\377\377\377f\061\307\071}\357\377\377\377\377\377\377\377\377\377\377\367\275"
-                                   "E)\247\071~\367\377\377\377\377U\255\313Z\030\306\377\377IJ\243\030\303\030Mk"
-                                   "\276\367}\357\307\071)J\337\377\064\245\303\030Mk\377\377\377\377\377\377\232"
-                                   "\326f\061\004!\276\367\030\306\343\030\014c\236\367\377\377\377\377\377\377\377"
-                                   "\377\367\275\303\030\253Z}\357\377\377\377\377}\357\206\061%)\272\326\034\347"
-                                   "\004!\307\071\333\336\377\377\377\377\277\377\216s\256s\236\367\337\377)Jf\061"
-                                   "\337\377\266\265\344\030\253R\337\377\377\377\377\377\222\224\313Z\373\336"
-                                   "\377\377\377\377\266\265%!)J%)\350A~\367\377\377\377\377\377\377\377\377\377"
-                                   "\377\267\275\303\030Mk\377\377\377\377\377\377\377\377\377\377\024\245\303\030"
-                                   "\216s\337\377\377\377\377\377\377\377\377\377\377\377mk\004!\266\265\377\377"
-                                   "\377\377\232\326\344\040\307\071]\357\327\275\303\030\353Z\337\377\377\377\377"
-                                   "\377\377\377\377\377\377\377u\255\344\030\327\275\377\377\377\377\276\367\350"
-                                   "A\303\030]\357\377\377\377\377\323\234\344\040nk\303\030\354b\337\377\377\377"
-                                   "\377\377\216s\243\030\226\265\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\327\275\303\030\014c\377\377\377\377\236\367\212R\303\030\071"
-                                   "\316\377\377\350A\004!Y\316\377\377\377\377\337\377\257{\303\030\357{\377\377"
-                                   "\377\377\377\377\377\377]\357\303\030jR\236\367\377\377\276\367\343\030\206"
-                                   "\061y\316\377\377Mk\344\030\014c\303\030\323\234\377\377\377\377\333\336f\061%"
-                                   "!\333\336\377\377\377\377\070\306\303\030\212R\377\377\377\377\236\367\307\071"
-                                   "\307\071\354Z\303\030\367\275\377\377\377\377\333\336\303\030\303\030\303\030\024"
-                                   "\245\337\377\327\275\303\030\024\245\377\377\377\377\236\367E)\307\071\010B%)"
-                                   "\034\347\377\377\377\377\377\377\377\377\377\377\377\377\377\377\333\336%)"
-                                   ")J\377\377\377\377\377\377q\214\344\030\232\326\377\377\216sE)\354b\303\030"
-                                   "\222\224\236\367\350AIJ\337\377\024\245\303\030Q\214\377\377\232\326\303\030"
-                                   "\212R\276\367\232\326\303\030\307\071\337\377\377\377)J\344\040\354b\354b\354"
-                                   "b\014c\222\224\377\377\327\275\303\030\010B\363\234\064\245\323\234\010B$!\030\306"
-                                   "\377\377\357{\303\030E)IJnk\030\306\337\377\377\377\232\326\303\030\252R\377"
-                                   "\377\226\265\344\030u\255\377\377\377\377\377\377\216s\303\030\266\265\377\377"
-                                   "\337\377jJ\004!]\357jR%!\232\326\377\377\377\377\216s\303\030\370\305\377\377"
-                                   "\377\377\236\367\354b\344\040\030\306\034\347\243\030f\061\354b\354b\354b\014cv"
-                                   "\265\377\377\377\377\377\377\377\377\377\377\377\377\377\377\354Z\344\030]"
-                                   "\357\377\377\377\377\377\377f\061\004!\313Z\354b\354b\014c\364\244\377\377\222"
-                                   "\224\303\030\020\204\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "IJE)mk\004!\263\234}\357\307\071)J\377\377\317{\303\030\327\275\377\377\377\377"
-                                   "\377\377\377\377\313Z\303\030\367\275\030\306\343\030\014c\236\367\377\377\377"
-                                   "\377\377\377\377\377\262\224\303\030\024\245\377\377\377\377\377\377\377\377"
-                                   "\216s\303\030\222\224U\255\303\030\020\204\377\377\377\377\236\367]\357]\357"
-                                   "]\357\337\377\337\377)Jf\061\337\377\061\214\303\030\263\234\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\337\377-c\304\030\367\275Mk\343\030"
-                                   "\266\265\377\377\377\377\377\377\377\377\377\377\267\275\303\030IJ\064\245\064"
-                                   "\245\064\245Y\316\377\377\024\245\303\030\247\061\354b\354b\354b\014c\232\326\377"
-                                   "\377mk\004!\267\275\377\377\377\377\377\377\253Z%)\272\326\327\275\303\030f\061"
-                                   "\354b\354b\354b\354b\327\275\377\377u\255\303\030\317{\064\245\064\245\222\224"
-                                   "%)\206\061\236\367\377\377\276\367)J%!}\357jJ%)\272\326\377\377\377\377\216"
-                                   "s\243\030\226\265\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\327\275\303\030\014c\377\377\377\377\377\377q\214\303\030\257{\337\377\303"
-                                   "\030)J\236\367\377\377\377\377\377\377y\316\303\030IJ\377\377\377\377\377\377"
-                                   "\377\377]\357\303\030iJ\034\347]\357\226\265\303\030\350\071\374\336Y\316f\061"
-                                   "\010BY\316%!\350A]\357\377\377\333\336f\061\344\040r\224\064\245\064\245\354Z\303"
-                                   "\030\222\224\377\377\377\377\267\275\344\030\317{\030\306\303\030-c\337\377\377"
-                                   "\377\333\336\303\030\247\071\307\071\206\061Y\316\327\275\303\030\024\245\377\377"
-                                   "\377\377u\255\344\030\061\204U\255\344\030\256s\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\333\336%))J\377\377\377\377\377\377q\214\344\030\232"
-                                   "\326\377\377\216sf\061\367\275%)\307\071Y\316\350AIJ\337\377\024\245\303\030Q"
-                                   "\214\377\377\377\377\206\061f\061\374\346\262\224\303\030r\224\377\377\377\377"
-                                   ")J\243\030\303\030\303\030\303\030\303\030\014c\377\377\327\275\303\030\303\030\303"
-                                   "\030\303\030\303\030f\061\263\224\236\367\377\377<\347Q\214f\061\303\030\303\030"
-                                   "E)\357{\337\377\232\326\303\030\252R\377\377\226\265\344\030u\255\377\377\377"
-                                   "\377\377\377\256s\303\030\064\245\377\377y\316%!\212R\377\377\222\224\303\030"
-                                   "\222\224\377\377\377\377\216s\303\030\370\305\377\377\377\377\236\367\014c\303"
-                                   "\030\327\275\034\347\243\030\303\030\303\030\303\030\303\030\304\030r\224\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\354Z\344\030]\357\377\377"
-                                   "\377\377\377\377f\061\303\030\303\030\303\030\303\030\344\030\257s\337\377ns\303"
-                                   "\030\262\224\377\377\377\377\377\377\377\377\377\377\377\377\377\377IJf\061"
-                                   "\373\336\004!\350A\333\336\307\071)J\377\377\253R\303\030\232\326\377\377\377"
-                                   "\377\377\377\377\377\353Z\303\030\327\275\030\306\343\030\014c\236\367\377\377"
-                                   "\377\377\377\377\377\377ns\303\030\267\275\377\377\377\377\377\377\377\377"
-                                   "\216s\303\030Q\214r\224\303\030q\214\377\377\377\377\257s\010B\350A\350A\367"
-                                   "\275\337\377)Jf\061\337\377\317{\303\030\226\265\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377]\357\247\071\307\071\236\367v\265\303\030\216s\276"
-                                   "\367\377\377\377\377\377\377\377\377\267\275\303\030\303\030\303\030\303\030\303"
-                                   "\030\257{\377\377\024\245\303\030\303\030\303\030\303\030\303\030\343\030\367\275"
-                                   "\377\377mk\004!\267\275\377\377\377\377\377\377\014c\303\030\030\306\327\275\303"
-                                   "\030\303\030\303\030\303\030\303\030\303\030\363\234\377\377u\255\303\030\303\030"
-                                   "\303\030\303\030\303\030\010B\070\306\377\377\377\377\071\316%!\253Z\377\377r\214"
-                                   "\303\030\262\224\377\377\377\377\216s\243\030\226\265\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\327\275\303\030\014c\377\377\377\377"
-                                   "\377\377\222\224\303\030\256s}\357\303\030-c\377\377\377\377\377\377\377\377"
-                                   "\272\326\004!)J\377\377\377\377\377\377\377\377]\357\303\030\004!\350A\350AE)\303"
-                                   "\030\222\224\337\377\061\204\344\030r\224\236\367\014c\344\040\070\306\377\377\333"
-                                   "\336f\061\303\030\303\030\303\030\303\030\004!-k\034\347\377\377\377\377\317{\344"
-                                   "\040\367\275\337\377f\061\207\061y\316\377\377\333\336\303\030\253Z\024\245\344"
-                                   "\030-k\267\275\303\030\024\245\377\377\377\377iJ\206\061\071\316<\347\206\061f\061"
-                                   "\236\367\377\377\377\377\377\377\377\377\377\377\377\377\034\347E))J\377\377"
-                                   "\377\377\377\377Q\214\344\030\232\326\377\377\216sf\061\333\336\222\224\303"
-                                   "\030\014c\350AIJ\337\377\024\245\303\030Q\214\377\377\377\377\216s\303\030\064\245"
-                                   "\313Z\303\030=\357\377\377\377\377)Jf)\276\367\337\377\337\377\337\377\337"
-                                   "\377\377\377\327\275\303\030)J\263\234\212R\343\030\216s\276\367\377\377\377"
-                                   "\377\377\377\337\377\337\377\232\326\020\204\004!\005!\272\326z\316\303\030\252"
-                                   "R\377\377\226\265\344\030u\255\377\377\377\377\377\377\257s\303\030\226\265"
-                                   "\337\377\357{\303\030(B\060\204ns\303\030\350A\034\347\377\377\216s\303\030\370"
-                                   "\305\377\377\377\377\236\367\014c\303\030\367\275\034\347\303\030\313Z\276\367"
-                                   "\337\377\337\377\337\377\337\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\354Z\344\030]\357\377\377\377\377\377\377f\061\247\071]\357\337"
-                                   "\377\337\377\337\377\337\377\377\377\222\224\303\030\060\204\377\377\377\377"
-                                   "\377\377\276\367<\347\377\377\377\377IJf\061\377\377\360\203\303\030mk\307\071"
-                                   ")J\377\377\357{\303\030\327\275\377\377\377\377\377\377\377\377\313Z\303\030"
-                                   "\327\275\030\306\343\030\014c\236\367\377\377\377\377\377\377\377\377\222\224"
-                                   "\303\030\024\245\377\377\377\377\377\377\377\377\256s\303\030Q\214\226\265\303"
-                                   "\030\020\204\377\377\377\377\257{)J%)\303\030\226\265\337\377)Jf\061\337\377Q"
-                                   "\214\303\030\222\224\377\377\377\377\377\377}\357}\357\377\377\377\377\226"
-                                   "\265\243\030\307\071\060\204\216s\343\030f\061\232\326\377\377\377\377\377\377"
-                                   "\377\377\267\275\303\030\353Z\373\336\373\336\373\336]\357\377\377\024\245\303"
-                                   "\030\216s\276\367\337\377\337\377\337\377\377\377\377\377mk\004!\267\275\377"
-                                   "\377\377\377\377\377\353Z%!\232\326\327\275\303\030\313Z\337\377\337\377\337"
-                                   "\377\337\377\377\377\377\377u\255\303\030\360{\262\224f\061\344\040\226\265\377"
-                                   "\377\377\377\337\377\257{\303\030)J\060\204Mk\303\030)B<\347\377\377\216s\243"
-                                   "\030\226\265\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\327\275\303\030\014c\377\377\377\377\377\377Q\214\303\030\256s\337\377\303\030"
-                                   "\010B~\367\377\377\377\377\377\377y\316\303\030)J\377\377\377\377\377\377\377"
-                                   "\377]\357\303\030\004!)B)J\354Z\065\255\377\377\236\367\350A\303\030\317{\020\204"
-                                   "\313Z\303\030\216s\377\377\333\336f\061\344\040Q\214\317{\343\030jR<\347\377\377"
-                                   "\377\377\377\377%)%!\317{\060\204\307\071\303\030\060\204\377\377\333\336\303"
-                                   "\030\313Z\236\367)J\303\030\020\204\303\030\024\245\377\377\272\326\303\030\247"
-                                   "\071\020\204\060\204f\061\303\030\370\305\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377}\357\307\071\307\071\236\367\377\377\337\377\014c\303\030\232\326\377"
-                                   "\377\216sf\061\333\336\337\377\253R\303\030\343\030)J\337\377\024\245\303\030Q"
-                                   "\214\377\377\377\377\327\275\004!\206\061f)\212R\377\377\377\377\377\377)Jf\061"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\327\275\303\030\354b\236\367"
-                                   "\236\367)J\303\030\222\224\276\367\272\326\206\061\313Z\276\367\377\377\377"
-                                   "\377mk\303\030U\255\232\326\303\030\252R\377\377\226\265\344\030u\255\377\377"
-                                   "\377\377<\347\350\071\004!}\357<\347f\061\344\040f\061\206\061\206\061E)\344\030\024"
-                                   "\245\377\377\216s\303\030\030\306\377\377\377\377\232\326\206\061IJ<\347\034\347"
-                                   "\303\030\353Z\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\354Z\344\030]\357\377\377\377\377\377\377"
-                                   "f\061\307\071~\367\377\377\377\377\377\377\377\377\377\377\327\275%)\307\071"
-                                   "\236\367\377\377\337\377\060\204\004!\024\245\377\377IJf\061\377\377\034\347jR\343"
-                                   "\030\343\030)J\337\377\364\244\303\030\353Z\236\367\377\377\377\377\232\326f"
-                                   "\061\004!\276\367\030\306\343\030\014c\236\367\377\377\377\377\377\377\377\377\327"
-                                   "\275\303\030jJ<\347\377\377\377\377}\357\206\061%)\272\326\034\347\005!\206\061"
-                                   "\232\326\377\377\377\377\337\377\353Z\303\030\226\265\337\377)Jf\061\337\377"
-                                   "\226\265\344\040\212R\337\377\377\377\337\377ns%)\030\306}\357\014c\344\040\206"
-                                   "\061\206\061\206\061f)\303\030\061\214\377\377\377\377\377\377\377\377\267\275"
-                                   "\303\030Mk\377\377\377\377\377\377\377\377\377\377\024\245\303\030\216s\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377mk\004!\267\275\377\377\377\377\333"
-                                   "\336\344\040\307\071]\357\327\275\303\030\353Z\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377u\255\344\030\327\275\337\377y\316E)\004!\327\275\377\377\034"
-                                   "\347f)\004!\206\061\206\061\206\061E)\343\030\064\245\377\377\216s\243\030\226\265"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\327\275\303"
-                                   "\030\014c\377\377\377\377\236\367\313Z\344\040\070\306\377\377\307\071\004!\267\275"
-                                   "\377\377\377\377\276\367-k\303\030\360{\377\377\377\377\377\377\377\377]\357"
-                                   "\303\030jR\276\367\377\377\377\377\377\377\377\377\030\306\303\030\004!\206\061"
-                                   "\206\061\206\061\344\030E)]\357\333\336f\061%!\333\336\377\377\357{\303\030jJ}"
-                                   "\357\377\377\222\224\303\030E)\206\061\206\061\206\061\303\030\307\071}\357\272"
-                                   "\326\303\030\313Z\377\377\370\305f\061\303\030\303\030\024\245\337\377\360{\303"
-                                   "\030f\061\206\061\206\061f)\303\030,c\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\276\367IJ\303\030\256sY\316\363\234%)%!<\347\377\377\216sf\061\333\336"
-                                   "\377\377\327\275%!\303\030)J\337\377\024\245\303\030Q\214\377\377\377\377=\357"
-                                   ")J\243\030\303\030\364\244\377\377\377\377\377\377)J%!\024\245\024\245\024\245"
-                                   "\024\245\024\245]\357\327\275\303\030\014c\236\367\377\377\327\275%)\206\061\070"
-                                   "\306\377\377\307\071\344\040Q\214y\316u\255\206\061E)\373\336z\316\303\030\252"
-                                   "R\377\377\226\265\303\030\216s\024\245\263\234\354b\344\030\014c\337\377u\255"
-                                   "\303\030-cY\316y\316y\316\363\234\344\040\313Z\377\377\216s\303\030\357{\024\245"
-                                   "\222\224\212R\303\030r\224\337\377\034\347\243\030\010B\024\245\024\245\024\245\024"
-                                   "\245\226\265\377\377\377\377\377\377\377\377\377\377\377\377\377\377\354Z"
-                                   "\344\030]\357\377\377\377\377\377\377f\061E)\323\234\024\245\024\245\024\245\024"
-                                   "\245\333\336\276\367Mk\303\030\216s\030\306\222\224E)\004!y\316\377\377IJf\061"
-                                   "\377\377\377\377\267\275\344\040\303\030)J\377\377<\347\350\071\344\040ns\071\316"
-                                   "\226\265)J\303\030\216s\377\377\030\306\303\030(B\363\234\024\245\024\245\024\245"
-                                   "y\316\236\367\212R\344\040\313Z\370\305\266\265\354b\303\030\313Z\337\377\377"
-                                   "\377\360\203\343\030IJu\255\071\306\060\204%)\344\030\226\265\337\377)Jf\061\337"
-                                   "\377}\357)J\344\030\360{\071\316\263\234%)E)]\357Y\316E)\313Z\071\316y\316y\316"
-                                   "\226\265%!\307\071\337\377\377\377\377\377\377\377\267\275\303\030Mk\377\377"
-                                   "\377\377\377\377\377\377\377\377\024\245\303\030jR\024\245\024\245\024\245\024\245"
-                                   "\367\275\337\377mk\344\040\257{\024\245\222\224\010B\344\030\360\203\377\377\327"
-                                   "\275\303\030\010B\024\245\024\245\024\245\024\245\226\265\377\377u\255\344\030\327"
-                                   "\275\377\377\337\377Q\214\343\030\010B\276\367u\255\303\030nky\316y\316y\316"
-                                   "\363\234\344\040\014c\377\377\216s\243\030\256s\024\245\024\245\024\245v\255\337"
-                                   "\377\377\377\377\377\377\377\327\275\303\030)B\024\245\263\234\257{\004!jJ\276"
-                                   "\367\377\377\262\224\344\040\247\071\024\245y\316\317{\344\040f\061Y\316\377\377"
-                                   "\377\377\377\377\377\377]\357\303\030jR\276\367\377\377\377\377\377\377\337"
-                                   "\377\357{\303\030r\224y\316y\316y\316-k\303\030\263\224\333\336f\061%!\333\336"
-                                   "\377\377\276\367\010B\303\030\323\234\337\377)J\004!\226\265y\316y\316y\316IJ"
-                                   "\344\040\370\275\333\336\303\030\313Z\377\377\377\377\360{\303\030\303\030\024"
-                                   "\245<\347)J%!\030\306y\316y\316\070\306E)\206\061\232\326\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377Y\316\350A\303\030\303\030\303\030%)\262\224\377"
-                                   "\377\377\377\216sf\061\333\336\377\377\337\377\060\204\303\030IJ\337\377\024\245"
-                                   "\303\030Q\214\377\377\377\377\377\377\222\224\303\030\004!\337\377\377\377\377"
-                                   "\377\377\377)J\303\030\303\030\303\030\303\030\303\030\303\030Y\316\327\275\303"
-                                   "\030\014c\236\367\377\377\337\377r\214\304\030\212R\337\377\327\275\247\071\303"
-                                   "\030\303\030\303\030%)Q\214\377\377\232\326\344\030\253R\377\377\226\265\303\030"
-                                   "\303\030\303\030\303\030\004!\354Z}\357\377\377-c\303\030\367\275\377\377\377\377"
-                                   "\377\377]\357\307\071\343\030]\357\216s\303\030\303\030\303\030\303\030E)ns\276"
-                                   "\367\377\377\034\347\303\030\303\030\303\030\303\030\303\030\303\030\010B\337\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\354b\344\030]\357\377\377"
-                                   "\377\377\377\377f\061\303\030\303\030\303\030\303\030\303\030\303\030\024\245\377"
-                                   "\377}\357\353Z\303\030\303\030\303\030E)\024\245\377\377\377\377IJf\061\377\377"
-                                   "\377\377\337\377\014c\303\030IJ\377\377\377\377\373\336IJ\303\030\303\030\303"
-                                   "\030\344\040\257s<\347\377\377\030\306\303\030\303\030\303\030\303\030\303\030\303"
-                                   "\030Q\214\377\377\236\367jR\344\030\303\030\303\030\303\030Mk\034\347\377\377\377"
-                                   "\377\337\377\216s%!\303\030\303\030\303\030f\061\020\204\236\367\337\377)J\206"
-                                   "\061\377\377\377\377\333\336\252R\303\030\303\030\303\030f\061\226\265\377\377"
-                                   "\317{\303\030\364\244\337\377\377\377\377\377\337\377IJ\344\030\266\265\377"
-                                   "\377\377\377\377\377\267\275\303\030Mk\377\377\377\377\377\377\377\377\377"
-                                   "\377\024\245\303\030\303\030\303\030\303\030\303\030\303\030\014c\276\367mk\303\030"
-                                   "\303\030\303\030\303\030E)\317{}\357\377\377\327\275\303\030\303\030\303\030\303"
-                                   "\030\303\030\303\030)J\337\377u\255\344\030\327\275\377\377\377\377\276\367\253"
-                                   "R\303\030\364\244\014c\303\030\030\306\377\377\377\377\377\377]\357\247\071\344"
-                                   "\040\236\367\216s\303\030\303\030\303\030\303\030\303\030\350A\236\367\377\377\377"
-                                   "\377\377\377\327\275\303\030\303\030\303\030\303\030\344\030)J\333\336\377\377"
-                                   "\377\377\337\377\020\204%)\303\030\303\030\303\030\307\071\030\306\377\377\377\377"
-                                   "\377\377\377\377\377\377]\357\343\030jR\276\367\377\377\377\377\377\377\272"
-                                   "\326\247\061\350A\034\347\377\377\377\377\377\377Y\316%!\350A\333\336f\061%!"
-                                   "\333\336\377\377\377\377\327\275\344\040\206\061y\316\344\030iJ\276\367\377\377"
-                                   "\377\377\377\377\363\234\303\030\257{\232\326\303\030\313Z\377\377\377\377}"
-                                   "\357\206\061\303\030\024\245\024\245\344\040\253R\377\377\377\377\377\377\377\377"
-                                   "q\214\343\030\020\204\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "<\347\070\306\024\245\327\275\333\336\337\377\377\377\377\377\034\347\232\326"
-                                   "\276\367\377\377\377\377\236\367y\316\333\336\377\377]\357y\316<\347\377\377"
-                                   "\377\377\377\377\236\367z\316\333\336\377\377\377\377\377\377\377\377\333"
-                                   "\336y\316y\316y\316y\316y\316y\316\276\367\236\367z\316\373\336\377\377\377"
-                                   "\377\377\377\276\367\232\326\232\326\377\377\377\377]\357\030\306\363\234\267"
-                                   "\275\333\336\337\377\377\377\276\367z\316\333\336\377\377}\357y\316y\316y"
-                                   "\316y\316\272\326\337\377\377\377\377\377\273\326y\316\276\367\377\377\377"
-                                   "\377\377\377\377\377\333\336y\316\236\367\034\347y\316y\316y\316y\316\373\336"
-                                   "\337\377\377\377\377\377\337\377y\316y\316y\316y\316y\316y\316\272\326\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\373\336z\316\337\377"
-                                   "\377\377\377\377\377\377\232\326y\316y\316y\316y\316y\316y\316}\357\377\377"
-                                   "\377\377\337\377Y\316\064\245\367\275\373\336\377\377\377\377\377\377\333\336"
-                                   "\232\326\377\377\377\377\377\377\236\367y\316\333\336\377\377\377\377\377"
-                                   "\377}\357y\316\024\245\266\265\272\326\337\377\377\377\377\377\236\367y\316"
-                                   "y\316y\316y\316y\316y\316<\347\377\377\377\377\236\367\232\326U\255u\255\232"
-                                   "\326\337\377\377\377\377\377\377\377\377\377\337\377\333\336\370\275\024\245"
-                                   "Y\316<\347\337\377\377\377\377\377\333\336\232\326\377\377\377\377\377\377"
-                                   "\236\367y\316\024\245\327\275<\347\377\377\377\377\373\336y\316\236\367\377"
-                                   "\377\377\377\377\377\377\377\034\347y\316\034\347\377\377\377\377\377\377\236"
-                                   "\367y\316\373\336\377\377\377\377\377\377\377\377\377\377]\357y\316y\316y"
-                                   "\316y\316y\316y\316\373\336\377\377\034\347y\316y\316y\316y\316\374\336\337"
-                                   "\377\377\377\377\377\236\367y\316y\316y\316y\316y\316y\316\333\336\377\377"
-                                   "}\357z\316\236\367\377\377\377\377\377\377\034\347y\316\333\336\333\336y\316"
-                                   "\276\367\377\377\377\377\377\377\377\377\333\336z\316\236\367\034\347y\316"
-                                   "y\316y\316y\316y\316\272\326\377\377\377\377\377\377\377\377\236\367y\316"
-                                   "y\316y\316y\316\232\326\236\367\377\377\377\377\377\377\377\377\337\377\333"
-                                   "\336\367\275\363\234Y\316]\357\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\337\377z\316\333\336\377\377\377\377\377\377\377\377\236\367y\316\373"
-                                   "\336\377\377\377\377\377\377\377\377\337\377\272\326y\316\276\367\232\326"
-                                   "\232\326\276\367\377\377\377\377\337\377\272\326y\316\373\336y\316\034\347"
-                                   "\377\377\377\377\377\377\377\377\236\367y\316\373\336\276\367y\316\373\336"
-                                   "\377\377\377\377\377\377\373\336y\316]\357\374\346z\316<\347\377\377\377\377"
-                                   "\377\377\377\377}\357y\316\034\347\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-                                   "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377");
\ No newline at end of file
+
+static const uint32_t utfprLogoClut[133] =
+{
+  0xFF181418, 0xFF181818, 0xFF181821, 0xFF181C18, 0xFF181C21, 0xFF211C21, 0xFF212021, 0xFF212029,
+  0xFF212421, 0xFF212429, 0xFF292429, 0xFF292829, 0xFF292831, 0xFF292C29, 0xFF292C31, 0xFF312C31,
+  0xFF313031, 0xFF313039, 0xFF313439, 0xFF393439, 0xFF393839, 0xFF393842, 0xFF393C42, 0xFF423C42,
+  0xFF424142, 0xFF424542, 0xFF42454A, 0xFF4A454A, 0xFF4A494A, 0xFF4A4D4A, 0xFF4A4D52, 0xFF524D52,
+  0xFF525152, 0xFF525552, 0xFF52555A, 0xFF5A555A, 0xFF5A595A, 0xFF5A5D5A, 0xFF5A5D63, 0xFF635D63,
+  0xFF636163, 0xFF636563, 0xFF63656B, 0xFF6B656B, 0xFF6B696B, 0xFF6B6D6B, 0xFF6B6D73, 0xFF736D73,
+  0xFF737173, 0xFF737573, 0xFF73757B, 0xFF7B757B, 0xFF7B797B, 0xFF7B7D7B, 0xFF7B7D84, 0xFF847D84,
+  0xFF848284, 0xFF848684, 0xFF84868C, 0xFF8C868C, 0xFF8C8A8C, 0xFF8C8E8C, 0xFF8C8E94, 0xFF948E94,
+  0xFF949294, 0xFF949694, 0xFF94969C, 0xFF9C969C, 0xFF9C9A9C, 0xFF9C9E9C, 0xFF9C9EA5, 0xFFA59EA5,
+  0xFFA5A2A5, 0xFFA5A6A5, 0xFFA5A6AD, 0xFFADA6AD, 0xFFADAAAD, 0xFFADAEAD, 0xFFADAEB5, 0xFFB5AEB5,
+  0xFFB5B2B5, 0xFFB5B6B5, 0xFFB5B6BD, 0xFFBDB6BD, 0xFFBDBABD, 0xFFBDBEBD, 0xFFBDBEC6, 0xFFC6BEC6,
+  0xFFC6C3C6, 0xFFC6C7C6, 0xFFC6C7CE, 0xFFCEC7CE, 0xFFCECBCE, 0xFFCECFCE, 0xFFCECFD6, 0xFFD6CFD6,
+  0xFFD6D3D6, 0xFFD6D7D6, 0xFFD6D7DE, 0xFFDED7DE, 0xFFDEDBDE, 0xFFDEDFDE, 0xFFDEDFE7, 0xFFE7DFE7,
+  0xFFE7E3E7, 0xFFE7E7E7, 0xFFE7E7EF, 0xFFEFE7EF, 0xFFEFEBEF, 0xFFEFEFEF, 0xFFEFEFF7, 0xFFF7EFF7,
+  0xFFF7F3F7, 0xFFF7F7F7, 0xFFFFCF00, 0xFFFFD300, 0xFFFFD700, 0xFFFFDB18, 0xFFFFDB21, 0xFFFFDF18,
+  0xFFFFDF31, 0xFFFFDF52, 0xFFFFE76B, 0xFFFFEB7B, 0xFFFFEB84, 0xFFFFEFA5, 0xFFFFF7C6, 0xFFFFF7CE,
+  0xFFFFF7FF, 0xFFFFFBE7, 0xFFFFFBEF, 0xFFFFFBFF, 0xFFFFFFFF
+};
+
+static const uint8_t utfprLogoData[10340] =
+{
+  0xFF,0x84,0xFF,0x84,0xFF,0x84,0xFF,0x84,0xFF,0x84,0xFF,0x84,0xFF,0x84,0xFF,0x84,
+  0xFF,0x84,0xFF,0x84,0xFF,0x84,0xFF,0x84,0xFF,0x84,0xFF,0x84,0xFF,0x84,0xFF,0x84,
+  0xA5,0x84,0x00,0x61,0x92,0x5D,0x00,0x61,0xAA,0x84,0x00,0x71,0xFF,0x5D,0x97,0x5D,
+  0x01,0x64,0x83,0xFC,0x84,0x01,0x70,0x17,0x92,0x01,0x00,0x14,0xAA,0x84,0x00,0x5D,
+  0xFF,0x01,0x97,0x01,0x01,0x20,0x6C,0xFC,0x84,0x02,0x70,0x17,0x01,0x90,0x00,0x01,
+  0x01,0x14,0xAA,0x84,0x01,0x5D,0x01,0xFF,0x00,0x95,0x00,0x02,0x01,0x20,0x6C,0xFC,
+  0x84,0x02,0x70,0x17,0x01,0x90,0x00,0x01,0x01,0x14,0xAA,0x84,0x01,0x5D,0x01,0xFF,
+  0x00,0x95,0x00,0x02,0x01,0x20,0x6C,0xFC,0x84,0x02,0x70,0x17,0x01,0x90,0x00,0x01,
+  0x01,0x14,0xAA,0x84,0x01,0x5D,0x01,0xFF,0x00,0x95,0x00,0x02,0x01,0x20,0x6C,0xFC,
+  0x84,0x02,0x70,0x17,0x01,0x90,0x00,0x01,0x01,0x14,0xAA,0x84,0x01,0x5D,0x01,0xFF,
+  0x00,0x95,0x00,0x02,0x01,0x20,0x6C,0xFC,0x84,0x02,0x70,0x17,0x01,0x90,0x00,0x01,
+  0x01,0x14,0xAA,0x84,0x01,0x5D,0x01,0xFF,0x00,0x95,0x00,0x02,0x01,0x20,0x6C,0xFC,
+  0x84,0x02,0x70,0x17,0x01,0x90,0x00,0x01,0x01,0x14,0xAA,0x84,0x01,0x5D,0x01,0xFF,
+  0x00,0x95,0x00,0x02,0x01,0x20,0x6C,0xFC,0x84,0x02,0x70,0x17,0x01,0x90,0x00,0x01,
+  0x01,0x14,0xAA,0x84,0x01,0x5D,0x01,0xFF,0x00,0x95,0x00,0x02,0x01,0x20,0x6C,0xFC,
+  0x84,0x02,0x70,0x17,0x01,0x90,0x00,0x01,0x01,0x14,0xAA,0x84,0x01,0x5D,0x01,0xFF,
+  0x00,0x95,0x00,0x02,0x01,0x20,0x6C,0xFC,0x84,0x02,0x70,0x17,0x01,0x90,0x00,0x01,
+  0x01,0x14,0xAA,0x84,0x01,0x5D,0x01,0xFF,0x00,0x95,0x00,0x02,0x01,0x20,0x6C,0xFC,
+  0x84,0x02,0x70,0x17,0x01,0x90,0x00,0x01,0x01,0x14,0xAA,0x84,0x01,0x5D,0x01,0xFF,
+  0x00,0x95,0x00,0x02,0x01,0x20,0x6C,0xFC,0x84,0x02,0x70,0x17,0x01,0x90,0x00,0x01,
+  0x01,0x14,0xAA,0x84,0x01,0x5D,0x01,0xFF,0x00,0x95,0x00,0x02,0x01,0x20,0x6C,0xFC,
+  0x84,0x02,0x70,0x17,0x01,0x90,0x00,0x01,0x01,0x14,0xAA,0x84,0x01,0x5D,0x01,0xFF,
+  0x00,0x95,0x00,0x02,0x01,0x20,0x6C,0xFC,0x84,0x02,0x70,0x17,0x01,0x90,0x00,0x01,
+  0x01,0x14,0xAA,0x84,0x01,0x5D,0x01,0xFF,0x00,0x95,0x00,0x02,0x01,0x20,0x6C,0xFC,
+  0x84,0x02,0x70,0x17,0x01,0x90,0x00,0x01,0x01,0x14,0xAA,0x84,0x01,0x5D,0x01,0xFF,
+  0x00,0x95,0x00,0x02,0x01,0x20,0x6C,0xFC,0x84,0x02,0x70,0x17,0x01,0x90,0x00,0x01,
+  0x01,0x14,0xAA,0x84,0x01,0x5D,0x01,0x93,0x00,0x97,0x01,0x93,0x00,0xD4,0x01,0x01,
+  0x20,0x6C,0xFC,0x84,0x02,0x70,0x17,0x01,0x90,0x00,0x01,0x01,0x14,0xAA,0x84,0x01,
+  0x5D,0x01,0x92,0x00,0x00,0x0E,0x96,0x1D,0x00,0x10,0x93,0x00,0x00,0x11,0xD3,0x1D,
+  0x01,0x33,0x6D,0xFC,0x84,0x02,0x70,0x17,0x01,0x90,0x00,0x01,0x01,0x14,0xAA,0x84,
+  0x01,0x5D,0x01,0x92,0x00,0x00,0x2D,0x95,0x6C,0x02,0x6B,0x39,0x01,0x91,0x00,0x02,
+  0x01,0x3C,0x6B,0xD2,0x6C,0x00,0x6D,0xFD,0x84,0x02,0x70,0x17,0x01,0x90,0x00,0x01,
+  0x01,0x14,0xAA,0x84,0x01,0x5D,0x01,0x92,0x00,0x00,0x30,0x96,0x84,0x01,0x3D,0x01,
+  0x91,0x00,0x01,0x01,0x41,0xFF,0x84,0xD2,0x84,0x02,0x70,0x17,0x01,0x90,0x00,0x01,
+  0x01,0x14,0xAA,0x84,0x01,0x5D,0x01,0x92,0x00,0x00,0x30,0x96,0x84,0x01,0x3D,0x01,
+  0x91,0x00,0x01,0x01,0x41,0xFF,0x84,0xD2,0x84,0x02,0x70,0x17,0x01,0x90,0x00,0x01,
+  0x01,0x14,0xAA,0x84,0x01,0x5D,0x01,0x92,0x00,0x00,0x30,0x96,0x84,0x01,0x3D,0x01,
+  0x91,0x00,0x01,0x01,0x41,0xFF,0x84,0xD2,0x84,0x02,0x70,0x17,0x01,0x90,0x00,0x01,
+  0x01,0x14,0xAA,0x84,0x01,0x5D,0x01,0x92,0x00,0x00,0x30,0x96,0x84,0x01,0x3D,0x01,
+  0x91,0x00,0x01,0x01,0x41,0x82,0x84,0x00,0x7A,0xCE,0x79,0x00,0x7D,0xFD,0x84,0x02,
+  0x70,0x17,0x01,0x90,0x00,0x01,0x01,0x14,0xAA,0x84,0x01,0x5D,0x01,0x92,0x00,0x00,
+  0x30,0x96,0x84,0x01,0x3D,0x01,0x91,0x00,0x01,0x01,0x41,0x82,0x84,0x00,0x76,0xCD,
+  0x72,0x01,0x73,0x7B,0xFD,0x84,0x02,0x70,0x17,0x01,0x90,0x00,0x01,0x01,0x14,0xAA,
+  0x84,0x01,0x5D,0x01,0x92,0x00,0x00,0x30,0x96,0x84,0x01,0x3D,0x01,0x91,0x00,0x01,
+  0x01,0x41,0x82,0x84,0x00,0x76,0xCE,0x72,0x00,0x7B,0xFD,0x84,0x02,0x70,0x17,0x01,
+  0x90,0x00,0x01,0x01,0x14,0xAA,0x84,0x01,0x5D,0x01,0x92,0x00,0x00,0x30,0x96,0x84,
+  0x01,0x3D,0x01,0x91,0x00,0x01,0x01,0x41,0x82,0x84,0x00,0x76,0xCE,0x72,0x00,0x7B,
+  0xFD,0x84,0x02,0x70,0x17,0x01,0x90,0x00,0x01,0x01,0x14,0xAA,0x84,0x01,0x5D,0x01,
+  0x92,0x00,0x00,0x30,0x96,0x84,0x01,0x3D,0x01,0x91,0x00,0x01,0x01,0x41,0x82,0x84,
+  0x00,0x76,0xCE,0x72,0x00,0x7B,0xFD,0x84,0x02,0x70,0x17,0x01,0x90,0x00,0x01,0x01,
+  0x14,0xAA,0x84,0x01,0x5D,0x01,0x92,0x00,0x00,0x30,0x96,0x84,0x01,0x3D,0x01,0x91,
+  0x00,0x01,0x01,0x41,0x82,0x84,0x00,0x76,0xCE,0x72,0x00,0x7B,0xFD,0x84,0x02,0x70,
+  0x17,0x01,0x90,0x00,0x01,0x01,0x14,0xAA,0x84,0x01,0x5D,0x01,0x92,0x00,0x00,0x30,
+  0x96,0x84,0x01,0x3D,0x01,0x91,0x00,0x01,0x01,0x41,0x82,0x84,0x00,0x76,0xCE,0x72,
+  0x00,0x7B,0xFD,0x84,0x02,0x70,0x17,0x01,0x90,0x00,0x01,0x01,0x14,0xAA,0x84,0x01,
+  0x5D,0x01,0x92,0x00,0x00,0x30,0x96,0x84,0x01,0x3D,0x01,0x91,0x00,0x01,0x01,0x41,
+  0x82,0x84,0x00,0x76,0xCE,0x72,0x00,0x7B,0xFD,0x84,0x02,0x70,0x17,0x01,0x90,0x00,
+  0x01,0x01,0x14,0xAA,0x84,0x01,0x5D,0x01,0x92,0x00,0x00,0x30,0x96,0x84,0x01,0x3D,
+  0x01,0x91,0x00,0x01,0x01,0x41,0x82,0x84,0x00,0x76,0xCE,0x72,0x00,0x7B,0xFD,0x84,
+  0x02,0x70,0x17,0x01,0x90,0x00,0x01,0x01,0x14,0xAA,0x84,0x01,0x5D,0x01,0x92,0x00,
+  0x00,0x30,0x96,0x84,0x01,0x3D,0x01,0x91,0x00,0x01,0x01,0x41,0x82,0x84,0x00,0x76,
+  0xCE,0x72,0x00,0x7B,0xFD,0x84,0x02,0x70,0x17,0x01,0x90,0x00,0x01,0x01,0x14,0xAA,
+  0x84,0x01,0x5D,0x01,0x92,0x00,0x00,0x30,0x96,0x84,0x01,0x3D,0x01,0x91,0x00,0x01,
+  0x01,0x41,0x82,0x84,0x00,0x76,0xCE,0x72,0x00,0x7B,0xFD,0x84,0x02,0x70,0x17,0x01,
+  0x90,0x00,0x01,0x01,0x14,0xAA,0x84,0x01,0x5D,0x01,0x92,0x00,0x00,0x30,0x96,0x84,
+  0x01,0x3D,0x01,0x91,0x00,0x01,0x01,0x41,0x82,0x84,0x00,0x76,0xCE,0x72,0x00,0x7B,
+  0xFD,0x84,0x02,0x70,0x17,0x01,0x90,0x00,0x01,0x01,0x14,0xAA,0x84,0x01,0x5D,0x01,
+  0x92,0x00,0x00,0x30,0x96,0x84,0x01,0x3D,0x01,0x91,0x00,0x01,0x01,0x41,0x82,0x84,
+  0x00,0x76,0xCE,0x72,0x00,0x7B,0xFD,0x84,0x02,0x70,0x17,0x01,0x90,0x00,0x01,0x01,
+  0x14,0xAA,0x84,0x01,0x5D,0x01,0x92,0x00,0x00,0x30,0x96,0x84,0x01,0x3D,0x01,0x91,
+  0x00,0x01,0x01,0x41,0x82,0x84,0x00,0x76,0xCE,0x72,0x00,0x7B,0xFD,0x84,0x02,0x70,
+  0x17,0x01,0x90,0x00,0x01,0x01,0x14,0xAA,0x84,0x01,0x5D,0x01,0x92,0x00,0x00,0x30,
+  0x96,0x84,0x01,0x3D,0x01,0x91,0x00,0x01,0x01,0x41,0x82,0x84,0x00,0x76,0xCE,0x72,
+  0x00,0x7B,0xFD,0x84,0x02,0x70,0x17,0x01,0x90,0x00,0x01,0x01,0x14,0xAA,0x84,0x01,
+  0x5D,0x01,0x92,0x00,0x00,0x30,0x96,0x84,0x01,0x3D,0x01,0x91,0x00,0x01,0x01,0x41,
+  0x82,0x84,0x00,0x76,0xCE,0x72,0x00,0x7B,0xFD,0x84,0x02,0x70,0x17,0x01,0x90,0x00,
+  0x01,0x01,0x14,0xAA,0x84,0x01,0x5D,0x01,0x92,0x00,0x00,0x30,0x96,0x84,0x01,0x3D,
+  0x01,0x91,0x00,0x01,0x01,0x41,0x82,0x84,0x00,0x76,0x93,0x72,0xB8,0x73,0x01,0x74,
+  0x7B,0xFD,0x84,0x02,0x70,0x17,0x01,0x90,0x00,0x01,0x01,0x14,0xAA,0x84,0x01,0x5D,
+  0x01,0x92,0x00,0x00,0x30,0x96,0x84,0x01,0x3D,0x01,0x91,0x00,0x01,0x01,0x41,0x82,
+  0x84,0x00,0x76,0x93,0x72,0x00,0x7B,0xB8,0x7C,0x00,0x7E,0xFD,0x84,0x02,0x70,0x17,
+  0x01,0x90,0x00,0x01,0x01,0x14,0xAA,0x84,0x01,0x5D,0x01,0x92,0x00,0x00,0x30,0x96,
+  0x84,0x01,0x3D,0x01,0x91,0x00,0x01,0x01,0x41,0x82,0x84,0x00,0x76,0x92,0x72,0x01,
+  0x73,0x81,0xFF,0x84,0xB7,0x84,0x02,0x70,0x17,0x01,0x90,0x00,0x01,0x01,0x14,0xAA,
+  0x84,0x01,0x5D,0x01,0x92,0x00,0x00,0x30,0x96,0x84,0x01,0x3D,0x01,0x91,0x00,0x01,
+  0x01,0x41,0x82,0x84,0x00,0x76,0x92,0x72,0x01,0x73,0x81,0xFF,0x84,0xB7,0x84,0x02,
+  0x70,0x17,0x01,0x90,0x00,0x01,0x01,0x14,0xAA,0x84,0x01,0x5D,0x01,0x92,0x00,0x00,
+  0x30,0x96,0x84,0x01,0x3D,0x01,0x91,0x00,0x01,0x01,0x41,0x82,0x84,0x00,0x76,0x92,
+  0x72,0x01,0x73,0x81,0xFF,0x84,0xB7,0x84,0x02,0x70,0x17,0x01,0x90,0x00,0x01,0x01,
+  0x14,0xAA,0x84,0x01,0x5D,0x01,0x92,0x00,0x00,0x30,0x96,0x84,0x01,0x3D,0x01,0x91,
+  0x00,0x01,0x01,0x41,0x82,0x84,0x00,0x76,0x92,0x72,0x01,0x73,0x81,0xFF,0x84,0xB7,
+  0x84,0x02,0x70,0x17,0x01,0x90,0x00,0x01,0x01,0x14,0xAA,0x84,0x01,0x5D,0x01,0x92,
+  0x00,0x00,0x30,0x96,0x84,0x01,0x3D,0x01,0x91,0x00,0x01,0x01,0x41,0x82,0x84,0x00,
+  0x76,0x92,0x72,0x01,0x73,0x81,0x81,0x84,0x00,0x71,0xB4,0x44,0x00,0x5C,0x86,0x84,
+  0x01,0x69,0x2B,0x94,0x28,0x03,0x2C,0x31,0x38,0x41,0x82,0x44,0x04,0x48,0x59,0x68,
+  0x69,0x83,0x8F,0x84,0x00,0x40,0x9A,0x28,0x02,0x2C,0x33,0x40,0x81,0x44,0x03,0x4C,
+  0x60,0x68,0x6D,0x98,0x84,0x02,0x70,0x17,0x01,0x90,0x00,0x01,0x01,0x14,0xAA,0x84,
+  0x01,0x5D,0x01,0x92,0x00,0x00,0x30,0x96,0x84,0x01,0x3D,0x01,0x91,0x00,0x01,0x01,
+  0x41,0x82,0x84,0x00,0x76,0x92,0x72,0x01,0x73,0x81,0x81,0x84,0x01,0x6C,0x01,0xB2,
+  0x00,0x01,0x01,0x3C,0x86,0x84,0x01,0x64,0x06,0x95,0x01,0x86,0x00,0x06,0x01,0x01,
+  0x05,0x12,0x20,0x4B,0x71,0x8C,0x84,0x00,0x28,0x9A,0x01,0x84,0x00,0x81,0x01,0x04,
+  0x0A,0x16,0x2E,0x49,0x71,0x94,0x84,0x02,0x70,0x17,0x01,0x90,0x00,0x01,0x01,0x14,
+  0xAA,0x84,0x01,0x5D,0x01,0x92,0x00,0x00,0x30,0x96,0x84,0x01,0x3D,0x01,0x91,0x00,
+  0x01,0x01,0x41,0x82,0x84,0x00,0x76,0x92,0x72,0x01,0x73,0x81,0x81,0x84,0x01,0x6C,
+  0x01,0xB2,0x00,0x01,0x01,0x3C,0x86,0x84,0x01,0x64,0x06,0xA0,0x00,0x81,0x01,0x02,
+  0x0B,0x3A,0x64,0x8A,0x84,0x01,0x28,0x01,0xA2,0x00,0x82,0x01,0x03,0x0A,0x34,0x58,
+  0x83,0x91,0x84,0x02,0x70,0x17,0x01,0x90,0x00,0x01,0x01,0x14,0xAA,0x84,0x01,0x5D,
+  0x01,0x92,0x00,0x00,0x30,0x96,0x84,0x01,0x3D,0x01,0x91,0x00,0x01,0x01,0x41,0x82,
+  0x84,0x00,0x76,0x92,0x72,0x01,0x73,0x81,0x81,0x84,0x01,0x6C,0x01,0xB2,0x00,0x01,
+  0x01,0x3C,0x86,0x84,0x01,0x64,0x06,0xA3,0x00,0x04,0x01,0x01,0x14,0x50,0x83,0x88,
+  0x84,0x01,0x28,0x01,0xA7,0x00,0x03,0x01,0x0A,0x3D,0x69,0x90,0x84,0x02,0x70,0x17,
+  0x01,0x90,0x00,0x01,0x01,0x14,0xAA,0x84,0x01,0x5D,0x01,0x92,0x00,0x00,0x30,0x96,
+  0x84,0x01,0x3D,0x01,0x91,0x00,0x01,0x01,0x41,0x82,0x84,0x00,0x76,0x92,0x72,0x01,
+  0x73,0x81,0x81,0x84,0x01,0x6C,0x01,0xB2,0x00,0x01,0x01,0x3C,0x86,0x84,0x01,0x64,
+  0x06,0xA6,0x00,0x02,0x03,0x2F,0x6C,0x87,0x84,0x01,0x28,0x01,0xA9,0x00,0x02,0x01,
+  0x17,0x61,0x8F,0x84,0x02,0x70,0x17,0x01,0x90,0x00,0x01,0x01,0x14,0xAA,0x84,0x01,
+  0x5D,0x01,0x92,0x00,0x00,0x30,0x96,0x84,0x01,0x3D,0x01,0x91,0x00,0x01,0x01,0x41,
+  0x82,0x84,0x00,0x76,0x92,0x72,0x01,0x73,0x81,0x81,0x84,0x01,0x6C,0x01,0xB2,0x00,
+  0x01,0x01,0x3C,0x86,0x84,0x01,0x64,0x06,0xA7,0x00,0x02,0x01,0x20,0x6D,0x86,0x84,
+  0x01,0x28,0x01,0xAA,0x00,0x02,0x01,0x14,0x65,0x8E,0x84,0x02,0x70,0x17,0x01,0x90,
+  0x00,0x01,0x01,0x14,0xAA,0x84,0x01,0x5D,0x01,0x92,0x00,0x00,0x30,0x96,0x84,0x01,
+  0x3D,0x01,0x91,0x00,0x01,0x01,0x41,0x82,0x84,0x00,0x76,0x92,0x72,0x01,0x73,0x81,
+  0x81,0x84,0x01,0x6C,0x01,0xB2,0x00,0x01,0x01,0x3C,0x86,0x84,0x01,0x64,0x06,0xA8,
+  0x00,0x02,0x01,0x1C,0x83,0x85,0x84,0x01,0x28,0x01,0xAB,0x00,0x02,0x01,0x1C,0x68,
+  0x8D,0x84,0x02,0x70,0x17,0x01,0x90,0x00,0x01,0x01,0x14,0xAA,0x84,0x01,0x5D,0x01,
+  0x92,0x00,0x00,0x30,0x96,0x84,0x01,0x3D,0x01,0x91,0x00,0x01,0x01,0x41,0x82,0x84,
+  0x00,0x76,0x92,0x72,0x01,0x73,0x81,0x81,0x84,0x01,0x6C,0x01,0xB2,0x00,0x01,0x01,
+  0x3C,0x86,0x84,0x01,0x64,0x06,0xA9,0x00,0x02,0x01,0x34,0x83,0x84,0x84,0x01,0x28,
+  0x01,0xAC,0x00,0x02,0x01,0x1D,0x70,0x8C,0x84,0x02,0x70,0x17,0x01,0x90,0x00,0x01,
+  0x01,0x14,0xAA,0x84,0x01,0x5D,0x01,0x92,0x00,0x00,0x30,0x96,0x84,0x01,0x3D,0x01,
+  0x91,0x00,0x01,0x01,0x41,0x82,0x84,0x00,0x76,0x92,0x72,0x01,0x73,0x81,0x81,0x84,
+  0x01,0x6C,0x01,0xB2,0x00,0x01,0x01,0x3C,0x86,0x84,0x01,0x64,0x06,0xAA,0x00,0x01,
+  0x06,0x54,0x84,0x84,0x01,0x28,0x01,0xAD,0x00,0x01,0x03,0x4C,0x8C,0x84,0x02,0x70,
+  0x17,0x01,0x90,0x00,0x01,0x01,0x14,0xAA,0x84,0x01,0x5D,0x01,0x92,0x00,0x00,0x30,
+  0x96,0x84,0x01,0x3D,0x01,0x91,0x00,0x01,0x01,0x41,0x82,0x84,0x00,0x76,0x92,0x72,
+  0x01,0x73,0x81,0x81,0x84,0x01,0x6C,0x01,0xB2,0x00,0x01,0x01,0x3C,0x86,0x84,0x01,
+  0x64,0x06,0xAA,0x00,0x02,0x01,0x13,0x69,0x83,0x84,0x01,0x28,0x01,0xAE,0x00,0x01,
+  0x14,0x64,0x8B,0x84,0x02,0x70,0x17,0x01,0x90,0x00,0x01,0x01,0x14,0xAA,0x84,0x01,
+  0x5D,0x01,0x92,0x00,0x00,0x30,0x96,0x84,0x01,0x3D,0x01,0x91,0x00,0x01,0x01,0x41,
+  0x82,0x84,0x00,0x76,0x92,0x72,0x01,0x73,0x81,0x81,0x84,0x01,0x6C,0x01,0xB2,0x00,
+  0x01,0x01,0x3C,0x86,0x84,0x01,0x64,0x06,0x8A,0x00,0x88,0x01,0x83,0x00,0x01,0x01,
+  0x01,0x8E,0x00,0x01,0x01,0x45,0x83,0x84,0x01,0x28,0x01,0x8A,0x00,0x8C,0x01,0x83,
+  0x00,0x01,0x01,0x01,0x8D,0x00,0x01,0x01,0x3C,0x8B,0x84,0x02,0x70,0x17,0x01,0x90,
+  0x00,0x01,0x01,0x14,0xAA,0x84,0x01,0x5D,0x01,0x92,0x00,0x00,0x30,0x96,0x84,0x01,
+  0x3D,0x01,0x91,0x00,0x01,0x01,0x41,0x82,0x84,0x00,0x76,0x92,0x72,0x01,0x73,0x81,
+  0x81,0x84,0x01,0x6C,0x01,0xB2,0x00,0x01,0x01,0x3C,0x86,0x84,0x01,0x64,0x06,0x89,
+  0x00,0x02,0x03,0x5D,0x61,0x83,0x63,0x0B,0x59,0x58,0x50,0x43,0x3E,0x3A,0x38,0x38,
+  0x1B,0x0F,0x01,0x01,0x8D,0x00,0x00,0x17,0x83,0x84,0x01,0x28,0x01,0x88,0x00,0x01,
+  0x01,0x34,0x89,0x63,0x0B,0x5C,0x58,0x58,0x4D,0x44,0x40,0x3B,0x38,0x2F,0x12,0x01,
+  0x01,0x8B,0x00,0x01,0x01,0x17,0x8B,0x84,0x02,0x70,0x17,0x01,0x90,0x00,0x01,0x01,
+  0x14,0xAA,0x84,0x01,0x5D,0x01,0x92,0x00,0x00,0x30,0x96,0x84,0x01,0x3D,0x01,0x91,
+  0x00,0x01,0x01,0x41,0x82,0x84,0x00,0x76,0x92,0x72,0x01,0x73,0x81,0x81,0x84,0x01,
+  0x6C,0x01,0xB2,0x00,0x01,0x01,0x3C,0x86,0x84,0x01,0x64,0x06,0x89,0x00,0x01,0x04,
+  0x70,0x8D,0x84,0x03,0x71,0x5C,0x2F,0x0B,0x8C,0x00,0x01,0x04,0x55,0x82,0x84,0x01,
+  0x28,0x01,0x88,0x00,0x01,0x01,0x3D,0x92,0x84,0x03,0x83,0x59,0x29,0x03,0x8B,0x00,
+  0x01,0x01,0x55,0x8A,0x84,0x02,0x70,0x17,0x01,0x90,0x00,0x01,0x01,0x14,0xAA,0x84,
+  0x01,0x5D,0x01,0x92,0x00,0x00,0x30,0x96,0x84,0x01,0x3D,0x01,0x91,0x00,0x01,0x01,
+  0x41,0x82,0x84,0x00,0x76,0x92,0x72,0x01,0x73,0x81,0x81,0x84,0x01,0x6C,0x01,0xB2,
+  0x00,0x01,0x01,0x3C,0x86,0x84,0x01,0x64,0x06,0x89,0x00,0x01,0x04,0x70,0x8F,0x84,
+  0x03,0x83,0x4C,0x0A,0x01,0x8A,0x00,0x01,0x01,0x33,0x82,0x84,0x01,0x28,0x01,0x88,
+  0x00,0x01,0x01,0x3D,0x94,0x84,0x02,0x70,0x37,0x03,0x8A,0x00,0x01,0x01,0x34,0x8A,
+  0x84,0x02,0x70,0x17,0x01,0x90,0x00,0x01,0x01,0x14,0xAA,0x84,0x01,0x5D,0x01,0x92,
+  0x00,0x00,0x30,0x96,0x84,0x01,0x3D,0x01,0x91,0x00,0x01,0x01,0x41,0x82,0x84,0x00,
+  0x76,0x92,0x72,0x01,0x73,0x81,0x81,0x84,0x01,0x6C,0x01,0xB2,0x00,0x01,0x01,0x3C,
+  0x86,0x84,0x01,0x64,0x06,0x89,0x00,0x01,0x04,0x70,0x91,0x84,0x01,0x59,0x06,0x8A,
+  0x00,0x01,0x01,0x17,0x82,0x84,0x01,0x28,0x01,0x88,0x00,0x01,0x01,0x3D,0x96,0x84,
+  0x01,0x25,0x01,0x89,0x00,0x01,0x01,0x1B,0x8A,0x84,0x02,0x70,0x17,0x01,0x90,0x00,
+  0x01,0x01,0x14,0xAA,0x84,0x01,0x5D,0x01,0x92,0x00,0x00,0x30,0x96,0x84,0x01,0x3D,
+  0x01,0x91,0x00,0x01,0x01,0x41,0x82,0x84,0x00,0x76,0x92,0x72,0x01,0x73,0x81,0x81,
+  0x84,0x01,0x6C,0x01,0xB2,0x00,0x01,0x01,0x3C,0x86,0x84,0x01,0x64,0x06,0x89,0x00,
+  0x01,0x04,0x70,0x92,0x84,0x01,0x41,0x01,0x8A,0x00,0x00,0x01,0x82,0x84,0x01,0x28,
+  0x01,0x88,0x00,0x01,0x01,0x3D,0x96,0x84,0x02,0x5C,0x0F,0x01,0x88,0x00,0x02,0x01,
+  0x0F,0x71,0x89,0x84,0x02,0x70,0x17,0x01,0x90,0x00,0x01,0x01,0x14,0xAA,0x84,0x01,
+  0x5D,0x01,0x92,0x00,0x00,0x30,0x96,0x84,0x01,0x3D,0x01,0x91,0x00,0x01,0x01,0x41,
+  0x82,0x84,0x00,0x76,0x92,0x72,0x01,0x73,0x81,0x81,0x84,0x01,0x6C,0x01,0x91,0x00,
+  0xA0,0x01,0x00,0x3C,0x86,0x84,0x01,0x64,0x06,0x89,0x00,0x01,0x04,0x70,0x92,0x84,
+  0x01,0x6D,0x20,0x8A,0x00,0x01,0x01,0x61,0x81,0x84,0x01,0x28,0x01,0x88,0x00,0x01,
+  0x01,0x3D,0x96,0x84,0x02,0x71,0x2F,0x01,0x89,0x00,0x01,0x01,0x6C,0x89,0x84,0x02,
+  0x70,0x17,0x01,0x90,0x00,0x01,0x01,0x14,0xAA,0x84,0x01,0x5D,0x01,0x92,0x00,0x00,
+  0x30,0x96,0x84,0x01,0x3D,0x01,0x91,0x00,0x01,0x01,0x41,0x82,0x84,0x00,0x76,0x92,
+  0x72,0x01,0x73,0x81,0x81,0x84,0x01,0x6C,0x01,0x91,0x00,0x00,0x28,0x9F,0x30,0x00,
+  0x51,0x86,0x84,0x01,0x64,0x06,0x89,0x00,0x01,0x04,0x70,0x93,0x84,0x01,0x4C,0x01,
+  0x89,0x00,0x01,0x01,0x54,0x81,0x84,0x01,0x28,0x01,0x88,0x00,0x01,0x01,0x3D,0x97,
+  0x84,0x01,0x3C,0x01,0x89,0x00,0x01,0x01,0x6C,0x89,0x84,0x02,0x70,0x17,0x01,0x90,
+  0x00,0x01,0x01,0x14,0xAA,0x84,0x01,0x5D,0x01,0x92,0x00,0x00,0x30,0x96,0x84,0x01,
+  0x3D,0x01,0x91,0x00,0x01,0x01,0x41,0x82,0x84,0x00,0x76,0x92,0x72,0x01,0x73,0x81,
+  0x81,0x84,0x01,0x6C,0x01,0x91,0x00,0x00,0x64,0xA8,0x84,0x01,0x64,0x06,0x89,0x00,
+  0x01,0x04,0x70,0x93,0x84,0x01,0x5A,0x05,0x89,0x00,0x01,0x01,0x54,0x81,0x84,0x01,
+  0x28,0x01,0x88,0x00,0x01,0x01,0x3D,0x97,0x84,0x01,0x5B,0x01,0x89,0x00,0x01,0x01,
+  0x6C,0x89,0x84,0x02,0x70,0x17,0x01,0x90,0x00,0x01,0x01,0x14,0xAA,0x84,0x01,0x5D,
+  0x01,0x92,0x00,0x00,0x30,0x96,0x84,0x01,0x3D,0x01,0x91,0x00,0x01,0x01,0x41,0x82,
+  0x84,0x00,0x76,0x92,0x72,0x01,0x73,0x81,0x81,0x84,0x01,0x6C,0x01,0x91,0x00,0x00,
+  0x64,0xA8,0x84,0x01,0x64,0x06,0x89,0x00,0x01,0x04,0x70,0x93,0x84,0x02,0x69,0x10,
+  0x01,0x88,0x00,0x01,0x01,0x54,0x81,0x84,0x01,0x28,0x01,0x88,0x00,0x01,0x01,0x3D,
+  0x97,0x84,0x01,0x5D,0x01,0x89,0x00,0x01,0x01,0x6C,0x89,0x84,0x02,0x70,0x17,0x01,
+  0x90,0x00,0x01,0x01,0x14,0xAA,0x84,0x01,0x5D,0x01,0x92,0x00,0x00,0x30,0x96,0x84,
+  0x01,0x3D,0x01,0x91,0x00,0x01,0x01,0x41,0x82,0x84,0x00,0x76,0x92,0x72,0x01,0x73,
+  0x81,0x81,0x84,0x01,0x6C,0x01,0x91,0x00,0x00,0x64,0xA8,0x84,0x01,0x64,0x06,0x89,
+  0x00,0x01,0x04,0x70,0x93,0x84,0x02,0x69,0x10,0x01,0x88,0x00,0x01,0x01,0x54,0x81,
+  0x84,0x01,0x28,0x01,0x88,0x00,0x01,0x01,0x3D,0x97,0x84,0x01,0x4D,0x01,0x89,0x00,
+  0x01,0x01,0x6C,0x89,0x84,0x02,0x70,0x17,0x01,0x90,0x00,0x01,0x01,0x0F,0xAA,0x84,
+  0x01,0x5D,0x01,0x92,0x00,0x00,0x30,0x96,0x84,0x01,0x3D,0x01,0x91,0x00,0x01,0x01,
+  0x41,0x82,0x84,0x00,0x76,0x92,0x72,0x01,0x73,0x81,0x81,0x84,0x01,0x6C,0x01,0x91,
+  0x00,0x00,0x64,0xA8,0x84,0x01,0x64,0x06,0x89,0x00,0x01,0x04,0x70,0x93,0x84,0x02,
+  0x68,0x0F,0x01,0x88,0x00,0x01,0x01,0x54,0x81,0x84,0x01,0x28,0x01,0x88,0x00,0x01,
+  0x01,0x3D,0x97,0x84,0x01,0x3C,0x01,0x88,0x00,0x02,0x01,0x10,0x83,0x89,0x84,0x02,
+  0x70,0x17,0x01,0x90,0x00,0x01,0x01,0x0F,0xAA,0x84,0x01,0x5D,0x01,0x92,0x00,0x00,
+  0x30,0x96,0x84,0x01,0x3D,0x01,0x91,0x00,0x01,0x01,0x41,0x82,0x84,0x00,0x76,0x92,
+  0x72,0x01,0x73,0x81,0x81,0x84,0x01,0x6C,0x01,0x91,0x00,0x00,0x64,0xA8,0x84,0x01,
+  0x64,0x06,0x89,0x00,0x01,0x04,0x70,0x93,0x84,0x01,0x55,0x01,0x89,0x00,0x01,0x01,
+  0x54,0x81,0x84,0x01,0x28,0x01,0x88,0x00,0x01,0x01,0x3D,0x96,0x84,0x02,0x6C,0x20,
+  0x01,0x88,0x00,0x01,0x01,0x1B,0x8A,0x84,0x02,0x70,0x17,0x01,0x90,0x00,0x01,0x01,
+  0x0F,0xAA,0x84,0x01,0x5D,0x01,0x92,0x00,0x00,0x30,0x96,0x84,0x01,0x3D,0x01,0x91,
+  0x00,0x01,0x01,0x41,0x82,0x84,0x00,0x76,0x92,0x72,0x01,0x73,0x81,0x81,0x84,0x01,
+  0x6C,0x01,0x91,0x00,0x00,0x64,0xA8,0x84,0x01,0x64,0x06,0x89,0x00,0x01,0x04,0x70,
+  0x93,0x84,0x01,0x3C,0x01,0x89,0x00,0x01,0x01,0x58,0x81,0x84,0x01,0x28,0x01,0x88,
+  0x00,0x01,0x01,0x3D,0x96,0x84,0x01,0x4D,0x06,0x89,0x00,0x01,0x01,0x35,0x8A,0x84,
+  0x02,0x70,0x17,0x01,0x90,0x00,0x01,0x01,0x0F,0xAA,0x84,0x01,0x58,0x01,0x92,0x00,
+  0x00,0x30,0x96,0x84,0x01,0x3D,0x01,0x91,0x00,0x01,0x01,0x41,0x82,0x84,0x00,0x76,
+  0x92,0x72,0x01,0x73,0x81,0x81,0x84,0x01,0x6C,0x01,0x91,0x00,0x00,0x64,0xA8,0x84,
+  0x01,0x64,0x06,0x89,0x00,0x01,0x04,0x70,0x92,0x84,0x01,0x61,0x11,0x8A,0x00,0x01,
+  0x01,0x71,0x81,0x84,0x01,0x28,0x01,0x88,0x00,0x01,0x01,0x3D,0x95,0x84,0x02,0x70,
+  0x13,0x01,0x89,0x00,0x01,0x01,0x5C,0x8A,0x84,0x02,0x70,0x17,0x01,0x90,0x00,0x02,
+  0x01,0x0B,0x83,0xA9,0x84,0x01,0x3B,0x01,0x92,0x00,0x00,0x30,0x96,0x84,0x01,0x3D,
+  0x01,0x91,0x00,0x01,0x01,0x41,0x82,0x84,0x00,0x76,0x92,0x72,0x01,0x73,0x81,0x81,
+  0x84,0x01,0x6C,0x01,0x91,0x00,0x00,0x64,0xA8,0x84,0x01,0x64,0x06,0x89,0x00,0x01,
+  0x04,0x70,0x92,0x84,0x01,0x2F,0x01,0x8A,0x00,0x00,0x0A,0x82,0x84,0x01,0x28,0x01,
+  0x88,0x00,0x01,0x01,0x3D,0x94,0x84,0x02,0x61,0x1C,0x01,0x89,0x00,0x01,0x01,0x18,
+  0x8B,0x84,0x02,0x70,0x17,0x01,0x91,0x00,0x01,0x01,0x60,0xA9,0x84,0x01,0x2C,0x01,
+  0x92,0x00,0x00,0x30,0x96,0x84,0x01,0x3D,0x01,0x91,0x00,0x01,0x01,0x41,0x82,0x84,
+  0x00,0x76,0x92,0x72,0x01,0x73,0x81,0x81,0x84,0x01,0x6C,0x01,0x91,0x00,0x00,0x64,
+  0xA8,0x84,0x01,0x64,0x06,0x89,0x00,0x01,0x04,0x70,0x91,0x84,0x01,0x44,0x05,0x8A,
+  0x00,0x01,0x01,0x24,0x82,0x84,0x01,0x28,0x01,0x88,0x00,0x01,0x01,0x3D,0x91,0x84,
+  0x04,0x83,0x64,0x40,0x14,0x01,0x8A,0x00,0x01,0x01,0x40,0x8B,0x84,0x02,0x70,0x17,
+  0x01,0x91,0x00,0x01,0x01,0x54,0xA9,0x84,0x01,0x2B,0x01,0x92,0x00,0x00,0x30,0x96,
+  0x84,0x01,0x3D,0x01,0x91,0x00,0x01,0x01,0x41,0x82,0x84,0x00,0x76,0x92,0x72,0x01,
+  0x73,0x81,0x81,0x84,0x01,0x6C,0x01,0x91,0x00,0x00,0x64,0xA8,0x84,0x01,0x64,0x06,
+  0x89,0x00,0x01,0x04,0x70,0x8F,0x84,0x02,0x6D,0x31,0x01,0x8B,0x00,0x01,0x01,0x4C,
+  0x82,0x84,0x01,0x28,0x01,0x88,0x00,0x01,0x01,0x1F,0x8F,0x38,0x04,0x1F,0x14,0x10,
+  0x02,0x01,0x8C,0x00,0x01,0x1E,0x6C,0x8B,0x84,0x02,0x70,0x17,0x01,0x91,0x00,0x01,
+  0x01,0x4C,0xA8,0x84,0x02,0x6F,0x18,0x01,0x92,0x00,0x00,0x33,0x96,0x84,0x01,0x3D,
+  0x01,0x91,0x00,0x01,0x01,0x41,0x82,0x84,0x00,0x76,0x92,0x72,0x01,0x73,0x81,0x81,
+  0x84,0x01,0x6C,0x01,0x91,0x00,0x00,0x64,0xA8,0x84,0x01,0x64,0x06,0x89,0x00,0x01,
+  0x04,0x6E,0x89,0x84,0x81,0x83,0x04,0x65,0x5C,0x3C,0x12,0x01,0x8C,0x00,0x01,0x0F,
+  0x6D,0x82,0x84,0x01,0x28,0x01,0x9B,0x00,0x81,0x01,0x8C,0x00,0x02,0x01,0x06,0x54,
+  0x8C,0x84,0x02,0x70,0x17,0x01,0x91,0x00,0x01,0x01,0x28,0xA8,0x84,0x02,0x69,0x10,
+  0x01,0x91,0x00,0x01,0x01,0x46,0x96,0x84,0x01,0x3D,0x01,0x91,0x00,0x01,0x01,0x41,
+  0x82,0x84,0x00,0x76,0x92,0x72,0x01,0x73,0x81,0x81,0x84,0x01,0x6C,0x01,0x91,0x00,
+  0x00,0x64,0xA8,0x84,0x01,0x64,0x06,0x89,0x00,0x01,0x01,0x41,0x87,0x44,0x08,0x43,
+  0x3B,0x25,0x18,0x18,0x0A,0x03,0x01,0x01,0x8C,0x00,0x01,0x01,0x36,0x83,0x84,0x01,
+  0x28,0x01,0xAC,0x00,0x02,0x03,0x33,0x83,0x8C,0x84,0x02,0x71,0x1A,0x01,0x91,0x00,
+  0x01,0x01,0x21,0xA8,0x84,0x01,0x5F,0x06,0x92,0x00,0x01,0x01,0x54,0x96,0x84,0x01,
+  0x3D,0x01,0x91,0x00,0x01,0x01,0x41,0x82,0x84,0x00,0x76,0x92,0x72,0x01,0x73,0x81,
+  0x81,0x84,0x01,0x6C,0x01,0x91,0x00,0x00,0x64,0xA8,0x84,0x01,0x64,0x06,0x8A,0x00,
+  0x8B,0x01,0x91,0x00,0x02,0x01,0x0F,0x64,0x83,0x84,0x01,0x28,0x01,0xAB,0x00,0x02,
+  0x01,0x2A,0x6D,0x8E,0x84,0x01,0x2C,0x01,0x92,0x00,0x00,0x06,0xA8,0x84,0x01,0x54,
+  0x01,0x92,0x00,0x01,0x01,0x54,0x96,0x84,0x01,0x3D,0x01,0x91,0x00,0x01,0x01,0x41,
+  0x82,0x84,0x00,0x76,0x92,0x72,0x01,0x73,0x81,0x81,0x84,0x01,0x6C,0x01,0x91,0x00,
+  0x00,0x64,0xA8,0x84,0x01,0x64,0x06,0xAA,0x00,0x02,0x01,0x3B,0x83,0x83,0x84,0x01,
+  0x28,0x01,0xAA,0x00,0x02,0x01,0x23,0x68,0x8F,0x84,0x01,0x31,0x01,0x92,0x00,0x01,
+  0x01,0x61,0xA7,0x84,0x00,0x34,0x93,0x00,0x01,0x01,0x54,0x96,0x84,0x01,0x3D,0x01,
+  0x91,0x00,0x01,0x01,0x41,0x82,0x84,0x00,0x76,0x92,0x72,0x01,0x73,0x81,0x81,0x84,
+  0x01,0x6C,0x01,0x91,0x00,0x00,0x64,0xA8,0x84,0x01,0x64,0x06,0xA9,0x00,0x02,0x01,
+  0x20,0x71,0x84,0x84,0x01,0x28,0x01,0xA8,0x00,0x02,0x01,0x05,0x3C,0x91,0x84,0x01,
+  0x33,0x01,0x92,0x00,0x01,0x01,0x49,0xA7,0x84,0x00,0x20,0x92,0x00,0x02,0x01,0x0A,
+  0x5D,0x96,0x84,0x01,0x3D,0x01,0x91,0x00,0x01,0x01,0x41,0x82,0x84,0x00,0x76,0x92,
+  0x72,0x01,0x73,0x81,0x81,0x84,0x01,0x6C,0x01,0x91,0x00,0x00,0x64,0xA8,0x84,0x01,
+  0x64,0x06,0xA9,0x00,0x01,0x0B,0x65,0x85,0x84,0x01,0x28,0x01,0xA5,0x00,0x04,0x01,
+  0x00,0x06,0x25,0x5D,0x92,0x84,0x01,0x43,0x04,0x92,0x00,0x02,0x01,0x30,0x83,0xA5,
+  0x84,0x01,0x6D,0x0A,0x92,0x00,0x02,0x01,0x1B,0x69,0x96,0x84,0x01,0x3D,0x01,0x91,
+  0x00,0x01,0x01,0x41,0x82,0x84,0x00,0x76,0x92,0x72,0x01,0x73,0x81,0x81,0x84,0x01,
+  0x6C,0x01,0x91,0x00,0x00,0x64,0xA8,0x84,0x01,0x64,0x06,0xA8,0x00,0x01,0x06,0x51,
+  0x86,0x84,0x01,0x28,0x01,0xA4,0x00,0x04,0x01,0x0B,0x24,0x50,0x70,0x93,0x84,0x01,
+  0x53,0x07,0x93,0x00,0x01,0x18,0x68,0xA5,0x84,0x01,0x45,0x01,0x92,0x00,0x02,0x01,
+  0x1E,0x6C,0x96,0x84,0x01,0x3D,0x01,0x91,0x00,0x01,0x01,0x41,0x82,0x84,0x00,0x76,
+  0x92,0x72,0x01,0x73,0x81,0x81,0x84,0x01,0x6C,0x01,0x91,0x00,0x00,0x64,0xA8,0x84,
+  0x01,0x64,0x06,0xA6,0x00,0x02,0x01,0x1B,0x5A,0x87,0x84,0x01,0x28,0x01,0xA1,0x00,
+  0x04,0x09,0x18,0x30,0x4D,0x64,0x96,0x84,0x01,0x60,0x10,0x93,0x00,0x01,0x05,0x48,
+  0xA5,0x84,0x01,0x20,0x01,0x92,0x00,0x02,0x01,0x35,0x83,0x96,0x84,0x01,0x3D,0x01,
+  0x91,0x00,0x01,0x01,0x41,0x82,0x84,0x00,0x76,0x92,0x72,0x01,0x73,0x81,0x81,0x84,
+  0x01,0x6C,0x01,0x91,0x00,0x00,0x64,0xA8,0x84,0x01,0x64,0x06,0xA4,0x00,0x03,0x01,
+  0x01,0x24,0x64,0x88,0x84,0x01,0x28,0x01,0x89,0x00,0x83,0x01,0x8F,0x00,0x04,0x01,
+  0x20,0x61,0x69,0x83,0x98,0x84,0x01,0x83,0x1B,0x93,0x00,0x02,0x01,0x23,0x83,0xA3,
+  0x84,0x01,0x68,0x01,0x93,0x00,0x01,0x01,0x3D,0x97,0x84,0x01,0x3D,0x01,0x91,0x00,
+  0x01,0x01,0x41,0x82,0x84,0x00,0x76,0x92,0x72,0x01,0x73,0x81,0x81,0x84,0x01,0x6C,
+  0x01,0x91,0x00,0x00,0x64,0xA8,0x84,0x01,0x64,0x06,0xA3,0x00,0x02,0x01,0x13,0x44,
+  0x8A,0x84,0x01,0x28,0x01,0x89,0x00,0x07,0x0A,0x13,0x12,0x13,0x0B,0x03,0x01,0x01,
+  0x8D,0x00,0x02,0x01,0x24,0x69,0x9A,0x84,0x01,0x31,0x01,0x92,0x00,0x02,0x01,0x06,
+  0x59,0xA3,0x84,0x01,0x33,0x01,0x93,0x00,0x01,0x01,0x5C,0x97,0x84,0x01,0x3D,0x01,
+  0x91,0x00,0x01,0x01,0x41,0x82,0x84,0x00,0x76,0x92,0x72,0x01,0x73,0x81,0x81,0x84,
+  0x01,0x6C,0x01,0x91,0x00,0x00,0x64,0xA8,0x84,0x01,0x64,0x06,0x9F,0x00,0x05,0x01,
+  0x01,0x0B,0x20,0x4B,0x70,0x8B,0x84,0x01,0x28,0x01,0x88,0x00,0x01,0x01,0x3D,0x81,
+  0x84,0x07,0x71,0x6A,0x68,0x65,0x49,0x30,0x14,0x01,0x8A,0x00,0x03,0x01,0x0D,0x41,
+  0x71,0x98,0x84,0x01,0x44,0x01,0x93,0x00,0x02,0x01,0x27,0x83,0xA1,0x84,0x01,0x65,
+  0x0A,0x94,0x00,0x01,0x0B,0x68,0x97,0x84,0x01,0x3D,0x01,0x91,0x00,0x01,0x01,0x41,
+  0x82,0x84,0x00,0x76,0x92,0x72,0x01,0x73,0x81,0x81,0x84,0x01,0x6C,0x01,0x91,0x00,
+  0x00,0x64,0xA8,0x84,0x01,0x64,0x06,0x8A,0x00,0x8E,0x01,0x81,0x05,0x05,0x10,0x18,
+  0x25,0x3C,0x57,0x71,0x8D,0x84,0x01,0x28,0x01,0x88,0x00,0x01,0x01,0x3D,0x87,0x84,
+  0x02,0x61,0x28,0x05,0x8B,0x00,0x02,0x04,0x3B,0x6F,0x97,0x84,0x01,0x60,0x01,0x94,
+  0x00,0x01,0x05,0x50,0xA0,0x84,0x02,0x83,0x2A,0x01,0x93,0x00,0x02,0x01,0x1C,0x71,
+  0x97,0x84,0x01,0x3D,0x01,0x91,0x00,0x01,0x01,0x41,0x82,0x84,0x00,0x76,0x92,0x72,
+  0x01,0x73,0x81,0x81,0x84,0x01,0x6C,0x01,0x91,0x00,0x00,0x64,0xA8,0x84,0x01,0x64,
+  0x06,0x89,0x00,0x01,0x01,0x41,0x8B,0x44,0x06,0x48,0x58,0x61,0x62,0x62,0x6C,0x83,
+  0x91,0x84,0x01,0x28,0x01,0x88,0x00,0x01,0x01,0x3D,0x88,0x84,0x02,0x83,0x48,0x01,
+  0x8B,0x00,0x02,0x01,0x24,0x70,0x96,0x84,0x02,0x71,0x0A,0x01,0x93,0x00,0x02,0x01,
+  0x1C,0x71,0x9F,0x84,0x01,0x57,0x0A,0x94,0x00,0x01,0x01,0x33,0x98,0x84,0x01,0x3D,
+  0x01,0x91,0x00,0x01,0x01,0x41,0x82,0x84,0x00,0x76,0x92,0x72,0x01,0x73,0x81,0x81,
+  0x84,0x01,0x6C,0x01,0x91,0x00,0x00,0x64,0xA8,0x84,0x01,0x64,0x06,0x89,0x00,0x01,
+  0x04,0x70,0xA5,0x84,0x01,0x28,0x01,0x88,0x00,0x01,0x01,0x3D,0x89,0x84,0x02,0x83,
+  0x41,0x01,0x8B,0x00,0x02,0x01,0x28,0x70,0x96,0x84,0x00,0x28,0x95,0x00,0x01,0x01,
+  0x35,0x9E,0x84,0x01,0x69,0x10,0x95,0x00,0x01,0x06,0x51,0x98,0x84,0x01,0x3D,0x01,
+  0x91,0x00,0x01,0x01,0x41,0x82,0x84,0x00,0x76,0x92,0x72,0x01,0x73,0x81,0x81,0x84,
+  0x01,0x6C,0x01,0x91,0x00,0x00,0x64,0xA8,0x84,0x01,0x64,0x06,0x89,0x00,0x01,0x04,
+  0x70,0xA5,0x84,0x01,0x28,0x01,0x88,0x00,0x01,0x01,0x3D,0x8B,0x84,0x01,0x34,0x01,
+  0x8B,0x00,0x02,0x01,0x34,0x83,0x95,0x84,0x01,0x58,0x01,0x95,0x00,0x02,0x01,0x38,
+  0x83,0x9B,0x84,0x02,0x64,0x1F,0x01,0x95,0x00,0x01,0x1C,0x71,0x98,0x84,0x01,0x3D,
+  0x01,0x91,0x00,0x01,0x01,0x41,0x82,0x84,0x00,0x76,0x92,0x72,0x01,0x73,0x81,0x81,
+  0x84,0x01,0x6C,0x01,0x91,0x00,0x00,0x64,0xA8,0x84,0x01,0x64,0x06,0x89,0x00,0x01,
+  0x04,0x70,0xA5,0x84,0x01,0x28,0x01,0x88,0x00,0x01,0x01,0x3D,0x8B,0x84,0x02,0x83,
+  0x28,0x01,0x8B,0x00,0x02,0x01,0x2F,0x83,0x94,0x84,0x02,0x71,0x13,0x01,0x95,0x00,
+  0x02,0x01,0x47,0x83,0x99,0x84,0x02,0x6D,0x20,0x01,0x95,0x00,0x01,0x01,0x3C,0x99,
+  0x84,0x01,0x3D,0x01,0x91,0x00,0x01,0x01,0x41,0x82,0x84,0x00,0x76,0x92,0x72,0x01,
+  0x73,0x81,0x81,0x84,0x01,0x6C,0x01,0x91,0x00,0x00,0x64,0xA8,0x84,0x01,0x64,0x06,
+  0x89,0x00,0x01,0x04,0x70,0xA5,0x84,0x01,0x28,0x01,0x88,0x00,0x01,0x01,0x3D,0x8C,
+  0x84,0x02,0x60,0x10,0x01,0x8B,0x00,0x01,0x09,0x55,0x95,0x84,0x01,0x37,0x01,0x96,
+  0x00,0x02,0x05,0x3C,0x71,0x97,0x84,0x02,0x69,0x1F,0x01,0x96,0x00,0x01,0x05,0x61,
+  0x99,0x84,0x01,0x3D,0x01,0x91,0x00,0x01,0x01,0x41,0x82,0x84,0x00,0x76,0x92,0x72,
+  0x01,0x73,0x81,0x81,0x84,0x01,0x6C,0x01,0x91,0x00,0x00,0x64,0xA8,0x84,0x01,0x64,
+  0x06,0x89,0x00,0x01,0x04,0x70,0xA5,0x84,0x01,0x28,0x01,0x88,0x00,0x01,0x01,0x3D,
+  0x8D,0x84,0x01,0x4C,0x05,0x8B,0x00,0x02,0x01,0x18,0x64,0x94,0x84,0x01,0x60,0x06,
+  0x97,0x00,0x02,0x03,0x27,0x64,0x94,0x84,0x03,0x83,0x4C,0x14,0x01,0x96,0x00,0x02,
+  0x01,0x28,0x83,0x99,0x84,0x01,0x3D,0x01,0x91,0x00,0x01,0x01,0x41,0x82,0x84,0x00,
+  0x76,0x92,0x72,0x01,0x73,0x81,0x81,0x84,0x01,0x6C,0x01,0x91,0x00,0x00,0x64,0xA8,
+  0x84,0x01,0x64,0x06,0x89,0x00,0x01,0x04,0x70,0xA5,0x84,0x01,0x28,0x01,0x88,0x00,
+  0x01,0x01,0x3D,0x8D,0x84,0x02,0x83,0x2F,0x01,0x8B,0x00,0x02,0x01,0x27,0x83,0x93,
+  0x84,0x02,0x83,0x28,0x01,0x97,0x00,0x03,0x01,0x05,0x40,0x6C,0x91,0x84,0x02,0x5A,
+  0x23,0x01,0x98,0x00,0x01,0x01,0x60,0x9A,0x84,0x01,0x3D,0x01,0x91,0x00,0x01,0x01,
+  0x41,0x82,0x84,0x00,0x76,0x92,0x72,0x01,0x73,0x81,0x81,0x84,0x01,0x6C,0x01,0x91,
+  0x00,0x00,0x64,0xA8,0x84,0x01,0x64,0x06,0x89,0x00,0x01,0x04,0x70,0xA5,0x84,0x01,
+  0x28,0x01,0x88,0x00,0x01,0x01,0x3D,0x8E,0x84,0x02,0x6D,0x0E,0x01,0x8B,0x00,0x01,
+  0x01,0x45,0x94,0x84,0x01,0x64,0x0B,0x99,0x00,0x05,0x01,0x06,0x28,0x48,0x60,0x6D,
+  0x88,0x84,0x06,0x83,0x68,0x55,0x3C,0x18,0x01,0x01,0x98,0x00,0x02,0x01,0x28,0x83,
+  0x9A,0x84,0x01,0x3D,0x01,0x91,0x00,0x01,0x01,0x41,0x82,0x84,0x00,0x76,0x92,0x72,
+  0x01,0x73,0x81,0x81,0x84,0x01,0x6C,0x01,0x91,0x00,0x00,0x64,0xA8,0x84,0x01,0x64,
+  0x06,0x89,0x00,0x01,0x04,0x70,0xA5,0x84,0x01,0x28,0x01,0x88,0x00,0x01,0x01,0x3D,
+  0x8F,0x84,0x01,0x60,0x05,0x8C,0x00,0x01,0x03,0x61,0x94,0x84,0x01,0x30,0x01,0x9A,
+  0x00,0x06,0x01,0x01,0x0F,0x23,0x35,0x43,0x56,0x83,0x58,0x06,0x53,0x38,0x30,0x17,
+  0x06,0x01,0x01,0x9A,0x00,0x01,0x0A,0x56,0x9B,0x84,0x01,0x3D,0x01,0x91,0x00,0x01,
+  0x01,0x41,0x82,0x84,0x00,0x76,0x92,0x72,0x01,0x73,0x81,0x81,0x84,0x01,0x6C,0x01,
+  0x91,0x00,0x00,0x64,0xA8,0x84,0x01,0x64,0x06,0x89,0x00,0x01,0x04,0x70,0xA5,0x84,
+  0x01,0x28,0x01,0x88,0x00,0x01,0x01,0x3D,0x8F,0x84,0x02,0x83,0x33,0x01,0x8B,0x00,
+  0x02,0x01,0x2C,0x71,0x93,0x84,0x02,0x66,0x18,0x01,0x9B,0x00,0x8A,0x01,0x9E,0x00,
+  0x02,0x01,0x3C,0x83,0x9B,0x84,0x01,0x3D,0x01,0x91,0x00,0x01,0x01,0x41,0x82,0x84,
+  0x00,0x76,0x92,0x72,0x01,0x73,0x81,0x81,0x84,0x01,0x6C,0x01,0x91,0x00,0x00,0x64,
+  0xA8,0x84,0x01,0x64,0x06,0x89,0x00,0x01,0x04,0x70,0xA5,0x84,0x01,0x28,0x01,0x88,
+  0x00,0x01,0x01,0x3D,0x90,0x84,0x02,0x70,0x1C,0x01,0x8B,0x00,0x01,0x05,0x45,0x94,
+  0x84,0x01,0x51,0x01,0xC6,0x00,0x02,0x01,0x15,0x6C,0x9C,0x84,0x01,0x3D,0x01,0x91,
+  0x00,0x01,0x01,0x41,0x82,0x84,0x00,0x76,0x92,0x72,0x01,0x73,0x81,0x81,0x84,0x01,
+  0x6C,0x01,0x91,0x00,0x00,0x64,0xA8,0x84,0x01,0x64,0x06,0x89,0x00,0x01,0x04,0x70,
+  0xA5,0x84,0x01,0x28,0x01,0x88,0x00,0x01,0x01,0x3D,0x91,0x84,0x01,0x55,0x06,0x8B,
+  0x00,0x02,0x01,0x13,0x68,0x94,0x84,0x01,0x2C,0x01,0xC5,0x00,0x01,0x0B,0x51,0x9D,
+  0x84,0x01,0x3D,0x01,0x91,0x00,0x01,0x01,0x41,0x82,0x84,0x00,0x76,0x92,0x72,0x01,
+  0x73,0x81,0x81,0x84,0x01,0x6C,0x01,0x91,0x00,0x00,0x64,0xA8,0x84,0x01,0x64,0x06,
+  0x89,0x00,0x01,0x04,0x70,0xA5,0x84,0x01,0x28,0x01,0x88,0x00,0x01,0x01,0x3D,0x92,
+  0x84,0x01,0x37,0x01,0x8B,0x00,0x02,0x01,0x39,0x83,0x93,0x84,0x02,0x71,0x1A,0x01,
+  0xC3,0x00,0x01,0x01,0x40,0x9E,0x84,0x01,0x3D,0x01,0x91,0x00,0x01,0x01,0x41,0x82,
+  0x84,0x00,0x76,0x92,0x72,0x01,0x73,0x81,0x81,0x84,0x01,0x6C,0x01,0x91,0x00,0x00,
+  0x64,0xA8,0x84,0x01,0x64,0x06,0x89,0x00,0x01,0x04,0x70,0xA5,0x84,0x01,0x28,0x01,
+  0x88,0x00,0x01,0x01,0x3D,0x92,0x84,0x02,0x70,0x1B,0x01,0x8B,0x00,0x01,0x06,0x51,
+  0x94,0x84,0x02,0x65,0x1C,0x01,0xC1,0x00,0x02,0x01,0x3A,0x83,0x9E,0x84,0x01,0x3D,
+  0x01,0x91,0x00,0x01,0x01,0x41,0x82,0x84,0x00,0x76,0x92,0x72,0x01,0x73,0x81,0x81,
+  0x84,0x01,0x6C,0x01,0x91,0x00,0x00,0x64,0xA8,0x84,0x01,0x64,0x06,0x89,0x00,0x01,
+  0x04,0x70,0xA5,0x84,0x01,0x28,0x01,0x88,0x00,0x01,0x01,0x3D,0x93,0x84,0x01,0x55,
+  0x0F,0x8B,0x00,0x02,0x01,0x18,0x71,0x94,0x84,0x02,0x61,0x0F,0x01,0xBF,0x00,0x01,
+  0x01,0x31,0xA0,0x84,0x01,0x3D,0x01,0x91,0x00,0x01,0x01,0x41,0x82,0x84,0x00,0x76,
+  0x92,0x72,0x01,0x73,0x81,0x81,0x84,0x01,0x6C,0x01,0x91,0x00,0x00,0x64,0xA8,0x84,
+  0x01,0x64,0x06,0x89,0x00,0x01,0x04,0x70,0xA5,0x84,0x01,0x28,0x01,0x88,0x00,0x01,
+  0x01,0x3D,0x94,0x84,0x01,0x40,0x01,0x8B,0x00,0x01,0x01,0x34,0x95,0x84,0x02,0x59,
+  0x1B,0x01,0xBD,0x00,0x02,0x04,0x3C,0x70,0xA0,0x84,0x01,0x3D,0x01,0x91,0x00,0x01,
+  0x01,0x41,0x82,0x84,0x00,0x76,0x92,0x72,0x01,0x73,0x81,0x81,0x84,0x01,0x6C,0x01,
+  0x91,0x00,0x00,0x64,0xA8,0x84,0x01,0x64,0x06,0x89,0x00,0x01,0x04,0x70,0xA5,0x84,
+  0x01,0x28,0x01,0x88,0x00,0x01,0x01,0x3D,0x94,0x84,0x02,0x70,0x17,0x01,0x8A,0x00,
+  0x02,0x01,0x09,0x60,0x95,0x84,0x02,0x6D,0x13,0x01,0xBB,0x00,0x02,0x04,0x3C,0x83,
+  0xA1,0x84,0x01,0x3D,0x01,0x91,0x00,0x01,0x01,0x41,0x82,0x84,0x00,0x76,0x92,0x72,
+  0x01,0x73,0x81,0x81,0x84,0x01,0x6C,0x01,0x91,0x00,0x00,0x64,0xA8,0x84,0x01,0x64,
+  0x06,0x89,0x00,0x01,0x04,0x70,0xA5,0x84,0x01,0x28,0x01,0x88,0x00,0x01,0x01,0x3D,
+  0x95,0x84,0x01,0x5C,0x07,0x8B,0x00,0x02,0x01,0x27,0x83,0x95,0x84,0x02,0x70,0x2F,
+  0x01,0xB8,0x00,0x02,0x01,0x01,0x54,0xA3,0x84,0x01,0x3D,0x01,0x91,0x00,0x01,0x01,
+  0x41,0x82,0x84,0x00,0x76,0x92,0x72,0x01,0x73,0x81,0x81,0x84,0x01,0x6C,0x01,0x91,
+  0x00,0x00,0x64,0xA8,0x84,0x01,0x64,0x06,0x89,0x00,0x01,0x04,0x70,0xA5,0x84,0x01,
+  0x28,0x01,0x88,0x00,0x01,0x01,0x3D,0x96,0x84,0x01,0x3C,0x01,0x8B,0x00,0x01,0x05,
+  0x43,0x96,0x84,0x04,0x71,0x4D,0x13,0x01,0x01,0xB3,0x00,0x03,0x01,0x05,0x20,0x64,
+  0xA4,0x84,0x01,0x3D,0x01,0x91,0x00,0x01,0x01,0x41,0x82,0x84,0x00,0x76,0x92,0x72,
+  0x01,0x73,0x81,0x81,0x84,0x01,0x6C,0x01,0x91,0x00,0x00,0x64,0xA8,0x84,0x01,0x64,
+  0x06,0x89,0x00,0x01,0x04,0x70,0xA5,0x84,0x01,0x28,0x01,0x88,0x00,0x01,0x01,0x3D,
+  0x96,0x84,0x02,0x6C,0x24,0x01,0x8A,0x00,0x02,0x01,0x10,0x64,0x97,0x84,0x03,0x69,
+  0x2E,0x09,0x01,0xB1,0x00,0x03,0x01,0x10,0x4C,0x71,0xA5,0x84,0x01,0x3D,0x01,0x91,
+  0x00,0x01,0x01,0x41,0x82,0x84,0x00,0x76,0x92,0x72,0x01,0x73,0x81,0x81,0x84,0x01,
+  0x6C,0x01,0x91,0x00,0x00,0x64,0xA8,0x84,0x01,0x64,0x06,0x89,0x00,0x01,0x04,0x70,
+  0xA5,0x84,0x01,0x28,0x01,0x88,0x00,0x01,0x01,0x3D,0x97,0x84,0x01,0x60,0x0A,0x8B,
+  0x00,0x02,0x01,0x28,0x83,0x97,0x84,0x04,0x83,0x60,0x29,0x05,0x01,0xAC,0x00,0x04,
+  0x01,0x01,0x0F,0x42,0x68,0xA7,0x84,0x01,0x3D,0x01,0x91,0x00,0x01,0x01,0x41,0x82,
+  0x84,0x00,0x76,0x92,0x72,0x01,0x73,0x81,0x81,0x84,0x01,0x6C,0x01,0x91,0x00,0x00,
+  0x64,0xA8,0x84,0x01,0x64,0x06,0x89,0x00,0x01,0x04,0x70,0xA5,0x84,0x01,0x28,0x01,
+  0x88,0x00,0x01,0x01,0x3D,0x98,0x84,0x01,0x3B,0x05,0x8B,0x00,0x01,0x04,0x51,0x99,
+  0x84,0x05,0x70,0x54,0x24,0x05,0x01,0x01,0xA7,0x00,0x04,0x01,0x01,0x11,0x38,0x64,
+  0xA9,0x84,0x01,0x3D,0x01,0x91,0x00,0x01,0x01,0x41,0x82,0x84,0x00,0x76,0x92,0x72,
+  0x01,0x73,0x81,0x81,0x84,0x01,0x6C,0x01,0x91,0x00,0x00,0x64,0xA8,0x84,0x01,0x64,
+  0x06,0x89,0x00,0x01,0x04,0x70,0xA5,0x84,0x01,0x28,0x01,0x88,0x00,0x01,0x01,0x3D,
+  0x98,0x84,0x02,0x6C,0x20,0x01,0x8A,0x00,0x02,0x01,0x1C,0x71,0x9B,0x84,0x05,0x6D,
+  0x46,0x16,0x01,0x00,0x01,0xA0,0x00,0x06,0x01,0x01,0x00,0x01,0x2A,0x55,0x83,0xAB,
+  0x84,0x01,0x3D,0x01,0x91,0x00,0x01,0x01,0x41,0x82,0x84,0x00,0x76,0x92,0x72,0x01,
+  0x73,0x81,0x81,0x84,0x01,0x6C,0x01,0x91,0x00,0x00,0x64,0xA8,0x84,0x01,0x64,0x06,
+  0x89,0x01,0x01,0x05,0x70,0xA5,0x84,0x00,0x28,0x8A,0x01,0x00,0x3F,0x99,0x84,0x01,
+  0x61,0x05,0x8C,0x01,0x00,0x31,0x9D,0x84,0x07,0x71,0x60,0x43,0x27,0x10,0x0A,0x01,
+  0x01,0x99,0x00,0x06,0x01,0x03,0x0F,0x1B,0x2F,0x4C,0x6B,0xAE,0x84,0x00,0x44,0x93,
+  0x10,0x00,0x45,0x82,0x84,0x00,0x78,0x92,0x75,0x01,0x77,0x82,0x81,0x84,0x01,0x6C,
+  0x10,0x91,0x0F,0x00,0x65,0xA8,0x84,0x01,0x68,0x27,0x8A,0x24,0x00,0x71,0xA5,0x84,
+  0x00,0x3D,0x8A,0x24,0x00,0x4D,0x9A,0x84,0x00,0x3F,0x8C,0x24,0x01,0x25,0x6D,0xA0,
+  0x84,0x07,0x61,0x51,0x3B,0x23,0x18,0x0A,0x06,0x05,0x91,0x01,0x07,0x06,0x06,0x13,
+  0x19,0x30,0x41,0x5C,0x6D,0xB1,0x84,0x00,0x69,0x93,0x60,0x00,0x6C,0x82,0x84,0x00,
+  0x7F,0x93,0x7E,0x82,0x84,0x01,0x83,0x5D,0x91,0x5C,0x00,0x71,0xFF,0x84,0xBE,0x84,
+  0x08,0x83,0x68,0x64,0x5C,0x47,0x46,0x44,0x34,0x26,0x87,0x25,0x08,0x2B,0x3C,0x45,
+  0x47,0x48,0x64,0x64,0x6D,0x83,0xFF,0x84,0xFF,0x84,0xC6,0x84,0x00,0x83,0x88,0x70,
+  0x00,0x71,0xFF,0x84,0xFF,0x84,0xFF,0x84,0xFF,0x84,0xFF,0x84,0xFF,0x84,0xA1,0x84,
+  0x02,0x83,0x71,0x83,0xFF,0x84,0xAE,0x84,0x01,0x71,0x83,0xFF,0x84,0xA5,0x84,0x02,
+  0x4C,0x2C,0x4D,0xFF,0x84,0xAD,0x84,0x02,0x60,0x2C,0x49,0xFF,0x84,0xA4,0x84,0x03,
+  0x6C,0x16,0x34,0x71,0xFF,0x84,0xAC,0x84,0x03,0x70,0x2C,0x2A,0x6D,0x86,0x84,0x02,
+  0x83,0x65,0x68,0x81,0x84,0x06,0x6D,0x64,0x83,0x84,0x6C,0x64,0x70,0x81,0x84,0x08,
+  0x68,0x68,0x84,0x70,0x64,0x6D,0x6D,0x64,0x6C,0x82,0x84,0x03,0x65,0x65,0x83,0x68,
+  0x84,0x64,0x01,0x84,0x71,0x82,0x64,0x02,0x68,0x6D,0x83,0x81,0x84,0x0B,0x70,0x52,
+  0x4B,0x50,0x70,0x84,0x84,0x83,0x64,0x69,0x84,0x70,0x81,0x64,0x02,0x66,0x6D,0x83,
+  0x83,0x84,0x02,0x70,0x64,0x69,0x82,0x84,0x00,0x6C,0x81,0x64,0x01,0x68,0x6D,0x81,
+  0x84,0x00,0x83,0x84,0x64,0x00,0x68,0x82,0x84,0x00,0x6D,0x84,0x64,0x02,0x68,0x83,
+  0x65,0x83,0x64,0x01,0x68,0x83,0x81,0x84,0x03,0x60,0x49,0x50,0x6B,0x81,0x84,0x02,
+  0x68,0x64,0x83,0x81,0x84,0x01,0x67,0x68,0x81,0x84,0x04,0x71,0x5D,0x4A,0x4D,0x6C,
+  0x81,0x84,0x02,0x83,0x6D,0x70,0x85,0x84,0x04,0x83,0x5C,0x2D,0x43,0x68,0x83,0x84,
+  0x05,0x83,0x68,0x4C,0x49,0x57,0x71,0x81,0x84,0x01,0x68,0x65,0x81,0x84,0x04,0x83,
+  0x5C,0x4A,0x4F,0x6D,0x83,0x84,0x02,0x83,0x64,0x68,0x85,0x84,0x00,0x71,0x84,0x64,
+  0x01,0x83,0x70,0x84,0x64,0x02,0x6C,0x84,0x6C,0x81,0x64,0x01,0x68,0x6D,0x81,0x84,
+  0x00,0x71,0x84,0x64,0x02,0x69,0x84,0x70,0x82,0x64,0x01,0x68,0x70,0x83,0x84,0x02,
+  0x70,0x64,0x6C,0x82,0x84,0x02,0x70,0x6C,0x83,0x86,0x84,0x00,0x71,0x81,0x64,0x02,
+  0x65,0x6C,0x83,0x83,0x84,0x04,0x6B,0x4C,0x4A,0x59,0x83,0x84,0x84,0x00,0x83,0x81,
+  0x64,0x02,0x65,0x69,0x70,0x82,0x84,0x02,0x68,0x64,0x6D,0x81,0x84,0x01,0x83,0x65,
+  0x81,0x64,0x02,0x65,0x6C,0x83,0x83,0x84,0x02,0x68,0x64,0x71,0x81,0x84,0x02,0x83,
+  0x64,0x68,0x81,0x84,0x02,0x71,0x64,0x70,0x81,0x84,0x03,0x70,0x4F,0x5C,0x83,0x86,
+  0x84,0x02,0x64,0x0A,0x1B,0x81,0x84,0x12,0x3D,0x04,0x5E,0x84,0x30,0x01,0x30,0x84,
+  0x84,0x70,0x17,0x1B,0x83,0x48,0x01,0x3C,0x49,0x01,0x30,0x81,0x84,0x04,0x68,0x05,
+  0x17,0x70,0x1B,0x84,0x01,0x01,0x83,0x54,0x84,0x01,0x0F,0x3C,0x71,0x84,0x60,0x14,
+  0x01,0x00,0x00,0x13,0x5C,0x84,0x5D,0x02,0x20,0x84,0x4F,0x82,0x01,0x01,0x04,0x30,
+  0x83,0x84,0x03,0x38,0x01,0x18,0x71,0x81,0x84,0x00,0x30,0x82,0x01,0x04,0x0A,0x3A,
+  0x83,0x84,0x68,0x84,0x01,0x00,0x1A,0x82,0x84,0x00,0x44,0x84,0x01,0x02,0x1C,0x6C,
+  0x0E,0x83,0x01,0x22,0x14,0x69,0x84,0x6D,0x29,0x01,0x00,0x00,0x0A,0x40,0x84,0x84,
+  0x1B,0x01,0x35,0x84,0x84,0x6D,0x13,0x1B,0x84,0x84,0x64,0x1C,0x01,0x00,0x00,0x06,
+  0x3B,0x71,0x84,0x58,0x01,0x28,0x70,0x83,0x84,0x1E,0x6F,0x20,0x01,0x00,0x00,0x01,
+  0x34,0x70,0x84,0x84,0x83,0x38,0x01,0x00,0x00,0x01,0x10,0x64,0x84,0x83,0x1B,0x0F,
+  0x84,0x84,0x6C,0x27,0x01,0x00,0x00,0x0F,0x4C,0x82,0x84,0x03,0x45,0x01,0x10,0x5D,
+  0x84,0x84,0x00,0x51,0x84,0x01,0x01,0x5E,0x48,0x84,0x01,0x02,0x2B,0x83,0x2C,0x83,
+  0x01,0x03,0x40,0x71,0x84,0x54,0x84,0x01,0x02,0x28,0x84,0x4C,0x83,0x01,0x01,0x0F,
+  0x48,0x82,0x84,0x03,0x34,0x01,0x1B,0x71,0x81,0x84,0x02,0x30,0x01,0x50,0x86,0x84,
+  0x00,0x54,0x83,0x01,0x0B,0x20,0x69,0x84,0x84,0x83,0x43,0x06,0x00,0x00,0x01,0x1B,
+  0x61,0x83,0x84,0x00,0x6C,0x83,0x01,0x0C,0x0A,0x61,0x84,0x84,0x70,0x0F,0x01,0x2C,
+  0x83,0x84,0x84,0x64,0x0F,0x83,0x01,0x01,0x1D,0x6C,0x81,0x84,0x03,0x68,0x0F,0x01,
+  0x44,0x81,0x84,0x08,0x61,0x01,0x0B,0x54,0x84,0x84,0x51,0x01,0x48,0x81,0x84,0x03,
+  0x54,0x01,0x01,0x51,0x86,0x84,0x02,0x64,0x0A,0x1B,0x81,0x84,0x1B,0x3D,0x04,0x60,
+  0x84,0x30,0x00,0x01,0x5B,0x84,0x70,0x17,0x1C,0x83,0x48,0x01,0x3C,0x6F,0x0B,0x13,
+  0x64,0x84,0x84,0x47,0x01,0x3B,0x84,0x1B,0x0A,0x82,0x50,0x27,0x51,0x84,0x54,0x01,
+  0x1C,0x4D,0x50,0x45,0x17,0x01,0x50,0x84,0x1C,0x09,0x44,0x51,0x43,0x03,0x14,0x70,
+  0x5E,0x01,0x21,0x84,0x50,0x01,0x35,0x50,0x48,0x22,0x04,0x25,0x83,0x84,0x84,0x65,
+  0x17,0x01,0x01,0x51,0x81,0x84,0x0B,0x30,0x01,0x3C,0x50,0x41,0x1B,0x01,0x40,0x83,
+  0x68,0x00,0x1B,0x82,0x50,0x00,0x58,0x82,0x84,0x0B,0x65,0x51,0x50,0x1B,0x01,0x49,
+  0x50,0x59,0x71,0x0F,0x0F,0x4C,0x81,0x50,0x22,0x57,0x83,0x71,0x28,0x01,0x2D,0x51,
+  0x45,0x13,0x02,0x54,0x84,0x1C,0x00,0x01,0x60,0x84,0x6D,0x14,0x1B,0x84,0x69,0x14,
+  0x06,0x33,0x51,0x4C,0x1B,0x01,0x2E,0x83,0x58,0x03,0x28,0x70,0x82,0x84,0x27,0x71,
+  0x20,0x05,0x28,0x50,0x50,0x22,0x01,0x24,0x83,0x84,0x38,0x03,0x1C,0x4C,0x51,0x30,
+  0x01,0x18,0x6D,0x83,0x1B,0x0F,0x83,0x70,0x1C,0x04,0x37,0x51,0x44,0x0B,0x02,0x65,
+  0x84,0x84,0x70,0x1D,0x01,0x03,0x36,0x84,0x84,0x02,0x53,0x01,0x1F,0x81,0x50,0x04,
+  0x51,0x6D,0x48,0x01,0x23,0x82,0x50,0x0D,0x5D,0x84,0x2D,0x05,0x39,0x50,0x44,0x14,
+  0x01,0x31,0x83,0x54,0x01,0x1B,0x82,0x50,0x11,0x5D,0x84,0x4D,0x01,0x3B,0x50,0x50,
+  0x39,0x0A,0x0A,0x6D,0x84,0x84,0x64,0x16,0x00,0x01,0x55,0x81,0x84,0x02,0x30,0x00,
+  0x50,0x86,0x84,0x12,0x54,0x01,0x1C,0x50,0x49,0x2C,0x05,0x1F,0x71,0x84,0x44,0x03,
+  0x1B,0x48,0x51,0x38,0x09,0x10,0x5D,0x82,0x84,0x19,0x6C,0x01,0x17,0x4D,0x4E,0x2E,
+  0x01,0x1C,0x6C,0x84,0x50,0x01,0x05,0x0F,0x68,0x84,0x84,0x64,0x0F,0x05,0x44,0x50,
+  0x50,0x21,0x01,0x36,0x81,0x84,0x0F,0x3F,0x05,0x06,0x13,0x70,0x84,0x84,0x64,0x01,
+  0x01,0x1B,0x6D,0x84,0x54,0x01,0x48,0x81,0x84,0x04,0x28,0x01,0x01,0x24,0x83,0x85,
+  0x84,0x02,0x64,0x0A,0x1B,0x81,0x84,0x1C,0x3D,0x04,0x60,0x84,0x30,0x01,0x01,0x1F,
+  0x71,0x70,0x17,0x1C,0x83,0x48,0x01,0x3C,0x84,0x30,0x03,0x44,0x84,0x84,0x1C,0x04,
+  0x58,0x84,0x1B,0x0F,0x83,0x83,0x84,0x35,0x54,0x01,0x28,0x70,0x84,0x84,0x44,0x01,
+  0x40,0x83,0x0B,0x0C,0x5C,0x70,0x83,0x2C,0x31,0x6C,0x5E,0x01,0x21,0x84,0x50,0x04,
+  0x4D,0x84,0x84,0x6B,0x14,0x05,0x6C,0x84,0x84,0x48,0x06,0x2C,0x01,0x24,0x71,0x84,
+  0x84,0x30,0x01,0x57,0x84,0x84,0x5D,0x0E,0x1B,0x68,0x68,0x01,0x25,0x83,0x88,0x84,
+  0x03,0x83,0x26,0x04,0x6C,0x81,0x84,0x02,0x0F,0x14,0x6D,0x83,0x84,0x15,0x55,0x0B,
+  0x13,0x6F,0x84,0x84,0x4C,0x24,0x58,0x84,0x1C,0x00,0x01,0x2C,0x71,0x6D,0x14,0x1B,
+  0x83,0x49,0x01,0x2C,0x81,0x84,0x07,0x60,0x0F,0x06,0x71,0x58,0x03,0x28,0x70,0x82,
+  0x84,0x28,0x55,0x01,0x23,0x6D,0x84,0x84,0x6D,0x10,0x0A,0x61,0x68,0x06,0x14,0x64,
+  0x84,0x84,0x80,0x30,0x31,0x70,0x83,0x1B,0x0F,0x83,0x51,0x04,0x22,0x83,0x84,0x84,
+  0x40,0x24,0x65,0x84,0x84,0x51,0x09,0x1B,0x0A,0x17,0x6F,0x83,0x84,0x02,0x53,0x01,
+  0x2C,0x83,0x84,0x03,0x48,0x01,0x30,0x83,0x83,0x84,0x0C,0x2D,0x06,0x51,0x84,0x84,
+  0x60,0x05,0x14,0x6C,0x54,0x01,0x25,0x83,0x83,0x84,0x15,0x4D,0x04,0x54,0x84,0x84,
+  0x71,0x17,0x01,0x6C,0x84,0x84,0x44,0x05,0x2E,0x01,0x27,0x83,0x84,0x84,0x30,0x00,
+  0x50,0x86,0x84,0x12,0x54,0x01,0x28,0x84,0x84,0x70,0x20,0x01,0x5B,0x84,0x17,0x06,
+  0x5C,0x84,0x84,0x83,0x33,0x01,0x35,0x82,0x84,0x24,0x6C,0x01,0x1F,0x70,0x84,0x71,
+  0x03,0x10,0x5D,0x84,0x2C,0x04,0x28,0x01,0x44,0x84,0x84,0x64,0x0F,0x09,0x64,0x84,
+  0x84,0x59,0x01,0x20,0x84,0x84,0x70,0x14,0x14,0x26,0x01,0x55,0x84,0x84,0x64,0x81,
+  0x01,0x0C,0x48,0x83,0x54,0x01,0x48,0x84,0x84,0x70,0x0B,0x14,0x18,0x0A,0x68,0x85,
+  0x84,0x02,0x64,0x0A,0x1B,0x81,0x84,0x1B,0x3D,0x04,0x60,0x84,0x30,0x0B,0x27,0x01,
+  0x40,0x70,0x17,0x1C,0x83,0x48,0x01,0x3C,0x84,0x60,0x01,0x20,0x71,0x60,0x01,0x14,
+  0x83,0x84,0x1B,0x05,0x81,0x27,0x1B,0x28,0x40,0x84,0x54,0x01,0x18,0x45,0x49,0x44,
+  0x18,0x08,0x58,0x84,0x35,0x01,0x0B,0x1C,0x2E,0x58,0x83,0x84,0x60,0x01,0x21,0x84,
+  0x50,0x04,0x4D,0x81,0x84,0x18,0x30,0x01,0x51,0x84,0x83,0x1E,0x06,0x6C,0x1F,0x09,
+  0x60,0x84,0x84,0x30,0x01,0x57,0x84,0x84,0x70,0x27,0x05,0x58,0x68,0x00,0x0F,0x81,
+  0x27,0x01,0x28,0x4F,0x85,0x84,0x02,0x26,0x04,0x6C,0x81,0x84,0x0A,0x0F,0x06,0x24,
+  0x27,0x27,0x28,0x47,0x84,0x40,0x01,0x38,0x85,0x84,0x0B,0x1C,0x0B,0x2D,0x06,0x43,
+  0x6D,0x14,0x1B,0x84,0x34,0x01,0x54,0x82,0x84,0x06,0x24,0x01,0x55,0x58,0x03,0x28,
+  0x70,0x82,0x84,0x02,0x41,0x01,0x48,0x82,0x84,0x08,0x30,0x01,0x40,0x4C,0x01,0x38,
+  0x84,0x84,0x70,0x81,0x6C,0x07,0x83,0x83,0x1B,0x0F,0x83,0x3B,0x01,0x43,0x85,0x84,
+  0x06,0x83,0x2A,0x02,0x55,0x2C,0x03,0x51,0x83,0x84,0x02,0x53,0x01,0x1C,0x81,0x49,
+  0x04,0x5C,0x84,0x48,0x01,0x12,0x81,0x27,0x05,0x28,0x60,0x84,0x2D,0x06,0x53,0x81,
+  0x84,0x05,0x23,0x0A,0x61,0x54,0x01,0x0F,0x82,0x27,0x17,0x54,0x84,0x4D,0x01,0x34,
+  0x49,0x49,0x40,0x0A,0x10,0x70,0x84,0x71,0x1B,0x09,0x6D,0x1E,0x0A,0x61,0x84,0x84,
+  0x30,0x00,0x50,0x86,0x84,0x02,0x54,0x01,0x28,0x81,0x84,0x06,0x3D,0x01,0x33,0x83,
+  0x01,0x1B,0x70,0x81,0x84,0x02,0x5D,0x01,0x1C,0x82,0x84,0x34,0x6C,0x01,0x1D,0x68,
+  0x6C,0x50,0x01,0x16,0x66,0x5C,0x0F,0x18,0x5C,0x09,0x17,0x6C,0x84,0x64,0x0F,0x05,
+  0x3F,0x49,0x49,0x26,0x01,0x40,0x84,0x84,0x53,0x04,0x34,0x58,0x01,0x2A,0x83,0x84,
+  0x64,0x01,0x13,0x14,0x10,0x5C,0x54,0x01,0x48,0x84,0x84,0x4D,0x04,0x3A,0x4C,0x04,
+  0x31,0x85,0x84,0x02,0x64,0x0A,0x1B,0x81,0x84,0x1B,0x3D,0x04,0x60,0x84,0x30,0x0F,
+  0x55,0x0A,0x14,0x5C,0x17,0x1C,0x83,0x48,0x01,0x3C,0x84,0x84,0x10,0x0F,0x67,0x41,
+  0x01,0x3F,0x84,0x84,0x1B,0x00,0x82,0x01,0x02,0x28,0x84,0x54,0x83,0x01,0x12,0x0F,
+  0x42,0x70,0x84,0x69,0x3C,0x0F,0x01,0x01,0x0B,0x35,0x83,0x60,0x01,0x21,0x84,0x50,
+  0x04,0x4D,0x81,0x84,0x17,0x31,0x01,0x49,0x84,0x5D,0x09,0x20,0x84,0x40,0x01,0x40,
+  0x84,0x84,0x30,0x01,0x57,0x84,0x84,0x70,0x28,0x01,0x54,0x68,0x00,0x82,0x01,0x01,
+  0x02,0x3F,0x85,0x84,0x02,0x26,0x04,0x6C,0x81,0x84,0x00,0x0F,0x82,0x01,0x05,0x04,
+  0x32,0x83,0x2F,0x01,0x41,0x85,0x84,0x0B,0x1C,0x0F,0x65,0x06,0x17,0x64,0x14,0x1B,
+  0x84,0x22,0x01,0x60,0x82,0x84,0x06,0x25,0x01,0x54,0x58,0x03,0x28,0x70,0x82,0x84,
+  0x02,0x2F,0x01,0x53,0x82,0x84,0x13,0x30,0x01,0x3C,0x3F,0x01,0x3D,0x84,0x84,0x32,
+  0x18,0x17,0x17,0x55,0x83,0x1B,0x0F,0x83,0x34,0x01,0x50,0x85,0x84,0x07,0x6C,0x13,
+  0x14,0x70,0x4F,0x01,0x30,0x71,0x82,0x84,0x00,0x53,0x83,0x01,0x02,0x33,0x84,0x48,
+  0x83,0x01,0x05,0x03,0x55,0x84,0x2D,0x06,0x53,0x81,0x84,0x03,0x28,0x01,0x58,0x54,
+  0x84,0x01,0x02,0x45,0x84,0x4D,0x83,0x01,0x0F,0x18,0x59,0x84,0x84,0x5B,0x09,0x23,
+  0x84,0x3E,0x01,0x41,0x84,0x84,0x30,0x00,0x50,0x86,0x84,0x02,0x54,0x01,0x28,0x81,
+  0x84,0x05,0x40,0x01,0x31,0x6D,0x01,0x2A,0x82,0x84,0x02,0x61,0x06,0x1B,0x82,0x84,
+  0x12,0x6C,0x01,0x06,0x17,0x17,0x0B,0x01,0x40,0x83,0x3A,0x04,0x3F,0x70,0x28,0x05,
+  0x59,0x84,0x64,0x0F,0x82,0x01,0x1E,0x06,0x2B,0x68,0x84,0x84,0x34,0x05,0x55,0x83,
+  0x0F,0x11,0x5D,0x84,0x64,0x01,0x23,0x48,0x04,0x2B,0x53,0x01,0x48,0x84,0x84,0x1D,
+  0x10,0x5B,0x69,0x10,0x0F,0x70,0x84,0x84,0x02,0x68,0x0B,0x1B,0x81,0x84,0x1C,0x3C,
+  0x04,0x60,0x84,0x30,0x0F,0x64,0x40,0x01,0x28,0x17,0x1C,0x83,0x48,0x01,0x3C,0x84,
+  0x84,0x30,0x01,0x49,0x24,0x01,0x6B,0x84,0x84,0x1B,0x0E,0x71,0x82,0x83,0x08,0x84,
+  0x54,0x01,0x1B,0x43,0x20,0x03,0x30,0x71,0x81,0x84,0x0D,0x83,0x83,0x60,0x38,0x06,
+  0x07,0x61,0x5E,0x01,0x21,0x84,0x50,0x04,0x4D,0x81,0x84,0x19,0x32,0x01,0x50,0x83,
+  0x35,0x01,0x19,0x39,0x2F,0x01,0x17,0x68,0x84,0x30,0x01,0x57,0x84,0x84,0x70,0x28,
+  0x01,0x55,0x68,0x01,0x24,0x71,0x82,0x83,0x85,0x84,0x02,0x26,0x04,0x6C,0x81,0x84,
+  0x02,0x0F,0x13,0x6C,0x82,0x83,0x03,0x84,0x40,0x01,0x39,0x81,0x84,0x0F,0x71,0x69,
+  0x84,0x84,0x1C,0x0F,0x84,0x37,0x01,0x2D,0x14,0x1B,0x84,0x35,0x01,0x54,0x82,0x84,
+  0x06,0x24,0x01,0x54,0x58,0x03,0x28,0x70,0x82,0x84,0x02,0x40,0x01,0x48,0x82,0x84,
+  0x13,0x31,0x01,0x3C,0x50,0x01,0x38,0x84,0x84,0x33,0x1B,0x0A,0x01,0x50,0x83,0x1B,
+  0x0F,0x83,0x3C,0x01,0x40,0x81,0x84,0x0B,0x6D,0x6D,0x84,0x84,0x50,0x00,0x14,0x39,
+  0x30,0x03,0x0F,0x60,0x82,0x84,0x02,0x53,0x01,0x25,0x81,0x65,0x05,0x6C,0x84,0x48,
+  0x01,0x30,0x71,0x81,0x83,0x04,0x84,0x84,0x2D,0x06,0x53,0x81,0x84,0x05,0x25,0x09,
+  0x60,0x54,0x01,0x24,0x82,0x83,0x17,0x84,0x84,0x4D,0x01,0x36,0x41,0x0F,0x05,0x50,
+  0x84,0x84,0x83,0x33,0x01,0x1B,0x39,0x2C,0x01,0x1A,0x69,0x84,0x30,0x00,0x50,0x86,
+  0x84,0x02,0x54,0x01,0x28,0x81,0x84,0x06,0x3C,0x01,0x31,0x83,0x01,0x18,0x6F,0x81,
+  0x84,0x02,0x5D,0x01,0x1B,0x82,0x84,0x18,0x6C,0x01,0x06,0x1A,0x1B,0x26,0x4B,0x84,
+  0x70,0x17,0x01,0x34,0x38,0x24,0x01,0x30,0x84,0x64,0x0F,0x05,0x3C,0x34,0x03,0x1F,
+  0x69,0x81,0x84,0x19,0x0A,0x09,0x34,0x39,0x14,0x01,0x39,0x84,0x64,0x01,0x24,0x70,
+  0x1B,0x01,0x38,0x01,0x48,0x84,0x61,0x01,0x13,0x38,0x39,0x0F,0x01,0x57,0x84,0x84,
+  0x1C,0x6D,0x14,0x14,0x70,0x84,0x83,0x28,0x01,0x60,0x84,0x30,0x0F,0x64,0x83,0x22,
+  0x01,0x03,0x1B,0x83,0x48,0x01,0x3C,0x84,0x84,0x54,0x06,0x10,0x0E,0x20,0x81,0x84,
+  0x01,0x1B,0x0F,0x84,0x84,0x34,0x54,0x01,0x27,0x70,0x70,0x1B,0x01,0x40,0x71,0x61,
+  0x10,0x24,0x71,0x84,0x84,0x2D,0x01,0x4C,0x60,0x01,0x21,0x84,0x50,0x04,0x4D,0x84,
+  0x84,0x69,0x16,0x06,0x6D,0x69,0x0F,0x05,0x0F,0x10,0x10,0x0B,0x04,0x48,0x84,0x30,
+  0x01,0x58,0x84,0x84,0x60,0x10,0x1C,0x69,0x68,0x01,0x25,0x8A,0x84,0x02,0x26,0x04,
+  0x6C,0x81,0x84,0x02,0x0F,0x14,0x6F,0x83,0x84,0x20,0x54,0x0A,0x14,0x70,0x84,0x83,
+  0x39,0x06,0x48,0x84,0x1C,0x0F,0x84,0x68,0x1F,0x03,0x03,0x1B,0x83,0x47,0x01,0x25,
+  0x70,0x84,0x84,0x60,0x0F,0x06,0x71,0x58,0x03,0x28,0x70,0x82,0x84,0x23,0x54,0x01,
+  0x1E,0x69,0x84,0x84,0x6D,0x10,0x0A,0x61,0x68,0x07,0x10,0x60,0x84,0x84,0x83,0x25,
+  0x01,0x50,0x83,0x1B,0x0F,0x83,0x50,0x05,0x20,0x83,0x84,0x83,0x2F,0x0A,0x58,0x6D,
+  0x28,0x05,0x81,0x10,0x02,0x0E,0x01,0x3B,0x82,0x84,0x02,0x53,0x01,0x2C,0x83,0x84,
+  0x02,0x48,0x01,0x30,0x84,0x84,0x0B,0x2D,0x06,0x53,0x84,0x84,0x64,0x05,0x14,0x6C,
+  0x54,0x01,0x25,0x84,0x84,0x0B,0x4D,0x04,0x54,0x83,0x5D,0x0B,0x06,0x54,0x84,0x68,
+  0x0E,0x06,0x81,0x10,0x06,0x0B,0x03,0x49,0x84,0x30,0x00,0x50,0x86,0x84,0x12,0x54,
+  0x01,0x28,0x84,0x84,0x70,0x24,0x05,0x59,0x84,0x14,0x06,0x53,0x84,0x84,0x71,0x2B,
+  0x01,0x36,0x82,0x84,0x03,0x6C,0x01,0x1F,0x71,0x82,0x84,0x02,0x58,0x01,0x06,0x81,
+  0x10,0x0F,0x04,0x0B,0x6C,0x64,0x0F,0x09,0x64,0x84,0x35,0x01,0x1E,0x6D,0x84,0x40,
+  0x01,0x0B,0x81,0x10,0x14,0x01,0x14,0x6D,0x61,0x01,0x24,0x84,0x57,0x0F,0x01,0x01,
+  0x48,0x83,0x36,0x01,0x0F,0x10,0x10,0x0E,0x01,0x29,0x84,0x84,0x1C,0x71,0x1C,0x01,
+  0x31,0x5C,0x45,0x0A,0x09,0x69,0x84,0x30,0x0F,0x64,0x84,0x54,0x09,0x01,0x1B,0x83,
+  0x48,0x01,0x3C,0x84,0x84,0x6B,0x1B,0x00,0x01,0x47,0x81,0x84,0x01,0x1B,0x09,0x83,
+  0x48,0x35,0x6C,0x54,0x01,0x28,0x70,0x84,0x54,0x0A,0x10,0x59,0x84,0x14,0x05,0x3C,
+  0x5D,0x4D,0x10,0x0B,0x65,0x5E,0x01,0x21,0x84,0x50,0x01,0x30,0x48,0x43,0x27,0x04,
+  0x28,0x83,0x4D,0x01,0x2A,0x5C,0x5D,0x5D,0x45,0x05,0x24,0x84,0x30,0x01,0x35,0x48,
+  0x40,0x20,0x01,0x3F,0x83,0x68,0x00,0x18,0x82,0x48,0x00,0x50,0x85,0x84,0x02,0x26,
+  0x04,0x6C,0x81,0x84,0x02,0x0F,0x0B,0x44,0x82,0x48,0x21,0x64,0x71,0x2C,0x01,0x30,
+  0x58,0x40,0x0B,0x06,0x5D,0x84,0x1C,0x0F,0x84,0x84,0x53,0x05,0x01,0x1B,0x84,0x69,
+  0x16,0x05,0x2F,0x5B,0x50,0x1B,0x01,0x30,0x84,0x58,0x01,0x19,0x45,0x81,0x48,0x2B,
+  0x5D,0x70,0x20,0x05,0x24,0x57,0x51,0x27,0x01,0x24,0x83,0x84,0x37,0x03,0x1C,0x4D,
+  0x5A,0x39,0x0A,0x04,0x50,0x83,0x1B,0x0F,0x83,0x6D,0x1B,0x04,0x36,0x5B,0x43,0x0A,
+  0x0B,0x6C,0x5C,0x0B,0x24,0x5B,0x5D,0x5D,0x50,0x09,0x14,0x83,0x81,0x84,0x02,0x53,
+  0x01,0x2C,0x83,0x84,0x02,0x48,0x01,0x1F,0x82,0x48,0x0D,0x55,0x83,0x2D,0x05,0x33,
+  0x48,0x40,0x18,0x04,0x37,0x84,0x54,0x01,0x18,0x82,0x48,0x0D,0x50,0x84,0x4D,0x04,
+  0x54,0x84,0x83,0x3C,0x03,0x18,0x71,0x4D,0x01,0x2E,0x81,0x5D,0x06,0x45,0x05,0x28,
+  0x84,0x30,0x00,0x31,0x81,0x48,0x01,0x4E,0x83,0x81,0x84,0x12,0x54,0x01,0x1A,0x48,
+  0x43,0x33,0x06,0x1E,0x71,0x84,0x41,0x05,0x13,0x48,0x5D,0x34,0x05,0x0F,0x5C,0x82,
+  0x84,0x03,0x6C,0x01,0x1F,0x71,0x81,0x84,0x03,0x83,0x35,0x01,0x3F,0x81,0x5D,0x0F,
+  0x2B,0x01,0x42,0x64,0x0F,0x09,0x64,0x84,0x71,0x18,0x01,0x44,0x83,0x1B,0x06,0x50,
+  0x81,0x5D,0x15,0x1C,0x05,0x56,0x64,0x01,0x24,0x84,0x84,0x36,0x01,0x01,0x48,0x69,
+  0x1B,0x09,0x58,0x5D,0x5D,0x59,0x0B,0x10,0x60,0x84,0x84,0x01,0x5C,0x17,0x81,0x01,
+  0x0F,0x0A,0x41,0x84,0x84,0x30,0x0F,0x64,0x84,0x83,0x39,0x01,0x1C,0x83,0x48,0x01,
+  0x3C,0x81,0x84,0x03,0x40,0x01,0x06,0x83,0x81,0x84,0x00,0x1B,0x84,0x01,0x0C,0x5C,
+  0x54,0x01,0x28,0x70,0x84,0x83,0x3E,0x02,0x20,0x83,0x54,0x13,0x81,0x01,0x07,0x0A,
+  0x3C,0x84,0x60,0x04,0x22,0x84,0x50,0x82,0x01,0x06,0x06,0x26,0x6D,0x84,0x2A,0x01,
+  0x55,0x81,0x84,0x04,0x6C,0x14,0x03,0x6C,0x30,0x82,0x01,0x04,0x0B,0x2F,0x71,0x84,
+  0x68,0x84,0x01,0x01,0x18,0x83,0x84,0x84,0x02,0x27,0x04,0x6C,0x81,0x84,0x00,0x0F,
+  0x84,0x01,0x03,0x48,0x84,0x6D,0x25,0x81,0x01,0x0F,0x0B,0x48,0x84,0x84,0x1C,0x0F,
+  0x84,0x84,0x83,0x28,0x01,0x1C,0x84,0x84,0x65,0x1C,0x81,0x01,0x04,0x05,0x32,0x69,
+  0x84,0x58,0x84,0x01,0x04,0x3C,0x84,0x70,0x1F,0x04,0x81,0x01,0x06,0x2C,0x68,0x84,
+  0x84,0x83,0x30,0x09,0x81,0x01,0x09,0x0F,0x38,0x70,0x83,0x1B,0x10,0x84,0x84,0x64,
+  0x21,0x81,0x01,0x0C,0x0F,0x50,0x84,0x34,0x01,0x47,0x83,0x84,0x84,0x83,0x1C,0x04,
+  0x51,0x81,0x84,0x02,0x53,0x01,0x2C,0x83,0x84,0x00,0x48,0x84,0x01,0x02,0x28,0x71,
+  0x2D,0x82,0x01,0x04,0x0B,0x34,0x6D,0x84,0x54,0x84,0x01,0x0D,0x1B,0x83,0x4D,0x04,
+  0x54,0x84,0x84,0x71,0x22,0x01,0x47,0x28,0x01,0x58,0x81,0x84,0x04,0x6C,0x13,0x05,
+  0x70,0x30,0x83,0x01,0x01,0x17,0x70,0x81,0x84,0x00,0x54,0x82,0x01,0x07,0x04,0x1B,
+  0x64,0x84,0x84,0x83,0x38,0x0A,0x81,0x01,0x01,0x14,0x58,0x83,0x84,0x03,0x6C,0x03,
+  0x1F,0x71,0x81,0x84,0x03,0x61,0x12,0x17,0x68,0x81,0x84,0x0F,0x5C,0x09,0x17,0x64,
+  0x0F,0x09,0x64,0x84,0x84,0x54,0x05,0x10,0x5D,0x04,0x1D,0x71,0x81,0x84,0x0E,0x45,
+  0x01,0x33,0x60,0x01,0x24,0x84,0x84,0x6D,0x10,0x01,0x48,0x48,0x05,0x22,0x82,0x84,
+  0x02,0x3D,0x03,0x38,0x85,0x84,0x13,0x69,0x59,0x48,0x54,0x64,0x83,0x84,0x84,0x68,
+  0x60,0x71,0x84,0x84,0x70,0x5D,0x64,0x84,0x6C,0x5D,0x69,0x81,0x84,0x02,0x70,0x5E,
+  0x64,0x82,0x84,0x00,0x64,0x84,0x5D,0x03,0x71,0x70,0x5E,0x65,0x81,0x84,0x10,0x71,
+  0x60,0x60,0x84,0x84,0x6C,0x58,0x45,0x53,0x64,0x83,0x84,0x71,0x5E,0x64,0x84,0x6D,
+  0x82,0x5D,0x06,0x61,0x83,0x84,0x84,0x62,0x5D,0x71,0x82,0x84,0x03,0x64,0x5D,0x70,
+  0x68,0x82,0x5D,0x04,0x65,0x83,0x84,0x84,0x83,0x84,0x5D,0x00,0x61,0x85,0x84,0x02,
+  0x65,0x5E,0x83,0x81,0x84,0x00,0x60,0x84,0x5D,0x07,0x6D,0x84,0x84,0x83,0x5C,0x49,
+  0x55,0x65,0x81,0x84,0x01,0x64,0x60,0x81,0x84,0x02,0x70,0x5D,0x64,0x81,0x84,0x08,
+  0x6D,0x5D,0x48,0x51,0x61,0x83,0x84,0x84,0x70,0x84,0x5D,0x08,0x69,0x84,0x84,0x70,
+  0x60,0x4C,0x4D,0x60,0x83,0x82,0x84,0x0A,0x83,0x64,0x56,0x48,0x5C,0x69,0x83,0x84,
+  0x84,0x64,0x60,0x81,0x84,0x09,0x70,0x5D,0x48,0x54,0x69,0x84,0x84,0x65,0x5D,0x70,
+  0x82,0x84,0x02,0x68,0x5D,0x68,0x81,0x84,0x02,0x70,0x5D,0x65,0x83,0x84,0x00,0x6C,
+  0x84,0x5D,0x02,0x65,0x84,0x68,0x82,0x5D,0x04,0x66,0x83,0x84,0x84,0x70,0x84,0x5D,
+  0x04,0x64,0x84,0x6D,0x5E,0x70,0x81,0x84,0x05,0x68,0x5D,0x64,0x64,0x5D,0x71,0x82,
+  0x84,0x03,0x64,0x5E,0x70,0x68,0x83,0x5D,0x00,0x61,0x82,0x84,0x00,0x70,0x82,0x5D,
+  0x01,0x60,0x70,0x82,0x84,0x05,0x83,0x64,0x55,0x45,0x5C,0x6C,0x84,0x84,0x02,0x83,
+  0x5E,0x64,0x82,0x84,0x02,0x70,0x5D,0x65,0x82,0x84,0x0E,0x83,0x61,0x5D,0x71,0x60,
+  0x60,0x71,0x84,0x84,0x83,0x61,0x5D,0x65,0x5D,0x68,0x82,0x84,0x05,0x70,0x5D,0x65,
+  0x71,0x5D,0x65,0x81,0x84,0x05,0x65,0x5D,0x6C,0x67,0x5E,0x69,0x82,0x84,0x02,0x6D,
+  0x5D,0x68,0xFF,0x84,0xFF,0x84,0xFF,0x84,0xFF,0x84,0xFF,0x84,0xFF,0x84,0xFF,0x84,
+  0xFF,0x84,0xFF,0x84,0xFF,0x84,0xFF,0x84,0xFF,0x84,0xFF,0x84,0xFF,0x84,0xFF,0x84,
+  0xFF,0x84,0xA5,0x84
+};
+
+const LcdImage utfprLogo =
+{
+  .format = LCD_IMAGE_RLE8,
+  .width = 350,
+  .height = 139,
+  .clut = utfprLogoClut,
+  .clutSize = 133,
+  .data = utfprLogoData,
+  .dataSize = 10340
+};
+
+#endif // __UTFPR_LOGO_H__
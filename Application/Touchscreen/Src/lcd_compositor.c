@@ -0,0 +1,871 @@
+/**
+  ******************************************************************************
+  * @file    lcd_compositor.c
+  * @brief   Dirty rectangle tracking and the queue of fills and blits for the
+  *          LCD. Shared by the board (DMA2D backend) and the host tools.
+  ******************************************************************************
+  */
+
+#include "lcd_compositor.h"
+#include <string.h>
+
+// private variables -----------------------------------------------------------
+// SDRAM bytes per destination pixel: fill writes, copy reads and writes,
+// conversion reads the image from flash, blend reads both layers and writes;
+// L8 indices are counted as read from the atlas, where RLE8 images unpack
+static const uint8_t sdramBytesPerPixel[] = { 4, 8, 4, 12, 5, 4 };
+
+static uint32_t* frontBuffer;
+static uint32_t* backBuffer;
+static uint32_t* staging;
+static uint32_t  stagingUsed = 0;
+static uint32_t* atlas;
+static uint32_t  atlasUsed = 0;
+
+// buffer the ops draw into: the back buffer, or a sprite in the atlas
+static uint32_t* target;
+static uint16_t  targetPitch = LCD_COMPOSITOR_WIDTH;
+static bool      renderingSprite = false;
+static LcdCompositor_RenderCallback renderScene;
+
+static LcdRect dirtyRects[LCD_COMPOSITOR_MAX_DIRTY_RECTS];
+static uint8_t dirtyCount = 0;
+
+// rectangles of the frame shown last, the back buffer misses them
+static LcdRect shownRects[LCD_COMPOSITOR_MAX_DIRTY_RECTS];
+static uint8_t shownCount = 0;
+
+// rectangle being rendered, empty outside of the render callback
+static LcdRect clip = { 0, 0, 0, 0 };
+// first op and staging pixel of that rectangle, an opaque op covering all
+// of it drops what was queued before
+static uint16_t clipFirstOp = 0;
+static uint32_t clipFirstStaging = 0;
+
+static LcdCompositorOp   ops[LCD_COMPOSITOR_MAX_OPS];
+static uint16_t          opCount = 0;
+static volatile uint16_t opIndex = 0;
+static volatile bool     busy = false;
+static volatile bool     presentPending = false;
+
+static LcdCompositorStats stats;
+// CLUT the backend holds, a different one is loaded before the op
+static const uint32_t*    loadedClut = NULL;
+
+// private function declarations -----------------------------------------------
+static bool             LcdCompositor_Intersect(const LcdRect* a, const LcdRect* b, LcdRect* result);
+static LcdRect          LcdCompositor_Union(const LcdRect* a, const LcdRect* b);
+static uint32_t         LcdCompositor_Area(const LcdRect* rect);
+static void             LcdCompositor_SyncBackBuffer(const LcdRect* rects, uint8_t rectCount);
+static void             LcdCompositor_SyncRect(int16_t x, int16_t y, int16_t width, int16_t height);
+static void             LcdCompositor_Kick(void);
+static void             LcdCompositor_StartNext(void);
+static void             LcdCompositor_Occlude(const LcdRect* area);
+static LcdCompositorOp* LcdCompositor_Reserve(uint32_t stagingPixels, uint32_t** stagingPointer);
+static uint32_t*        LcdCompositor_PixelAddress(int16_t x, int16_t y);
+static void             LcdCompositor_DrawL4Column(const LcdImage* image, int16_t x, int16_t y, int16_t column, const LcdRect* visible);
+
+/**
+ * @brief  Sets the frame buffers and the scene to render.
+ * @param  front: ARGB8888 frame buffer shown now, LCD_COMPOSITOR_WIDTH pixels per line
+ * @param  back: second frame buffer, same layout
+ * @param  stagingArea: LCD_COMPOSITOR_STAGING_PIXELS words readable by DMA2D
+ * @param  atlasArea: LCD_COMPOSITOR_ATLAS_PIXELS words readable by DMA2D
+ * @param  render: draws the scene
+ * @retval None
+ */
+void LcdCompositor_Init(uint32_t* front, uint32_t* back, uint32_t* stagingArea, uint32_t* atlasArea, LcdCompositor_RenderCallback render)
+{
+  frontBuffer = front;
+  backBuffer = back;
+  staging = stagingArea;
+  atlas = atlasArea;
+  atlasUsed = 0;
+  renderScene = render;
+  dirtyCount = 0;
+  shownCount = 0;
+  opCount = 0;
+  busy = false;
+  presentPending = false;
+  memset(&stats, 0, sizeof(stats));
+}
+
+/**
+ * @brief  Marks a part of the screen to be redrawn with the next flush.
+ *         Overlapping or touching rectangles are merged when that does not
+ *         grow the redrawn area; when the list is full the pair that grows
+ *         the least is merged.
+ * @param  x, y, width, height: area, clipped to the screen
+ * @retval None
+ */
+void LcdCompositor_Invalidate(int16_t x, int16_t y, int16_t width, int16_t height)
+{
+  LcdRect screen = { 0, 0, LCD_COMPOSITOR_WIDTH, LCD_COMPOSITOR_HEIGHT };
+  LcdRect area = { x, y, width, height };
+  LcdRect rect;
+
+  if(!LcdCompositor_Intersect(&area, &screen, &rect))
+    return;
+
+  for(;;)
+  {
+    bool merged = false;
+    for(uint8_t i = 0; i < dirtyCount && !merged; i++)
+    {
+      LcdRect combined = LcdCompositor_Union(&rect, &dirtyRects[i]);
+      if(LcdCompositor_Area(&combined) <= LcdCompositor_Area(&rect) + LcdCompositor_Area(&dirtyRects[i]))
+      {
+        rect = combined;
+        dirtyRects[i] = dirtyRects[--dirtyCount];
+        merged = true;
+      }
+    }
+
+    if(merged)
+      continue;
+    if(dirtyCount < LCD_COMPOSITOR_MAX_DIRTY_RECTS)
+      break;
+
+    uint8_t best = 0;
+    uint32_t bestGrowth = UINT32_MAX;
+    for(uint8_t i = 0; i < dirtyCount; i++)
+    {
+      LcdRect combined = LcdCompositor_Union(&rect, &dirtyRects[i]);
+      uint32_t growth = LcdCompositor_Area(&combined) - LcdCompositor_Area(&dirtyRects[i]);
+      if(growth < bestGrowth)
+      {
+        bestGrowth = growth;
+        best = i;
+      }
+    }
+    rect = LcdCompositor_Union(&rect, &dirtyRects[best]);
+    dirtyRects[best] = dirtyRects[--dirtyCount];
+  }
+
+  dirtyRects[dirtyCount++] = rect;
+}
+
+/**
+ * @brief  Marks the whole screen to be redrawn.
+ * @param  None
+ * @retval None
+ */
+void LcdCompositor_InvalidateAll(void)
+{
+  dirtyCount = 0;
+  LcdCompositor_Invalidate(0, 0, LCD_COMPOSITOR_WIDTH, LCD_COMPOSITOR_HEIGHT);
+}
+
+/**
+ * @brief  Renders the dirty rectangles into the back buffer and starts
+ *         executing the queue; the buffers are swapped at the vertical
+ *         blanking after it. Does nothing while the previous frame is still
+ *         being drawn or waits for its swap, so changes made meanwhile are
+ *         coalesced into the next one.
+ * @param  None
+ * @retval true if a frame was started
+ */
+bool LcdCompositor_Flush(void)
+{
+  LcdRect rects[LCD_COMPOSITOR_MAX_DIRTY_RECTS];
+
+  if(busy || dirtyCount == 0)
+    return false;
+
+  uint8_t rectCount = dirtyCount;
+  memcpy(rects, dirtyRects, rectCount * sizeof(LcdRect));
+  dirtyCount = 0;
+
+  opCount = 0;
+  stagingUsed = 0;
+  target = backBuffer;
+  targetPitch = LCD_COMPOSITOR_WIDTH;
+
+  LcdCompositor_SyncBackBuffer(rects, rectCount);
+
+  for(uint8_t i = 0; i < rectCount; i++)
+  {
+    clip = rects[i];
+    clipFirstOp = opCount;
+    clipFirstStaging = stagingUsed;
+    stats.rects++;
+    stats.dirtyPixels += LcdCompositor_Area(&clip);
+    renderScene();
+  }
+  clip.width = 0;
+  clip.height = 0;
+
+  memcpy(shownRects, rects, rectCount * sizeof(LcdRect));
+  shownCount = rectCount;
+
+  stats.frames++;
+  presentPending = true;
+  LcdCompositor_Kick();
+  return true;
+}
+
+/**
+ * @brief  Starts rendering a sprite: until LcdCompositor_EndSprite the
+ *         drawing functions draw into it, with (0, 0) its top left corner.
+ *         Meant for startup, it waits for the frame being drawn.
+ * @param  sprite: receives the pixels and size
+ * @param  width, height: size
+ * @param  opaque: false if it has transparent pixels to blend
+ * @retval false if the atlas is full, the sprite is left empty
+ */
+bool LcdCompositor_BeginSprite(LcdSprite* sprite, int16_t width, int16_t height, bool opaque)
+{
+  uint32_t pixels = (uint32_t)width * height;
+
+  sprite->pixels = NULL;
+  sprite->width = width;
+  sprite->height = height;
+  sprite->opaque = opaque;
+  if(atlasUsed + pixels > LCD_COMPOSITOR_ATLAS_PIXELS)
+    return false;
+
+  LcdCompositor_WaitIdle();
+
+  target = &atlas[atlasUsed];
+  targetPitch = width;
+  atlasUsed += pixels;
+  sprite->pixels = target;
+
+  renderingSprite = true;
+  clip.x = 0;
+  clip.y = 0;
+  clip.width = width;
+  clip.height = height;
+  opCount = 0;
+  stagingUsed = 0;
+  clipFirstOp = 0;
+  clipFirstStaging = 0;
+  return true;
+}
+
+/**
+ * @brief  Executes what was drawn into the sprite and waits for it.
+ * @param  None
+ * @retval None
+ */
+void LcdCompositor_EndSprite(void)
+{
+  if(!renderingSprite)
+    return;
+
+  LcdCompositor_Kick();
+  LcdCompositor_WaitIdle();
+
+  renderingSprite = false;
+  clip.width = 0;
+  clip.height = 0;
+}
+
+/**
+ * @brief  Expands an RLE8 image into the atlas as L8, which DMA2D can blit.
+ *         Meant for startup.
+ * @param  packed: RLE8 image
+ * @param  unpacked: receives the L8 image, same size and CLUT
+ * @retval false if the image is not RLE8, is corrupt or the atlas is full
+ */
+bool LcdCompositor_UnpackImage(const LcdImage* packed, LcdImage* unpacked)
+{
+  uint32_t count = (uint32_t)packed->width * packed->height;
+  uint32_t words = (count + 3) / 4;
+  uint32_t position = 0;
+  uint32_t offset = 0;
+
+  if(packed->format != LCD_IMAGE_RLE8 || atlasUsed + words > LCD_COMPOSITOR_ATLAS_PIXELS)
+    return false;
+
+  uint8_t* indices = (uint8_t*)&atlas[atlasUsed];
+
+  // packets: c < 128 is followed by c + 1 indices, c >= 128 by one index
+  // repeated c - 126 times
+  while(offset < packed->dataSize && position < count)
+  {
+    uint8_t control = packed->data[offset++];
+    uint32_t length = (control < 128) ? control + 1u : control - 126u;
+
+    if(position + length > count || offset + ((control < 128) ? length : 1) > packed->dataSize)
+      return false;
+
+    if(control < 128)
+    {
+      memcpy(&indices[position], &packed->data[offset], length);
+      offset += length;
+    }
+    else
+      memset(&indices[position], packed->data[offset++], length);
+    position += length;
+  }
+
+  if(position != count)
+    return false;
+
+  atlasUsed += words;
+  *unpacked = *packed;
+  unpacked->format = LCD_IMAGE_L8;
+  unpacked->data = indices;
+  unpacked->dataSize = count;
+  return true;
+}
+
+/**
+ * @brief  Tells whether DMA2D is still drawing the last frame or the frame
+ *         waits for the vertical blanking.
+ * @param  None
+ * @retval true while busy
+ */
+bool LcdCompositor_IsBusy(void)
+{
+  return busy;
+}
+
+/**
+ * @brief  Waits until the queue is executed. Needed before drawing through
+ *         the BSP, which uses DMA2D in polling mode.
+ * @param  None
+ * @retval None
+ */
+void LcdCompositor_WaitIdle(void)
+{
+  while(busy)
+  {
+  }
+}
+
+/**
+ * @brief  Copies the counters.
+ * @param  result: totals since LcdCompositor_Init
+ * @retval None
+ */
+void LcdCompositor_GetStats(LcdCompositorStats* result)
+{
+  *result = stats;
+}
+
+/**
+ * @brief  Tells whether an area intersects the rectangle being rendered, so
+ *         the scene can skip widgets that are not dirty.
+ * @param  x, y, width, height: area
+ * @retval true if any of it is redrawn
+ */
+bool LcdCompositor_IsVisible(int16_t x, int16_t y, int16_t width, int16_t height)
+{
+  LcdRect area = { x, y, width, height };
+  LcdRect visible;
+
+  return LcdCompositor_Intersect(&area, &clip, &visible);
+}
+
+/**
+ * @brief  Queues a register to memory fill.
+ * @param  x, y, width, height: area
+ * @param  color: ARGB8888
+ * @retval None
+ */
+void LcdCompositor_FillRect(int16_t x, int16_t y, int16_t width, int16_t height, uint32_t color)
+{
+  LcdRect area = { x, y, width, height };
+  LcdRect visible;
+
+  if(!LcdCompositor_Intersect(&area, &clip, &visible))
+    return;
+
+  LcdCompositor_Occlude(&visible);
+  LcdCompositorOp* op = LcdCompositor_Reserve(0, NULL);
+  op->type = LCD_COMPOSITOR_FILL;
+  op->color = color;
+  op->destination = LcdCompositor_PixelAddress(visible.x, visible.y);
+  op->width = visible.width;
+  op->height = visible.height;
+}
+
+/**
+ * @brief  Queues a filled circle: the visible part is rasterized with a
+ *         transparent surrounding and blended over what is below. Covers the
+ *         same pixels as BSP_LCD_FillCircle.
+ * @param  x, y: center
+ * @param  radius: in pixels
+ * @param  color: ARGB8888
+ * @retval None
+ */
+void LcdCompositor_FillCircle(int16_t x, int16_t y, int16_t radius, uint32_t color)
+{
+  LcdRect area = { x - radius, y - radius, 2 * radius + 1, 2 * radius + 1 };
+  LcdRect visible;
+  uint32_t* pixels;
+
+  if(!LcdCompositor_Intersect(&area, &clip, &visible))
+    return;
+
+  LcdCompositorOp* op = LcdCompositor_Reserve(visible.width * visible.height, &pixels);
+  int32_t limit = radius * radius + radius;
+
+  for(int16_t row = 0; row < visible.height; row++)
+  {
+    int32_t dy = visible.y + row - y;
+    for(int16_t column = 0; column < visible.width; column++)
+    {
+      int32_t dx = visible.x + column - x;
+      pixels[row * visible.width + column] = (dx * dx + dy * dy <= limit) ? color : LCD_COMPOSITOR_TRANSPARENT;
+    }
+  }
+
+  op->type = LCD_COMPOSITOR_BLEND;
+  op->source = pixels;
+  op->sourcePitch = visible.width;
+  op->destination = LcdCompositor_PixelAddress(visible.x, visible.y);
+  op->width = visible.width;
+  op->height = visible.height;
+}
+
+/**
+ * @brief  Queues a line of text. Position and alignment follow
+ *         BSP_LCD_DisplayStringAt; the visible glyph pixels are rasterized
+ *         with their background and copied in one blit.
+ * @param  x, y: position
+ * @param  text: characters from ' ' to '~'
+ * @param  font: glyph table
+ * @param  textColor, backColor: ARGB8888
+ * @param  mode: CENTER_MODE, RIGHT_MODE or LEFT_MODE
+ * @retval None
+ */
+void LcdCompositor_DrawString(int16_t x, int16_t y, const char* text, sFONT* font, uint32_t textColor, uint32_t backColor, Text_AlignModeTypdef mode)
+{
+  int16_t length = (int16_t)strlen(text);
+  int16_t charactersPerLine = LCD_COMPOSITOR_WIDTH / font->Width;
+  int16_t column = x;
+
+  if(length > charactersPerLine)
+    length = charactersPerLine;
+
+  if(mode == CENTER_MODE)
+    column = x + ((charactersPerLine - length) * font->Width) / 2;
+  else if(mode == RIGHT_MODE)
+    column = -x + (charactersPerLine - length) * font->Width;
+  // the BSP never starts a line at column 0, sprites may
+  if(column < 1 && !renderingSprite)
+    column = 1;
+
+  LcdRect area = { column, y, length * font->Width, font->Height };
+  LcdRect visible;
+  uint32_t* pixels;
+
+  if(!LcdCompositor_Intersect(&area, &clip, &visible))
+    return;
+
+  LcdCompositor_Occlude(&visible);
+  LcdCompositorOp* op = LcdCompositor_Reserve(visible.width * visible.height, &pixels);
+  uint16_t bytesPerLine = (font->Width + 7) / 8;
+  uint8_t padding = 8 * bytesPerLine - font->Width;
+
+  for(int16_t row = 0; row < visible.height; row++)
+  {
+    int16_t glyphRow = visible.y + row - y;
+    for(int16_t pixel = 0; pixel < visible.width; pixel++)
+    {
+      int16_t offset = visible.x + pixel - column;
+      const uint8_t* glyph = &font->table[(text[offset / font->Width] - ' ') * font->Height * bytesPerLine];
+      const uint8_t* line = glyph + glyphRow * bytesPerLine;
+      uint32_t bits = 0;
+      for(uint16_t i = 0; i < bytesPerLine; i++)
+        bits = (bits << 8) | line[i];
+
+      int16_t bit = font->Width - (offset % font->Width) + padding - 1;
+      pixels[row * visible.width + pixel] = (bits & (1u << bit)) ? textColor : backColor;
+    }
+  }
+
+  op->type = LCD_COMPOSITOR_COPY;
+  op->source = pixels;
+  op->sourcePitch = visible.width;
+  op->destination = LcdCompositor_PixelAddress(visible.x, visible.y);
+  op->width = visible.width;
+  op->height = visible.height;
+}
+
+/**
+ * @brief  Queues an RGB565 image, converted to ARGB8888 by the blit.
+ * @param  image: pixels, width per line
+ * @param  x, y: top left corner
+ * @param  width, height: image size
+ * @retval None
+ */
+void LcdCompositor_DrawImageRgb565(const uint8_t* image, int16_t x, int16_t y, int16_t width, int16_t height)
+{
+  LcdRect area = { x, y, width, height };
+  LcdRect visible;
+
+  if(!LcdCompositor_Intersect(&area, &clip, &visible))
+    return;
+
+  LcdCompositor_Occlude(&visible);
+  LcdCompositorOp* op = LcdCompositor_Reserve(0, NULL);
+  op->type = LCD_COMPOSITOR_CONVERT_RGB565;
+  op->source = image + 2 * ((visible.y - y) * width + (visible.x - x));
+  op->sourcePitch = width;
+  op->destination = LcdCompositor_PixelAddress(visible.x, visible.y);
+  op->width = visible.width;
+  op->height = visible.height;
+}
+
+/**
+ * @brief  Queues an L8 or L4 image, expanded through the CLUT by the blit.
+ *         DMA2D reads L4 by whole bytes, so an odd first or last column of
+ *         the visible part is expanded by the CPU. RLE8 images must go
+ *         through LcdCompositor_UnpackImage first.
+ * @param  image: image asset
+ * @param  x, y: top left corner
+ * @retval None
+ */
+void LcdCompositor_DrawImage(const LcdImage* image, int16_t x, int16_t y)
+{
+  LcdRect area = { x, y, image->width, image->height };
+  LcdRect visible;
+
+  if(image->format == LCD_IMAGE_RLE8 || !LcdCompositor_Intersect(&area, &clip, &visible))
+    return;
+
+  LcdCompositor_Occlude(&visible);
+
+  if(image->format == LCD_IMAGE_L4)
+  {
+    if((visible.x - x) & 1)
+    {
+      LcdCompositor_DrawL4Column(image, x, y, visible.x - x, &visible);
+      visible.x++;
+      visible.width--;
+    }
+
+    if(visible.width & 1)
+    {
+      visible.width--;
+      LcdCompositor_DrawL4Column(image, x, y, visible.x + visible.width - x, &visible);
+    }
+
+    if(visible.width == 0)
+      return;
+  }
+
+  // lines of L4 images hold an even number of pixels
+  uint16_t pitch = (image->format == LCD_IMAGE_L4) ? (image->width + 1) & ~1 : image->width;
+  uint32_t first = (uint32_t)(visible.y - y) * pitch + (visible.x - x);
+
+  LcdCompositorOp* op = LcdCompositor_Reserve(0, NULL);
+  op->type = (image->format == LCD_IMAGE_L4) ? LCD_COMPOSITOR_CONVERT_L4 : LCD_COMPOSITOR_CONVERT_L8;
+  op->source = image->data + ((image->format == LCD_IMAGE_L4) ? first / 2 : first);
+  op->sourcePitch = pitch;
+  op->destination = LcdCompositor_PixelAddress(visible.x, visible.y);
+  op->width = visible.width;
+  op->height = visible.height;
+  op->clut = image->clut;
+  op->clutSize = image->clutSize;
+}
+
+/**
+ * @brief  Queues a sprite, copied if opaque and blended otherwise.
+ * @param  sprite: rendered with LcdCompositor_BeginSprite
+ * @param  x, y: top left corner
+ * @retval None
+ */
+void LcdCompositor_DrawSprite(const LcdSprite* sprite, int16_t x, int16_t y)
+{
+  LcdRect area = { x, y, sprite->width, sprite->height };
+  LcdRect visible;
+
+  if(!sprite->pixels || !LcdCompositor_Intersect(&area, &clip, &visible))
+    return;
+
+  if(sprite->opaque)
+    LcdCompositor_Occlude(&visible);
+  LcdCompositorOp* op = LcdCompositor_Reserve(0, NULL);
+  op->type = sprite->opaque ? LCD_COMPOSITOR_COPY : LCD_COMPOSITOR_BLEND;
+  op->source = &sprite->pixels[(visible.y - y) * sprite->width + (visible.x - x)];
+  op->sourcePitch = sprite->width;
+  op->destination = LcdCompositor_PixelAddress(visible.x, visible.y);
+  op->width = visible.width;
+  op->height = visible.height;
+}
+
+/**
+ * @brief  Called by the backend when the running op is done, starts the next.
+ * @param  failed: the op stopped on a transfer or configuration error
+ * @retval None
+ */
+void LcdCompositor_TransferComplete(bool failed)
+{
+  if(!busy)
+    return;
+
+  if(failed)
+    stats.transferErrors++;
+
+  LcdCompositor_StartNext();
+}
+
+/**
+ * @brief  Called by the backend once LTDC shows the back buffer.
+ * @param  None
+ * @retval None
+ */
+void LcdCompositor_PresentComplete(void)
+{
+  uint32_t* shown = backBuffer;
+
+  backBuffer = frontBuffer;
+  frontBuffer = shown;
+  stats.swaps++;
+  busy = false;
+}
+
+/**
+ * @brief  Called by the backend on an LTDC FIFO underrun.
+ * @param  None
+ * @retval None
+ */
+void LcdCompositor_Underrun(void)
+{
+  stats.underruns++;
+}
+
+/**
+ * @brief  Computes the intersection of two rectangles.
+ * @param  a, b: rectangles
+ * @param  result: intersection
+ * @retval false if it is empty
+ */
+static bool LcdCompositor_Intersect(const LcdRect* a, const LcdRect* b, LcdRect* result)
+{
+  int16_t left   = (a->x > b->x) ? a->x : b->x;
+  int16_t top    = (a->y > b->y) ? a->y : b->y;
+  int16_t right  = (a->x + a->width < b->x + b->width) ? a->x + a->width : b->x + b->width;
+  int16_t bottom = (a->y + a->height < b->y + b->height) ? a->y + a->height : b->y + b->height;
+
+  if(right <= left || bottom <= top)
+    return false;
+
+  result->x = left;
+  result->y = top;
+  result->width = right - left;
+  result->height = bottom - top;
+  return true;
+}
+
+/**
+ * @brief  Computes the bounding box of two rectangles.
+ * @param  a, b: rectangles
+ * @retval bounding box
+ */
+static LcdRect LcdCompositor_Union(const LcdRect* a, const LcdRect* b)
+{
+  int16_t left   = (a->x < b->x) ? a->x : b->x;
+  int16_t top    = (a->y < b->y) ? a->y : b->y;
+  int16_t right  = (a->x + a->width > b->x + b->width) ? a->x + a->width : b->x + b->width;
+  int16_t bottom = (a->y + a->height > b->y + b->height) ? a->y + a->height : b->y + b->height;
+  LcdRect result = { left, top, right - left, bottom - top };
+
+  return result;
+}
+
+/**
+ * @brief  Area of a rectangle.
+ * @param  rect: rectangle
+ * @retval pixels
+ */
+static uint32_t LcdCompositor_Area(const LcdRect* rect)
+{
+  return (uint32_t)rect->width * rect->height;
+}
+
+/**
+ * @brief  Queues copies of what the last frame changed from the front buffer
+ *         to the back buffer, which still holds the frame before it. Of each
+ *         changed rectangle, the part this frame redraws anyway is skipped,
+ *         taking the dirty rectangle it overlaps most.
+ * @param  rects: dirty rectangles of this frame
+ * @param  rectCount: number of them
+ * @retval None
+ */
+static void LcdCompositor_SyncBackBuffer(const LcdRect* rects, uint8_t rectCount)
+{
+  for(uint8_t i = 0; i < shownCount; i++)
+  {
+    const LcdRect* shown = &shownRects[i];
+    LcdRect redrawn = { shown->x, shown->y, 0, 0 };
+    LcdRect overlap;
+
+    for(uint8_t j = 0; j < rectCount; j++)
+    {
+      if(LcdCompositor_Intersect(shown, &rects[j], &overlap) && LcdCompositor_Area(&overlap) > LcdCompositor_Area(&redrawn))
+        redrawn = overlap;
+    }
+
+    // up to four bands around the redrawn part: above, below, left, right
+    int16_t shownBottom = shown->y + shown->height;
+    int16_t redrawnBottom = redrawn.y + redrawn.height;
+    LcdCompositor_SyncRect(shown->x, shown->y, shown->width, redrawn.y - shown->y);
+    LcdCompositor_SyncRect(shown->x, redrawnBottom, shown->width, shownBottom - redrawnBottom);
+    LcdCompositor_SyncRect(shown->x, redrawn.y, redrawn.x - shown->x, redrawn.height);
+    LcdCompositor_SyncRect(redrawn.x + redrawn.width, redrawn.y, shown->x + shown->width - redrawn.x - redrawn.width, redrawn.height);
+  }
+
+  shownCount = 0;
+}
+
+/**
+ * @brief  Queues the copy of one area from the front to the back buffer.
+ * @param  x, y, width, height: area, nothing is queued if empty
+ * @retval None
+ */
+static void LcdCompositor_SyncRect(int16_t x, int16_t y, int16_t width, int16_t height)
+{
+  if(width <= 0 || height <= 0)
+    return;
+
+  LcdCompositorOp* op = LcdCompositor_Reserve(0, NULL);
+  op->type = LCD_COMPOSITOR_COPY;
+  op->source = &frontBuffer[(int32_t)y * LCD_COMPOSITOR_WIDTH + x];
+  op->sourcePitch = LCD_COMPOSITOR_WIDTH;
+  op->destination = LcdCompositor_PixelAddress(x, y);
+  op->width = width;
+  op->height = height;
+  stats.syncPixels += (uint32_t)width * height;
+}
+
+/**
+ * @brief  Starts executing the queued ops.
+ * @param  None
+ * @retval None
+ */
+static void LcdCompositor_Kick(void)
+{
+  busy = true;
+  opIndex = 0;
+  LcdCompositor_StartNext();
+}
+
+/**
+ * @brief  Hands the next op to the backend, and the back buffer to LTDC once
+ *         the last op of a frame is done. Backends that execute synchronously
+ *         return true and the sequence goes on; DMA2D and LTDC return false
+ *         and report completion from their interrupts.
+ * @param  None
+ * @retval None
+ */
+static void LcdCompositor_StartNext(void)
+{
+  while(opIndex < opCount)
+  {
+    const LcdCompositorOp* op = &ops[opIndex++];
+    uint32_t pixels = (uint32_t)op->width * op->height;
+
+    stats.ops++;
+    stats.pixelsWritten += pixels;
+    stats.sdramBytes += pixels * sdramBytesPerPixel[op->type];
+    if((op->type == LCD_COMPOSITOR_CONVERT_L8 || op->type == LCD_COMPOSITOR_CONVERT_L4) && op->clut != loadedClut)
+    {
+      loadedClut = op->clut;
+      stats.clutLoads++;
+    }
+    if(!LcdCompositorBackend_Start(op))
+      return;
+  }
+
+  if(!presentPending)
+  {
+    busy = false;
+    return;
+  }
+
+  presentPending = false;
+  if(LcdCompositorBackend_Present(backBuffer))
+    LcdCompositor_PresentComplete();
+}
+
+/**
+ * @brief  Drops the ops queued for the rectangle being rendered when an
+ *         opaque op is about to cover all of it.
+ * @param  area: visible part of the opaque op
+ * @retval None
+ */
+static void LcdCompositor_Occlude(const LcdRect* area)
+{
+  if(area->x != clip.x || area->y != clip.y || area->width != clip.width || area->height != clip.height)
+    return;
+
+  stats.culledOps += opCount - clipFirstOp;
+  opCount = clipFirstOp;
+  stagingUsed = clipFirstStaging;
+}
+
+/**
+ * @brief  Takes an op slot and staging pixels. When either runs out the
+ *         queue is executed first, without swapping, and both start over.
+ * @param  stagingPixels: pixels to rasterize, 0 for fills and image blits
+ * @param  stagingPointer: receives the pixels, may be NULL if none
+ * @retval op to fill in
+ */
+static LcdCompositorOp* LcdCompositor_Reserve(uint32_t stagingPixels, uint32_t** stagingPointer)
+{
+  if(opCount == LCD_COMPOSITOR_MAX_OPS || stagingUsed + stagingPixels > LCD_COMPOSITOR_STAGING_PIXELS)
+  {
+    stats.queueStalls++;
+    LcdCompositor_Kick();
+    LcdCompositor_WaitIdle();
+    opCount = 0;
+    stagingUsed = 0;
+    clipFirstOp = 0;
+    clipFirstStaging = 0;
+  }
+
+  if(stagingPointer)
+  {
+    *stagingPointer = &staging[stagingUsed];
+    stagingUsed += stagingPixels;
+  }
+
+  ops[opCount].destinationPitch = targetPitch;
+  return &ops[opCount++];
+}
+
+/**
+ * @brief  Expands one column of an L4 image with the CPU and queues its copy.
+ * @param  image: L4 image
+ * @param  x, y: top left corner of the image
+ * @param  column: column in the image
+ * @param  visible: visible part of the image, gives the rows
+ * @retval None
+ */
+static void LcdCompositor_DrawL4Column(const LcdImage* image, int16_t x, int16_t y, int16_t column, const LcdRect* visible)
+{
+  uint16_t pitch = (image->width + 1) & ~1;
+  uint32_t* pixels;
+
+  LcdCompositorOp* op = LcdCompositor_Reserve(visible->height, &pixels);
+
+  for(int16_t row = 0; row < visible->height; row++)
+  {
+    uint32_t index = (uint32_t)(visible->y - y + row) * pitch + column;
+    uint8_t pair = image->data[index / 2];
+    pixels[row] = image->clut[(index & 1) ? pair >> 4 : pair & 0x0F];
+  }
+
+  op->type = LCD_COMPOSITOR_COPY;
+  op->source = pixels;
+  op->sourcePitch = 1;
+  op->destination = LcdCompositor_PixelAddress(x + column, visible->y);
+  op->width = 1;
+  op->height = visible->height;
+}
+
+/**
+ * @brief  Address of a pixel in the buffer drawn into.
+ * @param  x, y: position on screen or in the sprite
+ * @retval pointer to the pixel
+ */
+static uint32_t* LcdCompositor_PixelAddress(int16_t x, int16_t y)
+{
+  return &target[(int32_t)y * targetPitch + x];
+}
@@ -0,0 +1,188 @@
+/**
+  ******************************************************************************
+  * @file    lcd_compositor_dma2d.c
+  * @brief   DMA2D and LTDC backend of the compositor. Each op is programmed
+  *          straight into the DMA2D registers and the next one is started from
+  *          the transfer complete interrupt, so drawing costs the CPU a few
+  *          register writes per op. The finished back buffer is handed to
+  *          LTDC with a reload at vertical blanking, whose interrupt tells the
+  *          compositor that the buffers have been swapped.
+  ******************************************************************************
+  */
+
+#include "lcd_compositor.h"
+
+// private defines -------------------------------------------------------------
+#define LCD_DMA2D_INTERRUPTS  (DMA2D_CR_TCIE | DMA2D_CR_TEIE | DMA2D_CR_CEIE | DMA2D_CR_CTCIE | DMA2D_CR_CAEIE)
+#define LCD_DMA2D_FLAGS       (DMA2D_IFCR_CTCIF | DMA2D_IFCR_CTEIF | DMA2D_IFCR_CCEIF | DMA2D_IFCR_CCTCIF | DMA2D_IFCR_CAECIF)
+#define LCD_LTDC_ERRORS       (LTDC_ICR_CFUIF | LTDC_ICR_CTERRIF)
+
+// variables -------------------------------------------------------------------
+extern LTDC_HandleTypeDef hltdc_discovery;
+
+// private variables -----------------------------------------------------------
+// CLUT in the DMA2D, and the op started once a new one is loaded
+static const uint32_t*        loadedClut = NULL;
+static const LcdCompositorOp* clutOp = NULL;
+
+/**
+ * @brief  Moves the DMA2D and LTDC interrupts below the audio ones. The BSP
+ *         enables them at priority 3 in BSP_LCD_MspInit, which must have run
+ *         before.
+ * @param  None
+ * @retval None
+ */
+void LcdCompositorBackend_Init(void)
+{
+  __HAL_RCC_DMA2D_CLK_ENABLE();
+  DMA2D->AMTCR = (LCD_DMA2D_DEAD_TIME << DMA2D_AMTCR_DT_Pos) | DMA2D_AMTCR_EN;
+
+  HAL_NVIC_SetPriority(DMA2D_IRQn, LCD_DMA2D_IRQ_PREPRIO, 0);
+  HAL_NVIC_EnableIRQ(DMA2D_IRQn);
+
+  LTDC->ICR = LTDC_ICR_CRRIF | LCD_LTDC_ERRORS;
+  LTDC->IER |= LTDC_IER_FUIE | LTDC_IER_TERRIE;
+  HAL_NVIC_SetPriority(LTDC_IRQn, LCD_LTDC_IRQ_PREPRIO, 0);
+  HAL_NVIC_EnableIRQ(LTDC_IRQn);
+}
+
+/**
+ * @brief  Starts one op.
+ * @param  op: fill or blit, destination in an ARGB8888 frame buffer or sprite
+ * @retval false, completion is reported by LcdCompositor_Dma2dIrqHandler
+ */
+bool LcdCompositorBackend_Start(const LcdCompositorOp* op)
+{
+  uint32_t mode = DMA2D_M2M;
+  bool indexed = (op->type == LCD_COMPOSITOR_CONVERT_L8 || op->type == LCD_COMPOSITOR_CONVERT_L4);
+  uint32_t colorMode = (op->type == LCD_COMPOSITOR_CONVERT_L8) ? DMA2D_INPUT_L8 : DMA2D_INPUT_L4;
+
+  // a CLUT load is a transfer of its own, the op follows from the interrupt
+  if(indexed && op->clut != loadedClut)
+  {
+    clutOp = op;
+    DMA2D->FGCMAR = (uint32_t)op->clut;
+    DMA2D->FGPFCCR = colorMode | ((uint32_t)(op->clutSize - 1) << DMA2D_FGPFCCR_CS_Pos) | DMA2D_FGPFCCR_START;
+    DMA2D->IFCR = LCD_DMA2D_FLAGS;
+    DMA2D->CR |= LCD_DMA2D_INTERRUPTS;
+    return false;
+  }
+
+  DMA2D->OPFCCR = DMA2D_OUTPUT_ARGB8888;
+  DMA2D->OMAR = (uint32_t)op->destination;
+  DMA2D->OOR = op->destinationPitch - op->width;
+  DMA2D->NLR = ((uint32_t)op->width << DMA2D_NLR_PL_Pos) | op->height;
+
+  if(op->type == LCD_COMPOSITOR_FILL)
+  {
+    mode = DMA2D_R2M;
+    DMA2D->OCOLR = op->color;
+  }
+  else
+  {
+    DMA2D->FGMAR = (uint32_t)op->source;
+    DMA2D->FGOR = op->sourcePitch - op->width;
+    DMA2D->FGPFCCR = (op->type == LCD_COMPOSITOR_CONVERT_RGB565) ? DMA2D_INPUT_RGB565 : DMA2D_INPUT_ARGB8888;
+
+    if(op->type == LCD_COMPOSITOR_CONVERT_RGB565)
+    {
+      mode = DMA2D_M2M_PFC;
+    }
+    else if(indexed)
+    {
+      // the CLUT size is kept, rewriting it without START does not reload
+      mode = DMA2D_M2M_PFC;
+      DMA2D->FGPFCCR = colorMode | ((uint32_t)(op->clutSize - 1) << DMA2D_FGPFCCR_CS_Pos);
+    }
+    else if(op->type == LCD_COMPOSITOR_BLEND)
+    {
+      mode = DMA2D_M2M_BLEND;
+      DMA2D->BGMAR = (uint32_t)op->destination;
+      DMA2D->BGOR = op->destinationPitch - op->width;
+      DMA2D->BGPFCCR = DMA2D_INPUT_ARGB8888;
+    }
+  }
+
+  DMA2D->IFCR = LCD_DMA2D_FLAGS;
+  DMA2D->CR = mode | LCD_DMA2D_INTERRUPTS | DMA2D_CR_START;
+
+  return false;
+}
+
+/**
+ * @brief  Shows a buffer from the next vertical blanking. The BSP layer
+ *         configuration follows, so BSP drawing lands on the visible buffer.
+ * @param  buffer: ARGB8888 frame buffer for layer 0
+ * @retval false, completion is reported by LcdCompositor_LtdcIrqHandler
+ */
+bool LcdCompositorBackend_Present(uint32_t* buffer)
+{
+  hltdc_discovery.LayerCfg[0].FBStartAdress = (uint32_t)buffer;
+  LTDC_LAYER(&hltdc_discovery, 0)->CFBAR = (uint32_t)buffer;
+
+  LTDC->ICR = LTDC_ICR_CRRIF;
+  LTDC->IER |= LTDC_IER_RRIE;
+  LTDC->SRCR = LTDC_SRCR_VBR;
+
+  return false;
+}
+
+/**
+ * @brief  DMA2D interrupt: acknowledges the op and starts the next one. The
+ *         interrupt enables are cleared so that BSP transfers in polling mode
+ *         never reach this handler.
+ * @param  None
+ * @retval None
+ */
+void LcdCompositor_Dma2dIrqHandler(void)
+{
+  uint32_t flags = DMA2D->ISR;
+
+  DMA2D->IFCR = flags & LCD_DMA2D_FLAGS;
+  DMA2D->CR &= ~LCD_DMA2D_INTERRUPTS;
+
+  if(clutOp != NULL && (flags & (DMA2D_ISR_CTCIF | DMA2D_ISR_CAEIF)))
+  {
+    const LcdCompositorOp* op = clutOp;
+
+    clutOp = NULL;
+    if(flags & DMA2D_ISR_CAEIF)
+    {
+      loadedClut = NULL;
+      LcdCompositor_TransferComplete(true);
+      return;
+    }
+
+    loadedClut = op->clut;
+    LcdCompositorBackend_Start(op);
+    return;
+  }
+
+  if(flags & (DMA2D_ISR_TCIF | DMA2D_ISR_TEIF | DMA2D_ISR_CEIF))
+    LcdCompositor_TransferComplete((flags & (DMA2D_ISR_TEIF | DMA2D_ISR_CEIF)) != 0);
+}
+
+/**
+ * @brief  LTDC interrupt: the register reload means the new buffer is shown.
+ *         FIFO underruns and bus errors are counted, they show the scanout
+ *         did not get enough SDRAM bandwidth.
+ * @param  None
+ * @retval None
+ */
+void LcdCompositor_LtdcIrqHandler(void)
+{
+  uint32_t flags = LTDC->ISR;
+
+  if(flags & (LTDC_ISR_FUIF | LTDC_ISR_TERRIF))
+  {
+    LTDC->ICR = LCD_LTDC_ERRORS;
+    LcdCompositor_Underrun();
+  }
+
+  if(flags & LTDC_ISR_RRIF)
+  {
+    LTDC->ICR = LTDC_ICR_CRRIF;
+    LTDC->IER &= ~LTDC_IER_RRIE;
+    LcdCompositor_PresentComplete();
+  }
+}
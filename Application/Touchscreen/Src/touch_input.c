@@ -0,0 +1,255 @@
+/**
+  ******************************************************************************
+  * @file    touch_input.c
+  * @brief   Report queue and the press / move / release state machine of the
+  *          touch input, one per finger. Hardware independent: the FT6x06
+  *          driver posts the reports from its interrupts, the main loop takes
+  *          the events.
+  ******************************************************************************
+  */
+
+#include "touch_input.h"
+
+// private defines -------------------------------------------------------------
+#define TOUCH_REPORT_QUEUE_MASK (TOUCH_REPORT_QUEUE_SIZE - 1)
+
+#if (TOUCH_REPORT_QUEUE_SIZE & TOUCH_REPORT_QUEUE_MASK) != 0
+#error "TOUCH_REPORT_QUEUE_SIZE must be a power of two"
+#endif
+
+// private typedefs ------------------------------------------------------------
+typedef enum TouchState
+{
+  TOUCH_STATE_IDLE,
+  TOUCH_STATE_TOUCHED,
+  TOUCH_STATE_LIFTING                 // lifted, waiting out the debounce time
+} TouchState;
+
+typedef struct TouchFinger
+{
+  TouchState state;
+  uint8_t    id;                      // touch ID of the point it follows
+  uint16_t   lastX;
+  uint16_t   lastY;
+  uint32_t   lastContact;             // timestamp of the last report with contact
+  uint32_t   liftTime;
+} TouchFinger;
+
+// variables -------------------------------------------------------------------
+TouchInputStats   touchInputStats;
+TouchLatencyStats touchLatencyStats;
+
+// private variables -----------------------------------------------------------
+// single producer (the I2C interrupt), single consumer (the main loop)
+static TouchReport       queue[TOUCH_REPORT_QUEUE_SIZE];
+static volatile uint32_t queueHead = 0;
+static volatile uint32_t queueTail = 0;
+
+static TouchFinger fingers[TOUCH_MAX_POINTS];
+
+// events of the last report not returned yet, one per finger at most
+static TouchEvent pending[TOUCH_MAX_POINTS];
+static uint8_t    pendingCount = 0;
+static uint8_t    pendingNext = 0;
+
+// private function declarations -----------------------------------------------
+static void TouchInput_Step(const TouchReport* report);
+static int8_t TouchInput_FindFinger(uint8_t id);
+static void TouchInput_Emit(TouchEvent* event, uint8_t finger, TouchEventType type, uint32_t timestamp, uint32_t cycles);
+
+/**
+ * @brief  Empties the queue and forgets any touch in progress.
+ * @param  None
+ * @retval None
+ */
+void TouchInput_Reset(void)
+{
+  queueHead = 0;
+  queueTail = 0;
+  pendingCount = 0;
+  pendingNext = 0;
+  for(uint8_t i = 0; i < TOUCH_MAX_POINTS; i++)
+    fingers[i].state = TOUCH_STATE_IDLE;
+  touchInputStats = (TouchInputStats){0};
+  touchLatencyStats = (TouchLatencyStats){0};
+}
+
+/**
+ * @brief  Queues a report. Called from one interrupt only.
+ * @param  report: contact and position read from the controller
+ * @retval false if the queue was full and the report was dropped
+ */
+bool TouchInput_PostReport(const TouchReport* report)
+{
+  uint32_t head = queueHead;
+
+  if(head - queueTail == TOUCH_REPORT_QUEUE_SIZE)
+  {
+    touchInputStats.dropped++;
+    return false;
+  }
+
+  queue[head & TOUCH_REPORT_QUEUE_MASK] = *report;
+  queueHead = head + 1;
+  return true;
+}
+
+/**
+ * @brief  Runs the queued reports through the state machines until one gives
+ *         an event. A report moving both fingers gives two events, returned
+ *         by two calls. A release is only reported once the finger stayed off
+ *         for TOUCH_DEBOUNCE_MS, so it also needs the current time.
+ * @param  event: receives the event
+ * @param  now: HAL tick, in ms
+ * @retval true if an event was returned
+ */
+bool TouchInput_GetEvent(TouchEvent* event, uint32_t now)
+{
+  while(pendingNext == pendingCount && queueTail != queueHead)
+  {
+    TouchReport report = queue[queueTail & TOUCH_REPORT_QUEUE_MASK];
+    queueTail = queueTail + 1;
+
+    pendingCount = 0;
+    pendingNext = 0;
+    TouchInput_Step(&report);
+  }
+
+  if(pendingNext < pendingCount)
+  {
+    *event = pending[pendingNext++];
+    return true;
+  }
+
+  for(uint8_t i = 0; i < TOUCH_MAX_POINTS; i++)
+  {
+    TouchFinger* finger = &fingers[i];
+
+    // the controller stopped reporting without a lift report
+    if(finger->state == TOUCH_STATE_TOUCHED && now - finger->lastContact >= TOUCH_RELEASE_TIMEOUT_MS)
+    {
+      finger->state = TOUCH_STATE_LIFTING;
+      finger->liftTime = finger->lastContact;
+    }
+
+    if(finger->state == TOUCH_STATE_LIFTING && now - finger->liftTime >= TOUCH_DEBOUNCE_MS)
+    {
+      finger->state = TOUCH_STATE_IDLE;
+      TouchInput_Emit(event, i, TOUCH_EVENT_UP, finger->liftTime, 0);
+      return true;
+    }
+  }
+
+  return false;
+}
+
+/**
+ * @brief  Adds one touch to coefficient latency. Called from the USB
+ *         interrupt only.
+ * @param  latencyUs: from the touch interrupt to the new coefficients
+ * @retval None
+ */
+void TouchInput_RecordLatency(uint32_t latencyUs)
+{
+  touchLatencyStats.updates++;
+  touchLatencyStats.totalUs += latencyUs;
+  if(latencyUs > touchLatencyStats.maxUs)
+    touchLatencyStats.maxUs = latencyUs;
+}
+
+/**
+ * @brief  Advances the finger state machines by one report: fingers whose
+ *         point is missing start lifting, each point moves the finger that
+ *         follows its touch ID or presses an idle one. The events go to the
+ *         pending list.
+ * @param  report: next report
+ * @retval None
+ */
+static void TouchInput_Step(const TouchReport* report)
+{
+  for(uint8_t i = 0; i < TOUCH_MAX_POINTS; i++)
+  {
+    TouchFinger* finger = &fingers[i];
+    bool present = false;
+
+    for(uint8_t p = 0; p < report->points; p++)
+      present |= (report->point[p].id == finger->id);
+
+    if(finger->state == TOUCH_STATE_TOUCHED && !present)
+    {
+      finger->state = TOUCH_STATE_LIFTING;
+      finger->liftTime = report->timestamp;
+    }
+  }
+
+  for(uint8_t p = 0; p < report->points; p++)
+  {
+    const TouchPoint* point = &report->point[p];
+    int8_t index = TouchInput_FindFinger(point->id);
+
+    if(index < 0)
+    {
+      touchInputStats.unassigned++;
+      continue;
+    }
+
+    TouchFinger* finger = &fingers[index];
+    TouchState previous = finger->state;
+    uint16_t dx = (point->x > finger->lastX) ? point->x - finger->lastX : finger->lastX - point->x;
+    uint16_t dy = (point->y > finger->lastY) ? point->y - finger->lastY : finger->lastY - point->y;
+
+    finger->state = TOUCH_STATE_TOUCHED;
+    finger->id = point->id;
+    finger->lastContact = report->timestamp;
+
+    if(previous == TOUCH_STATE_IDLE)
+    {
+      finger->lastX = point->x;
+      finger->lastY = point->y;
+      TouchInput_Emit(&pending[pendingCount++], index, TOUCH_EVENT_DOWN, report->timestamp, report->cycles);
+      continue;
+    }
+
+    // contact back within the debounce time: the same touch goes on
+    if(previous == TOUCH_STATE_LIFTING)
+      touchInputStats.bounces++;
+
+    if(dx + dy <= TOUCH_JITTER_PIXELS)
+      continue;
+
+    finger->lastX = point->x;
+    finger->lastY = point->y;
+    TouchInput_Emit(&pending[pendingCount++], index, TOUCH_EVENT_MOVE, report->timestamp, report->cycles);
+  }
+}
+
+/**
+ * @brief  Finger for a touch ID: the one following it, touched or lifting,
+ *         else an idle one.
+ * @param  id: controller touch ID
+ * @retval finger index, -1 if all fingers follow other IDs
+ */
+static int8_t TouchInput_FindFinger(uint8_t id)
+{
+  int8_t idle = -1;
+
+  for(uint8_t i = 0; i < TOUCH_MAX_POINTS; i++)
+  {
+    if(fingers[i].state != TOUCH_STATE_IDLE && fingers[i].id == id)
+      return i;
+    if(fingers[i].state == TOUCH_STATE_IDLE && idle < 0)
+      idle = i;
+  }
+
+  return idle;
+}
+
+static void TouchInput_Emit(TouchEvent* event, uint8_t finger, TouchEventType type, uint32_t timestamp, uint32_t cycles)
+{
+  event->type = type;
+  event->finger = finger;
+  event->x = fingers[finger].lastX;
+  event->y = fingers[finger].lastY;
+  event->timestamp = timestamp;
+  event->cycles = cycles;
+}
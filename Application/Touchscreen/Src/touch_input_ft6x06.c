@@ -0,0 +1,207 @@
+/**
+  ******************************************************************************
+  * @file    touch_input_ft6x06.c
+  * @brief   FT6x06 backend of the touch input. The controller pulls its
+  *          interrupt line low once per report while touched; each edge
+  *          starts an interrupt-mode read of the status and both point
+  *          registers, whose completion posts a timestamped report. Nothing
+  *          goes over I2C while the screen is not touched.
+  *
+  *          I2C4 is shared with the audio codec, which the BSP drives in
+  *          blocking mode through its own handle. A read that finds the bus
+  *          busy is retried from TouchInput_Process.
+  ******************************************************************************
+  */
+
+#include "touch_input.h"
+#include "stm32f769i_discovery_ts.h"
+
+// private defines -------------------------------------------------------------
+// status, then XH, XL, YH, YL, weight and misc of each point
+#define TOUCH_READ_REGISTER FT6206_TD_STAT_REG
+#define TOUCH_READ_LENGTH   (FT6206_P2_YL_REG - FT6206_TD_STAT_REG + 1)
+#define TOUCH_POINT_STRIDE  (FT6206_P2_XH_REG - FT6206_P1_XH_REG)
+// touch ID in the high nibble of YH
+#define TOUCH_ID_SHIFT      4
+
+// variables -------------------------------------------------------------------
+extern uint8_t I2C_Address;           // FT6x06 address found by BSP_TS_Init
+
+// private variables -----------------------------------------------------------
+static I2C_HandleTypeDef touchI2cHandle = {0};
+static uint8_t           registers[TOUCH_READ_LENGTH];
+static volatile bool     readBusy = false;    // a read is on the bus
+static volatile bool     readPending = false; // an edge is waiting for a read
+static volatile uint32_t pendingTimestamp = 0;
+static volatile uint32_t pendingCycles = 0;
+static uint32_t          readTimestamp = 0;
+static uint32_t          readCycles = 0;
+
+// private function declarations -----------------------------------------------
+static void TouchInput_StartRead(void);
+
+/**
+ * @brief  Switches the touch controller to interrupt mode and takes over its
+ *         reads. BSP_TS_Init must have succeeded before.
+ * @param  None
+ * @retval true on success
+ */
+bool TouchInput_Init(void)
+{
+  TouchInput_Reset();
+
+  // same bus and settings as the BSP handle, which configured the pins
+  touchI2cHandle.Instance              = DISCOVERY_AUDIO_I2Cx;
+  touchI2cHandle.Init.Timing           = DISCOVERY_I2Cx_TIMING;
+  touchI2cHandle.Init.OwnAddress1      = 0;
+  touchI2cHandle.Init.AddressingMode   = I2C_ADDRESSINGMODE_7BIT;
+  touchI2cHandle.Init.DualAddressMode  = I2C_DUALADDRESS_DISABLE;
+  touchI2cHandle.Init.OwnAddress2      = 0;
+  touchI2cHandle.Init.GeneralCallMode  = I2C_GENERALCALL_DISABLE;
+  touchI2cHandle.Init.NoStretchMode    = I2C_NOSTRETCH_DISABLE;
+
+  if(HAL_I2C_Init(&touchI2cHandle) != HAL_OK)
+    return false;
+
+  HAL_NVIC_SetPriority(DISCOVERY_AUDIO_I2Cx_EV_IRQn, TOUCH_I2C_IRQ_PREPRIO, 0);
+  HAL_NVIC_EnableIRQ(DISCOVERY_AUDIO_I2Cx_EV_IRQn);
+  HAL_NVIC_SetPriority(DISCOVERY_AUDIO_I2Cx_ER_IRQn, TOUCH_I2C_IRQ_PREPRIO, 0);
+  HAL_NVIC_EnableIRQ(DISCOVERY_AUDIO_I2Cx_ER_IRQn);
+
+  return BSP_TS_ITConfig() == TS_OK;
+}
+
+/**
+ * @brief  Retries a read the bus was too busy for. Called from the main loop.
+ * @param  None
+ * @retval None
+ */
+void TouchInput_Process(void)
+{
+  if(!readPending)
+    return;
+
+  HAL_NVIC_DisableIRQ(TS_INT_EXTI_IRQn);
+  if(readPending && !readBusy)
+  {
+    touchInputStats.busyRetries++;
+    TouchInput_StartRead();
+  }
+  HAL_NVIC_EnableIRQ(TS_INT_EXTI_IRQn);
+}
+
+void TouchInput_I2cEventIrqHandler(void)
+{
+  HAL_I2C_EV_IRQHandler(&touchI2cHandle);
+}
+
+void TouchInput_I2cErrorIrqHandler(void)
+{
+  HAL_I2C_ER_IRQHandler(&touchI2cHandle);
+}
+
+/**
+ * @brief  Starts the register read for the pending edge. If the bus is busy
+ *         the edge stays pending.
+ * @param  None
+ * @retval None
+ */
+static void TouchInput_StartRead(void)
+{
+  readTimestamp = pendingTimestamp;
+  readCycles = pendingCycles;
+  readBusy = true;
+
+  if(HAL_I2C_Mem_Read_IT(&touchI2cHandle, I2C_Address, TOUCH_READ_REGISTER, I2C_MEMADD_SIZE_8BIT,
+      registers, TOUCH_READ_LENGTH) == HAL_OK)
+  {
+    readPending = false;
+    return;
+  }
+
+  readBusy = false;
+}
+
+/**
+ * @brief  FT6x06 interrupt line edge: a new report is ready.
+ * @param  GPIO_Pin: pin of the edge
+ * @retval None
+ */
+void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
+{
+  if(GPIO_Pin != TS_INT_PIN)
+    return;
+
+  touchInputStats.interrupts++;
+  pendingTimestamp = HAL_GetTick();
+  pendingCycles = DWT->CYCCNT;
+  readPending = true;
+
+  // a read in flight starts the next one when done
+  if(!readBusy)
+    TouchInput_StartRead();
+}
+
+/**
+ * @brief  Registers read: posts the report in screen coordinates.
+ * @param  hi2c: I2C handle
+ * @retval None
+ */
+void HAL_I2C_MemRxCpltCallback(I2C_HandleTypeDef* hi2c)
+{
+  if(hi2c != &touchI2cHandle)
+    return;
+
+  TouchReport report = {0};
+  uint8_t points = registers[0] & FT6206_TD_STAT_MASK;
+
+  touchInputStats.reads++;
+
+  // a count above the maximum is a read during the controller's update
+  if(points > TOUCH_MAX_POINTS)
+    points = 0;
+
+  for(uint8_t i = 0; i < points; i++)
+  {
+    uint8_t* point = &registers[FT6206_P1_XH_REG - TOUCH_READ_REGISTER + i * TOUCH_POINT_STRIDE];
+    uint8_t event = (point[0] & FT6206_TOUCH_EVT_FLAG_MASK) >> FT6206_TOUCH_EVT_FLAG_SHIFT;
+    uint16_t rawX = ((point[0] & FT6206_MSB_MASK) << 8) | point[1];
+    uint16_t rawY = ((point[2] & FT6206_MSB_MASK) << 8) | point[3];
+
+    if(event == FT6206_TOUCH_EVT_FLAG_LIFT_UP)
+      continue;
+
+    // landscape, as BSP_TS_Init sets it up for the 800x480 screen
+    report.point[report.points].id = point[2] >> TOUCH_ID_SHIFT;
+    report.point[report.points].x = rawY;
+    report.point[report.points].y = FT_6206_MAX_HEIGHT - 1 - rawX;
+    report.points++;
+  }
+
+  report.timestamp = readTimestamp;
+  report.cycles = readCycles;
+  TouchInput_PostReport(&report);
+
+  readBusy = false;
+  if(readPending)
+    TouchInput_StartRead();
+}
+
+/**
+ * @brief  I2C error, the report is lost. The controller interrupts again on
+ *         the next one while touched, and the release timeout covers a lost
+ *         lift.
+ * @param  hi2c: I2C handle
+ * @retval None
+ */
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef* hi2c)
+{
+  if(hi2c != &touchI2cHandle)
+    return;
+
+  touchInputStats.errors++;
+
+  readBusy = false;
+  if(readPending)
+    TouchInput_StartRead();
+}
@@ -0,0 +1,138 @@
+/**
+  ******************************************************************************
+  * @file    touch_map.c
+  * @brief   Cell grid of the widgets and the slider each finger holds.
+  *          Hardware independent. The grid is filled once, when the widgets
+  *          are added; widgets do not overlap, so the first one containing
+  *          the point is the one under it.
+  ******************************************************************************
+  */
+
+#include "touch_map.h"
+#include <stddef.h>
+
+// private defines -------------------------------------------------------------
+#define TOUCH_MAP_CELL_SIZE   (1 << TOUCH_MAP_CELL_SHIFT)
+#define TOUCH_MAP_COLUMNS     ((TOUCH_MAP_WIDTH + TOUCH_MAP_CELL_SIZE - 1) >> TOUCH_MAP_CELL_SHIFT)
+#define TOUCH_MAP_ROWS        ((TOUCH_MAP_HEIGHT + TOUCH_MAP_CELL_SIZE - 1) >> TOUCH_MAP_CELL_SHIFT)
+#define TOUCH_MAP_EMPTY       0xFF
+
+// private variables -----------------------------------------------------------
+static TouchWidget        widgets[TOUCH_MAP_MAX_WIDGETS];
+static uint8_t            widgetCount = 0;
+static uint8_t            cells[TOUCH_MAP_ROWS][TOUCH_MAP_COLUMNS][TOUCH_MAP_CELL_WIDGETS];
+// slider held by each finger, NULL when it holds none
+static const TouchWidget* held[TOUCH_MAX_POINTS];
+
+/**
+ * @brief  Removes every widget and releases every slider.
+ * @param  None
+ * @retval None
+ */
+void TouchMap_Reset(void)
+{
+  widgetCount = 0;
+
+  for(uint16_t row = 0; row < TOUCH_MAP_ROWS; row++)
+    for(uint16_t column = 0; column < TOUCH_MAP_COLUMNS; column++)
+      for(uint8_t i = 0; i < TOUCH_MAP_CELL_WIDGETS; i++)
+        cells[row][column][i] = TOUCH_MAP_EMPTY;
+
+  for(uint8_t i = 0; i < TOUCH_MAX_POINTS; i++)
+    held[i] = NULL;
+}
+
+/**
+ * @brief  Adds a widget and lists it in every cell it overlaps.
+ * @param  type: kind of widget
+ * @param  index: in the array of widgets of its type
+ * @param  x, y: top left corner of the area that takes touches
+ * @param  width, height: size of that area
+ * @retval false if the widget did not fit, in the map or in one of its cells;
+ *         it is then not added
+ */
+bool TouchMap_Add(TouchWidgetType type, uint8_t index, uint16_t x, uint16_t y, uint16_t width, uint16_t height)
+{
+  if(widgetCount == TOUCH_MAP_MAX_WIDGETS || width == 0 || height == 0 ||
+     x + width > TOUCH_MAP_WIDTH || y + height > TOUCH_MAP_HEIGHT)
+    return false;
+
+  uint16_t firstColumn = x >> TOUCH_MAP_CELL_SHIFT;
+  uint16_t lastColumn = (x + width - 1) >> TOUCH_MAP_CELL_SHIFT;
+  uint16_t firstRow = y >> TOUCH_MAP_CELL_SHIFT;
+  uint16_t lastRow = (y + height - 1) >> TOUCH_MAP_CELL_SHIFT;
+
+  // every cell needs a free slot before any is taken
+  for(uint16_t row = firstRow; row <= lastRow; row++)
+    for(uint16_t column = firstColumn; column <= lastColumn; column++)
+      if(cells[row][column][TOUCH_MAP_CELL_WIDGETS - 1] != TOUCH_MAP_EMPTY)
+        return false;
+
+  for(uint16_t row = firstRow; row <= lastRow; row++)
+  {
+    for(uint16_t column = firstColumn; column <= lastColumn; column++)
+    {
+      uint8_t slot = 0;
+      while(cells[row][column][slot] != TOUCH_MAP_EMPTY)
+        slot++;
+      cells[row][column][slot] = widgetCount;
+    }
+  }
+
+  widgets[widgetCount++] = (TouchWidget){ type, index, x, y, width, height };
+  return true;
+}
+
+/**
+ * @brief  Widget under a point.
+ * @param  x, y: screen coordinates
+ * @retval the widget, NULL if there is none
+ */
+const TouchWidget* TouchMap_Find(uint16_t x, uint16_t y)
+{
+  if(x >= TOUCH_MAP_WIDTH || y >= TOUCH_MAP_HEIGHT)
+    return NULL;
+
+  const uint8_t* cell = cells[y >> TOUCH_MAP_CELL_SHIFT][x >> TOUCH_MAP_CELL_SHIFT];
+
+  for(uint8_t i = 0; i < TOUCH_MAP_CELL_WIDGETS && cell[i] != TOUCH_MAP_EMPTY; i++)
+  {
+    const TouchWidget* widget = &widgets[cell[i]];
+
+    if(x >= widget->x && x < widget->x + widget->width && y >= widget->y && y < widget->y + widget->height)
+      return widget;
+  }
+
+  return NULL;
+}
+
+/**
+ * @brief  Widget an event applies to. A finger pressing a slider, or moving
+ *         onto one while holding none, holds it until it lifts; its moves go
+ *         to that slider wherever they are. Other touches go to the widget
+ *         under them.
+ * @param  event: touch event
+ * @retval the widget, NULL if there is none; for a release, the slider the
+ *         finger held
+ */
+const TouchWidget* TouchMap_Route(const TouchEvent* event)
+{
+  const TouchWidget* widget;
+
+  if(event->finger >= TOUCH_MAX_POINTS)
+    return NULL;
+
+  if(event->type == TOUCH_EVENT_UP)
+  {
+    widget = held[event->finger];
+    held[event->finger] = NULL;
+    return widget;
+  }
+
+  if(event->type == TOUCH_EVENT_MOVE && held[event->finger] != NULL)
+    return held[event->finger];
+
+  widget = TouchMap_Find(event->x, event->y);
+  held[event->finger] = (widget != NULL && widget->type == TOUCH_WIDGET_SLIDER) ? widget : NULL;
+  return widget;
+}
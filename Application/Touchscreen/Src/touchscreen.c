@@ -20,6 +20,8 @@
 #include "main.h"
 #include "user_lcd.h"
 #include "flash_persistence.h"
+#include "touch_input.h"
+#include "touch_map.h"
 /** @addtogroup STM32F7xx_HAL_Examples
  * @{
  */
@@ -62,6 +64,9 @@ TS_StateTypeDef TS_State = {0};
 /* Private function prototypes -----------------------------------------------*/
 //static void     Touchscreen_SetHint_Demo(TouchScreenDemoTypeDef demoIndex);
 void                    Touchscreen_DrawBackground_Circles(uint8_t state);
+static void             Touchscreen_HandleTouch(const TouchEvent* event);
+static void             Touchscreen_PressOptionButton(uint8_t index);
+static void             Touchscreen_MoveSlider(uint8_t index, const TouchEvent* event);
 #if (TS_MULTI_TOUCH_SUPPORTED == 1)
 static uint32_t Touchscreen_Handle_NewTouch(void);
 #endif // TS_MULTI_TOUCH_SUPPORTED == 1
@@ -73,165 +78,155 @@ extern bool shouldPrintSamples;
 extern bool shouldApplyFilter;
 bool areInitialCirclesDrawn = false;
 
-#define CIRCLE_BUTTON_DEBOUNCE_TIMER 100
+// a circle button toggles at most once in that time, in ms
+#define CIRCLE_BUTTON_DEBOUNCE_MS 300
+// rows at each end of a slider track that do not take touches
+#define SLIDER_TOUCH_MARGIN       10
+#define NUMBER_OF_OPTION_BUTTONS  3
+
+// in the order LCD_AddTouchWidgets puts them on the touch map
+static RectangleButton* const optionButtons[NUMBER_OF_OPTION_BUTTONS] = { &saveButton, &undoButton, &resetButton };
 uint32_t yOffset = 0;
 uint32_t xOffset = 150;
 
 void Touchscreen_Init(void)
 {
   initStatus = BSP_TS_Init(BSP_LCD_GetXSize(), BSP_LCD_GetYSize());
+
+  if(initStatus == TS_OK && !TouchInput_Init())
+    initStatus = TS_ERROR;
+
+  if(!LCD_AddTouchWidgets())
+    Error_Handler();
 }
 
 void Touchscreen_ButtonHandler(void)
 {
-  uint16_t touchXPosition, touchYPosition;
-//	uint8_t state = 0;
-//	uint8_t exitTsUseCase = 0;
+  TouchEvent event;
 
   if(initStatus != TS_OK)
     return;
 
-  initStatus = BSP_TS_GetState(&TS_State);
+  TouchInput_Process();
+
+  while(TouchInput_GetEvent(&event, HAL_GetTick()))
+    Touchscreen_HandleTouch(&event);
+}
 
-  if(!TS_State.touchDetected)
+/**
+ * @brief  Applies a press or a move to the widget it is routed to: the one
+ *         under it, or the slider its finger holds. Releases only let go of
+ *         the slider.
+ * @param  event: debounced touch event
+ * @retval None
+ */
+static void Touchscreen_HandleTouch(const TouchEvent* event)
+{
+  const TouchWidget* widget = TouchMap_Route(event);
+
+  if(widget == NULL || event->type == TOUCH_EVENT_UP)
+    return;
+
+  if(widget->type == TOUCH_WIDGET_CIRCLE_BUTTON)
   {
-    for(uint8_t i = 0; i < NUMBER_OF_CIRCLE_BUTTONS; i++) 
+    CircleButtonTypeDef* button = &circleButtons[widget->index];
+
+    // toggle on the press only, a finger resting on the button does nothing
+    if(event->type == TOUCH_EVENT_DOWN && event->timestamp - button->debounceTimer >= CIRCLE_BUTTON_DEBOUNCE_MS)
     {
-      if(++circleButtons[i].debounceTimer > CIRCLE_BUTTON_DEBOUNCE_TIMER)
-        circleButtons[i].debounceTimer = CIRCLE_BUTTON_DEBOUNCE_TIMER;
+      LCD_UpdateButton(widget->index, !button->isPressed, true);
+      button->debounceTimer = event->timestamp;
     }
     return;
   }
 
-  touchXPosition = TS_State.touchX[0];
-  touchYPosition = TS_State.touchY[0];
+  // the other widgets are on the EQ screen
+  if(!circleButtons[0].isActive)
+    return;
 
-  for(uint8_t i = 0; i < NUMBER_OF_CIRCLE_BUTTONS; i++) 
-  {
-    if((touchYPosition > circleButtons[i].y - circleButtons[i].radius) && (touchYPosition < circleButtons[i].y + circleButtons[i].radius))
-    {
-      if((touchXPosition > circleButtons[i].x - circleButtons[i].radius) && (touchXPosition < circleButtons[i].x + circleButtons[i].radius))
-      {
-        
-        if(circleButtons[i].debounceTimer == CIRCLE_BUTTON_DEBOUNCE_TIMER)
-          LCD_UpdateButton(i, !circleButtons[i].isPressed, false);
+  if(widget->type == TOUCH_WIDGET_RECTANGLE_BUTTON)
+    Touchscreen_PressOptionButton(widget->index);
+  else
+    Touchscreen_MoveSlider(widget->index, event);
+}
 
-        circleButtons[i].debounceTimer = 0;
+/**
+ * @brief  Runs the action of the save, undo or reset button once per press
+ *         and shows it as the selected one.
+ * @param  index: in the order of optionButtons
+ * @retval None
+ */
+static void Touchscreen_PressOptionButton(uint8_t index)
+{
+  RectangleButton* pressed = optionButtons[index];
 
-        return;
-      }
-    }
+  if(pressed->isPressed)
+    return;
+
+  for(uint8_t i = 0; i < NUMBER_OF_OPTION_BUTTONS; i++)
+  {
+    optionButtons[i]->isPressed = (i == index);
+    optionButtons[i]->isActive = (i == index);
+    LCD_UpdateRectangleButton(optionButtons[i]);
   }
 
-  if(circleButtons[0].isActive)
-  {  
-    if(touchYPosition > saveButton.y && touchYPosition < saveButton.y + saveButton.height)
-    {
-      if(touchXPosition > saveButton.x && touchXPosition < saveButton.x + saveButton.width)
-      {
-        if(!saveButton.isPressed)
-        {
-          saveButton.isPressed = true;
-          saveButton.isActive = true;
-          resetButton.isPressed = false;
-          resetButton.isActive = false;
-          undoButton.isPressed = false;
-          undoButton.isActive = false;
-          LCD_UpdateRectangleButton(&saveButton);
-          LCD_UpdateRectangleButton(&undoButton);
-          LCD_UpdateRectangleButton(&resetButton);
-          FlashPersistence_Write();
-        }
-
-        return;
-      }
-    }  
-    else if(touchYPosition > undoButton.y && touchYPosition < undoButton.y + undoButton.height)
-    {
-      if(touchXPosition > undoButton.x && touchXPosition < saveButton.x + undoButton.width)
-      {
-        if(!undoButton.isPressed)
-        {
-          saveButton.isPressed = false;
-          saveButton.isActive = false;
-          undoButton.isPressed = true;
-          undoButton.isActive = true;
-          resetButton.isPressed = false;
-          resetButton.isActive = false;
-          LCD_UpdateRectangleButton(&saveButton);
-          LCD_UpdateRectangleButton(&undoButton);
-          LCD_UpdateRectangleButton(&resetButton);
-          for(uint8_t i = 0; i < NUMBER_OF_SLIDER_BUTTONS; i++)
-            LCD_DisplayKnob(i, FlashPersistence_Read(i));
-        }
-
-        return;
-      }
-    }
-    else if(touchYPosition > resetButton.y && touchYPosition < resetButton.y + resetButton.height)
+  if(pressed == &saveButton)
+  {
+    // queued, the flash interrupt and the flash task write it
+    FlashPersistence_Write();
+  }
+  else if(pressed == &undoButton)
+  {
+    // the saved gains too, not only the knobs
+    for(uint8_t i = 0; i < NUMBER_OF_SLIDER_BUTTONS; i++)
+      LCD_DisplayKnob(i, FlashPersistence_Read(i));
+    FlashPersistence_RecallCoefficients();
+  }
+  else
+  {
+    for(uint8_t i = 0; i < NUMBER_OF_SLIDER_BUTTONS; i++)
     {
-      if(touchXPosition > resetButton.x && touchXPosition < resetButton.x + resetButton.width)
-      {
-        if(!resetButton.isPressed)
-        {
-          saveButton.isPressed = false;
-          saveButton.isActive = false;
-          undoButton.isPressed = false;
-          undoButton.isActive = false;
-          resetButton.isPressed = true;
-          resetButton.isActive = true;
-          LCD_UpdateRectangleButton(&saveButton);
-          LCD_UpdateRectangleButton(&undoButton);
-          LCD_UpdateRectangleButton(&resetButton);
-          for(uint8_t i = 0; i < NUMBER_OF_SLIDER_BUTTONS; i++)
-          {
-            AudioUserDsp_BiquadFilterConfig(&biquadFilters[i], 0, frequencies[i], bandwidths[i]);
-            LCD_DisplayKnob(i, LCD_TranslateGainToKnobPosition(i, 0));
-          }
-        }
-
-        return;
-      }
+      AudioUserDsp_BiquadFilterConfig(&biquadFilters[i], 0, frequencies[i], bandwidths[i]);
+      LCD_DisplayKnob(i, LCD_TranslateGainToKnobPosition(i, 0));
     }
+  }
+}
 
-    for(uint8_t i = 0; i < NUMBER_OF_SLIDER_BUTTONS; i++)
+/**
+ * @brief  Moves a knob to the touch, kept on its track, and flags it for the
+ *         USB interrupt, which sets the new gain before the next packet. The
+ *         time of the first touch it has not taken yet is kept for the
+ *         latency.
+ * @param  index: slider
+ * @param  event: press or move
+ * @retval None
+ */
+static void Touchscreen_MoveSlider(uint8_t index, const TouchEvent* event)
+{
+  SliderKnob* knob = &sliderKnobs[index];
+  uint16_t top = knob->sliderY + SLIDER_TOUCH_MARGIN + 1;
+  uint16_t bottom = knob->sliderY + knob->sliderHeight - SLIDER_TOUCH_MARGIN - 1;
+  uint16_t y = event->y;
+
+  if(y < top)
+    y = top;
+  if(y > bottom)
+    y = bottom;
+
+  LCD_DisplayKnob(index, y);
+  if(!knob->isPressed)
+    knob->touchCycles = event->cycles;
+  knob->isPressed = true;
+
+  for(uint8_t i = 0; i < NUMBER_OF_OPTION_BUTTONS; i++)
+  {
+    optionButtons[i]->isPressed = false;
+    if(optionButtons[i]->isActive)
     {
-      if((touchYPosition > sliderKnobs[i].sliderY + 10) && (touchYPosition < sliderKnobs[i].sliderY + sliderKnobs[i].sliderHeight - 10))
-      {
-        if((touchXPosition > sliderKnobs[i].sliderX) && (touchXPosition < sliderKnobs[i].sliderX + sliderKnobs[i].sliderWidth))
-        {
-          if(++sliderKnobs[i].debounceCount >= sliderKnobs[i].debouceLimit)
-          {
-            LCD_DisplayKnob(i, touchYPosition);
-            sliderKnobs[i].isPressed = true;
-            sliderKnobs[i].debounceCount = 0;
-
-            resetButton.isPressed = false;
-            saveButton.isPressed = false;
-            undoButton.isPressed = false;
-            
-            if(resetButton.isActive)
-            {
-              resetButton.isActive = false;
-              LCD_UpdateRectangleButton(&resetButton);
-            }
-            if(saveButton.isActive)
-            {
-              saveButton.isActive = false;
-              LCD_UpdateRectangleButton(&saveButton);
-            }
-            if(undoButton.isActive)
-            {
-              undoButton.isActive = false;
-              LCD_UpdateRectangleButton(&undoButton);
-            } 
-            return;
-          }
-        }
-      }
+      optionButtons[i]->isActive = false;
+      LCD_UpdateRectangleButton(optionButtons[i]);
     }
   }
-
 }
 
 
@@ -1,4 +1,10 @@
 #include "user_lcd.h"
+#include "lcd_compositor.h"
+#include "touch_map.h"
+#include "audio_user_dsp_response.h"
+#include "spectrum.h"
+#include <math.h>
+#include <string.h>
 #define FOREGROUND_LAYER_OFFSET  (800 * 480 * sizeof(uint16_t))  // Adjust this offset based on your needs
 
 // pictures -----------------------------------------------------------
@@ -30,18 +36,52 @@
 #define BUTTON_BORDER_SIZE 2
 #define Y_BAR_POSITION -60
 
+#define LCD_FONT          Font24
+#define KNOB_HEIGHT       12
+#define KNOB_LABEL_Y      450
+#define KNOB_LABEL_LENGTH 3
+// rows of track above and below the knob sprite, drags up to that far need
+// only the sprite to be drawn
+#define KNOB_SPRITE_MARGIN 8
+#define GAIN_MIN          -15
+#define GAIN_MAX          15
+#define WATCHDOG_LENGTH   4
+// EQ response drawn over the sliders, on their dB scale; each segment of the
+// polyline is one fill, this many rows above and below the line
+#define CURVE_COLOR       LCD_COLOR_BLUE
+#define CURVE_HALF_WIDTH  1
+// spectrum bars fill the frame of the sliders, dB scale from SPECTRUM_MIN_DB at
+// the bottom to 0 dBFS at the top
+#define SPECTRUM_COLOR      LCD_COLOR_BLUE
+#define SPECTRUM_BAR_WIDTH  15
+#define SPECTRUM_BAR_GAP    2
+
 // private function declarations --------------------------------------
 static void     LCD_LayertInit(uint16_t LayerIndex, uint32_t Address);
 static void     Display_StartupScreen(void);
-static uint8_t  CopyImageToLcdFrameBuffer(void *pSrc, void *pDst, uint32_t xSize, uint32_t ySize, uint16_t x, uint16_t y);
+static void     LCD_RenderSprites(void);
+static void     LCD_RenderScene(void);
+static void     LCD_RenderRectangleButton(RectangleButton* button);
+static void     LCD_RenderSlider(uint8_t knobIndex);
+static void     LCD_RenderCircleButton(CircleButtonTypeDef* button);
+static bool     LCD_KnobSpriteFits(SliderKnob* knob, uint16_t knobY);
+static int16_t  LCD_KnobGain(SliderKnob* knob, uint16_t knobY);
+static void     LCD_FormatGain(int16_t gain, char* text);
+static void     LCD_InvalidateKnob(SliderKnob* knob, uint16_t knobY, uint16_t margin);
+static void     LCD_RenderResponseCurve(void);
+static int16_t  LCD_CurveX(uint16_t point);
+static int16_t  LCD_CurveY(float magnitude);
+static void     LCD_RenderSpectrum(void);
+static int16_t  LCD_SpectrumX(float frequency);
+static int16_t  LCD_SpectrumY(float level);
 void LCD_DisplayPlusButton(uint8_t buttonIndex);
 
 // variables ----------------------------------------------------------
 // !! THE NUMBER_OF_CIRCLE_BUTTONS DEFINE HAS TO BE UP TO DATE WITH THE NUMBER OF BUTTONS DEFINED HERE
 CircleButtonTypeDef circleButtons[] = {
-  //  x,   y,  r,               color,       text color,        on,     off,  pressed, independent, active
-  { 100, 440, 30, LCD_COLOR_BURGUNDY,   LCD_COLOR_BLACK, "EQ",     "",       false,     false,      false, 0},
-  { 150, 440, 30, LCD_COLOR_BURGUNDY,   LCD_COLOR_BLACK, "Vol",     "",       false,     false,      false, 0},
+  //  x,   y,  r,               color,       text color,        on,     off,  pressed, independent, active, debounce, sprites
+  { 100, 440, 30, LCD_COLOR_BURGUNDY,   LCD_COLOR_BLACK, "EQ",     "",       false,     false,      false, 0, { { 0 } } },
+  { 170, 440, 30, LCD_COLOR_BURGUNDY,   LCD_COLOR_BLACK, "FFT",     "",       false,     false,      false, 0, { { 0 } } },
   // { 250, 420, 50, LCD_COLOR_MINT_GREEN, LCD_COLOR_BLACK, "Volume",  "",       false,    false,      false},
   // { 400, 420, 50, LCD_COLOR_MINT_GREEN, LCD_COLOR_BLACK, "Low Pass",     "",       false,    false,      false},
   // { 550, 420, 50, LCD_COLOR_MINT_GREEN, LCD_COLOR_BLACK, "Biquad",     "",       false,    false,      false},
@@ -93,16 +133,31 @@ IncrementButton plusButtons[] = {
 };
 
 SliderKnob sliderKnobs[] = {
-  { 200 + 50,  25, 60, 400, LCD_COLOR_BLACK, 160, 20, false, 5, 7},
-  { 200 + 110, 25, 60, 400, LCD_COLOR_BLACK, 160, 20, false, 5, 7},
-  { 200 + 170, 25, 60, 400, LCD_COLOR_BLACK, 160, 20, false, 5, 7},
-  { 200 + 230, 25, 60, 400, LCD_COLOR_BLACK, 160, 20, false, 5, 7},
-  { 200 + 290, 25, 60, 400, LCD_COLOR_BLACK, 160, 20, false, 5, 7},
-  { 200 + 350, 25, 60, 400, LCD_COLOR_BLACK, 160, 20, false, 5, 7},
-  { 200 + 410, 25, 60, 400, LCD_COLOR_BLACK, 160, 20, false, 5, 7},
-  { 200 + 470, 25, 60, 400, LCD_COLOR_BLACK, 160, 20, false, 5, 7}
+  { 200 + 50,  25, 60, 400, LCD_COLOR_BLACK, 160, 20, false, 0},
+  { 200 + 110, 25, 60, 400, LCD_COLOR_BLACK, 160, 20, false, 0},
+  { 200 + 170, 25, 60, 400, LCD_COLOR_BLACK, 160, 20, false, 0},
+  { 200 + 230, 25, 60, 400, LCD_COLOR_BLACK, 160, 20, false, 0},
+  { 200 + 290, 25, 60, 400, LCD_COLOR_BLACK, 160, 20, false, 0},
+  { 200 + 350, 25, 60, 400, LCD_COLOR_BLACK, 160, 20, false, 0},
+  { 200 + 410, 25, 60, 400, LCD_COLOR_BLACK, 160, 20, false, 0},
+  { 200 + 470, 25, 60, 400, LCD_COLOR_BLACK, 160, 20, false, 0}
 };
 
+static char watchdogText[WATCHDOG_LENGTH + 1] = "0000";
+
+// all sliders share the size and color of the first one
+static LcdSprite knobSprite;
+static LcdSprite gainLabelSprites[GAIN_MAX - GAIN_MIN + 1];
+
+// logo unpacked into the atlas, drawn with the DMA2D CLUT
+static LcdImage logo;
+
+// screen row of each point of the EQ response, as last drawn
+static int16_t curveY[DSP_RESPONSE_POINTS];
+
+// screen row of the top of each spectrum bar, as last drawn
+static int16_t spectrumTop[SPECTRUM_BARS];
+
 // external variable declarations -------------------------------------
 extern LTDC_HandleTypeDef hltdc_discovery;
 /**
@@ -130,9 +185,35 @@ void LCD_Init(void)
 
   BSP_LCD_Clear(LCD_COLOR_WHITE);
 
+  // from here on everything is drawn by the compositor, alternating between
+  // the layer 0 buffer and the one after it; SDRAM is not cacheable in the
+  // default memory map, so the staging area needs no cache maintenance
+  LcdCompositorBackend_Init();
+  LcdCompositor_Init((uint32_t*)LAYER0_ADDRESS, (uint32_t*)LAYER1_ADDRESS, (uint32_t*)(INTERNAL_BUFFER_START_ADDRESS),
+    (uint32_t*)(INTERNAL_BUFFER_START_ADDRESS) + LCD_COMPOSITOR_STAGING_PIXELS, LCD_RenderScene);
+  LcdCompositor_UnpackImage(&utfprLogo, &logo);
+  LCD_RenderSprites();
+
+  // flat until the first update of the response
+  for(uint16_t i = 0; i < DSP_RESPONSE_POINTS; i++)
+    curveY[i] = LCD_CurveY(0);
+  for(uint8_t i = 0; i < SPECTRUM_BARS; i++)
+    spectrumTop[i] = LCD_SpectrumY(SPECTRUM_MIN_DB);
+
   Display_StartupScreen();
 }
 
+/**
+ * @brief  Draws what changed since the last call. Returns at once, DMA2D
+ *         does the drawing in the background.
+ * @param  None
+ * @retval None
+ */
+void LCD_Process(void)
+{
+  LcdCompositor_Flush();
+}
+
 /**
  * @brief  Initializes the LCD layers.
  * @param  LayerIndex: Layer foreground or background
@@ -168,143 +249,235 @@ static void Display_StartupScreen(void)
   // sets lcd foreground layer
   BSP_LCD_SelectLayer(0);
 
-  // clears the lcd
-  BSP_LCD_SetBackColor(LCD_COLOR_WHITE);
-  BSP_LCD_Clear(LCD_COLOR_WHITE);
-
   LCD_UpdateState();
 }
 
 void LCD_UpdateState()
 {
+  // switching screens redraws everything
+  LcdCompositor_InvalidateAll();
+}
+
+/**
+ * @brief  Renders the widgets that change at runtime into sprites once, so
+ *         updating one of them is a single blit: the knob, every gain label
+ *         and both states of the buttons.
+ * @param  None
+ * @retval None
+ */
+static void LCD_RenderSprites(void)
+{
+  SliderKnob* knob = &sliderKnobs[0];
+  RectangleButton* buttons[] = { &saveButton, &undoButton, &resetButton };
+  int16_t knobWidth = knob->sliderWidth - 3;
+  int16_t trackX = knob->sliderWidth / 2 - 5 - 3;
+  char text[5];
+
+  // knob with the slider background around it, as LCD_RenderSlider draws them
+  LcdCompositor_BeginSprite(&knobSprite, knobWidth, KNOB_HEIGHT + 2 * KNOB_SPRITE_MARGIN, true);
+  LcdCompositor_FillRect(0, 0, knobWidth, KNOB_HEIGHT + 2 * KNOB_SPRITE_MARGIN, LCD_COLOR_WHITE);
+  LcdCompositor_FillRect(trackX, 0, 10, KNOB_HEIGHT + 2 * KNOB_SPRITE_MARGIN, knob->sliderColor);
+  LcdCompositor_FillRect(0, KNOB_SPRITE_MARGIN, knobWidth, KNOB_HEIGHT, knob->sliderColor);
+  LcdCompositor_FillRect(2, KNOB_SPRITE_MARGIN + 2, knob->sliderWidth - 7, 8, LCD_COLOR_WHITE);
+  LcdCompositor_EndSprite();
+
+  for(int16_t gain = GAIN_MIN; gain <= GAIN_MAX; gain++)
+  {
+    LCD_FormatGain(gain, text);
+    LcdCompositor_BeginSprite(&gainLabelSprites[gain - GAIN_MIN], KNOB_LABEL_LENGTH * LCD_FONT.Width, LCD_FONT.Height, true);
+    LcdCompositor_DrawString(0, 0, text, &LCD_FONT, LCD_COLOR_BLACK, LCD_COLOR_WHITE, LEFT_MODE);
+    LcdCompositor_EndSprite();
+  }
+
+  for(uint8_t i = 0; i < sizeof(buttons) / sizeof(buttons[0]); i++)
+  {
+    RectangleButton* button = buttons[i];
+    int16_t width = button->width + (2*BUTTON_BORDER_SIZE);
+    int16_t height = button->height + (2*BUTTON_BORDER_SIZE);
+
+    for(uint8_t active = 0; active < 2; active++)
+    {
+      uint32_t color = active ? button->activeColor : button->inactiveColor;
+
+      LcdCompositor_BeginSprite(&button->sprites[active], width, height, true);
+      LcdCompositor_FillRect(0, 0, width, height, LCD_COLOR_BLACK);
+      LcdCompositor_FillRect(BUTTON_BORDER_SIZE, BUTTON_BORDER_SIZE, button->width, button->height, color);
+      LcdCompositor_DrawString(BUTTON_BORDER_SIZE + 5, BUTTON_BORDER_SIZE + button->height / 2 - 6, button->text, &LCD_FONT, LCD_COLOR_BLACK, color, LEFT_MODE);
+      LcdCompositor_EndSprite();
+    }
+  }
+
+  for(uint8_t i = 0; i < NUMBER_OF_CIRCLE_BUTTONS; i++)
+  {
+    CircleButtonTypeDef* button = &circleButtons[i];
+    int16_t size = 2 * button->radius + 1;
+
+    for(uint8_t pressed = 0; pressed < 2; pressed++)
+    {
+      LcdCompositor_BeginSprite(&button->sprites[pressed], size, size, false);
+      LcdCompositor_FillRect(0, 0, size, size, LCD_COMPOSITOR_TRANSPARENT);
+      LcdCompositor_FillCircle(button->radius, button->radius, button->radius, LCD_COLOR_BLACK);
+      LcdCompositor_FillCircle(button->radius, button->radius, button->radius - 3, pressed ? LCD_COLOR_LIGHTGREEN : LCD_COLOR_LIGHTGRAY);
+      LcdCompositor_EndSprite();
+    }
+  }
+}
+
+/**
+ * @brief  Draws the whole screen from the widget state, back to front. Called
+ *         by the compositor once per dirty rectangle, which clips every fill
+ *         and skips what lies outside.
+ * @param  None
+ * @retval None
+ */
+static void LCD_RenderScene(void)
+{
+  LcdCompositor_FillRect(0, 0, LCD_SCREEN_WIDTH, LCD_SCREEN_HEIGHT, LCD_COLOR_WHITE);
 
   if(circleButtons[0].isActive)
   {
     // displays background
-    BSP_LCD_SetBackColor(LCD_COLOR_WHITE);
-    BSP_LCD_SetTextColor(LCD_COLOR_BLACK);
-    BSP_LCD_DisplayStringAt(sliderKnobs[0].sliderX, 0, (uint8_t *)" 30  60 150 400 1k 3k 8k 16k", LEFT_MODE);
-    BSP_LCD_FillRect(sliderKnobs[0].sliderX - 2, sliderKnobs[0].sliderY - 2, NUMBER_OF_SLIDER_BUTTONS * sliderKnobs[0].sliderWidth + 4, sliderKnobs[0].sliderHeight + 4);
+    LcdCompositor_DrawString(sliderKnobs[0].sliderX, 0, " 30  60 150 400 1k 3k 8k 16k", &LCD_FONT, LCD_COLOR_BLACK, LCD_COLOR_WHITE, LEFT_MODE);
+    LcdCompositor_FillRect(sliderKnobs[0].sliderX - 2, sliderKnobs[0].sliderY - 2, NUMBER_OF_SLIDER_BUTTONS * sliderKnobs[0].sliderWidth + 4, sliderKnobs[0].sliderHeight + 4, LCD_COLOR_BLACK);
 
     // displays option buttons
-    LCD_UpdateRectangleButton(&saveButton);
-    LCD_UpdateRectangleButton(&resetButton);
-    LCD_UpdateRectangleButton(&undoButton);
+    LCD_RenderRectangleButton(&saveButton);
+    LCD_RenderRectangleButton(&resetButton);
+    LCD_RenderRectangleButton(&undoButton);
 
-    // displays sliders and their knobs
+    // displays sliders and their knobs, the response curve over them
     for(uint8_t i = 0; i < NUMBER_OF_SLIDER_BUTTONS; i++)
-    {
-      LCD_InitSlider(i);
-      LCD_DisplayKnob(i, sliderKnobs[i].knobY);
-    }
+      LCD_RenderSlider(i);
+    LCD_RenderResponseCurve();
+  }
+  else if(circleButtons[1].isActive)
+  {
+    LCD_RenderSpectrum();
   }
   else
   {
-    // default state: displays background
-
-    // clears display
-    BSP_LCD_Clear(LCD_COLOR_WHITE);
-
-    // displays logo
-    BSP_LCD_DrawPicture(utfprlogo, UTFPR_LOGO_WIDTH, UTFPR_LOGO_HEIGHT, 20, 20);
+    // default state: displays logo
+    LcdCompositor_DrawImage(&logo, 20, 20);
 
     // displays background yellow line
-    BSP_LCD_SetFont(&Font24);
-    BSP_LCD_SetTextColor(LCD_COLOR_UTFPRYELLOW);
-    BSP_LCD_FillRect(0, BSP_LCD_GetYSize() / 2 + Y_BAR_POSITION, BSP_LCD_GetXSize(), 90);
+    LcdCompositor_FillRect(0, LCD_SCREEN_HEIGHT / 2 + Y_BAR_POSITION, LCD_SCREEN_WIDTH, 90, LCD_COLOR_UTFPRYELLOW);
 
     // displays background text
-    BSP_LCD_SetBackColor(LCD_COLOR_UTFPRYELLOW);
-    BSP_LCD_SetTextColor(LCD_COLOR_BLACK);
-    BSP_LCD_DisplayStringAt(0, BSP_LCD_GetYSize() / 2 + Y_BAR_POSITION + 15, (uint8_t *)"V1.0", CENTER_MODE);
-    BSP_LCD_DisplayStringAt(0, BSP_LCD_GetYSize() / 2 + Y_BAR_POSITION + 45, (uint8_t *)"Branch Biquad", CENTER_MODE);
+    LcdCompositor_DrawString(0, LCD_SCREEN_HEIGHT / 2 + Y_BAR_POSITION + 15, "V1.0", &LCD_FONT, LCD_COLOR_BLACK, LCD_COLOR_UTFPRYELLOW, CENTER_MODE);
+    LcdCompositor_DrawString(0, LCD_SCREEN_HEIGHT / 2 + Y_BAR_POSITION + 45, "Branch Biquad", &LCD_FONT, LCD_COLOR_BLACK, LCD_COLOR_UTFPRYELLOW, CENTER_MODE);
   }
 
-  // circle buttons are always updated
+  LcdCompositor_DrawString(0, 0, watchdogText, &LCD_FONT, LCD_COLOR_BLACK, LCD_COLOR_WHITE, RIGHT_MODE);
+
+  // circle buttons are always drawn
   for(uint8_t i = 0; i < NUMBER_OF_CIRCLE_BUTTONS; i++)
-  {
-    // draws button border
-    BSP_LCD_SetTextColor(LCD_COLOR_BLACK);
-    BSP_LCD_FillCircle(circleButtons[i].x, circleButtons[i].y, circleButtons[i].radius);
+    LCD_RenderCircleButton(&circleButtons[i]);
+}
 
-    // draws button inner circle
-    BSP_LCD_SetTextColor(circleButtons[i].isPressed ? LCD_COLOR_LIGHTGREEN : LCD_COLOR_LIGHTGRAY);
-    BSP_LCD_FillCircle(circleButtons[i].x, circleButtons[i].y, circleButtons[i].radius - 3);
+/**
+ * @brief  Draws the EQ response as a polyline, one fill per segment spanning
+ *         the rows between its two points. Fills outside the rectangle being
+ *         redrawn are skipped by the compositor.
+ * @param  None
+ * @retval None
+ */
+static void LCD_RenderResponseCurve(void)
+{
+  SliderKnob* first = &sliderKnobs[0];
 
-    BSP_LCD_SetTextColor(LCD_COLOR_BLACK);
-    BSP_LCD_SetBackColor(LCD_COLOR_WHITE);
-    BSP_LCD_DisplayStringAt(circleButtons[i].x - circleButtons[i].radius - 12, circleButtons[i].y - circleButtons[i].radius - 24, (uint8_t *)circleButtons[i].onText, LEFT_MODE);
+  if(!LcdCompositor_IsVisible(first->sliderX, first->sliderY, NUMBER_OF_SLIDER_BUTTONS * first->sliderWidth, first->sliderHeight))
+    return;
 
+  for(uint16_t i = 0; i + 1 < DSP_RESPONSE_POINTS; i++)
+  {
+    int16_t x = LCD_CurveX(i);
+    int16_t top = (curveY[i] < curveY[i + 1]) ? curveY[i] : curveY[i + 1];
+    int16_t bottom = (curveY[i] < curveY[i + 1]) ? curveY[i + 1] : curveY[i];
 
+    LcdCompositor_FillRect(x, top - CURVE_HALF_WIDTH, LCD_CurveX(i + 1) - x + 1, bottom - top + 2 * CURVE_HALF_WIDTH + 1, CURVE_COLOR);
   }
-
 }
 
 /**
- * @brief  Copy and convert image (LAYER_SIZE_X, LAYER_SIZE_Y) of format RGB565
- * to LCD frame buffer area centered in WVGA resolution.
- * The area of copy is of size (LAYER_SIZE_X, LAYER_SIZE_Y) in ARGB8888.
- * @param  pSrc: Pointer to source buffer : source image buffer start here
- * @param  pDst: Pointer to destination buffer LCD frame buffer center area start here
- * @param  xSize: Buffer width (LAYER_SIZE_X here)
- * @param  ySize: Buffer height (LAYER_SIZE_Y here)
- * @retval LCD Status : LCD_OK or LCD_ERROR
+ * @brief  Draws the spectrum in the frame of the sliders, one fill per bar
+ *         from its top to the bottom of the frame, and the frequency labels
+ *         above it at their place on the log scale.
+ * @param  None
+ * @retval None
  */
-static uint8_t CopyImageToLcdFrameBuffer(void *pSrc, void *pDst, uint32_t xSize, uint32_t ySize, uint16_t x, uint16_t y)
+static void LCD_RenderSpectrum(void)
 {
+  SliderKnob* first = &sliderKnobs[0];
+  int16_t width = NUMBER_OF_SLIDER_BUTTONS * first->sliderWidth;
+  int16_t bottom = first->sliderY + first->sliderHeight;
+  const float labelFrequencies[] = { 100, 1000, 10000 };
+  const char* labels[] = { "100", "1k", "10k" };
+
+  for(uint8_t i = 0; i < sizeof(labels) / sizeof(labels[0]); i++)
+  {
+    int16_t x = LCD_SpectrumX(labelFrequencies[i]) - strlen(labels[i]) * LCD_FONT.Width / 2;
+    LcdCompositor_DrawString(x, 0, (char*)labels[i], &LCD_FONT, LCD_COLOR_BLACK, LCD_COLOR_WHITE, LEFT_MODE);
+  }
+
+  LcdCompositor_FillRect(first->sliderX - 2, first->sliderY - 2, width + 4, first->sliderHeight + 4, LCD_COLOR_BLACK);
+
+  if(!LcdCompositor_IsVisible(first->sliderX, first->sliderY, width, first->sliderHeight))
+    return;
 
-  uint32_t destination = (uint32_t)pDst + (y * 800 + x) * 4;
-  DMA2D_HandleTypeDef hdma2d_discovery;
-  HAL_StatusTypeDef hal_status = HAL_OK;
-  uint8_t lcd_status = LCD_ERROR;
-
-  // Configure the DMA2D Mode, Color Mode and output offset
-  hdma2d_discovery.Init.Mode         = DMA2D_M2M_PFC;
-  hdma2d_discovery.Init.ColorMode    = DMA2D_OUTPUT_ARGB8888;// Output color out of PFC
-  hdma2d_discovery.Init.AlphaInverted = DMA2D_REGULAR_ALPHA; // No Output Alpha Inversion
-  hdma2d_discovery.Init.RedBlueSwap   = DMA2D_RB_REGULAR;// No Output Red & Blue swap
-
-  // Output offset in pixels == nb of pixels to be added at end of line to come to the
-  // first pixel of the next line : on the output side of the DMA2D computation
-  // TODO: GENERALIZE
-  hdma2d_discovery.Init.OutputOffset = (WVGA_RES_X - UTFPR_LOGO_WIDTH);
-
-  // Foreground Configuration
-  hdma2d_discovery.LayerCfg[1].AlphaMode = DMA2D_NO_MODIF_ALPHA;
-  hdma2d_discovery.LayerCfg[1].InputAlpha = 0xFF; // fully opaque
-  hdma2d_discovery.LayerCfg[1].InputColorMode = DMA2D_INPUT_RGB565;
-  hdma2d_discovery.LayerCfg[1].InputOffset = 0;
-  hdma2d_discovery.LayerCfg[1].RedBlueSwap = DMA2D_RB_REGULAR; // No ForeGround Red/Blue swap
-  hdma2d_discovery.LayerCfg[1].AlphaInverted = DMA2D_REGULAR_ALPHA; // No ForeGround Alpha inversion
-
-  hdma2d_discovery.Instance = DMA2D;
-
-  // DMA2D Initialization
-  if(HAL_DMA2D_Init(&hdma2d_discovery) == HAL_OK)
+  LcdCompositor_FillRect(first->sliderX, first->sliderY, width, first->sliderHeight, LCD_COLOR_WHITE);
+
+  for(uint8_t i = 0; i < SPECTRUM_BARS; i++)
   {
-    if(HAL_DMA2D_ConfigLayer(&hdma2d_discovery, 1) == HAL_OK)
+    if(spectrumTop[i] < bottom)
+      LcdCompositor_FillRect(first->sliderX + i * SPECTRUM_BAR_WIDTH + SPECTRUM_BAR_GAP / 2, spectrumTop[i],
+        SPECTRUM_BAR_WIDTH - SPECTRUM_BAR_GAP, bottom - spectrumTop[i], SPECTRUM_COLOR);
+  }
+}
+
+static void LCD_RenderCircleButton(CircleButtonTypeDef* button)
+{
+  // draws button border and inner circle
+  LcdCompositor_DrawSprite(&button->sprites[button->isPressed], button->x - button->radius, button->y - button->radius);
+
+  LcdCompositor_DrawString(button->x - button->radius - 12, button->y - button->radius - 24, button->onText, &LCD_FONT, LCD_COLOR_BLACK, LCD_COLOR_WHITE, LEFT_MODE);
+}
+
+static void LCD_RenderRectangleButton(RectangleButton* button)
+{
+  LcdCompositor_DrawSprite(&button->sprites[button->isActive], button->x - BUTTON_BORDER_SIZE, button->y - BUTTON_BORDER_SIZE);
+}
+
+static void LCD_RenderSlider(uint8_t knobIndex)
+{
+  SliderKnob* knob = &sliderKnobs[knobIndex];
+
+  if(LcdCompositor_IsVisible(knob->sliderX, knob->sliderY, knob->sliderWidth, knob->sliderHeight))
+  {
+    LcdCompositor_FillRect(knob->sliderX, knob->sliderY, knob->sliderWidth, knob->sliderHeight, LCD_COLOR_WHITE);
+    LcdCompositor_FillRect((knob->sliderX + (knob->sliderWidth / 2)-5), knob->sliderY + 10, 10, knob->sliderHeight - 20, knob->sliderColor);
+
+    // near the ends of the track the sprite margin would cover them
+    if(LCD_KnobSpriteFits(knob, knob->knobY))
     {
-      if (HAL_DMA2D_Start(&hdma2d_discovery, (uint32_t)pSrc, destination, xSize, ySize) == HAL_OK)
-      {
-        // Polling For DMA transfer
-        hal_status = HAL_DMA2D_PollForTransfer(&hdma2d_discovery, 10);
-        if(hal_status == HAL_OK)
-        {
-          // return good status on exit
-          lcd_status = LCD_OK;
-        }
-      }
+      LcdCompositor_DrawSprite(&knobSprite, knob->sliderX + 3, knob->knobY - 5 - KNOB_SPRITE_MARGIN);
+    }
+    else
+    {
+      LcdCompositor_FillRect(knob->sliderX + 3, knob->knobY - 5, knob->sliderWidth - 3, KNOB_HEIGHT, knob->sliderColor);
+      LcdCompositor_FillRect(knob->sliderX + 5, knob->knobY - 3, knob->sliderWidth - 7, 8, LCD_COLOR_WHITE);
     }
   }
 
-  return(lcd_status);
+  LcdCompositor_DrawSprite(&gainLabelSprites[LCD_KnobGain(knob, knob->knobY) - GAIN_MIN], knob->sliderX, KNOB_LABEL_Y);
 }
 
-
 void LCD_DisplayPlusButton(uint8_t buttonIndex)
 {
   IncrementButton* button = &plusButtons[buttonIndex];
 
+  // drawn through the BSP, which shares DMA2D with the compositor
+  LcdCompositor_WaitIdle();
+
   BSP_LCD_SetTextColor(button->color);
   BSP_LCD_FillRect(button->x, button->y, button->width, button->height);
 
@@ -314,57 +487,248 @@ void LCD_DisplayPlusButton(uint8_t buttonIndex)
   BSP_LCD_DisplayStringAt(button->x + button->width + 5, button->y + button->height - 20, (uint8_t *)button->text, LEFT_MODE);
 }
 
-void LCD_UpdateRectangleButton(RectangleButton* button)
+/**
+ * @brief  Puts the widgets on the touch map, with the areas the touch handler
+ *         always tested: inside the circle's bounding square, inside the
+ *         buttons' borders, and the slider tracks but for 10 rows at each end.
+ * @param  None
+ * @retval true if every widget fitted on the map
+ */
+bool LCD_AddTouchWidgets(void)
 {
-  BSP_LCD_SetTextColor(LCD_COLOR_BLACK);
-  BSP_LCD_FillRect(button->x - BUTTON_BORDER_SIZE, button->y - BUTTON_BORDER_SIZE, button->width + (2*BUTTON_BORDER_SIZE), button->height + (2*BUTTON_BORDER_SIZE));
-  BSP_LCD_SetTextColor(button->isActive ? button->activeColor : button->inactiveColor);
-  BSP_LCD_FillRect(button->x, button->y, button->width, button->height);
+  RectangleButton* buttons[] = { &saveButton, &undoButton, &resetButton };
+  bool added = true;
 
-  BSP_LCD_SetBackColor(button->isActive ? button->activeColor : button->inactiveColor);
-  BSP_LCD_SetTextColor(LCD_COLOR_BLACK);
-  BSP_LCD_DisplayStringAt(button->x + 5, button->y + button->height / 2 - 6, (uint8_t *)button->text, LEFT_MODE);
+  TouchMap_Reset();
+
+  for(uint8_t i = 0; i < NUMBER_OF_CIRCLE_BUTTONS; i++)
+  {
+    CircleButtonTypeDef* button = &circleButtons[i];
+    added &= TouchMap_Add(TOUCH_WIDGET_CIRCLE_BUTTON, i, button->x - button->radius + 1, button->y - button->radius + 1,
+      2 * button->radius - 1, 2 * button->radius - 1);
+  }
+
+  for(uint8_t i = 0; i < sizeof(buttons) / sizeof(buttons[0]); i++)
+    added &= TouchMap_Add(TOUCH_WIDGET_RECTANGLE_BUTTON, i, buttons[i]->x + 1, buttons[i]->y + 1, buttons[i]->width - 1, buttons[i]->height - 1);
+
+  for(uint8_t i = 0; i < NUMBER_OF_SLIDER_BUTTONS; i++)
+  {
+    SliderKnob* knob = &sliderKnobs[i];
+    added &= TouchMap_Add(TOUCH_WIDGET_SLIDER, i, knob->sliderX + 1, knob->sliderY + 11, knob->sliderWidth - 1, knob->sliderHeight - 21);
+  }
+
+  return added;
+}
+
+void LCD_UpdateRectangleButton(RectangleButton* button)
+{
+  LcdCompositor_Invalidate(button->x - BUTTON_BORDER_SIZE, button->y - BUTTON_BORDER_SIZE, button->width + (2*BUTTON_BORDER_SIZE), button->height + (2*BUTTON_BORDER_SIZE));
 }
 
 void LCD_InitSlider(uint8_t knobIndex)
 {
   SliderKnob* knob = &sliderKnobs[knobIndex];
 
-  BSP_LCD_SetTextColor(LCD_COLOR_WHITE);
-  BSP_LCD_FillRect(knob->sliderX, knob->sliderY, knob->sliderWidth, knob->sliderHeight);
-
-  BSP_LCD_SetTextColor(knob->sliderColor);
-  BSP_LCD_FillRect((knob->sliderX + (knob->sliderWidth / 2)-5), knob->sliderY + 10, 10, knob->sliderHeight - 20);
+  LcdCompositor_Invalidate(knob->sliderX, knob->sliderY, knob->sliderWidth, knob->sliderHeight);
 }
 
 void LCD_DisplayKnob(uint8_t knobIndex, uint16_t newKnobY)
 {
   SliderKnob* knob = &sliderKnobs[knobIndex];
 
-  // clears the previous spot if it moved
+  // only the previous spot, the new one and the gain label if it changed are
+  // redrawn; when the new sprite covers the previous spot it is all redrawn
   if(newKnobY != knob->knobY)
   {
-    BSP_LCD_SetTextColor(LCD_COLOR_WHITE);
-    BSP_LCD_FillRect(knob->sliderX + 3, knob->knobY - 5, knob->sliderWidth - 3, 12);
+    LCD_InvalidateKnob(knob, knob->knobY, 0);
+    LCD_InvalidateKnob(knob, newKnobY, LCD_KnobSpriteFits(knob, newKnobY) ? KNOB_SPRITE_MARGIN : 0);
+    if(LCD_KnobGain(knob, newKnobY) != LCD_KnobGain(knob, knob->knobY))
+      LcdCompositor_Invalidate(knob->sliderX, KNOB_LABEL_Y, KNOB_LABEL_LENGTH * LCD_FONT.Width, LCD_FONT.Height);
+  }
+
+  knob->knobY = newKnobY;
+}
+
+/**
+ * @brief  Takes a new EQ response and redraws the part of the curve that
+ *         moved: the segments next to the points that changed row, between
+ *         their old and new rows. Off the EQ screen only the rows are kept.
+ * @param  magnitude: DSP_RESPONSE_POINTS values in dB, lowest frequency first
+ * @retval None
+ */
+void LCD_UpdateResponseCurve(const float* magnitude)
+{
+  int16_t first = -1;
+  int16_t last = -1;
+  int16_t top = LCD_SCREEN_HEIGHT;
+  int16_t bottom = 0;
+
+  for(uint16_t i = 0; i < DSP_RESPONSE_POINTS; i++)
+  {
+    int16_t y = LCD_CurveY(magnitude[i]);
+    int16_t low = (y < curveY[i]) ? y : curveY[i];
+    int16_t high = (y < curveY[i]) ? curveY[i] : y;
 
-    BSP_LCD_SetTextColor(knob->sliderColor);
-    BSP_LCD_FillRect((knob->sliderX + (knob->sliderWidth / 2)-5), knob->knobY - 5, 10, 12);
+    if(y == curveY[i])
+      continue;
+
+    if(first < 0)
+      first = i;
+    last = i;
+
+    if(low < top)
+      top = low;
+    if(high > bottom)
+      bottom = high;
+
+    curveY[i] = y;
   }
 
-  BSP_LCD_SetTextColor(knob->sliderColor);
-  BSP_LCD_FillRect(knob->sliderX + 3, newKnobY - 5, knob->sliderWidth - 3, 12);
+  if(first < 0 || !circleButtons[0].isActive)
+    return;
 
-  BSP_LCD_SetTextColor(LCD_COLOR_WHITE);
-  BSP_LCD_FillRect(knob->sliderX + 5, newKnobY - 3, knob->sliderWidth - 7, 8);
+  if(first > 0)
+    first--;
+  if(last < DSP_RESPONSE_POINTS - 1)
+    last++;
 
-  knob->knobY = newKnobY;
+  LcdCompositor_Invalidate(LCD_CurveX(first), top - CURVE_HALF_WIDTH, LCD_CurveX(last) - LCD_CurveX(first) + 1,
+    bottom - top + 2 * CURVE_HALF_WIDTH + 1);
+}
+
+/**
+ * @brief  Takes new spectrum levels and redraws the bars that changed height,
+ *         in one rectangle from the first to the last of them between their
+ *         highest and lowest tops. Off the spectrum screen only the tops are
+ *         kept.
+ * @param  bars: SPECTRUM_BARS levels in dBFS, lowest frequency first
+ * @retval None
+ */
+void LCD_UpdateSpectrum(const float* bars)
+{
+  int16_t first = -1;
+  int16_t last = -1;
+  int16_t top = LCD_SCREEN_HEIGHT;
+  int16_t bottom = 0;
+
+  for(uint8_t i = 0; i < SPECTRUM_BARS; i++)
+  {
+    int16_t y = LCD_SpectrumY(bars[i]);
+    int16_t low = (y < spectrumTop[i]) ? y : spectrumTop[i];
+    int16_t high = (y < spectrumTop[i]) ? spectrumTop[i] : y;
+
+    if(y == spectrumTop[i])
+      continue;
+
+    if(first < 0)
+      first = i;
+    last = i;
+
+    if(low < top)
+      top = low;
+    if(high > bottom)
+      bottom = high;
+
+    spectrumTop[i] = y;
+  }
+
+  if(first < 0 || !LCD_IsSpectrumShown())
+    return;
+
+  LcdCompositor_Invalidate(sliderKnobs[0].sliderX + first * SPECTRUM_BAR_WIDTH, top, (last - first + 1) * SPECTRUM_BAR_WIDTH, bottom - top);
+}
+
+/**
+ * @brief  Tells whether the spectrum screen is shown, the analyzer only runs
+ *         then.
+ * @param  None
+ * @retval true on the spectrum screen
+ */
+bool LCD_IsSpectrumShown(void)
+{
+  return circleButtons[1].isActive && !circleButtons[0].isActive;
+}
 
+static void LCD_InvalidateKnob(SliderKnob* knob, uint16_t knobY, uint16_t margin)
+{
+  LcdCompositor_Invalidate(knob->sliderX + 3, knobY - 5 - margin, knob->sliderWidth - 3, KNOB_HEIGHT + 2 * margin);
+}
+
+static bool LCD_KnobSpriteFits(SliderKnob* knob, uint16_t knobY)
+{
+  return knobY - 5 - KNOB_SPRITE_MARGIN >= knob->sliderY + 10 &&
+         knobY + 7 + KNOB_SPRITE_MARGIN <= knob->sliderY + knob->sliderHeight - 10;
+}
+
+static int16_t LCD_CurveX(uint16_t point)
+{
+  SliderKnob* first = &sliderKnobs[0];
+
+  return first->sliderX + point * (NUMBER_OF_SLIDER_BUTTONS * first->sliderWidth - 1) / (DSP_RESPONSE_POINTS - 1);
+}
+
+/**
+ * @brief  Row of a magnitude on the scale of the sliders, GAIN_MAX at the top
+ *         of the track and GAIN_MIN at the bottom, clamped to the track.
+ * @param  magnitude: in dB
+ * @retval screen row
+ */
+static int16_t LCD_CurveY(float magnitude)
+{
+  SliderKnob* first = &sliderKnobs[0];
+  int16_t top = first->sliderY + CURVE_HALF_WIDTH;
+  int16_t bottom = first->sliderY + first->sliderHeight - 1 - CURVE_HALF_WIDTH;
+
+  if(magnitude >= GAIN_MAX)
+    return top;
+  if(magnitude <= GAIN_MIN)
+    return bottom;
+
+  return first->sliderY + (int16_t)((GAIN_MAX - magnitude) * first->sliderHeight / (GAIN_MAX - GAIN_MIN) + 0.5f);
+}
+
+static int16_t LCD_SpectrumX(float frequency)
+{
+  float position = logf(frequency / SPECTRUM_MIN_FREQUENCY) / logf(SPECTRUM_MAX_FREQUENCY / SPECTRUM_MIN_FREQUENCY);
+
+  return sliderKnobs[0].sliderX + (int16_t)(position * SPECTRUM_BARS * SPECTRUM_BAR_WIDTH + 0.5f);
+}
+
+/**
+ * @brief  Row of the top of a bar, 0 dBFS at the top of the frame and
+ *         SPECTRUM_MIN_DB at its bottom, where the bar is empty.
+ * @param  level: in dBFS
+ * @retval screen row
+ */
+static int16_t LCD_SpectrumY(float level)
+{
+  SliderKnob* first = &sliderKnobs[0];
+
+  if(level >= 0)
+    return first->sliderY;
+  if(level <= SPECTRUM_MIN_DB)
+    return first->sliderY + first->sliderHeight;
+
+  return first->sliderY + (int16_t)(level * first->sliderHeight / SPECTRUM_MIN_DB + 0.5f);
+}
+
+static int16_t LCD_KnobGain(SliderKnob* knob, uint16_t knobY)
+{
   double inputMin = knob->sliderY;
   double inputMax = knob->sliderY + knob->sliderHeight;
-  double outputMax = 15;
-  double outputMin = -15;
-  int16_t newGain = outputMax + (knob->knobY - inputMin) * (outputMin - outputMax) / (inputMax - inputMin);
-  char text[5];
+  double outputMax = GAIN_MAX;
+  double outputMin = GAIN_MIN;
+  int16_t gain = outputMax + (knobY - inputMin) * (outputMin - outputMax) / (inputMax - inputMin);
+
+  if(gain < GAIN_MIN)
+    return GAIN_MIN;
+  if(gain > GAIN_MAX)
+    return GAIN_MAX;
+  return gain;
+}
+
+static void LCD_FormatGain(int16_t newGain, char* text)
+{
   if(newGain <= -10)
     sprintf(text, "%03i", newGain);
   else if(newGain < 0)
@@ -373,13 +737,9 @@ void LCD_DisplayKnob(uint8_t knobIndex, uint16_t newKnobY)
     sprintf(text, "  %01i", newGain);
   else
     sprintf(text, " %02i", newGain);
-
-  BSP_LCD_SetBackColor(LCD_COLOR_WHITE);
-  BSP_LCD_SetTextColor(LCD_COLOR_BLACK);
-  BSP_LCD_DisplayStringAt(knob->sliderX, 450, (uint8_t *)text, LEFT_MODE);
 }
 
-int16_t LCD_TranslateGainToKnobPosition(uint8_t knobIndex, uint16_t gain)
+int16_t LCD_TranslateGainToKnobPosition(uint8_t knobIndex, int16_t gain)
 {
   SliderKnob* knob = &sliderKnobs[knobIndex];
   double outputMin = knob->sliderY;
@@ -397,23 +757,28 @@ void LCD_UpdateButton(uint8_t buttonIndex, bool isPressed, bool shouldToggleOthe
 
   button->isPressed = isPressed;
   button->isActive = isPressed;
+
+  // each button opens a screen, pressing one closes the others
+  if(shouldToggleOtherButtons && isPressed)
+  {
+    for(uint8_t i = 0; i < NUMBER_OF_CIRCLE_BUTTONS; i++)
+    {
+      if(i != buttonIndex && !circleButtons[i].isIndependent)
+      {
+        circleButtons[i].isPressed = false;
+        circleButtons[i].isActive = false;
+      }
+    }
+  }
+
   LCD_UpdateState();
 }
 
 void LCD_UpdateWatchdog (uint32_t* watchdogCounter)
 {
-  char text[5];
-  sprintf(text, "%04u", ((unsigned int)*watchdogCounter));
-  BSP_LCD_SetBackColor(LCD_COLOR_WHITE);
-  BSP_LCD_SetTextColor(LCD_COLOR_BLACK);
-  BSP_LCD_DisplayStringAt(0, 0, (uint8_t *)text, RIGHT_MODE);
+  sprintf(watchdogText, "%04u", ((unsigned int)*watchdogCounter));
+  LcdCompositor_Invalidate((LCD_SCREEN_WIDTH / LCD_FONT.Width - WATCHDOG_LENGTH) * LCD_FONT.Width, 0, WATCHDOG_LENGTH * LCD_FONT.Width, LCD_FONT.Height);
   *watchdogCounter = *watchdogCounter + 1;
   if(*watchdogCounter > 9999)
     *watchdogCounter = 0;
 }
-
-
-void BSP_LCD_DrawPicture(const uint8_t* image, uint32_t width, uint32_t height, uint32_t xPosition, uint32_t yPosition )
-{
-  CopyImageToLcdFrameBuffer((void*)image, (void*)(LCD_FRAME_BUFFER), width, height, xPosition, yPosition);
-}
@@ -0,0 +1,64 @@
+/**
+  ******************************************************************************
+  * @file    logger.h
+  * @brief   Non-blocking logger drained over the USART1 TX DMA.
+  *          Producers (main loop or ISRs) only copy the format pointer and up to
+  *          LOGGER_MAX_ARGS integer arguments into a lock-free ring, the text is
+  *          expanded later by Logger_Process() from the main loop.
+  ******************************************************************************
+  */
+
+// define to prevent recursive inclusion ---------------------------------------
+#ifndef __LOGGER_H__
+#define __LOGGER_H__
+
+// includes --------------------------------------------------------------------
+#include <stdint.h>
+#include <stdbool.h>
+
+// defines ---------------------------------------------------------------------
+
+// number of pending messages, must be a power of two
+#define LOGGER_RING_SIZE        64
+// maximum number of arguments stored with each message
+#define LOGGER_MAX_ARGS         4
+// size of the DMA transmit buffer, one drain never sends more than this
+#define LOGGER_TX_BUFFER_SIZE   512
+
+// counts the arguments passed to LOG (0 to LOGGER_MAX_ARGS)
+#define LOGGER_ARG_COUNT(...)   LOGGER_ARG_COUNT_(0, ##__VA_ARGS__, 4, 3, 2, 1, 0)
+#define LOGGER_ARG_COUNT_(_0, _1, _2, _3, _4, count, ...) count
+
+// queues a message, the format string must have static storage and arguments
+// must be integers or pointers to static strings (%d, %u, %x, %c, %s)
+#define LOG(format, ...) \
+  Logger_Write((format), LOGGER_ARG_COUNT(__VA_ARGS__), ##__VA_ARGS__)
+
+// queues a message at most once every periodMs milliseconds for this call site
+#define LOG_RATE_LIMITED(periodMs, format, ...)                     \
+  do                                                                \
+  {                                                                 \
+    static uint32_t logNextTick = 0;                                \
+    if(Logger_RateLimitAllows(&logNextTick, (periodMs)))            \
+      LOG(format, ##__VA_ARGS__);                                   \
+  } while(0)
+
+// typedefs --------------------------------------------------------------------
+typedef struct LoggerStats
+{
+  uint32_t written;     // messages accepted into the ring
+  uint32_t dropped;     // messages lost because the ring was full
+  uint32_t suppressed;  // messages skipped by LOG_RATE_LIMITED
+  uint32_t truncated;   // messages longer than LOGGER_TX_BUFFER_SIZE, cut on expansion
+  uint32_t retried;     // transfers the USART refused, sent again from the buffer
+} LoggerStats;
+
+// function prototypes ---------------------------------------------------------
+void Logger_Init(void);
+bool Logger_Write(const char* format, uint8_t argCount, ...);
+bool Logger_RateLimitAllows(uint32_t* nextTick, uint32_t periodMs);
+void Logger_Process(void);
+void Logger_Flush(uint32_t timeoutMs);
+void Logger_GetStats(LoggerStats* out);
+
+#endif // __LOGGER_H__
@@ -13,9 +13,26 @@
 // includes --------------------------------------------------------------------
 #include "stm32f7xx.h"
 #include "audio_node.h"
+#include <stdbool.h>
+
+// defines ---------------------------------------------------------------------
+
+// USART1 runs from PCLK2 (100 MHz); above PCLK2 / 16 the peripheral switches to
+// 8x oversampling, which allows up to 12.5 Mbaud
+#define USART1_BAUD_RATE          115200
+
+// USART1_TX is only routed to DMA2 stream 7 channel 4 (shared with the DFSDM
+// bottom right microphone, unused by the playback build)
+#define USART1_TX_DMA_STREAM      DMA2_Stream7
+#define USART1_TX_DMA_CHANNEL     DMA_CHANNEL_4
+#define USART1_TX_DMA_IRQn        DMA2_Stream7_IRQn
+#define USART1_TX_DMA_IRQHandler  DMA2_Stream7_IRQHandler
+#define USART1_IRQ_PREPRIO        12
 
 extern UART_HandleTypeDef UART1_Handle;
 
 void USART1_UART_Init(void);
+bool USART1_TransmitDMA(uint8_t* data, uint16_t length);
+bool USART1_IsTransmitting(void);
 
 #endif // __USART_H__
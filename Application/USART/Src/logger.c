@@ -0,0 +1,261 @@
+/**
+  ******************************************************************************
+  * @file    logger.c
+  * @brief   Non-blocking logger: lock-free multi-producer ring, deferred
+  *          formatting and USART1 TX DMA drain.
+  ******************************************************************************
+  */
+
+#include "logger.h"
+#include "usart.h"
+#include <stdarg.h>
+#include <stdio.h>
+
+// private defines -------------------------------------------------------------
+#define LOGGER_RING_MASK        (LOGGER_RING_SIZE - 1)
+#define LOGGER_CACHE_LINE_SIZE  32
+#define LOGGER_DROP_NOTICE_SIZE 48
+
+#if (LOGGER_RING_SIZE & LOGGER_RING_MASK) != 0
+#error "LOGGER_RING_SIZE must be a power of two"
+#endif
+
+// private typedefs ------------------------------------------------------------
+
+// a slot is free for the producer at position p when sequence == p and holds a
+// committed message for the consumer when sequence == p + 1
+typedef struct LoggerEntry
+{
+  volatile uint32_t sequence;
+  const char*       format;
+  uint32_t          args[LOGGER_MAX_ARGS];
+} LoggerEntry;
+
+// private variables -----------------------------------------------------------
+static LoggerEntry ring[LOGGER_RING_SIZE];
+static volatile uint32_t ringHead = 0;  // next position reserved by producers
+static uint32_t ringTail          = 0;  // next position read by Logger_Process
+static LoggerStats stats;
+static uint32_t reportedDrops     = 0;
+// bytes expanded into txBuffer that the USART has not taken yet
+static uint32_t txLength          = 0;
+
+// the buffer is read by the DMA, so it is kept aligned to whole cache lines
+static uint8_t txBuffer[LOGGER_TX_BUFFER_SIZE] __attribute__((aligned(LOGGER_CACHE_LINE_SIZE)));
+
+// private function declarations -----------------------------------------------
+static uint32_t Logger_Fill(void);
+static uint32_t Logger_Expand(const LoggerEntry* entry, uint32_t offset);
+
+/**
+ * @brief  Resets the ring, must be called before the USART1 DMA is used.
+ * @param  None
+ * @retval None
+ */
+void Logger_Init(void)
+{
+  for(uint32_t i = 0; i < LOGGER_RING_SIZE; i++)
+    ring[i].sequence = i;
+
+  ringHead = 0;
+  ringTail = 0;
+  reportedDrops = 0;
+  txLength = 0;
+  stats = (LoggerStats){0};
+}
+
+/**
+ * @brief  Queues a message without formatting it. Safe from any interrupt
+ *         priority, never waits: when the ring is full the message is dropped
+ *         and counted.
+ * @param  format: printf format with static storage
+ * @param  argCount: number of 32-bit arguments that follow
+ * @retval true if the message was queued
+ */
+bool Logger_Write(const char* format, uint8_t argCount, ...)
+{
+  uint32_t position = __atomic_load_n(&ringHead, __ATOMIC_RELAXED);
+  LoggerEntry* entry;
+
+  // reserves a slot, retrying only when another producer preempted us
+  for(;;)
+  {
+    entry = &ring[position & LOGGER_RING_MASK];
+    int32_t difference = (int32_t)(__atomic_load_n(&entry->sequence, __ATOMIC_ACQUIRE) - position);
+
+    if(difference == 0)
+    {
+      if(__atomic_compare_exchange_n(&ringHead, &position, position + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+        break;
+    }
+    else if(difference < 0)
+    {
+      __atomic_fetch_add(&stats.dropped, 1, __ATOMIC_RELAXED);
+      return false;
+    }
+    else
+    {
+      position = __atomic_load_n(&ringHead, __ATOMIC_RELAXED);
+    }
+  }
+
+  if(argCount > LOGGER_MAX_ARGS)
+    argCount = LOGGER_MAX_ARGS;
+
+  va_list args;
+  va_start(args, argCount);
+  entry->format = format;
+  for(uint8_t i = 0; i < LOGGER_MAX_ARGS; i++)
+    entry->args[i] = (i < argCount) ? va_arg(args, uint32_t) : 0;
+  va_end(args);
+
+  // publishes the slot to the consumer
+  __atomic_store_n(&entry->sequence, position + 1, __ATOMIC_RELEASE);
+  __atomic_fetch_add(&stats.written, 1, __ATOMIC_RELAXED);
+
+  return true;
+}
+
+/**
+ * @brief  Rate limiter used by LOG_RATE_LIMITED, one state word per call site.
+ * @param  nextTick: tick from which the next message is allowed
+ * @param  periodMs: minimum interval between two messages
+ * @retval true if the message may be logged
+ */
+bool Logger_RateLimitAllows(uint32_t* nextTick, uint32_t periodMs)
+{
+  uint32_t now = HAL_GetTick();
+
+  if((int32_t)(now - *nextTick) < 0)
+  {
+    __atomic_fetch_add(&stats.suppressed, 1, __ATOMIC_RELAXED);
+    return false;
+  }
+
+  *nextTick = now + periodMs;
+  return true;
+}
+
+/**
+ * @brief  Expands queued messages into the transmit buffer and starts the DMA.
+ *         Called from the main loop only; returns at once while a transfer is
+ *         still running. A batch the USART refuses, busy with another
+ *         sender or failing to start, stays in the buffer and is sent again
+ *         before anything new is expanded.
+ * @param  None
+ * @retval None
+ */
+void Logger_Process(void)
+{
+  if(USART1_IsTransmitting())
+    return;
+
+  if(txLength == 0)
+  {
+    txLength = Logger_Fill();
+    if(txLength == 0)
+      return;
+
+    SCB_CleanDCache_by_Addr((uint32_t*)txBuffer, (txLength + LOGGER_CACHE_LINE_SIZE - 1) & ~(LOGGER_CACHE_LINE_SIZE - 1));
+  }
+  else
+  {
+    stats.retried++;
+  }
+
+  if(USART1_TransmitDMA(txBuffer, txLength))
+    txLength = 0;
+}
+
+/**
+ * @brief  Drains the ring until it is empty, for start-up and error paths only.
+ * @param  timeoutMs: maximum time spent waiting
+ * @retval None
+ */
+void Logger_Flush(uint32_t timeoutMs)
+{
+  uint32_t start = HAL_GetTick();
+
+  while(HAL_GetTick() - start < timeoutMs)
+  {
+    Logger_Process();
+    if(!USART1_IsTransmitting() && txLength == 0 && ring[ringTail & LOGGER_RING_MASK].sequence != ringTail + 1)
+      return;
+  }
+}
+
+/**
+ * @brief  Copies the logger counters.
+ * @param  out: destination
+ * @retval None
+ */
+void Logger_GetStats(LoggerStats* out)
+{
+  out->written    = __atomic_load_n(&stats.written, __ATOMIC_RELAXED);
+  out->dropped    = __atomic_load_n(&stats.dropped, __ATOMIC_RELAXED);
+  out->suppressed = __atomic_load_n(&stats.suppressed, __ATOMIC_RELAXED);
+  out->truncated  = stats.truncated;
+  out->retried    = stats.retried;
+}
+
+/**
+ * @brief  Expands queued messages into the transmit buffer, and the count of
+ *         dropped ones if it changed.
+ * @param  None
+ * @retval bytes to send, 0 if there is nothing
+ */
+static uint32_t Logger_Fill(void)
+{
+  uint32_t length = 0;
+
+  while(length < LOGGER_TX_BUFFER_SIZE)
+  {
+    LoggerEntry* entry = &ring[ringTail & LOGGER_RING_MASK];
+    if(__atomic_load_n(&entry->sequence, __ATOMIC_ACQUIRE) != ringTail + 1)
+      break;
+
+    uint32_t expanded = Logger_Expand(entry, length);
+
+    // keeps the message for the next transfer if it does not fit behind others
+    if(length + expanded >= LOGGER_TX_BUFFER_SIZE)
+    {
+      if(length > 0)
+        break;
+
+      stats.truncated++;
+      expanded = LOGGER_TX_BUFFER_SIZE - 1;
+    }
+
+    length += expanded;
+
+    // hands the slot back to the producers
+    __atomic_store_n(&entry->sequence, ringTail + LOGGER_RING_SIZE, __ATOMIC_RELEASE);
+    ringTail++;
+  }
+
+  // messages are only dropped while the ring is full, so they are newer than
+  // everything sent so far and are reported once there is room behind them
+  uint32_t drops = __atomic_load_n(&stats.dropped, __ATOMIC_RELAXED);
+  if(drops != reportedDrops && length + LOGGER_DROP_NOTICE_SIZE <= LOGGER_TX_BUFFER_SIZE)
+  {
+    length += snprintf((char*)txBuffer + length, LOGGER_DROP_NOTICE_SIZE, "\r\n[logger] %lu messages dropped\r\n", (unsigned long)(drops - reportedDrops));
+    reportedDrops = drops;
+  }
+
+  return length;
+}
+
+/**
+ * @brief  Formats one message at the given offset of the transmit buffer.
+ * @param  entry: committed ring slot
+ * @param  offset: write position in txBuffer
+ * @retval length the full message needs, excluding the terminator
+ */
+static uint32_t Logger_Expand(const LoggerEntry* entry, uint32_t offset)
+{
+  // unused trailing arguments are zero and ignored by the format
+  int written = snprintf((char*)txBuffer + offset, LOGGER_TX_BUFFER_SIZE - offset, entry->format,
+                         entry->args[0], entry->args[1], entry->args[2], entry->args[3]);
+
+  return (written < 0) ? 0 : (uint32_t)written;
+}
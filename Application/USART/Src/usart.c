@@ -23,25 +23,70 @@ void Error_Handler(void);
 #define VCP_TX_Pin        GPIO_PIN_9
 
 UART_HandleTypeDef UART1_Handle;
+DMA_HandleTypeDef  UART1_TxDmaHandle;
+
+// set while a DMA transfer is in flight, cleared by the transfer complete callback
+static volatile bool isTransmitting = false;
 
 #define SEND_MANY_BUFFER_SIZE 100
 
 void USART1_UART_Init(void)
 {
     UART1_Handle.Instance           = USART1; 
-    UART1_Handle.Init.BaudRate      = 115200;
+    UART1_Handle.Init.BaudRate      = USART1_BAUD_RATE;
     UART1_Handle.Init.WordLength    = UART_WORDLENGTH_8B;
     UART1_Handle.Init.StopBits      = UART_STOPBITS_1;
     UART1_Handle.Init.Parity        = UART_PARITY_NONE;
     UART1_Handle.Init.Mode          = UART_MODE_TX_RX;
     UART1_Handle.Init.HwFlowCtl     = UART_HWCONTROL_NONE;
-    UART1_Handle.Init.OverSampling  = UART_OVERSAMPLING_16;
+    UART1_Handle.Init.OverSampling  = (USART1_BAUD_RATE > HAL_RCC_GetPCLK2Freq() / 16) ? UART_OVERSAMPLING_8 : UART_OVERSAMPLING_16;
     if (HAL_UART_Init(&UART1_Handle) != HAL_OK)
     {
         Error_Handler();
     }
 }
 
+/**
+ * @brief  Starts a DMA transfer on USART1, never waits for the line.
+ * @param  data: buffer that stays untouched until the transfer completes
+ * @param  length: number of bytes
+ * @retval false if a transfer is already running
+ */
+bool USART1_TransmitDMA(uint8_t* data, uint16_t length)
+{
+  if(isTransmitting)
+    return false;
+
+  isTransmitting = true;
+  if(HAL_UART_Transmit_DMA(&UART1_Handle, data, length) != HAL_OK)
+  {
+    isTransmitting = false;
+    return false;
+  }
+
+  return true;
+}
+
+bool USART1_IsTransmitting(void)
+{
+  return isTransmitting;
+}
+
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef* uartHandle)
+{
+  if(uartHandle->Instance == USART1)
+    isTransmitting = false;
+}
+
+void HAL_UART_ErrorCallback(UART_HandleTypeDef* uartHandle)
+{
+  if(uartHandle->Instance == USART1)
+  {
+    HAL_UART_DMAStop(uartHandle);
+    isTransmitting = false;
+  }
+}
+
 void HAL_UART_MspInit(UART_HandleTypeDef* uartHandle)
 {
 
@@ -74,9 +119,33 @@ void HAL_UART_MspInit(UART_HandleTypeDef* uartHandle)
     GPIO_InitStruct.Pin       = VCP_TX_Pin;
     GPIO_InitStruct.Mode      = GPIO_MODE_AF_PP;
     GPIO_InitStruct.Pull      = GPIO_NOPULL;
-    GPIO_InitStruct.Speed     = GPIO_SPEED_FREQ_LOW;
+    GPIO_InitStruct.Speed     = GPIO_SPEED_FREQ_VERY_HIGH;
     GPIO_InitStruct.Alternate = GPIO_AF7_USART1;
     HAL_GPIO_Init(VCP_TX_GPIO_Port, &GPIO_InitStruct);
+
+    // TX DMA, low priority so it never delays the audio streams
+    __HAL_RCC_DMA2_CLK_ENABLE();
+
+    UART1_TxDmaHandle.Instance                 = USART1_TX_DMA_STREAM;
+    UART1_TxDmaHandle.Init.Channel             = USART1_TX_DMA_CHANNEL;
+    UART1_TxDmaHandle.Init.Direction           = DMA_MEMORY_TO_PERIPH;
+    UART1_TxDmaHandle.Init.PeriphInc           = DMA_PINC_DISABLE;
+    UART1_TxDmaHandle.Init.MemInc              = DMA_MINC_ENABLE;
+    UART1_TxDmaHandle.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+    UART1_TxDmaHandle.Init.MemDataAlignment    = DMA_MDATAALIGN_BYTE;
+    UART1_TxDmaHandle.Init.Mode                = DMA_NORMAL;
+    UART1_TxDmaHandle.Init.Priority            = DMA_PRIORITY_LOW;
+    UART1_TxDmaHandle.Init.FIFOMode            = DMA_FIFOMODE_DISABLE;
+    if (HAL_DMA_Init(&UART1_TxDmaHandle) != HAL_OK)
+    {
+      Error_Handler();
+    }
+    __HAL_LINKDMA(uartHandle, hdmatx, UART1_TxDmaHandle);
+
+    HAL_NVIC_SetPriority(USART1_TX_DMA_IRQn, USART1_IRQ_PREPRIO, 0);
+    HAL_NVIC_EnableIRQ(USART1_TX_DMA_IRQn);
+    HAL_NVIC_SetPriority(USART1_IRQn, USART1_IRQ_PREPRIO, 0);
+    HAL_NVIC_EnableIRQ(USART1_IRQn);
   }
 }
 
@@ -89,5 +158,9 @@ void HAL_UART_MspDeInit(UART_HandleTypeDef* uartHandle)
     __HAL_RCC_USART1_CLK_DISABLE();
 
     HAL_GPIO_DeInit(GPIOA, VCP_RX_Pin|VCP_TX_Pin);
+
+    HAL_DMA_DeInit(uartHandle->hdmatx);
+    HAL_NVIC_DisableIRQ(USART1_TX_DMA_IRQn);
+    HAL_NVIC_DisableIRQ(USART1_IRQn);
   }
 }
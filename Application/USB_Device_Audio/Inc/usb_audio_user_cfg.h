@@ -53,7 +53,9 @@
 #define USB_AUDIO_CONFIG_PLAY_USE_FREQ_8_K            0 /* to set by user:  1 : to use , 0 to not support*/
 
 #define USE_AUDIO_TIMER_VOLUME_CTRL  0   
+#ifndef USB_AUDIO_CONFIG_PLAY_BUFFER_SIZE
 #define  USB_AUDIO_CONFIG_PLAY_BUFFER_SIZE (1024 * 10)   
+#endif /* USB_AUDIO_CONFIG_PLAY_BUFFER_SIZE */
 #endif /* USE_USB_AUDIO_PLAYBACK*/
  
 #if USE_USB_AUDIO_RECORDING   
@@ -34,6 +34,7 @@
 /* Includes ------------------------------------------------------------------*/
 #include "usbd_audio.h"
 #include "usbd_ctlreq.h"
+#include "eq_control.h"
 
 /** @addtogroup STM32_USB_DEVICE_LIBRARY
   * @{
@@ -105,6 +106,7 @@ typedef struct
   */
 #define AUDIO_UNIT_CONTROL_REQUEST 0x01
 #define AUDIO_EP_REQUEST 0x02
+#define AUDIO_VENDOR_REQUEST 0x03
 #if USBD_SUPPORT_AUDIO_OUT_FEEDBACK 
 #define USBD_AUDIO_SOF_COUNT_FEEDBACK_BITS 7
 #define USBD_AUDIO_SOF_COUNT_FEEDBACK (1 << USBD_AUDIO_SOF_COUNT_FEEDBACK_BITS)
@@ -158,6 +160,8 @@ static uint8_t  USBD_AUDIO_IsoOutIncomplete (USBD_HandleTypeDef *pdev, uint8_t e
 
 static uint8_t AUDIO_REQ(USBD_HandleTypeDef *pdev, USBD_SetupReqTypedef *req);
 
+static uint8_t AUDIO_VENDOR_REQ(USBD_HandleTypeDef *pdev, USBD_SetupReqTypedef *req);
+
 #if USBD_SUPPORT_AUDIO_MULTI_FREQUENCIES
 static uint8_t AUDIO_EP_REQ(USBD_HandleTypeDef *pdev, USBD_SetupReqTypedef *req);
 #endif /* USBD_SUPPORT_AUDIO_MULTI_FREQUENCIES*/
@@ -484,6 +488,20 @@ static uint8_t  USBD_AUDIO_Setup (USBD_HandleTypeDef *pdev,
     }
 #endif /*USBD_SUPPORT_AUDIO_MULTI_FREQUENCIES*/
     break;
+
+  case USB_REQ_TYPE_VENDOR:
+    /* EQ parameters from the host, device recipient only, once configured */
+    if(((req->bmRequest & USB_REQ_RECIPIENT_MASK) == USB_REQ_RECIPIENT_DEVICE) &&
+       (pdev->dev_state == USBD_STATE_CONFIGURED))
+    {
+      ret = AUDIO_VENDOR_REQ(pdev, req);
+    }
+    else
+    {
+      USBD_CtlError (pdev, req);
+      ret = USBD_FAIL;
+    }
+    break;
     
   case USB_REQ_TYPE_STANDARD:
     switch (req->bRequest)
@@ -644,6 +662,13 @@ static uint8_t  USBD_AUDIO_EP0_RxReady (USBD_HandleTypeDef *pdev)
     /* @TODO Manage this error */
     return USBD_OK;
   }
+  if(haudio->last_control.request_target == AUDIO_VENDOR_REQUEST)
+  {
+    /* the data was received in the buffer of the EQ control */
+    EqControl_DataReceived();
+    haudio->last_control.req = 0x00;
+    return USBD_OK;
+  }
   if(haudio->last_control.request_target == AUDIO_UNIT_CONTROL_REQUEST)
   {
     USBD_AUDIO_ControlTypeDef *ctl;
@@ -1031,6 +1056,47 @@ static uint8_t AUDIO_REQ(USBD_HandleTypeDef *pdev, USBD_SetupReqTypedef *req)
     }
   return USBD_OK;
 }
+/**
+  * @brief  AUDIO_VENDOR_REQ
+  *         Handles the vendor requests of the EQ control (eq_control_request.h).
+  * @param  pdev: instance
+  * @param  req: setup vendor request
+  * @retval status
+  */
+static uint8_t AUDIO_VENDOR_REQ(USBD_HandleTypeDef *pdev, USBD_SetupReqTypedef *req)
+{
+  USBD_AUDIO_HandleTypeDef   *haudio;
+  uint8_t *data;
+  int32_t len;
+
+  haudio = (USBD_AUDIO_HandleTypeDef*) pdev->pClassData;
+
+  /* reset last command */
+  haudio->last_control.req = 0x00;
+
+  len = EqControl_Setup(req->bRequest, (req->bmRequest & 0x80) != 0,
+                        req->wValue, req->wIndex, req->wLength, &data);
+  if(len == EQ_CONTROL_STALL)
+  {
+    /* request not supported, or not now */
+    USBD_CtlError (pdev, req);
+    return USBD_FAIL;
+  }
+
+  if(req->bmRequest & 0x80)
+  {
+    USBD_CtlSendData (pdev, data, len);
+    return USBD_OK;
+  }
+
+  /* set request, applied when the data stage is received */
+  haudio->last_control.request_target = AUDIO_VENDOR_REQUEST;
+  haudio->last_control.len = len;
+  haudio->last_control.req = req->bRequest;
+  USBD_CtlPrepareRx (pdev, data, len);
+  return USBD_OK;
+}
+
 #if USBD_SUPPORT_AUDIO_MULTI_FREQUENCIES
 /**
   * @brief  AUDIO_EP_REQ
@@ -57,6 +57,14 @@ void OTG_HS_IRQHandler(void);
 void AUDIO_DFSDMx_DMAx_TOP_LEFT_IRQHandler(void);
 void AUDIO_DFSDMx_DMAx_TOP_RIGHT_IRQHandler(void);
 void AUDIO_OUT_SAIx_DMAx_IRQHandler(void);
+void USART1_IRQHandler(void);
+void DMA2_Stream7_IRQHandler(void);
+void DMA2D_IRQHandler(void);
+void LTDC_IRQHandler(void);
+void EXTI15_10_IRQHandler(void);
+void I2C4_EV_IRQHandler(void);
+void I2C4_ER_IRQHandler(void);
+void FLASH_IRQHandler(void);
 #ifdef __cplusplus
 }
 #endif
@@ -1,20 +1,28 @@
 // includes --------------------------------------------------------------------
 #include "main.h"
-#include "stlogo.h"
 #include "usb_audio.h"
 #include "usart.h"
+#include "logger.h"
+#include "telemetry.h"
 #include "flash_persistence.h"
 #include "user_lcd.h"
+#include "audio_user_dsp_bench.h"
+#include "audio_user_dsp_response.h"
+#include "audio_user_dsp_fir.h"
+#include "spectrum.h"
+#include "scheduler.h"
+#include "touch_input.h"
+#include "isr_latency.h"
+#include "boot_time.h"
+#include "eq_control.h"
 
 // private variables -----------------------------------------------------------
 USBD_HandleTypeDef USBD_Device;
 // static int32_t pending_buffer   = -1;
 // static int32_t active_area      = INVALID_AREA;
 // static uint32_t ImageIndex      = 0;
-uint32_t watchdogTimer    = 0;
 uint32_t watchdogCounter  = 0;
 uint32_t serialTimer      = 0;
-uint32_t touchscreenTimer = 0;
 uint32_t serialSendTimer  = 0;
 bool shouldPrintSamples   = false;
 float in_z1               = 0;
@@ -26,8 +34,6 @@ uint8_t pColLeft[]        = {0x00, 0x00, 0x01, 0x8F}; // 0 -> 399
 uint8_t pColRight[]       = {0x01, 0x90, 0x03, 0x1F}; // 400 -> 799
 uint8_t pPage[]           = {0x00, 0x00, 0x01, 0xDF}; // 0 -> 479
 uint8_t pSyncLeft[]       = {0x02, 0x15};             // Scan @ 533
-extern int16_t frequencies[];
-extern int16_t bandwidths[];
 
 #if USE_AUDIO_TIMER_VOLUME_CTRL
 TIM_HandleTypeDef TimHandle;
@@ -35,11 +41,53 @@ TIM_HandleTypeDef TimHandle;
 uint32_t uwPrescalerValue = 0;
 #endif // USE_AUDIO_TIMER_VOLUME_CTRL
 
+// private defines -------------------------------------------------------------
+#define TOUCH_TASK_PERIOD_MS              10
+// a journal record takes a few flash interrupts, an erase about a second
+#define FLASH_TASK_PERIOD_MS              10
+// EQ sets from the host, one per period at most
+#define EQ_CONTROL_TASK_PERIOD_MS         10
+#define WATCHDOG_TASK_PERIOD_MS           500
+#define TELEMETRY_TASK_PERIOD_MS          (1000 / TELEMETRY_MAX_RATE_HZ)
+#define SCHEDULER_REPORT_TASK_PERIOD_MS   10000
+// EQ response curve at 30 fps
+#define RESPONSE_CURVE_TASK_PERIOD_MS     33
+// spectrum analyzer, same rate; a late frame is skipped, not queued
+#define SPECTRUM_TASK_PERIOD_MS           33
+// touch waits for the codec to be set up on the shared I2C4, not for a host
+// that is never plugged
+#define BOOT_TASK_PERIOD_MS               10
+#define BOOT_UI_TIMEOUT_MS                1000
+#define BOOT_REPORT_TIMEOUT_MS            5000
+// the FIR spectra in the upper half of the SDRAM, above the LCD buffers, then
+// the taps the host sends, in one MPU region of DSP_FIR_MEMORY_REGION bytes
+#define DSP_FIR_MEMORY_ADDRESS            (SDRAM_DEVICE_ADDR + SDRAM_DEVICE_SIZE / 2)
+#define DSP_FIR_TAPS_ADDRESS              (DSP_FIR_MEMORY_ADDRESS + DSP_FIR_MEMORY_SIZE)
+#define DSP_FIR_MEMORY_REGION             0x100000
+
+#if DSP_FIR_MEMORY_SIZE + DSP_FIR_MAX_TAPS * 4 > DSP_FIR_MEMORY_REGION
+#error "FIR spectra and taps larger than their MPU region"
+#endif
+
 // private function prototypes -------------------------------------------------
 // static void OnError_Handler(uint32_t condition);
 static void     SystemClock_Config(void);
 static void     CPU_CACHE_Enable(void);
+static void     MPU_Config(void);
 static void     USB_Init(void);
+static void     MainLoop_AddTasks(void);
+static void     MainLoop_BootTask(void);
+static void     MainLoop_ReportBoot(void);
+static void     MainLoop_WatchdogTask(void);
+static void     MainLoop_EqControlTask(void);
+static void     MainLoop_ResponseCurveTask(void);
+static void     MainLoop_SpectrumTask(void);
+static void     MainLoop_ReportScheduler(void);
+static uint32_t DspFir_ReadCycles(void);
+
+#if DSP_BENCHMARK
+static void     DspBenchmark_Write(const char* text, uint32_t length);
+#endif // DSP_BENCHMARK
 
 #if USE_AUDIO_TIMER_VOLUME_CTRL
 static HAL_StatusTypeDef Timer_Init(void);
@@ -71,32 +119,41 @@ int main(void)
 
 	// configures the system clock to have a frequency of 200 MHz
 	SystemClock_Config();
+	BootTime_Init();
 
-	BSP_SDRAM_Init();
-	USB_Init();
-
-	HAL_Delay(1000);
-
+	Logger_Init();
 	USART1_UART_Init();
-	LCD_Init();
-	Touchscreen_Init();
-	
-	uint8_t initString[] = "\r\n--- Horoscope Initialization Complete! ---\r\n";
-	HAL_UART_Transmit(&UART1_Handle, initString, sizeof(initString), 10);
-
-	uint8_t readingString[] = "\r\nReading data from storage...\r\n";
-	HAL_UART_Transmit(&UART1_Handle, readingString, sizeof(readingString), 10);
+  #if DSP_BENCHMARK
+	AudioUserDspBench_Run(DspBenchmark_Write);
+  #endif // DSP_BENCHMARK
 
+	// init graph: each step needs the ones before it. Audio needs the
+	// filters set before the first packet, the UI only needs to be up
+	// after enumeration.
+	BSP_SDRAM_Init();
+	MPU_Config();
+	AudioUserDspFir_Init((void*)DSP_FIR_MEMORY_ADDRESS);
+	// the longest FIR the USB interrupt affords, timed on the SDRAM before
+	// the stream can start; a few ms, the filters are loaded much later
+	AudioUserDspFir_Calibrate(DspFir_ReadCycles, SystemCoreClock / 1000 * DSP_FIR_BUDGET_PERCENT / 100);
+	LOG("FIR: up to %u taps per channel\r\n", AudioUserDspFir_GetMaxTaps());
+	EqControl_Init((float*)DSP_FIR_TAPS_ADDRESS);
+	BootTime_Mark(BOOT_TIME_SDRAM);
+
+	LOG("\r\nReading data from storage...\r\n");
+	// the knobs, and the filters copied from the working preset
 	FlashPersistence_Restore();
-	for(int i = 0; i < NUMBER_OF_SLIDER_BUTTONS; i++)
-	{
-		int16_t newGain = AudioUserDsp_CalculateGain(i, &sliderKnobs[i]);
-		AudioUserDsp_BiquadFilterConfig(&biquadFilters[i], newGain, frequencies[i], bandwidths[i]);
-	}
+	BootTime_Mark(BOOT_TIME_RESTORED);
 
+	// enumeration and the codec run from the USB interrupt from here on
+	Telemetry_Init();
+	USB_Init();
+	BootTime_Mark(BOOT_TIME_USB_STARTED);
 
-	uint8_t readFinishedString[] = "\r\nRead finished!\r\n";
-	HAL_UART_Transmit(&UART1_Handle, readFinishedString, sizeof(readFinishedString), 10);
+	AudioUserDspResponse_Init(USB_AUDIO_CONFIG_PLAY_DEF_FREQ);
+	Spectrum_Init(USB_AUDIO_CONFIG_PLAY_DEF_FREQ);
+	LCD_Init();
+	BootTime_Mark(BOOT_TIME_LCD);
 
 
   #if USE_AUDIO_TIMER_VOLUME_CTRL
@@ -104,21 +161,203 @@ int main(void)
 	Timer_Init();
   #endif // USE_AUDIO_TIMER_VOLUME_CTRL
 
+	// keeps the debugger attached while the core sleeps in __WFI
+	HAL_DBGMCU_EnableDBGSleepMode();
+	MainLoop_AddTasks();
+
 	// Infinite loop
 	while (1)
 	{
-		if(++touchscreenTimer > 40)
-		{
-			Touchscreen_ButtonHandler();
-			touchscreenTimer = 0;
-		}
+		Scheduler_Run();
+	}
+}
+
+/**
+ * @brief  Puts the main loop work on the scheduler. LCD and logger follow
+ *         their DMA completions, so they run on every pass.
+ * @param  None
+ * @retval None
+ */
+static void MainLoop_AddTasks(void)
+{
+	Scheduler_Init();
+	Scheduler_AddBackground("lcd", LCD_Process);
+	Scheduler_AddBackground("logger", Logger_Process);
+	Scheduler_AddPeriodic("touch", Touchscreen_ButtonHandler, TOUCH_TASK_PERIOD_MS, 0);
+	Scheduler_AddPeriodic("flash", FlashPersistence_Process, FLASH_TASK_PERIOD_MS, 0);
+	Scheduler_AddPeriodic("eq control", MainLoop_EqControlTask, EQ_CONTROL_TASK_PERIOD_MS, 0);
+	Scheduler_AddPeriodic("telemetry", Telemetry_Process, TELEMETRY_TASK_PERIOD_MS, 0);
+	Scheduler_AddPeriodic("watchdog", MainLoop_WatchdogTask, WATCHDOG_TASK_PERIOD_MS, 0);
+	Scheduler_AddPeriodic("curve", MainLoop_ResponseCurveTask, RESPONSE_CURVE_TASK_PERIOD_MS, 0);
+	Scheduler_AddPeriodic("spectrum", MainLoop_SpectrumTask, SPECTRUM_TASK_PERIOD_MS, 0);
+	Scheduler_AddPeriodic("report", MainLoop_ReportScheduler, SCHEDULER_REPORT_TASK_PERIOD_MS, 0);
+	Scheduler_AddOneShot("boot", MainLoop_BootTask, 0);
+}
+
+/**
+ * @brief  Last steps of the startup. Brings up touch once the codec is set
+ *         up, its I2C4 transfers run from the USB interrupt at enumeration,
+ *         then logs the boot times once the host plays or gives up. Arms
+ *         itself again until both are done.
+ * @param  None
+ * @retval None
+ */
+static void MainLoop_BootTask(void)
+{
+	uint32_t tick = HAL_GetTick();
+
+	if(!BootTime_IsReached(BOOT_TIME_UI) && (BootTime_IsReached(BOOT_TIME_CODEC) || tick >= BOOT_UI_TIMEOUT_MS))
+	{
+		Touchscreen_Init();
+		BootTime_Mark(BOOT_TIME_UI);
+	}
+
+	if(BootTime_IsReached(BOOT_TIME_UI) && (BootTime_IsReached(BOOT_TIME_FIRST_AUDIO) || tick >= BOOT_REPORT_TIMEOUT_MS))
+	{
+		MainLoop_ReportBoot();
+		return;
+	}
+
+	Scheduler_AddOneShot("boot", MainLoop_BootTask, BOOT_TASK_PERIOD_MS);
+}
+
+/**
+ * @brief  Logs the time from HAL_Init to each startup step that was reached.
+ *         First audio counts from power up, so it includes the time the host
+ *         took to enumerate and to open the stream.
+ * @param  None
+ * @retval None
+ */
+static void MainLoop_ReportBoot(void)
+{
+	static const char* const markNames[BOOT_TIME_MARKS] = { "sdram", "restored", "usb started", "codec", "first audio", "lcd", "ui" };
+
+	LOG("\r\n--- Horoscope Initialization Complete! ---\r\n");
+
+	for(int8_t i = 0; i < BOOT_TIME_MARKS; i++)
+	{
+		if(BootTime_IsReached(i))
+			LOG("  boot %s: %u us\r\n", markNames[i], BootTime_Us(i));
+	}
+
+	if(!BootTime_IsReached(BOOT_TIME_FIRST_AUDIO))
+		LOG("  boot: no stream yet\r\n");
+	else if(BootTime_Us(BOOT_TIME_FIRST_AUDIO) > BOOT_TIME_AUDIO_TARGET_US)
+		LOG("  boot: first audio over the %u ms target\r\n", BOOT_TIME_AUDIO_TARGET_US / 1000);
+}
+
+static void MainLoop_WatchdogTask(void)
+{
+	LCD_UpdateWatchdog(&watchdogCounter);
+}
+
+/**
+ * @brief  Applies the last EQ set from the host and moves the knobs to the
+ *         new gains; the response curve follows the coefficients by itself.
+ * @param  None
+ * @retval None
+ */
+static void MainLoop_EqControlTask(void)
+{
+	if(!EqControl_Process())
+		return;
 
-		if(++watchdogTimer > 500)
+	for(uint8_t i = 0; i < NUMBER_OF_SLIDER_BUTTONS; i++)
+		LCD_DisplayKnob(i, LCD_TranslateGainToKnobPosition(i, biquadFilters[i].gain));
+}
+
+/**
+ * @brief  Follows the live EQ coefficients, which the USB interrupt changes
+ *         when a knob moved. Only the bands that changed are evaluated and
+ *         nothing is drawn when none did. The peak of the curve becomes the
+ *         headroom of the output, a boost lowers the level before it clips.
+ * @param  None
+ * @retval None
+ */
+static void MainLoop_ResponseCurveTask(void)
+{
+	if(AudioUserDspResponse_Update() == 0)
+		return;
+
+	AudioUserDsp_SetHeadroom(AudioUserDspResponse_Peak());
+	LCD_UpdateResponseCurve(AudioUserDspResponse_Magnitude());
+}
+
+/**
+ * @brief  Runs the analyzer while its screen is shown; the tap in the USB
+ *         interrupt is off otherwise. Only the bars that moved are drawn.
+ * @param  None
+ * @retval None
+ */
+static void MainLoop_SpectrumTask(void)
+{
+	Spectrum_SetEnabled(LCD_IsSpectrumShown());
+	if(Spectrum_Process())
+		LCD_UpdateSpectrum(Spectrum_Bars());
+}
+
+/**
+ * @brief  Logs the idle time since the last report, then the runs, mean and
+ *         worst release jitter, worst run time and overruns of each task,
+ *         the latency of the knob moves that changed the EQ, the analyzer
+ *         frame counts once it has run and how late the audio interrupts
+ *         came, apart while the flash was busy.
+ * @param  None
+ * @retval None
+ */
+static void MainLoop_ReportScheduler(void)
+{
+	SchedulerStats stats;
+	SchedulerTaskStats task;
+	SpectrumStats spectrum;
+	TouchLatencyStats latency;
+	IsrLatencyStats isr;
+	static const char* const isrNames[ISR_LATENCY_SOURCES] = { "usb sof", "sai dma" };
+
+	Scheduler_GetStats(&stats);
+	if(stats.totalUs == 0)
+		return;
+
+	LOG("scheduler: idle %u.%u%%, %u passes\r\n", (uint32_t)(stats.idleUs * 1000 / stats.totalUs) / 10,
+	    (uint32_t)(stats.idleUs * 1000 / stats.totalUs) % 10, stats.passes);
+
+	for(int8_t i = 0; i < SCHEDULER_MAX_TASKS; i++)
+	{
+		if(!Scheduler_GetTaskStats(i, &task) || task.runs == 0)
+			continue;
+
+		if(task.type == SCHEDULER_TASK_BACKGROUND)
+			LOG("  %s: %u runs, run max %u us\r\n", task.name, task.runs, task.runMaxUs);
+		else
 		{
-			LCD_UpdateWatchdog(&watchdogCounter);
-			watchdogTimer = 0;
+			LOG("  %s: %u runs, jitter mean %u us max %u us", task.name, task.runs, task.jitterTotalUs / task.runs, task.jitterMaxUs);
+			LOG(", run max %u us, %u overruns\r\n", task.runMaxUs, task.overruns);
 		}
 	}
+
+	// written by the USB interrupt
+	__disable_irq();
+	latency = touchLatencyStats;
+	touchLatencyStats = (TouchLatencyStats){0};
+	__enable_irq();
+	if(latency.updates > 0)
+		LOG("  touch to EQ: %u updates, latency mean %u us max %u us\r\n", latency.updates, latency.totalUs / latency.updates, latency.maxUs);
+
+	Spectrum_GetStats(&spectrum);
+	if(spectrum.frames + spectrum.tornFrames > 0)
+		LOG("  spectrum: %u frames, %u torn, %u idle\r\n", spectrum.frames, spectrum.tornFrames, spectrum.idleFrames);
+
+	for(int8_t i = 0; i < ISR_LATENCY_SOURCES; i++)
+	{
+		IsrLatency_GetStats(i, &isr);
+		if(isr.intervals == 0)
+			continue;
+
+		LOG("  %s: period %u us, late max %u us", isrNames[i], isr.periodUs, isr.lateMaxUs);
+		LOG(", during flash %u us over %u periods\r\n", isr.flashLateMaxUs, isr.flashIntervals);
+	}
+
+	Scheduler_ResetStats();
 }
 
 /**
@@ -132,6 +371,64 @@ static void CPU_CACHE_Enable(void)
 	SCB_EnableDCache();
 }
 
+/**
+ * @brief  Makes the FIR spectra cacheable. The rest of the SDRAM keeps the
+ *         default map, device memory the DMA2D and the LTDC share with the
+ *         CPU without cache maintenance; only the CPU touches the FIR area.
+ *         Called once the SDRAM is up, so no speculative read reaches it
+ *         before.
+ * @param  None
+ * @retval None
+ */
+static void MPU_Config(void)
+{
+	MPU_Region_InitTypeDef region;
+
+	HAL_MPU_Disable();
+
+	region.Enable           = MPU_REGION_ENABLE;
+	region.Number           = MPU_REGION_NUMBER0;
+	region.BaseAddress      = DSP_FIR_MEMORY_ADDRESS;
+	region.Size             = MPU_REGION_SIZE_1MB;
+	region.SubRegionDisable = 0x00;
+	region.TypeExtField     = MPU_TEX_LEVEL0;
+	region.AccessPermission = MPU_REGION_FULL_ACCESS;
+	region.DisableExec      = MPU_INSTRUCTION_ACCESS_DISABLE;
+	region.IsShareable      = MPU_ACCESS_NOT_SHAREABLE;
+	region.IsCacheable      = MPU_ACCESS_CACHEABLE;
+	region.IsBufferable     = MPU_ACCESS_BUFFERABLE;
+	HAL_MPU_ConfigRegion(&region);
+
+	// the default map everywhere else
+	HAL_MPU_Enable(MPU_PRIVILEGED_DEFAULT);
+}
+
+/**
+ * @brief  Clock of the FIR calibration. BootTime_Init has started the DWT
+ *         cycle counter.
+ * @param  None
+ * @retval core cycles
+ */
+static uint32_t DspFir_ReadCycles(void)
+{
+	return DWT->CYCCNT;
+}
+
+#if DSP_BENCHMARK
+
+/**
+ * @brief  Sends the benchmark results on USART1. Blocking: the logger has not
+ *         queued anything yet when the benchmark runs.
+ * @param  text: JSON text
+ * @param  length: bytes in text
+ * @retval None
+ */
+static void DspBenchmark_Write(const char* text, uint32_t length)
+{
+	HAL_UART_Transmit(&UART1_Handle, (uint8_t*)text, length, HAL_MAX_DELAY);
+}
+
+#endif // DSP_BENCHMARK
 
 #if USE_AUDIO_TIMER_VOLUME_CTRL
 
@@ -288,31 +585,25 @@ void USBD_error_handler(void)
 //	}
 //}
 
+/**
+ * @brief  Starts the USB device. Runs before the LCD is set up, so it shows
+ *         nothing; the host sees the device as soon as this returns.
+ * @param  None
+ * @retval None
+ */
 static void USB_Init(void)
 {
-	BSP_LCD_SetBackColor(LCD_COLOR_WHITE);
-	BSP_LCD_SetTextColor(LCD_COLOR_BLACK);
-
 	// Init Device Library
-	BSP_LCD_DisplayStringAt(0, 10, (uint8_t *)"USB Device Library ..... ", LEFT_MODE);
 	USBD_Init(&USBD_Device, &AUDIO_Desc, 0);
-	BSP_LCD_DisplayStringAt(420, 10, (uint8_t *)"OK", LEFT_MODE);
 
 	// Add Supported Class
-	BSP_LCD_DisplayStringAt(0, 30, (uint8_t *)"USB Register Class ..... ", LEFT_MODE);
 	USBD_RegisterClass(&USBD_Device, USBD_AUDIO_CLASS);
-	BSP_LCD_DisplayStringAt(420, 30, (uint8_t *)"OK", LEFT_MODE);
 
 	// Add Interface callbacks for AUDIO Class
-	BSP_LCD_DisplayStringAt(0, 50, (uint8_t *)"USB Register Interface . ", LEFT_MODE);
 	USBD_AUDIO_RegisterInterface(&USBD_Device, &audio_class_interface);
-	BSP_LCD_DisplayStringAt(420, 50, (uint8_t *)"OK", LEFT_MODE);
 
 	// Start Device Process
-	BSP_LCD_DisplayStringAt(0, 70, (uint8_t *)"USB Init ............... ", LEFT_MODE);
 	USBD_Start(&USBD_Device);
-	BSP_LCD_DisplayStringAt(420, 70, (uint8_t *)"OK", LEFT_MODE);
-
 }
 
 #ifdef  USE_FULL_ASSERT
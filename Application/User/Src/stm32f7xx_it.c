@@ -21,6 +21,11 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "stm32f7xx_it.h"
+#include "usart.h"
+#include "lcd_compositor.h"
+#include "touch_input.h"
+#include "flash_journal.h"
+#include "isr_latency.h"
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
@@ -185,6 +190,7 @@ void TIM_VolumeChangeIRQHandler(void)
   */
 void AUDIO_OUT_SAIx_DMAx_IRQHandler(void)
 {
+  IsrLatency_Mark(ISR_LATENCY_SAI_DMA);
   HAL_DMA_IRQHandler(haudio_out_sai.hdmatx);
 }
 
@@ -208,6 +214,86 @@ void AUDIO_DFSDMx_DMAx_TOP_RIGHT_IRQHandler(void)
   HAL_DMA_IRQHandler(hAudioInTopRightFilter.hdmaReg);
 }
 
+/**
+  * @brief  This function handles USART1 global interrupt request.
+  * @param  None
+  * @retval None
+  */
+void USART1_IRQHandler(void)
+{
+  HAL_UART_IRQHandler(&UART1_Handle);
+}
+
+/**
+  * @brief  This function handles the USART1 TX DMA interrupt request.
+  * @param  None
+  * @retval None
+  */
+void USART1_TX_DMA_IRQHandler(void)
+{
+  HAL_DMA_IRQHandler(UART1_Handle.hdmatx);
+}
+
+/**
+  * @brief  This function handles the DMA2D interrupt request.
+  * @param  None
+  * @retval None
+  */
+void DMA2D_IRQHandler(void)
+{
+  LcdCompositor_Dma2dIrqHandler();
+}
+
+/**
+  * @brief  This function handles the LTDC interrupt request.
+  * @param  None
+  * @retval None
+  */
+void LTDC_IRQHandler(void)
+{
+  LcdCompositor_LtdcIrqHandler();
+}
+
+/**
+  * @brief  This function handles the touch controller interrupt line.
+  * @param  None
+  * @retval None
+  */
+void EXTI15_10_IRQHandler(void)
+{
+  HAL_GPIO_EXTI_IRQHandler(TS_INT_PIN);
+}
+
+/**
+  * @brief  This function handles the I2C4 event interrupt request.
+  * @param  None
+  * @retval None
+  */
+void I2C4_EV_IRQHandler(void)
+{
+  TouchInput_I2cEventIrqHandler();
+}
+
+/**
+  * @brief  This function handles the I2C4 error interrupt request.
+  * @param  None
+  * @retval None
+  */
+void I2C4_ER_IRQHandler(void)
+{
+  TouchInput_I2cErrorIrqHandler();
+}
+
+/**
+  * @brief  This function handles the flash interrupt request.
+  * @param  None
+  * @retval None
+  */
+void FLASH_IRQHandler(void)
+{
+  FlashJournalBackend_IrqHandler();
+}
+
 /**
   * @brief  This function handles PPP interrupt request.
   * @param  None
@@ -0,0 +1,32 @@
+/**
+  ******************************************************************************
+  * @file    sim_report.h
+  * @brief   Outcome line of the self-checking host tools, "  name ... ok" or
+  *          "FAILED" for each check; the tool folds the outcomes into its
+  *          exit status.
+  ******************************************************************************
+  */
+
+// define to prevent recursive inclusion ---------------------------------------
+#ifndef __SIM_REPORT_H__
+#define __SIM_REPORT_H__
+
+// includes --------------------------------------------------------------------
+#include <stdbool.h>
+#include <stdio.h>
+
+// function prototypes ---------------------------------------------------------
+
+/**
+ * @brief  Prints the outcome of a check.
+ * @param  name: of the check
+ * @param  ok: outcome
+ * @retval ok
+ */
+static inline bool SimReport_Check(const char* name, bool ok)
+{
+  printf("  %s ... %s\n", name, ok ? "ok" : "FAILED");
+  return ok;
+}
+
+#endif // __SIM_REPORT_H__
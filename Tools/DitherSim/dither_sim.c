@@ -0,0 +1,347 @@
+/**
+  ******************************************************************************
+  * @file    dither_sim.c
+  * @brief   Measures the requantisation of the EQ output to 16 bits on the
+  *          host. A 997 Hz tone at -20 dBFS goes through the flat EQ with the
+  *          volume at -40 dB, so the last band leaves a -60 dBFS tone in float
+  *          that has to be requantised, once with each mode:
+  *          - truncate: the (int16_t) cast every band used to end with;
+  *          - round, tpdf, shaped 1, shaped 2: the modes of
+  *            AudioUserDsp_SetDither.
+  *          The left channel is windowed (4 term Blackman-Harris) and
+  *          transformed over 65536 frames. For each mode the tool prints the
+  *          noise over the whole band and below 4 kHz, in dBFS, and the THD
+  *          from the 2nd to the 9th harmonic, in dB under the tone. Checks:
+  *          - the tpdf noise is within 1 dB of rounding plus triangular
+  *            dither, a quarter of an lsb squared;
+  *          - with dither no harmonic stands more than 6 dB above the noise
+  *            around it, without dither one does;
+  *          - each order of shaping takes at least 6 dB more noise out from
+  *            under 4 kHz.
+  *
+  *          The cycle cost of each mode is the process_packet_<mode> cases of
+  *          Tools/DspBench.
+  *
+  *          build (from Tools, the sources are listed in its Makefile):
+  *            make build/dither_sim
+  *
+  *          usage:
+  *            ./dither_sim   (exit status 1 if a check fails)
+  ******************************************************************************
+  */
+
+#include "audio_user_dsp.h"
+#include "usb_audio.h"
+#include "sim_report.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// private defines -------------------------------------------------------------
+#define SAMPLE_RATE         USB_AUDIO_CONFIG_PLAY_DEF_FREQ
+#define PACKET_SIZE         AUDIO_MS_PACKET_SIZE(SAMPLE_RATE, USB_AUDIO_CONFIG_PLAY_CHANNEL_COUNT, USB_AUDIO_CONFIG_PLAY_RES_BYTE)
+#define FRAMES_PER_PACKET   (PACKET_SIZE / 4)
+#define FFT_SIZE            65536
+// dropped before the window, the filters start from silence
+#define SETTLE_PACKETS      10
+#define PACKETS             (SETTLE_PACKETS + (FFT_SIZE + FRAMES_PER_PACKET - 1) / FRAMES_PER_PACKET)
+#define FRAMES              (PACKETS * FRAMES_PER_PACKET)
+#define TONE_FREQUENCY      997.0
+#define INPUT_LEVEL_DB      (-20.0)
+#define VOLUME_DB           (-40)
+#define HARMONICS           9
+// bins on each side of a tone that belong to it, the main lobe of the window
+// is 4 wide
+#define TONE_BINS           8
+#define LOW_BAND_HZ         4000.0
+#define FULL_SCALE          32768.0
+#define PI                  3.14159265358979323846
+// rounding error plus triangular dither, in lsb squared
+#define TPDF_NOISE          0.25
+#define TPDF_NOISE_TOLERANCE_DB 1.0
+#define HARMONIC_MARGIN_DB  6.0
+#define SHAPING_GAIN_DB     6.0
+
+// private typedefs ------------------------------------------------------------
+// the modes of the firmware, then the cast
+typedef enum DitherSimMode
+{
+  MODE_TRUNCATE = DSP_DITHER_MODES,
+  MODES
+} DitherSimMode;
+
+typedef struct DitherSimResult
+{
+  double noiseDb;         // whole band, dBFS
+  double lowNoiseDb;      // under LOW_BAND_HZ, dBFS
+  double thdDb;           // harmonics under the tone
+  double harmonicDb;      // highest harmonic over the noise around it
+} DitherSimResult;
+
+// variables -------------------------------------------------------------------
+
+// normally owned by main.c
+float in_z1  = 0;
+float in_z2  = 0;
+float out_z1 = 0;
+float out_z2 = 0;
+
+// band layout, normally defined in audio_usb_nodes.c
+int16_t frequencies[] = {30, 60, 150, 400, 1000, 3000, 8000, 16000};
+int16_t bandwidths[] =  {1,   1,   2,   2,    2,    3,    3,     3};
+
+// private variables -----------------------------------------------------------
+static int16_t input[2 * FRAMES];
+static int16_t output[2 * FRAMES];
+static double  real[FFT_SIZE];
+static double  imaginary[FFT_SIZE];
+static double  power[FFT_SIZE / 2];
+
+static const int16_t flatGains[NUMBER_OF_BANDS] = {0};
+
+static const char* modeNames[MODES] = { "round", "tpdf", "shaped 1", "shaped 2", "truncate" };
+
+// private function declarations -----------------------------------------------
+static void DitherSim_Configure(void);
+static void DitherSim_Tone(void);
+static void DitherSim_Run(uint32_t mode);
+static void DitherSim_Analyze(DitherSimResult* result);
+static void DitherSim_Fft(double* re, double* im, uint32_t size);
+
+int main(void)
+{
+  DitherSimResult results[MODES];
+  bool passed = true;
+
+  DitherSim_Configure();
+  DitherSim_Tone();
+
+  for(uint32_t mode = 0; mode < MODES; mode++)
+  {
+    DitherSim_Run(mode);
+    DitherSim_Analyze(&results[mode]);
+    printf("  %-9s noise %7.2f dBFS, %7.2f dBFS under 4 kHz, THD %7.2f dB, highest harmonic %+6.2f dB over the noise\n",
+           modeNames[mode], results[mode].noiseDb, results[mode].lowNoiseDb, results[mode].thdDb, results[mode].harmonicDb);
+  }
+
+  double tpdfDb = 10.0 * log10(TPDF_NOISE / (FULL_SCALE * FULL_SCALE / 2.0));
+  passed &= SimReport_Check("tpdf level", fabs(results[DSP_DITHER_TPDF].noiseDb - tpdfDb) <= TPDF_NOISE_TOLERANCE_DB);
+
+  bool decorrelated = results[MODE_TRUNCATE].harmonicDb > HARMONIC_MARGIN_DB && results[DSP_DITHER_OFF].harmonicDb > HARMONIC_MARGIN_DB;
+  for(uint32_t mode = DSP_DITHER_TPDF; mode <= DSP_DITHER_SHAPED_2; mode++)
+    decorrelated &= results[mode].harmonicDb <= HARMONIC_MARGIN_DB;
+  passed &= SimReport_Check("decorrelated", decorrelated);
+
+  passed &= SimReport_Check("shaping", results[DSP_DITHER_SHAPED_1].lowNoiseDb + SHAPING_GAIN_DB <= results[DSP_DITHER_TPDF].lowNoiseDb &&
+                                       results[DSP_DITHER_SHAPED_2].lowNoiseDb + SHAPING_GAIN_DB <= results[DSP_DITHER_SHAPED_1].lowNoiseDb);
+
+  printf("%s\n", passed ? "all checks passed" : "CHECK FAILED");
+  return passed ? 0 : 1;
+}
+
+/**
+ * @brief  Sets every band flat and the volume to VOLUME_DB, settled, so the
+ *         last band only scales the tone.
+ * @param  None
+ * @retval None
+ */
+static void DitherSim_Configure(void)
+{
+  for(uint8_t i = 0; i < NUMBER_OF_BANDS; i++)
+  {
+    biquadFilters[i].isInitialized = false;
+    AudioUserDsp_BiquadFilterConfig(&biquadFilters[i], flatGains[i], frequencies[i], bandwidths[i]);
+  }
+  AudioUserDsp_SetVolume(VOLUME_DB * 256);
+  AudioUserDsp_SettleVolume();
+}
+
+/**
+ * @brief  Fills the input with the tone on both channels, rounded.
+ * @param  None
+ * @retval None
+ */
+static void DitherSim_Tone(void)
+{
+  double amplitude = (FULL_SCALE - 1) * pow(10.0, INPUT_LEVEL_DB / 20.0);
+
+  for(uint32_t n = 0; n < FRAMES; n++)
+  {
+    int16_t sample = (int16_t)lround(amplitude * sin(2.0 * PI * TONE_FREQUENCY * n / SAMPLE_RATE));
+    input[2 * n] = sample;
+    input[2 * n + 1] = sample;
+  }
+}
+
+/**
+ * @brief  Plays the tone through the packet path with one mode. The cast is
+ *         applied by the tool to the float the last band computes, the
+ *         volume times the sample.
+ * @param  mode: a DspDither, or MODE_TRUNCATE
+ * @retval None
+ */
+static void DitherSim_Run(uint32_t mode)
+{
+  uint8_t packet[PACKET_SIZE];
+
+  if(mode == MODE_TRUNCATE)
+  {
+    double gain = AudioUserDsp_VolumeGain();
+
+    for(uint32_t i = 0; i < 2 * FRAMES; i++)
+      output[i] = (int16_t)(float)(gain * input[i]);
+    return;
+  }
+
+  for(uint8_t i = 0; i < NUMBER_OF_BANDS; i++)
+    memset(biquadFilters[i].state, 0, sizeof(biquadFilters[i].state));
+  AudioUserDsp_SetDither((DspDither)mode);
+
+  for(uint32_t p = 0; p < PACKETS; p++)
+  {
+    for(uint32_t f = 0; f < FRAMES_PER_PACKET; f++)
+      AudioUserDsp_SamplesToFrame(packet + 4 * f, &input[2 * (p * FRAMES_PER_PACKET + f)], &input[2 * (p * FRAMES_PER_PACKET + f) + 1]);
+
+    AudioUserDsp_ProcessPacket(packet, PACKET_SIZE);
+
+    for(uint32_t f = 0; f < FRAMES_PER_PACKET; f++)
+      AudioUserDsp_FrameToSamples(packet + 4 * f, &output[2 * (p * FRAMES_PER_PACKET + f)], &output[2 * (p * FRAMES_PER_PACKET + f) + 1]);
+  }
+}
+
+/**
+ * @brief  Windows the left channel of the output after the settling packets,
+ *         transforms it and splits the power into the tone, its harmonics
+ *         and the noise. The noise in the bins of the tones is taken to be
+ *         as dense as elsewhere.
+ * @param  result: levels of the run
+ * @retval None
+ */
+static void DitherSim_Analyze(DitherSimResult* result)
+{
+  const int16_t* samples = &output[2 * SETTLE_PACKETS * FRAMES_PER_PACKET];
+  const double binHz = (double)SAMPLE_RATE / FFT_SIZE;
+  const uint32_t lowBins = (uint32_t)(LOW_BAND_HZ / binHz);
+  double windowPower = 0;
+  double harmonicPower[HARMONICS + 1] = {0};
+  double noise = 0, lowNoise = 0;
+  uint32_t noiseBins = 0, lowNoiseBins = 0;
+
+  for(uint32_t n = 0; n < FFT_SIZE; n++)
+  {
+    double x = 2.0 * PI * n / FFT_SIZE;
+    double window = 0.35875 - 0.48829 * cos(x) + 0.14128 * cos(2 * x) - 0.01168 * cos(3 * x);
+
+    real[n] = samples[2 * n] * window;
+    imaginary[n] = 0;
+    windowPower += window * window;
+  }
+
+  DitherSim_Fft(real, imaginary, FFT_SIZE);
+
+  // one sided, a bin holds the mean square it adds to the signal
+  for(uint32_t k = 0; k < FFT_SIZE / 2; k++)
+    power[k] = 2.0 * (real[k] * real[k] + imaginary[k] * imaginary[k]) / (FFT_SIZE * windowPower);
+
+  for(uint32_t k = TONE_BINS + 1; k < FFT_SIZE / 2; k++)
+  {
+    bool tone = false;
+
+    for(uint32_t h = 1; h <= HARMONICS; h++)
+    {
+      double center = h * TONE_FREQUENCY / binHz;
+      if(fabs(k - center) <= TONE_BINS)
+      {
+        harmonicPower[h] += power[k];
+        tone = true;
+      }
+    }
+
+    if(tone)
+      continue;
+    noise += power[k];
+    noiseBins++;
+    if(k < lowBins)
+    {
+      lowNoise += power[k];
+      lowNoiseBins++;
+    }
+  }
+
+  double fullScale = FULL_SCALE * FULL_SCALE / 2.0;
+  double harmonics = 0;
+
+  result->noiseDb = 10.0 * log10(noise * (FFT_SIZE / 2) / noiseBins / fullScale);
+  result->lowNoiseDb = 10.0 * log10(lowNoise * lowBins / lowNoiseBins / fullScale);
+  result->harmonicDb = -INFINITY;
+
+  for(uint32_t h = 2; h <= HARMONICS; h++)
+  {
+    uint32_t center = (uint32_t)lround(h * TONE_FREQUENCY / binHz);
+    // the noise of the bins around the harmonic, from its neighbourhood
+    double local = 0;
+    uint32_t count = 0;
+
+    for(uint32_t k = center - 4 * TONE_BINS; k <= center + 4 * TONE_BINS; k++)
+    {
+      if(k + TONE_BINS < center || k > center + TONE_BINS)
+      {
+        local += power[k];
+        count++;
+      }
+    }
+
+    double over = 10.0 * log10(harmonicPower[h] / (local / count * (2 * TONE_BINS + 1)));
+    if(over > result->harmonicDb)
+      result->harmonicDb = over;
+    harmonics += harmonicPower[h];
+  }
+
+  result->thdDb = 10.0 * log10(harmonics / harmonicPower[1]);
+}
+
+/**
+ * @brief  In place radix 2 transform.
+ * @param  re: real parts
+ * @param  im: imaginary parts
+ * @param  size: power of two
+ * @retval None
+ */
+static void DitherSim_Fft(double* re, double* im, uint32_t size)
+{
+  for(uint32_t i = 1, j = 0; i < size; i++)
+  {
+    uint32_t bit = size >> 1;
+    for(; j & bit; bit >>= 1)
+      j ^= bit;
+    j ^= bit;
+
+    if(i < j)
+    {
+      double t = re[i]; re[i] = re[j]; re[j] = t;
+      t = im[i]; im[i] = im[j]; im[j] = t;
+    }
+  }
+
+  for(uint32_t length = 2; length <= size; length <<= 1)
+  {
+    double angle = -2.0 * PI / length;
+
+    for(uint32_t i = 0; i < size; i += length)
+    {
+      for(uint32_t k = 0; k < length / 2; k++)
+      {
+        double wr = cos(angle * k), wi = sin(angle * k);
+        uint32_t a = i + k, b = i + k + length / 2;
+        double tr = re[b] * wr - im[b] * wi;
+        double ti = re[b] * wi + im[b] * wr;
+
+        re[b] = re[a] - tr;
+        im[b] = im[a] - ti;
+        re[a] += tr;
+        im[a] += ti;
+      }
+    }
+  }
+}
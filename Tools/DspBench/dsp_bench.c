@@ -0,0 +1,70 @@
+/**
+  ******************************************************************************
+  * @file    dsp_bench.c
+  * @brief   Linux build of the EQ microbenchmark (audio_user_dsp_bench.c). The
+  *          board runs the same code at boot when built with DSP_BENCHMARK=1
+  *          and sends the JSON on USART1; compare the two files with any JSON
+  *          diff tool.
+  *
+  *          build (from Tools, the sources are listed in its Makefile):
+  *            make build/dsp_bench
+  *
+  *          usage:
+  *            ./dsp_bench [results.json]
+  ******************************************************************************
+  */
+
+#include "audio_user_dsp_bench.h"
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+// variables -------------------------------------------------------------------
+
+// band layout, normally defined in audio_usb_nodes.c
+int16_t frequencies[] = {30, 60, 150, 400, 1000, 3000, 8000, 16000};
+int16_t bandwidths[] =  {1,   1,   2,   2,    2,    3,    3,     3};
+
+// normally owned by main.c
+float in_z1  = 0;
+float in_z2  = 0;
+float out_z1 = 0;
+float out_z2 = 0;
+
+// private variables -----------------------------------------------------------
+static FILE* output;
+
+/**
+ * @brief  Writer handed to the benchmark.
+ * @param  text: JSON text
+ * @param  length: bytes in text
+ * @retval None
+ */
+static void DspBench_Write(const char* text, uint32_t length)
+{
+  fwrite(text, 1, length, output);
+}
+
+int main(int argc, char** argv)
+{
+  output = stdout;
+  if(argc > 2)
+  {
+    fprintf(stderr, "usage: %s [results.json]\n", argv[0]);
+    return 1;
+  }
+
+  if(argc == 2)
+  {
+    output = fopen(argv[1], "w");
+    if(!output)
+    {
+      fprintf(stderr, "cannot create %s: %s\n", argv[1], strerror(errno));
+      return 1;
+    }
+  }
+
+  AudioUserDspBench_Run(DspBench_Write);
+
+  return fclose(output) == 0 ? 0 : 1;
+}
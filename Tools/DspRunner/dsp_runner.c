@@ -0,0 +1,481 @@
+/**
+  ******************************************************************************
+  * @file    dsp_runner.c
+  * @brief   Offline WAV-in/WAV-out runner for the firmware EQ. Streams a 48 kHz
+  *          16-bit stereo WAV file through AudioUserDsp_ProcessPacket in
+  *          USB packet sized chunks (1 ms, 192 bytes), exactly as the USB input
+  *          node does, and writes the result. The input is memory mapped, so
+  *          large corpora cost no copies beyond one packet at a time.
+  *
+  *          The preset is the 8 knob positions FlashPersistence_Restore loads
+  *          (-k, or -f with a raw dump of the two journal sectors, or of the
+  *          old format sector), or gains in dB (-g). -d picks how the output
+  *          is requantised to 16 bits, the firmware default otherwise. -r
+  *          loads a room correction filter into the FIR ahead of the bands,
+  *          the same on both channels; it delays the output by
+  *          DSP_FIR_DELAY_FRAMES.
+  *
+  *          build (from Tools, the sources are listed in its Makefile):
+  *            make build/dsp_runner
+  *
+  *          usage:
+  *            ./dsp_runner [-k y0,..,y7 | -f sector.bin | -g g0,..,g7] [-d mode] [-r taps.f32]
+  *                         input.wav output.wav
+  ******************************************************************************
+  */
+
+#define _DEFAULT_SOURCE
+
+#include "audio_user_dsp.h"
+#include "audio_user_dsp_fir.h"
+#include "audio_node.h"
+#include "usb_audio.h"
+#include "flash_journal.h"
+#include "flash_persistence.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+// private defines -------------------------------------------------------------
+#define PACKET_SIZE       AUDIO_MS_PACKET_SIZE(USB_AUDIO_CONFIG_PLAY_DEF_FREQ, USB_AUDIO_CONFIG_PLAY_CHANNEL_COUNT, USB_AUDIO_CONFIG_PLAY_RES_BYTE)
+#define FRAME_SIZE        (USB_AUDIO_CONFIG_PLAY_CHANNEL_COUNT * USB_AUDIO_CONFIG_PLAY_RES_BYTE)
+#define OUTPUT_BUFFER     (1 << 20)
+#define WAV_FORMAT_PCM    1
+
+// slider geometry of user_lcd.c, used to turn knob positions into gains
+#define SLIDER_Y          25
+#define SLIDER_HEIGHT     400
+
+// private typedefs ------------------------------------------------------------
+typedef struct __attribute__((packed)) WavHeader
+{
+  char     riff[4];
+  uint32_t riffSize;
+  char     wave[4];
+  char     fmt[4];
+  uint32_t fmtSize;
+  uint16_t format;
+  uint16_t channels;
+  uint32_t sampleRate;
+  uint32_t byteRate;
+  uint16_t blockAlign;
+  uint16_t bitsPerSample;
+  char     data[4];
+  uint32_t dataSize;
+} WavHeader;
+
+typedef struct WavInput
+{
+  const uint8_t* map;
+  size_t         mapSize;
+  const uint8_t* data;
+  uint32_t       dataSize;
+} WavInput;
+
+// variables -------------------------------------------------------------------
+
+// normally owned by main.c and user_lcd.c
+float in_z1  = 0;
+float in_z2  = 0;
+float out_z1 = 0;
+float out_z2 = 0;
+SliderKnob sliderKnobs[NUMBER_OF_SLIDER_BUTTONS];
+
+// private variables -----------------------------------------------------------
+// journal sectors as read from the dump, erased past its end
+static uint8_t journal[FLASH_JOURNAL_SECTORS][FLASH_JOURNAL_SECTOR_SIZE];
+// the FIR spectra, in the SDRAM on the board, and the taps of -r
+static float   firMemory[DSP_FIR_MEMORY_SIZE / sizeof(float)];
+static float   firTaps[DSP_FIR_MAX_TAPS];
+
+// private function declarations -----------------------------------------------
+static void DspRunner_PrintUsage(const char* program);
+static bool DspRunner_ParseList(const char* text, int32_t* values);
+static bool DspRunner_ReadFlashDump(const char* path, int32_t* knobY);
+static bool DspRunner_LoadFir(const char* path);
+static bool DspRunner_OpenWav(const char* path, WavInput* input);
+static uint32_t DspRunner_ReadU32(const uint8_t* pointer);
+
+// band layout, normally defined in audio_usb_nodes.c
+int16_t frequencies[] = {30, 60, 150, 400, 1000, 3000, 8000, 16000};
+int16_t bandwidths[] =  {1,   1,   2,   2,    2,    3,    3,     3};
+
+int main(int argc, char** argv)
+{
+  int32_t knobY[NUMBER_OF_BANDS];
+  int32_t gains[NUMBER_OF_BANDS] = { 0 };
+  bool useKnobs = false;
+  int option;
+
+  AudioUserDspFir_Init(firMemory);
+
+  while((option = getopt(argc, argv, "k:f:g:d:r:h")) != -1)
+  {
+    switch(option)
+    {
+      case 'k':
+        if(!DspRunner_ParseList(optarg, knobY))
+          return 1;
+        useKnobs = true;
+        break;
+      case 'f':
+        if(!DspRunner_ReadFlashDump(optarg, knobY))
+          return 1;
+        useKnobs = true;
+        break;
+      case 'g':
+        if(!DspRunner_ParseList(optarg, gains))
+          return 1;
+        useKnobs = false;
+        break;
+      case 'd':
+        if(atoi(optarg) < 0 || atoi(optarg) >= DSP_DITHER_MODES)
+        {
+          DspRunner_PrintUsage(argv[0]);
+          return 1;
+        }
+        AudioUserDsp_SetDither((DspDither)atoi(optarg));
+        break;
+      case 'r':
+        if(!DspRunner_LoadFir(optarg))
+          return 1;
+        break;
+      default:
+        DspRunner_PrintUsage(argv[0]);
+        return 1;
+    }
+  }
+
+  if(argc - optind != 2)
+  {
+    DspRunner_PrintUsage(argv[0]);
+    return 1;
+  }
+
+  // same steps as main(): knob positions to gains, then the filter coefficients
+  for(int i = 0; i < NUMBER_OF_BANDS; i++)
+  {
+    sliderKnobs[i].sliderY = SLIDER_Y;
+    sliderKnobs[i].sliderHeight = SLIDER_HEIGHT;
+    if(useKnobs)
+    {
+      sliderKnobs[i].knobY = knobY[i];
+      gains[i] = AudioUserDsp_CalculateGain(i, &sliderKnobs[i]);
+    }
+    AudioUserDsp_BiquadFilterConfig(&biquadFilters[i], gains[i], frequencies[i], bandwidths[i]);
+  }
+
+  printf("preset dB:");
+  for(int i = 0; i < NUMBER_OF_BANDS; i++)
+    printf(" %d", (int)biquadFilters[i].gain);
+  printf("\n");
+
+  WavInput input;
+  if(!DspRunner_OpenWav(argv[optind], &input))
+    return 1;
+
+  FILE* output = fopen(argv[optind + 1], "wb");
+  if(!output)
+  {
+    fprintf(stderr, "cannot create %s: %s\n", argv[optind + 1], strerror(errno));
+    return 1;
+  }
+  setvbuf(output, NULL, _IOFBF, OUTPUT_BUFFER);
+
+  WavHeader header = {
+    { 'R', 'I', 'F', 'F' }, 36 + input.dataSize, { 'W', 'A', 'V', 'E' }, { 'f', 'm', 't', ' ' }, 16,
+    WAV_FORMAT_PCM, USB_AUDIO_CONFIG_PLAY_CHANNEL_COUNT, USB_AUDIO_CONFIG_PLAY_DEF_FREQ,
+    USB_AUDIO_CONFIG_PLAY_DEF_FREQ * FRAME_SIZE, FRAME_SIZE, USB_AUDIO_CONFIG_PLAY_RES_BIT,
+    { 'd', 'a', 't', 'a' }, input.dataSize
+  };
+  fwrite(&header, sizeof(header), 1, output);
+
+  uint8_t packet[PACKET_SIZE];
+  double dspSeconds = 0;
+  struct timespec start, end, dspStart, dspEnd;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+
+  for(uint32_t offset = 0; offset < input.dataSize; offset += PACKET_SIZE)
+  {
+    uint32_t length = input.dataSize - offset;
+    if(length > PACKET_SIZE)
+      length = PACKET_SIZE;
+
+    memcpy(packet, input.data + offset, length);
+
+    clock_gettime(CLOCK_MONOTONIC, &dspStart);
+    AudioUserDsp_ProcessPacket(packet, length);
+    clock_gettime(CLOCK_MONOTONIC, &dspEnd);
+    dspSeconds += (dspEnd.tv_sec - dspStart.tv_sec) + (dspEnd.tv_nsec - dspStart.tv_nsec) * 1e-9;
+
+    if(fwrite(packet, 1, length, output) != length)
+    {
+      fprintf(stderr, "write failed: %s\n", strerror(errno));
+      fclose(output);
+      return 1;
+    }
+  }
+
+  if(fclose(output) != 0)
+  {
+    fprintf(stderr, "write failed: %s\n", strerror(errno));
+    return 1;
+  }
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  munmap((void*)input.map, input.mapSize);
+
+  double totalSeconds = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) * 1e-9;
+  double audioSeconds = (double)input.dataSize / (USB_AUDIO_CONFIG_PLAY_DEF_FREQ * FRAME_SIZE);
+
+  printf("%.1f s of audio, %u packets\n", audioSeconds, (input.dataSize + PACKET_SIZE - 1) / PACKET_SIZE);
+  printf("DSP only: %.3f s (%.0fx real time)\n", dspSeconds, dspSeconds > 0 ? audioSeconds / dspSeconds : 0.0);
+  printf("with I/O: %.3f s (%.0fx real time)\n", totalSeconds, totalSeconds > 0 ? audioSeconds / totalSeconds : 0.0);
+
+  return 0;
+}
+
+/**
+ * @brief  Prints the command line help.
+ * @param  program: argv[0]
+ * @retval None
+ */
+static void DspRunner_PrintUsage(const char* program)
+{
+  fprintf(stderr,
+    "usage: %s [-k y0,..,y7 | -f sector.bin | -g g0,..,g7] [-d mode] [-r taps.f32]\n"
+    "       input.wav output.wav\n"
+    "  -k  knob positions as stored by FlashPersistence_Write (%d = 0 dB)\n"
+    "  -f  raw dump of the preset sectors (0x%08X, 512 KB), e.g. from st-flash read\n"
+    "  -g  gains in dB, -15 to 15\n"
+    "  -d  requantisation: 0 round, 1 tpdf (default), 2 and 3 tpdf shaped to first\n"
+    "      and second order\n"
+    "  -r  FIR taps, raw little endian float32, 1 is unity gain, up to %d; the\n"
+    "      output comes %d frames late\n"
+    "input must be 16-bit stereo PCM at %d Hz, the format the board plays\n",
+    program, SLIDER_Y + SLIDER_HEIGHT / 2, FLASH_USER_START_ADDR, DSP_FIR_MAX_TAPS, DSP_FIR_DELAY_FRAMES,
+    USB_AUDIO_CONFIG_PLAY_DEF_FREQ);
+}
+
+/**
+ * @brief  Parses NUMBER_OF_BANDS comma separated integers.
+ * @param  text: argument
+ * @param  values: output
+ * @retval false if the list is malformed
+ */
+static bool DspRunner_ParseList(const char* text, int32_t* values)
+{
+  char* end;
+
+  for(int i = 0; i < NUMBER_OF_BANDS; i++)
+  {
+    values[i] = (int32_t)strtol(text, &end, 10);
+    if(end == text || (i < NUMBER_OF_BANDS - 1 && *end != ','))
+    {
+      fprintf(stderr, "expected %d comma separated values: %s\n", NUMBER_OF_BANDS, text);
+      return false;
+    }
+    text = end + 1;
+  }
+
+  return *end == '\0';
+}
+
+/**
+ * @brief  Reads the knob positions from a dump of the preset sectors: the
+ *         newest record of the flash journal, or without a journal the words
+ *         of the old format at the start, one little endian word per band.
+ * @param  path: dump file
+ * @param  knobY: output
+ * @retval false on error
+ */
+static bool DspRunner_ReadFlashDump(const char* path, int32_t* knobY)
+{
+  uint16_t positions[NUMBER_OF_BANDS];
+
+  FILE* file = fopen(path, "rb");
+  if(!file)
+  {
+    fprintf(stderr, "cannot open %s: %s\n", path, strerror(errno));
+    return false;
+  }
+
+  memset(journal, 0xFF, sizeof(journal));
+  size_t count = fread(journal, 1, sizeof(journal), file);
+  fclose(file);
+
+  FlashJournal_Init();
+  if(FlashJournal_Read(FLASH_PERSISTENCE_KEY_KNOBS, positions, sizeof(positions)) == sizeof(positions))
+  {
+    for(int i = 0; i < NUMBER_OF_BANDS; i++)
+      knobY[i] = positions[i];
+    return true;
+  }
+
+  if(count < NUMBER_OF_BANDS * 4)
+  {
+    fprintf(stderr, "%s: no journal record and less than %d bytes\n", path, NUMBER_OF_BANDS * 4);
+    return false;
+  }
+
+  const uint8_t* words = journal[0];
+  for(int i = 0; i < NUMBER_OF_BANDS; i++)
+    knobY[i] = (int32_t)(words[4 * i] | (words[4 * i + 1] << 8) | (words[4 * i + 2] << 16) | ((uint32_t)words[4 * i + 3] << 24));
+
+  return true;
+}
+
+/**
+ * @brief  Reads FIR taps and loads them on both channels.
+ * @param  path: raw float32 file
+ * @retval false on error
+ */
+static bool DspRunner_LoadFir(const char* path)
+{
+  FILE* file = fopen(path, "rb");
+  if(!file)
+  {
+    fprintf(stderr, "cannot open %s: %s\n", path, strerror(errno));
+    return false;
+  }
+
+  size_t count = fread(firTaps, sizeof(float), DSP_FIR_MAX_TAPS, file);
+  bool longer = fgetc(file) != EOF;
+  fclose(file);
+
+  if(count == 0 || longer)
+  {
+    fprintf(stderr, "%s: expected 1 to %d float32 taps\n", path, DSP_FIR_MAX_TAPS);
+    return false;
+  }
+
+  for(uint8_t channel = 0; channel < DSP_CHANNELS; channel++)
+    AudioUserDspFir_Load(channel, firTaps, (uint32_t)count);
+  printf("fir: %u taps\n", (uint32_t)count);
+
+  return true;
+}
+
+/**
+ * @brief  Maps a WAV file and locates its samples.
+ * @param  path: file name
+ * @param  input: filled on success
+ * @retval false if the file is missing or not in the board format
+ */
+static bool DspRunner_OpenWav(const char* path, WavInput* input)
+{
+  struct stat info;
+
+  int file = open(path, O_RDONLY);
+  if(file < 0 || fstat(file, &info) != 0)
+  {
+    fprintf(stderr, "cannot open %s: %s\n", path, strerror(errno));
+    return false;
+  }
+
+  if(info.st_size < 12)
+  {
+    fprintf(stderr, "%s: not a WAV file\n", path);
+    close(file);
+    return false;
+  }
+
+  input->mapSize = info.st_size;
+  input->map = mmap(NULL, input->mapSize, PROT_READ, MAP_PRIVATE, file, 0);
+  close(file);
+  if(input->map == MAP_FAILED)
+  {
+    fprintf(stderr, "cannot map %s: %s\n", path, strerror(errno));
+    return false;
+  }
+  madvise((void*)input->map, input->mapSize, MADV_SEQUENTIAL);
+
+  if(memcmp(input->map, "RIFF", 4) != 0 || memcmp(input->map + 8, "WAVE", 4) != 0)
+  {
+    fprintf(stderr, "%s: not a WAV file\n", path);
+    return false;
+  }
+
+  // walks the chunks, fmt must come before data
+  bool formatOk = false;
+  size_t offset = 12;
+  while(offset + 8 <= input->mapSize)
+  {
+    const uint8_t* chunk = input->map + offset;
+    uint32_t chunkSize = DspRunner_ReadU32(chunk + 4);
+
+    if(memcmp(chunk, "fmt ", 4) == 0 && chunkSize >= 16 && offset + 8 + 16 <= input->mapSize)
+    {
+      uint16_t format        = chunk[8] | (chunk[9] << 8);
+      uint16_t channels      = chunk[10] | (chunk[11] << 8);
+      uint32_t sampleRate    = DspRunner_ReadU32(chunk + 12);
+      uint16_t bitsPerSample = chunk[22] | (chunk[23] << 8);
+
+      if(format != WAV_FORMAT_PCM || channels != USB_AUDIO_CONFIG_PLAY_CHANNEL_COUNT
+         || sampleRate != USB_AUDIO_CONFIG_PLAY_DEF_FREQ || bitsPerSample != USB_AUDIO_CONFIG_PLAY_RES_BIT)
+      {
+        fprintf(stderr, "%s: %u ch, %u Hz, %u bit (format %u) is not supported, expected 2 ch, %d Hz, 16 bit PCM\n",
+                path, channels, sampleRate, bitsPerSample, format, USB_AUDIO_CONFIG_PLAY_DEF_FREQ);
+        return false;
+      }
+      formatOk = true;
+    }
+    else if(memcmp(chunk, "data", 4) == 0)
+    {
+      if(!formatOk)
+        break;
+
+      input->data = chunk + 8;
+      input->dataSize = chunkSize;
+      // a truncated file keeps whatever whole frames it has
+      if(offset + 8 + (size_t)chunkSize > input->mapSize)
+        input->dataSize = input->mapSize - offset - 8;
+      input->dataSize -= input->dataSize % FRAME_SIZE;
+      return true;
+    }
+
+    offset += 8 + (size_t)chunkSize + (chunkSize & 1);
+  }
+
+  fprintf(stderr, "%s: no fmt/data chunk\n", path);
+  return false;
+}
+
+/**
+ * @brief  Reads a little endian 32-bit value.
+ * @param  pointer: first byte
+ * @retval value
+ */
+static uint32_t DspRunner_ReadU32(const uint8_t* pointer)
+{
+  return pointer[0] | (pointer[1] << 8) | (pointer[2] << 16) | ((uint32_t)pointer[3] << 24);
+}
+
+// the dump is read only
+const uint8_t* FlashJournalBackend_Sector(uint8_t sector)
+{
+  return journal[sector];
+}
+
+void FlashJournalBackend_StartErase(uint8_t sector)
+{
+  (void)sector;
+}
+
+void FlashJournalBackend_StartProgram(uint8_t sector, uint32_t offset, const uint32_t* words, uint32_t count)
+{
+  (void)sector;
+  (void)offset;
+  (void)words;
+  (void)count;
+}
+
+bool FlashJournalBackend_IsBusy(void)
+{
+  return false;
+}
@@ -0,0 +1,508 @@
+/**
+  ******************************************************************************
+  * @file    dynamics_sim.c
+  * @brief   Checks the compressor and the look-ahead limiter of the EQ output
+  *          on the host. The stages are fed float frames directly, in chunks
+  *          of random length so blocks span calls, except for the last
+  *          check. Checks:
+  *          - transparent: below the ceiling the limiter passes the samples
+  *            unchanged, DSP_DYNAMICS_DELAY_FRAMES late;
+  *          - overshoot: noise bursts up to 20 dB over full scale, clicks and
+  *            steps never come out above the ceiling;
+  *          - falling peaks: staircases that fall from block to block for
+  *            longer than the look-ahead, with a release of 1 ms, never come
+  *            out above the ceiling either;
+  *          - attack: a step to 12 dB over the ceiling is met at the ceiling,
+  *            the gain falls steadily and starts no earlier than the
+  *            look-ahead;
+  *          - release: after the step the gain starts to recover within two
+  *            blocks and gets back to 1/e of its reduction within the release
+  *            time and the look-ahead;
+  *          - static curve: levels from 10 dB under to 20 dB over the
+  *            threshold settle to the gain of the ratio and the makeup,
+  *            within 0.05 dB;
+  *          - compressor attack, compressor release: the mean square the
+  *            gain comes from reaches 1/e of a 15 dB step within a block of
+  *            the attack and release times;
+  *          - packet path: full scale noise through the all boost preset
+  *            without headroom clips with the limiter off and stays under
+  *            the ceiling with it on.
+  *
+  *          The cycle cost is the process_packet_limiter, _compressor and
+  *          _dynamics cases of Tools/DspBench.
+  *
+  *          build (from Tools, the sources are listed in its Makefile):
+  *            make build/dynamics_sim
+  *
+  *          usage:
+  *            ./dynamics_sim   (exit status 1 if a check fails)
+  ******************************************************************************
+  */
+
+#include "audio_user_dsp.h"
+#include "audio_user_dsp_dynamics.h"
+#include "usb_audio.h"
+#include "sim_report.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// private defines -------------------------------------------------------------
+#define SAMPLE_RATE         USB_AUDIO_CONFIG_PLAY_DEF_FREQ
+#define PACKET_SIZE         AUDIO_MS_PACKET_SIZE(SAMPLE_RATE, USB_AUDIO_CONFIG_PLAY_CHANNEL_COUNT, USB_AUDIO_CONFIG_PLAY_RES_BYTE)
+#define FRAMES_PER_PACKET   (PACKET_SIZE / 4)
+#define FRAMES              (10 * SAMPLE_RATE)
+#define PACKETS             2000
+#define FULL_SCALE          32767.0
+#define BLOCK               DSP_DYNAMICS_BLOCK_FRAMES
+#define DELAY               DSP_DYNAMICS_DELAY_FRAMES
+// longest chunk handed to the stages at once
+#define MAX_CHUNK           100
+// float rounding of the gain, relative
+#define TOLERANCE           1e-5
+#define CURVE_TOLERANCE_DB  0.05
+#define CEILING_DB          (-1.0f)
+#define RELEASE_MS          50.0f
+#define THRESHOLD_DB        (-20.0f)
+#define RATIO               3.0f
+#define ATTACK_MS           5.0f
+#define COMPRESSOR_RELEASE_MS 100.0f
+#define MAKEUP_DB           6.0f
+// where the steps of the attack and release checks start, off a block boundary
+#define STEP_FRAME          (SAMPLE_RATE + 3)
+#define STEP_FRAMES         (SAMPLE_RATE / 2)
+// release short enough for the gain to recover between the blocks of a
+// staircase, and its steps: 0.5 dB a block, twice the look-ahead long
+#define FALLING_RELEASE_MS  1.0f
+#define FALLING_STEP_DB     0.5
+#define FALLING_BLOCKS      (2 * DSP_DYNAMICS_LOOKAHEAD_BLOCKS + 2)
+
+// variables -------------------------------------------------------------------
+
+// normally owned by main.c
+float in_z1  = 0;
+float in_z2  = 0;
+float out_z1 = 0;
+float out_z2 = 0;
+
+// band layout, normally defined in audio_usb_nodes.c
+int16_t frequencies[] = {30, 60, 150, 400, 1000, 3000, 8000, 16000};
+int16_t bandwidths[] =  {1,   1,   2,   2,    2,    3,    3,     3};
+
+// private variables -----------------------------------------------------------
+static float    input[2 * FRAMES];
+static float    output[2 * FRAMES];
+static uint32_t randomState = 1;
+
+static const int16_t allBoost[NUMBER_OF_BANDS] = {15, 15, 15, 15, 15, 15, 15, 15};
+
+// private function declarations -----------------------------------------------
+static bool     DynamicsSim_Transparent(void);
+static bool     DynamicsSim_Overshoot(void);
+static bool     DynamicsSim_FallingPeaks(void);
+static bool     DynamicsSim_Limiter(void);
+static bool     DynamicsSim_Curve(void);
+static bool     DynamicsSim_Compressor(void);
+static bool     DynamicsSim_Packets(void);
+static void     DynamicsSim_Configure(bool limiter, bool compressor);
+static void     DynamicsSim_Run(uint32_t frames);
+static void     DynamicsSim_Constant(uint32_t from, uint32_t to, float level);
+static double   DynamicsSim_Gain(uint32_t frame, uint32_t delay);
+static uint32_t DynamicsSim_MeanSquareTime(uint32_t from, uint32_t to, double start, double end);
+static double   DynamicsSim_Uniform(void);
+
+int main(void)
+{
+  bool passed = true;
+
+  passed &= DynamicsSim_Transparent();
+  passed &= DynamicsSim_Overshoot();
+  passed &= DynamicsSim_FallingPeaks();
+  passed &= DynamicsSim_Limiter();
+  passed &= DynamicsSim_Curve();
+  passed &= DynamicsSim_Compressor();
+  passed &= DynamicsSim_Packets();
+
+  printf("%s\n", passed ? "all checks passed" : "CHECK FAILED");
+  return passed ? 0 : 1;
+}
+
+/**
+ * @brief  Noise at -20 dBFS through the limiter alone.
+ * @param  None
+ * @retval true if the output is the input delayed, bit for bit
+ */
+static bool DynamicsSim_Transparent(void)
+{
+  bool exact = true;
+
+  for(uint32_t i = 0; i < 2 * FRAMES; i++)
+    input[i] = (float)(0.1 * FULL_SCALE * (2.0 * DynamicsSim_Uniform() - 1.0));
+
+  DynamicsSim_Configure(true, false);
+  DynamicsSim_Run(FRAMES);
+
+  for(uint32_t i = 0; i < 2 * FRAMES; i++)
+    exact &= output[i] == ((i < 2 * DELAY) ? 0.0f : input[i - 2 * DELAY]);
+
+  printf("  transparent: delay %u frames (%.2f ms), %s\n", DELAY, 1000.0 * DELAY / SAMPLE_RATE, exact ? "exact" : "changed");
+  return SimReport_Check("transparent", exact);
+}
+
+/**
+ * @brief  Bursts of noise, clicks and steps well over full scale through the
+ *         limiter.
+ * @param  None
+ * @retval true if no sample comes out above the ceiling
+ */
+static bool DynamicsSim_Overshoot(void)
+{
+  const double ceiling = FULL_SCALE * pow(10.0, CEILING_DB / 20.0);
+  uint32_t over = 0;
+  double peak = 0;
+
+  for(uint32_t f = 0; f < FRAMES;)
+  {
+    uint32_t length = 1 + (uint32_t)(DynamicsSim_Uniform() * SAMPLE_RATE / 20);
+    double level = FULL_SCALE * pow(10.0, (DynamicsSim_Uniform() * 60.0 - 40.0) / 20.0);
+    uint32_t kind = (uint32_t)(DynamicsSim_Uniform() * 3);
+
+    for(uint32_t n = 0; n < length && f < FRAMES; n++, f++)
+    {
+      // noise, a click at the start of a silence, a constant with a sign per channel
+      double left = (kind == 0) ? level * (2.0 * DynamicsSim_Uniform() - 1.0) : (kind == 1) ? ((n == 0) ? level : 0.0) : level;
+      double right = (kind == 0) ? level * (2.0 * DynamicsSim_Uniform() - 1.0) : (kind == 1) ? 0.0 : -level;
+
+      input[2 * f] = (float)left;
+      input[2 * f + 1] = (float)right;
+    }
+  }
+
+  DynamicsSim_Configure(true, false);
+  DynamicsSim_Run(FRAMES);
+
+  for(uint32_t i = 0; i < 2 * FRAMES; i++)
+  {
+    if(fabs(output[i]) > ceiling * (1.0 + TOLERANCE))
+      over++;
+    if(fabs(output[i]) > peak)
+      peak = fabs(output[i]);
+  }
+
+  printf("  overshoot: %u samples over the ceiling, peak %.3f dBFS (ceiling %.3f dBFS)\n",
+         over, 20.0 * log10(peak / FULL_SCALE), (double)CEILING_DB);
+  return SimReport_Check("overshoot", over == 0);
+}
+
+/**
+ * @brief  Staircases of blocks from 20 dB over the ceiling, each block
+ *         FALLING_STEP_DB under the one before, through the limiter with a
+ *         release of FALLING_RELEASE_MS. Every block peak is lower than the
+ *         ones in the look-ahead before it, so the highest of them must stay
+ *         in the window after newer, lower ones come in.
+ * @param  None
+ * @retval true if no sample comes out above the ceiling
+ */
+static bool DynamicsSim_FallingPeaks(void)
+{
+  const double ceiling = FULL_SCALE * pow(10.0, CEILING_DB / 20.0);
+  AudioUserDspDynamicsSettings settings;
+  uint32_t over = 0;
+  double peak = 0;
+
+  for(uint32_t f = 0; f < FRAMES; f++)
+  {
+    uint32_t block = (f / BLOCK) % (2 * FALLING_BLOCKS);
+    // the staircase, then as many blocks of silence for the gain to recover
+    double level = (block < FALLING_BLOCKS) ? ceiling * pow(10.0, (20.0 - FALLING_STEP_DB * block) / 20.0) : 0.0;
+    double sign = (f & 1) ? -1.0 : 1.0;
+
+    input[2 * f] = (float)(sign * level);
+    input[2 * f + 1] = (float)(-sign * level);
+  }
+
+  AudioUserDspDynamics_DefaultSettings(&settings);
+  settings.limiter = true;
+  settings.ceilingDb = CEILING_DB;
+  settings.limiterReleaseMs = FALLING_RELEASE_MS;
+  AudioUserDspDynamics_Configure(&settings);
+  AudioUserDspDynamics_Reset();
+  DynamicsSim_Run(FRAMES);
+
+  for(uint32_t i = 0; i < 2 * FRAMES; i++)
+  {
+    if(fabs(output[i]) > ceiling * (1.0 + TOLERANCE))
+      over++;
+    if(fabs(output[i]) > peak)
+      peak = fabs(output[i]);
+  }
+
+  printf("  falling peaks: %u samples over the ceiling, peak %.3f dBFS (ceiling %.3f dBFS)\n",
+         over, 20.0 * log10(peak / FULL_SCALE), (double)CEILING_DB);
+  return SimReport_Check("falling peaks", over == 0);
+}
+
+/**
+ * @brief  A constant at half the ceiling steps up to 12 dB over it and back
+ *         down, through the limiter.
+ * @param  None
+ * @retval true if both the attack and the release check pass
+ */
+static bool DynamicsSim_Limiter(void)
+{
+  const double ceiling = FULL_SCALE * pow(10.0, CEILING_DB / 20.0);
+  const uint32_t stepEnd = STEP_FRAME + STEP_FRAMES;
+  uint32_t attackStart = 0, releaseStart = 0, releaseFrame = 0;
+  bool falling = true;
+  double previous = 1.0;
+
+  DynamicsSim_Constant(0, FRAMES, (float)(ceiling / 2));
+  DynamicsSim_Constant(STEP_FRAME, stepEnd, (float)(ceiling * 4));
+  DynamicsSim_Configure(true, false);
+  DynamicsSim_Run(FRAMES);
+
+  // in output frames: the step comes out at STEP_FRAME + DELAY
+  for(uint32_t n = DELAY; n < STEP_FRAME + DELAY + 2 * BLOCK; n++)
+  {
+    double gain = DynamicsSim_Gain(n, DELAY);
+
+    if(attackStart == 0 && gain < 1.0)
+      attackStart = n;
+    if(gain > previous)
+      falling = false;
+    previous = gain;
+  }
+
+  double atStep = output[2 * (STEP_FRAME + DELAY)];
+  bool attack = falling && attackStart >= STEP_FRAME && atStep <= ceiling * (1.0 + TOLERANCE) && atStep >= ceiling * 0.99;
+
+  printf("  attack: starts %u frames ahead of the step, the step comes out at %.3f dBFS\n",
+         STEP_FRAME + DELAY - attackStart, 20.0 * log10(atStep / FULL_SCALE));
+
+  double reduced = DynamicsSim_Gain(stepEnd + DELAY - 1, DELAY);
+  for(uint32_t n = stepEnd + DELAY; n < FRAMES; n++)
+  {
+    double gain = DynamicsSim_Gain(n, DELAY);
+
+    if(releaseStart == 0 && gain > reduced)
+      releaseStart = n;
+    if(releaseStart != 0 && 1.0 - gain <= (1.0 - reduced) / M_E)
+    {
+      releaseFrame = n;
+      break;
+    }
+  }
+
+  const uint32_t releaseFrames = (uint32_t)(RELEASE_MS * SAMPLE_RATE / 1000);
+  bool release = releaseStart != 0 && releaseStart <= stepEnd + DELAY + 2 * BLOCK &&
+                 releaseFrame >= releaseStart + releaseFrames - BLOCK &&
+                 releaseFrame <= releaseStart + releaseFrames + DSP_DYNAMICS_LOOKAHEAD_BLOCKS * BLOCK;
+
+  printf("  release: starts %u frames after the step, 1/e after %u frames (release %u)\n",
+         releaseStart - (stepEnd + DELAY), releaseFrame - releaseStart, releaseFrames);
+
+  return SimReport_Check("attack", attack) & SimReport_Check("release", release);
+}
+
+/**
+ * @brief  Settles the compressor on constants from 10 dB under to 20 dB over
+ *         the threshold.
+ * @param  None
+ * @retval true if every level gets the gain of the static curve
+ */
+static bool DynamicsSim_Curve(void)
+{
+  // a constant has the mean square of a sine 3 dB louder
+  const double threshold = FULL_SCALE * pow(10.0, THRESHOLD_DB / 20.0) / sqrt(2.0);
+  double worst = 0;
+
+  for(int32_t over = -10; over <= 20; over += 5)
+  {
+    DynamicsSim_Constant(0, FRAMES, (float)(threshold * pow(10.0, over / 20.0)));
+    DynamicsSim_Configure(false, true);
+    DynamicsSim_Run(SAMPLE_RATE);
+
+    double expected = MAKEUP_DB + ((over > 0) ? over * (1.0 / RATIO - 1.0) : 0.0);
+    double gain = 20.0 * log10(DynamicsSim_Gain(SAMPLE_RATE - 1, 0));
+    if(fabs(gain - expected) > worst)
+      worst = fabs(gain - expected);
+  }
+
+  printf("  static curve: worst difference %.4f dB\n", worst);
+  return SimReport_Check("static curve", worst <= CURVE_TOLERANCE_DB);
+}
+
+/**
+ * @brief  Steps a constant from 5 dB to 20 dB over the threshold and back,
+ *         and follows the mean square through the gain.
+ * @param  None
+ * @retval true if the 1/e times are the attack and release
+ */
+static bool DynamicsSim_Compressor(void)
+{
+  const double threshold = FULL_SCALE * pow(10.0, THRESHOLD_DB / 20.0) / sqrt(2.0);
+  const double low = threshold * pow(10.0, 5.0 / 20.0);
+  const double high = threshold * pow(10.0, 20.0 / 20.0);
+  const uint32_t stepEnd = STEP_FRAME + STEP_FRAMES;
+
+  DynamicsSim_Constant(0, FRAMES, (float)low);
+  DynamicsSim_Constant(STEP_FRAME, stepEnd, (float)high);
+  DynamicsSim_Configure(false, true);
+  DynamicsSim_Run(FRAMES);
+
+  uint32_t attack = DynamicsSim_MeanSquareTime(STEP_FRAME, stepEnd, low * low, high * high);
+  uint32_t release = DynamicsSim_MeanSquareTime(stepEnd, FRAMES, high * high, low * low);
+  const uint32_t attackFrames = (uint32_t)(ATTACK_MS * SAMPLE_RATE / 1000);
+  const uint32_t releaseFrames = (uint32_t)(COMPRESSOR_RELEASE_MS * SAMPLE_RATE / 1000);
+
+  printf("  compressor: mean square 1/e after %u frames rising (attack %u), %u falling (release %u)\n",
+         attack, attackFrames, release, releaseFrames);
+
+  // the gain of a block comes from the one before it
+  return SimReport_Check("compressor attack", attack + BLOCK >= attackFrames && attack <= attackFrames + 2 * BLOCK) &
+         SimReport_Check("compressor release", release + BLOCK >= releaseFrames && release <= releaseFrames + 2 * BLOCK);
+}
+
+/**
+ * @brief  Full scale noise through the packet path with every band at +15
+ *         dB and no headroom, without and with the limiter, dither off.
+ * @param  None
+ * @retval true if the limiter takes the output from clipping to under its
+ *         ceiling
+ */
+static bool DynamicsSim_Packets(void)
+{
+  const int32_t ceiling = (int32_t)lround(FULL_SCALE * pow(10.0, CEILING_DB / 20.0));
+  uint32_t over[2] = { 0, 0 };
+  uint8_t packet[PACKET_SIZE];
+
+  AudioUserDsp_SetDither(DSP_DITHER_OFF);
+  for(uint32_t pass = 0; pass < 2; pass++)
+  {
+    for(uint8_t i = 0; i < NUMBER_OF_BANDS; i++)
+    {
+      biquadFilters[i].isInitialized = false;
+      AudioUserDsp_BiquadFilterConfig(&biquadFilters[i], allBoost[i], frequencies[i], bandwidths[i]);
+    }
+    DynamicsSim_Configure(pass == 1, false);
+
+    for(uint32_t p = 0; p < PACKETS; p++)
+    {
+      for(uint32_t f = 0; f < FRAMES_PER_PACKET; f++)
+      {
+        int16_t left = (int16_t)(FULL_SCALE * (2.0 * DynamicsSim_Uniform() - 1.0));
+        int16_t right = (int16_t)(FULL_SCALE * (2.0 * DynamicsSim_Uniform() - 1.0));
+        AudioUserDsp_SamplesToFrame(packet + 4 * f, &left, &right);
+      }
+
+      AudioUserDsp_ProcessPacket(packet, PACKET_SIZE);
+
+      for(uint32_t f = 0; f < FRAMES_PER_PACKET; f++)
+      {
+        int16_t left, right;
+        AudioUserDsp_FrameToSamples(packet + 4 * f, &left, &right);
+        over[pass] += (abs(left) > ceiling) + (abs(right) > ceiling);
+      }
+    }
+  }
+
+  printf("  packet path: %u samples over the ceiling without the limiter, %u with it\n", over[0], over[1]);
+  return SimReport_Check("packet path", over[0] > 0 && over[1] == 0);
+}
+
+/**
+ * @brief  Sets the stages with the parameters of the checks, from scratch.
+ * @param  limiter: on
+ * @param  compressor: on
+ * @retval None
+ */
+static void DynamicsSim_Configure(bool limiter, bool compressor)
+{
+  AudioUserDspDynamicsSettings settings;
+
+  AudioUserDspDynamics_DefaultSettings(&settings);
+  settings.limiter = limiter;
+  settings.ceilingDb = CEILING_DB;
+  settings.limiterReleaseMs = RELEASE_MS;
+  settings.compressor = compressor;
+  settings.thresholdDb = THRESHOLD_DB;
+  settings.ratio = RATIO;
+  settings.attackMs = ATTACK_MS;
+  settings.releaseMs = COMPRESSOR_RELEASE_MS;
+  settings.makeupDb = MAKEUP_DB;
+  AudioUserDspDynamics_Configure(&settings);
+  AudioUserDspDynamics_Reset();
+}
+
+/**
+ * @brief  Copies the input to the output and runs the stages over it in
+ *         chunks of random length.
+ * @param  frames: from the start
+ * @retval None
+ */
+static void DynamicsSim_Run(uint32_t frames)
+{
+  memcpy(output, input, 2 * frames * sizeof(float));
+
+  for(uint32_t f = 0; f < frames;)
+  {
+    uint32_t chunk = 1 + (uint32_t)(DynamicsSim_Uniform() * MAX_CHUNK);
+
+    if(chunk > frames - f)
+      chunk = frames - f;
+    AudioUserDspDynamics_Process(&output[2 * f], chunk);
+    f += chunk;
+  }
+}
+
+// both channels of a range of input frames at a level
+static void DynamicsSim_Constant(uint32_t from, uint32_t to, float level)
+{
+  for(uint32_t f = from; f < to; f++)
+  {
+    input[2 * f] = level;
+    input[2 * f + 1] = level;
+  }
+}
+
+// gain the stages applied to an output frame, left channel
+static double DynamicsSim_Gain(uint32_t frame, uint32_t delay)
+{
+  return (double)output[2 * frame] / input[2 * (frame - delay)];
+}
+
+/**
+ * @brief  Finds when the mean square the compressor follows, recovered from
+ *         its gain, has covered all but 1/e of a step. The gain is
+ *         (mean square / threshold)^((1 / ratio - 1) / 2) times the makeup.
+ * @param  from: frame of the step
+ * @param  to: last frame to look at
+ * @param  start: mean square before the step
+ * @param  end: mean square it moves to
+ * @retval frames after the step, 0 if it does not get there
+ */
+static uint32_t DynamicsSim_MeanSquareTime(uint32_t from, uint32_t to, double start, double end)
+{
+  const double threshold = pow(FULL_SCALE * pow(10.0, THRESHOLD_DB / 20.0), 2.0) / 2.0;
+  const double exponent = (1.0 / RATIO - 1.0) / 2.0;
+  const double makeup = pow(10.0, MAKEUP_DB / 20.0);
+
+  for(uint32_t n = from; n < to; n++)
+  {
+    double meanSquare = threshold * pow(DynamicsSim_Gain(n, 0) / makeup, 1.0 / exponent);
+
+    if(fabs(end - meanSquare) <= fabs(end - start) / M_E)
+      return n - from;
+  }
+  return 0;
+}
+
+// uniform in [0, 1) from xorshift32
+static double DynamicsSim_Uniform(void)
+{
+  randomState ^= randomState << 13;
+  randomState ^= randomState >> 17;
+  randomState ^= randomState << 5;
+  return randomState / 4294967296.0;
+}
@@ -0,0 +1,599 @@
+/**
+  ******************************************************************************
+  * @file    horoscope_eq.c
+  * @brief   Linux tool that sets the EQ of the board over USB, with the vendor
+  *          requests of eq_control_request.h. Talks to usbdevfs directly, no
+  *          libusb; the requests go to the device, no interface is claimed,
+  *          so it runs while the audio plays. Needs write access to the
+  *          device node (root, or a udev rule for 0483:5730).
+  *
+  *          A band is written gain[:frequency[:q]], in dB, Hz and Q. The
+  *          filters take their bandwidth in whole octaves, so the Q is
+  *          rounded to the nearest one and the Q used is printed. What is
+  *          left out keeps its value on the board.
+  *
+  *          A FIR filter is read from a file of float32 taps, as DspRunner -r
+  *          takes, and sent in chunks; "off" removes the filter of the
+  *          channel. The board takes up to the taps info reports.
+  *
+  *          dynamics alone prints the compressor and the limiter; otherwise
+  *          the stages named are turned on, the others off, and a value left
+  *          out keeps its value on the board. Levels in dB, times in ms.
+  *
+  *          build (from Tools, the sources are listed in its Makefile):
+  *            make build/horoscope_eq
+  *
+  *          usage:
+  *            ./horoscope_eq [-d /dev/bus/usb/001/004] info
+  *            ./horoscope_eq [-d ...] get
+  *            ./horoscope_eq [-d ...] set <band> <gain[:frequency[:q]]>
+  *            ./horoscope_eq [-d ...] preset [-s slot -n name] <8 x gain[:frequency[:q]]>
+  *            ./horoscope_eq [-d ...] fir <0|1> <taps.f32|off>
+  *            ./horoscope_eq [-d ...] dynamics [off | limiter[:ceiling[:release]]
+  *                                      compressor[:threshold[:ratio[:attack[:release[:makeup]]]]]]
+  ******************************************************************************
+  */
+
+#define _DEFAULT_SOURCE
+
+#include "eq_control_request.h"
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/usbdevice_fs.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+// private defines -------------------------------------------------------------
+#define SYSFS_DEVICES       "/sys/bus/usb/devices"
+#define PATH_CAPACITY       300
+#define TRANSFER_TIMEOUT_MS 1000
+// the main loop applies a set within a few task periods
+#define APPLY_TIMEOUT_MS    1000
+#define APPLY_POLL_MS       5
+// bmRequestType of the requests, vendor, device recipient
+#define REQUEST_TYPE_IN     0xC0
+#define REQUEST_TYPE_OUT    0x40
+
+// private typedefs ------------------------------------------------------------
+typedef struct Options
+{
+  const char* device;
+  int         slot;                   // 0 applies only
+  const char* name;
+  int         argc;                   // command and its arguments
+  char**      argv;
+} Options;
+
+// private function declarations -----------------------------------------------
+static void EqTool_PrintUsage(const char* program);
+static bool EqTool_ParseOptions(int argc, char** argv, Options* options);
+static bool EqTool_FindDevice(char* path, size_t capacity);
+static int  EqTool_Control(int device, uint8_t requestType, uint8_t request, uint16_t value, uint16_t index, void* data, uint16_t length);
+static bool EqTool_ParseBand(const char* text, EqControlBand* band);
+static bool EqTool_WaitApplied(int device);
+static void EqTool_PrintBand(uint8_t index, const EqControlBand* band);
+static int  EqTool_Info(int device);
+static int  EqTool_Get(int device);
+static int  EqTool_Set(int device, const Options* options);
+static int  EqTool_Preset(int device, const Options* options);
+static int  EqTool_Fir(int device, const Options* options);
+static int  EqTool_Dynamics(int device, const Options* options);
+static bool EqTool_ParseStage(const char* text, EqControlDynamics* dynamics);
+static void EqTool_PrintDynamics(const EqControlDynamics* dynamics);
+static double EqTool_OctavesToQ(int16_t octaves);
+static int16_t EqTool_QToOctaves(double q);
+
+int main(int argc, char** argv)
+{
+  Options options = { NULL, 0, "", 0, NULL };
+  char path[PATH_CAPACITY];
+  int result = 1;
+
+  if(!EqTool_ParseOptions(argc, argv, &options))
+  {
+    EqTool_PrintUsage(argv[0]);
+    return 1;
+  }
+
+  if(options.device == NULL)
+  {
+    if(!EqTool_FindDevice(path, sizeof(path)))
+    {
+      fprintf(stderr, "no device %04x:%04x found\n", EQ_CONTROL_VENDOR_ID, EQ_CONTROL_PRODUCT_ID);
+      return 1;
+    }
+    options.device = path;
+  }
+
+  int device = open(options.device, O_RDWR);
+  if(device < 0)
+  {
+    fprintf(stderr, "cannot open %s: %s\n", options.device, strerror(errno));
+    return 1;
+  }
+
+  const char* command = options.argv[0];
+  if(strcmp(command, "info") == 0 && options.argc == 1)
+    result = EqTool_Info(device);
+  else if(strcmp(command, "get") == 0 && options.argc == 1)
+    result = EqTool_Get(device);
+  else if(strcmp(command, "set") == 0 && options.argc == 3)
+    result = EqTool_Set(device, &options);
+  else if(strcmp(command, "preset") == 0 && options.argc == 1 + EQ_CONTROL_BANDS)
+    result = EqTool_Preset(device, &options);
+  else if(strcmp(command, "fir") == 0 && options.argc == 3)
+    result = EqTool_Fir(device, &options);
+  else if(strcmp(command, "dynamics") == 0 && options.argc <= 3)
+    result = EqTool_Dynamics(device, &options);
+  else
+    EqTool_PrintUsage(argv[0]);
+
+  close(device);
+  return result;
+}
+
+static void EqTool_PrintUsage(const char* program)
+{
+  fprintf(stderr,
+          "usage: %s [-d device] info\n"
+          "       %s [-d device] get\n"
+          "       %s [-d device] set <band> <gain[:frequency[:q]]>\n"
+          "       %s [-d device] preset [-s slot -n name] <%u x gain[:frequency[:q]]>\n"
+          "       %s [-d device] fir <0|1> <taps.f32|off>\n"
+          "       %s [-d device] dynamics [off | limiter[:ceiling[:release]]\n"
+          "                  compressor[:threshold[:ratio[:attack[:release[:makeup]]]]]]\n"
+          "  -d  usbdevfs node, e.g. /dev/bus/usb/001/004 (default: found by id)\n"
+          "  -s  also save the preset to this slot (1 to slots - 1, see info)\n"
+          "  -n  name of the saved preset, up to %u characters\n",
+          program, program, program, program, EQ_CONTROL_BANDS, program, program, EQ_CONTROL_NAME_LENGTH);
+}
+
+static bool EqTool_ParseOptions(int argc, char** argv, Options* options)
+{
+  int option;
+
+  // stops at the command, a negative gain is not an option
+  while((option = getopt(argc, argv, "+d:s:n:")) != -1)
+  {
+    switch(option)
+    {
+      case 'd':
+        options->device = optarg;
+        break;
+      case 's':
+        options->slot = atoi(optarg);
+        if(options->slot <= 0)
+          return false;
+        break;
+      case 'n':
+        options->name = optarg;
+        if(strlen(options->name) > EQ_CONTROL_NAME_LENGTH)
+          return false;
+        break;
+      default:
+        return false;
+    }
+  }
+
+  // preset options may also follow the command, before the bands; a band
+  // can start with a minus, so getopt is not used here
+  if(optind < argc && strcmp(argv[optind], "preset") == 0)
+  {
+    while(optind + 2 < argc && (strcmp(argv[optind + 1], "-s") == 0 || strcmp(argv[optind + 1], "-n") == 0))
+    {
+      if(argv[optind + 1][1] == 's')
+        options->slot = atoi(argv[optind + 2]);
+      else
+        options->name = argv[optind + 2];
+      if(options->slot < 0 || strlen(options->name) > EQ_CONTROL_NAME_LENGTH)
+        return false;
+
+      // the command moves over the option, the bands follow it
+      argv[optind + 2] = argv[optind];
+      optind += 2;
+    }
+  }
+
+  options->argc = argc - optind;
+  options->argv = &argv[optind];
+  return options->argc > 0;
+}
+
+/**
+ * @brief  Looks for the board in sysfs.
+ * @param  path: receives its usbdevfs node
+ * @param  capacity: of path
+ * @retval false if it is not plugged
+ */
+static bool EqTool_FindDevice(char* path, size_t capacity)
+{
+  DIR* devices = opendir(SYSFS_DEVICES);
+  struct dirent* entry;
+  bool found = false;
+
+  if(devices == NULL)
+    return false;
+
+  while(!found && (entry = readdir(devices)) != NULL)
+  {
+    unsigned vendor = 0, product = 0, bus = 0, address = 0;
+    char file[PATH_CAPACITY];
+    FILE* attribute;
+
+    snprintf(file, sizeof(file), SYSFS_DEVICES "/%s/uevent", entry->d_name);
+    attribute = fopen(file, "r");
+    if(attribute == NULL)
+      continue;
+
+    char line[128];
+    while(fgets(line, sizeof(line), attribute))
+    {
+      sscanf(line, "PRODUCT=%x/%x/", &vendor, &product);
+      sscanf(line, "BUSNUM=%u", &bus);
+      sscanf(line, "DEVNUM=%u", &address);
+    }
+    fclose(attribute);
+
+    if(vendor == EQ_CONTROL_VENDOR_ID && product == EQ_CONTROL_PRODUCT_ID && bus != 0)
+    {
+      snprintf(path, capacity, "/dev/bus/usb/%03u/%03u", bus, address);
+      found = true;
+    }
+  }
+
+  closedir(devices);
+  return found;
+}
+
+/**
+ * @brief  One control transfer.
+ * @retval bytes of the data stage, -1 if it failed (a stall shows as EPIPE)
+ */
+static int EqTool_Control(int device, uint8_t requestType, uint8_t request, uint16_t value, uint16_t index, void* data, uint16_t length)
+{
+  struct usbdevfs_ctrltransfer transfer = {
+    .bRequestType = requestType,
+    .bRequest = request,
+    .wValue = value,
+    .wIndex = index,
+    .wLength = length,
+    .timeout = TRANSFER_TIMEOUT_MS,
+    .data = data,
+  };
+
+  int result = ioctl(device, USBDEVFS_CONTROL, &transfer);
+  if(result < 0)
+    fprintf(stderr, "request 0x%02x failed: %s\n", request, errno == EPIPE ? "refused by the device" : strerror(errno));
+  return result;
+}
+
+/**
+ * @brief  Reads gain[:frequency[:q]] over the band as it is.
+ * @param  text: argument
+ * @param  band: holds the current band, receives the new one
+ * @retval false if the text or a value is not valid
+ */
+static bool EqTool_ParseBand(const char* text, EqControlBand* band)
+{
+  double gain, frequency, q;
+  int fields = sscanf(text, "%lf:%lf:%lf", &gain, &frequency, &q);
+
+  if(fields < 1)
+    return false;
+
+  band->gain = (int16_t)lround(gain);
+  if(fields >= 2)
+    band->frequency = (int16_t)lround(frequency);
+  if(fields >= 3)
+  {
+    if(q <= 0)
+      return false;
+    band->bandwidth = EqTool_QToOctaves(q);
+    if(fabs(EqTool_OctavesToQ(band->bandwidth) - q) > 0.005)
+      printf("q %.2f rounded to %.2f (%d octaves)\n", q, EqTool_OctavesToQ(band->bandwidth), band->bandwidth);
+  }
+
+  if(!EqControlRequest_IsValidBand(band))
+  {
+    fprintf(stderr, "%s: out of range (gain %d to %d dB, frequency %d to %d Hz, %d to %d octaves)\n", text,
+            EQ_CONTROL_GAIN_MIN, EQ_CONTROL_GAIN_MAX, EQ_CONTROL_FREQUENCY_MIN, EQ_CONTROL_FREQUENCY_MAX,
+            EQ_CONTROL_BANDWIDTH_MIN, EQ_CONTROL_BANDWIDTH_MAX);
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * @brief  Polls the status of the last set until the main loop took it.
+ * @param  device: open node
+ * @retval true if it was applied
+ */
+static bool EqTool_WaitApplied(int device)
+{
+  uint8_t status = EQ_CONTROL_STATUS_PENDING;
+
+  for(int waited = 0; waited < APPLY_TIMEOUT_MS; waited += APPLY_POLL_MS)
+  {
+    if(EqTool_Control(device, REQUEST_TYPE_IN, EQ_CONTROL_REQ_GET_STATUS, 0, 0, &status, sizeof(status)) != sizeof(status))
+      return false;
+    if(status != EQ_CONTROL_STATUS_PENDING)
+      break;
+    usleep(APPLY_POLL_MS * 1000);
+  }
+
+  if(status == EQ_CONTROL_STATUS_APPLIED)
+    return true;
+
+  fprintf(stderr, "%s\n", status == EQ_CONTROL_STATUS_REJECTED ? "rejected by the device" : "not applied in time");
+  return false;
+}
+
+static void EqTool_PrintBand(uint8_t index, const EqControlBand* band)
+{
+  printf("band %u: %+3d dB at %5d Hz, %d octaves (q %.2f)\n", index, band->gain, band->frequency,
+         band->bandwidth, EqTool_OctavesToQ(band->bandwidth));
+}
+
+static int EqTool_Info(int device)
+{
+  EqControlInfo info;
+
+  if(EqTool_Control(device, REQUEST_TYPE_IN, EQ_CONTROL_REQ_GET_INFO, 0, 0, &info, sizeof(info)) != sizeof(info))
+    return 1;
+
+  printf("protocol %u, %u bands, %u preset slots, filters for %u Hz, FIR up to %u taps\n", info.version,
+         info.bandCount, info.presetSlots, info.sampleRate, info.firMaxTaps);
+  return info.version == EQ_CONTROL_PROTOCOL_VERSION ? 0 : 1;
+}
+
+static int EqTool_Get(int device)
+{
+  EqControlBand band;
+
+  for(uint8_t i = 0; i < EQ_CONTROL_BANDS; i++)
+  {
+    if(EqTool_Control(device, REQUEST_TYPE_IN, EQ_CONTROL_REQ_GET_BAND, 0, i, &band, sizeof(band)) != sizeof(band))
+      return 1;
+    EqTool_PrintBand(i, &band);
+  }
+  return 0;
+}
+
+static int EqTool_Set(int device, const Options* options)
+{
+  EqControlBand band;
+  char* end;
+  long index = strtol(options->argv[1], &end, 10);
+
+  if(*end != '\0' || index < 0 || index >= EQ_CONTROL_BANDS)
+  {
+    fprintf(stderr, "band must be 0 to %u\n", EQ_CONTROL_BANDS - 1);
+    return 1;
+  }
+
+  if(EqTool_Control(device, REQUEST_TYPE_IN, EQ_CONTROL_REQ_GET_BAND, 0, index, &band, sizeof(band)) != sizeof(band) ||
+     !EqTool_ParseBand(options->argv[2], &band))
+    return 1;
+
+  if(EqTool_Control(device, REQUEST_TYPE_OUT, EQ_CONTROL_REQ_SET_BAND, 0, index, &band, sizeof(band)) != sizeof(band) ||
+     !EqTool_WaitApplied(device))
+    return 1;
+
+  EqTool_PrintBand(index, &band);
+  return 0;
+}
+
+static int EqTool_Preset(int device, const Options* options)
+{
+  EqControlPreset preset;
+
+  memset(&preset, 0, sizeof(preset));
+  preset.version = EQ_CONTROL_PROTOCOL_VERSION;
+  preset.bandCount = EQ_CONTROL_BANDS;
+  memcpy(preset.name, options->name, strlen(options->name));
+
+  for(uint8_t i = 0; i < EQ_CONTROL_BANDS; i++)
+  {
+    if(EqTool_Control(device, REQUEST_TYPE_IN, EQ_CONTROL_REQ_GET_BAND, 0, i, &preset.bands[i], sizeof(EqControlBand)) != sizeof(EqControlBand) ||
+       !EqTool_ParseBand(options->argv[1 + i], &preset.bands[i]))
+      return 1;
+  }
+
+  // one transfer, the board loads every band between two packets
+  if(EqTool_Control(device, REQUEST_TYPE_OUT, EQ_CONTROL_REQ_SET_PRESET, options->slot, 0, &preset, sizeof(preset)) != sizeof(preset) ||
+     !EqTool_WaitApplied(device))
+    return 1;
+
+  for(uint8_t i = 0; i < EQ_CONTROL_BANDS; i++)
+    EqTool_PrintBand(i, &preset.bands[i]);
+  if(options->slot != 0)
+    printf("saved to slot %d as \"%s\"\n", options->slot, options->name);
+  return 0;
+}
+
+static int EqTool_Fir(int device, const Options* options)
+{
+  EqControlInfo info;
+  EqControlFir fir = { .version = EQ_CONTROL_PROTOCOL_VERSION };
+  EqControlFirTaps chunk;
+  FILE* file = NULL;
+  char* end;
+  long channel = strtol(options->argv[1], &end, 10);
+
+  if(*end != '\0' || channel < 0 || channel >= EQ_CONTROL_CHANNELS)
+  {
+    fprintf(stderr, "channel must be 0 to %u\n", EQ_CONTROL_CHANNELS - 1);
+    return 1;
+  }
+  fir.channel = (uint8_t)channel;
+
+  if(EqTool_Control(device, REQUEST_TYPE_IN, EQ_CONTROL_REQ_GET_INFO, 0, 0, &info, sizeof(info)) != sizeof(info))
+    return 1;
+  if(info.version != EQ_CONTROL_PROTOCOL_VERSION)
+  {
+    fprintf(stderr, "the board speaks protocol %u, this tool %u\n", info.version, EQ_CONTROL_PROTOCOL_VERSION);
+    return 1;
+  }
+
+  if(strcmp(options->argv[2], "off") != 0)
+  {
+    file = fopen(options->argv[2], "rb");
+    if(file == NULL)
+    {
+      fprintf(stderr, "cannot open %s: %s\n", options->argv[2], strerror(errno));
+      return 1;
+    }
+  }
+
+  // chunks until the file ends, the last one padded with zeros
+  while(file != NULL)
+  {
+    memset(&chunk, 0, sizeof(chunk));
+    size_t count = fread(chunk.taps, sizeof(float), EQ_CONTROL_FIR_CHUNK_TAPS, file);
+    if(count == 0)
+      break;
+    if(fir.tapCount + count > info.firMaxTaps)
+    {
+      fprintf(stderr, "%s: more than the %u taps the board takes\n", options->argv[2], info.firMaxTaps);
+      fclose(file);
+      return 1;
+    }
+    if(EqTool_Control(device, REQUEST_TYPE_OUT, EQ_CONTROL_REQ_SET_FIR_TAPS, 0, fir.tapCount, &chunk, sizeof(chunk)) != sizeof(chunk))
+    {
+      fclose(file);
+      return 1;
+    }
+    fir.tapCount += count;
+  }
+  if(file != NULL)
+    fclose(file);
+
+  if(EqTool_Control(device, REQUEST_TYPE_OUT, EQ_CONTROL_REQ_LOAD_FIR, 0, 0, &fir, sizeof(fir)) != sizeof(fir) ||
+     !EqTool_WaitApplied(device))
+    return 1;
+
+  if(fir.tapCount == 0)
+    printf("channel %u: no filter\n", fir.channel);
+  else
+    printf("channel %u: %u taps\n", fir.channel, fir.tapCount);
+  return 0;
+}
+
+static int EqTool_Dynamics(int device, const Options* options)
+{
+  EqControlDynamics dynamics;
+
+  if(EqTool_Control(device, REQUEST_TYPE_IN, EQ_CONTROL_REQ_GET_DYNAMICS, 0, 0, &dynamics, sizeof(dynamics)) != sizeof(dynamics))
+    return 1;
+  if(options->argc == 1)
+  {
+    EqTool_PrintDynamics(&dynamics);
+    return 0;
+  }
+
+  dynamics.flags = 0;
+  for(int i = 1; i < options->argc; i++)
+  {
+    if(!(options->argc == 2 && strcmp(options->argv[i], "off") == 0) && !EqTool_ParseStage(options->argv[i], &dynamics))
+    {
+      fprintf(stderr, "%s: not limiter[:ceiling[:release]] or compressor[:threshold[:ratio[:...]]]\n", options->argv[i]);
+      return 1;
+    }
+  }
+
+  if(!EqControlRequest_IsValidDynamics(&dynamics))
+  {
+    fprintf(stderr, "out of range (ceiling %.1f to %.1f dB, threshold %.1f to %.1f dB, ratio %.1f to %.1f, "
+            "makeup %.1f to %.1f dB, times %d to %d ms)\n", EQ_CONTROL_CEILING_MIN / 10.0, EQ_CONTROL_CEILING_MAX / 10.0,
+            EQ_CONTROL_THRESHOLD_MIN / 10.0, EQ_CONTROL_THRESHOLD_MAX / 10.0, EQ_CONTROL_RATIO_MIN / 10.0,
+            EQ_CONTROL_RATIO_MAX / 10.0, EQ_CONTROL_MAKEUP_MIN / 10.0, EQ_CONTROL_MAKEUP_MAX / 10.0,
+            EQ_CONTROL_TIME_MIN, EQ_CONTROL_TIME_MAX);
+    return 1;
+  }
+
+  if(EqTool_Control(device, REQUEST_TYPE_OUT, EQ_CONTROL_REQ_SET_DYNAMICS, 0, 0, &dynamics, sizeof(dynamics)) != sizeof(dynamics) ||
+     !EqTool_WaitApplied(device))
+    return 1;
+
+  EqTool_PrintDynamics(&dynamics);
+  return 0;
+}
+
+/**
+ * @brief  Reads limiter[:ceiling[:release]] or
+ *         compressor[:threshold[:ratio[:attack[:release[:makeup]]]]] over the
+ *         dynamics as they are, and turns the stage on.
+ * @param  text: argument
+ * @param  dynamics: holds the current dynamics, receives the new ones
+ * @retval false if the text is not a stage
+ */
+static bool EqTool_ParseStage(const char* text, EqControlDynamics* dynamics)
+{
+  double values[5];
+  int fields;
+
+  if(strncmp(text, "limiter", 7) == 0 && (text[7] == '\0' || text[7] == ':'))
+  {
+    fields = sscanf(text + 7, ":%lf:%lf", &values[0], &values[1]);
+    if(fields >= 1)
+      dynamics->ceiling = (int16_t)lround(values[0] * 10.0);
+    if(fields >= 2)
+      dynamics->limiterRelease = (uint16_t)lround(values[1]);
+    dynamics->flags |= EQ_CONTROL_DYNAMICS_LIMITER;
+    return true;
+  }
+
+  if(strncmp(text, "compressor", 10) == 0 && (text[10] == '\0' || text[10] == ':'))
+  {
+    fields = sscanf(text + 10, ":%lf:%lf:%lf:%lf:%lf", &values[0], &values[1], &values[2], &values[3], &values[4]);
+    if(fields >= 1)
+      dynamics->threshold = (int16_t)lround(values[0] * 10.0);
+    if(fields >= 2)
+      dynamics->ratio = (uint16_t)lround(values[1] * 10.0);
+    if(fields >= 3)
+      dynamics->attack = (uint16_t)lround(values[2]);
+    if(fields >= 4)
+      dynamics->release = (uint16_t)lround(values[3]);
+    if(fields >= 5)
+      dynamics->makeup = (int16_t)lround(values[4] * 10.0);
+    dynamics->flags |= EQ_CONTROL_DYNAMICS_COMPRESSOR;
+    return true;
+  }
+
+  return false;
+}
+
+static void EqTool_PrintDynamics(const EqControlDynamics* dynamics)
+{
+  printf("limiter %s: ceiling %.1f dBFS, release %u ms\n", (dynamics->flags & EQ_CONTROL_DYNAMICS_LIMITER) ? "on" : "off",
+         dynamics->ceiling / 10.0, dynamics->limiterRelease);
+  printf("compressor %s: threshold %.1f dBFS, ratio %.1f, attack %u ms, release %u ms, makeup %.1f dB\n",
+         (dynamics->flags & EQ_CONTROL_DYNAMICS_COMPRESSOR) ? "on" : "off", dynamics->threshold / 10.0,
+         dynamics->ratio / 10.0, dynamics->attack, dynamics->release, dynamics->makeup / 10.0);
+}
+
+// Q of a peaking band N octaves wide: sqrt(2^N) / (2^N - 1)
+static double EqTool_OctavesToQ(int16_t octaves)
+{
+  double ratio = pow(2.0, octaves);
+
+  return sqrt(ratio) / (ratio - 1.0);
+}
+
+static int16_t EqTool_QToOctaves(double q)
+{
+  double octaves = 2.0 / log(2.0) * asinh(1.0 / (2.0 * q));
+  long rounded = lround(octaves);
+
+  if(rounded < EQ_CONTROL_BANDWIDTH_MIN)
+    rounded = EQ_CONTROL_BANDWIDTH_MIN;
+  if(rounded > EQ_CONTROL_BANDWIDTH_MAX)
+    rounded = EQ_CONTROL_BANDWIDTH_MAX;
+  return (int16_t)rounded;
+}
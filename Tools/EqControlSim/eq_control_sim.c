@@ -0,0 +1,597 @@
+/**
+  ******************************************************************************
+  * @file    eq_control_sim.c
+  * @brief   Runs the EQ vendor requests through eq_control.c the way the USB
+  *          class driver does (setup stage, data stage, then the main loop
+  *          task), with the firmware EQ math and no USB stack. Checks:
+  *          - info: the reply describes the build;
+  *          - stalls: unknown requests, the wrong direction or length, a
+  *            band or slot that does not exist, and a set while the
+  *            previous one is still pending are refused at the setup stage;
+  *          - band: a set changes that band only, once the task ran, and a
+  *            get returns it;
+  *          - rejected: a value out of range is acknowledged, reads back as
+  *            rejected and changes nothing;
+  *          - preset: a whole preset is loaded in a single
+  *            AudioUserDsp_LoadCoefficients call, so between two packets,
+  *            and saved to the slot in wValue;
+  *          - fir: taps sent in chunks reach AudioUserDspFir_Load as sent
+  *            and in the main loop; chunks out of the buffer or during a
+  *            pending load are stalled; a load past the taps the info
+  *            reports, or on a third channel, is rejected;
+  *          - dynamics: a set reaches AudioUserDspDynamics_Configure in the
+  *            main loop, converted to dB and ms, and a get returns it; a
+  *            set out of range is rejected and configures nothing;
+  *          - fuzz: random requests never leave a band out of range.
+  *
+  *          build (from Tools, the sources are listed in its Makefile):
+  *            make build/eq_control_sim
+  *
+  *          usage:
+  *            ./eq_control_sim   (exit status 1 if a check fails)
+  ******************************************************************************
+  */
+
+#include "eq_control.h"
+#include "audio_user_dsp.h"
+#include "audio_user_dsp_dynamics.h"
+#include "audio_user_dsp_fir.h"
+#include "preset_store.h"
+#include "sim_report.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// private defines -------------------------------------------------------------
+#define SAMPLE_RATE         USB_AUDIO_CONFIG_PLAY_DEF_FREQ
+#define FUZZ_REQUESTS       100000
+// taps of the filter of the fir check, not a whole number of chunks
+#define FIR_TAPS            (3 * EQ_CONTROL_FIR_CHUNK_TAPS + 5)
+// bmRequestType of the requests, vendor, device recipient
+#define REQUEST_TYPE_IN     0xC0
+#define REQUEST_TYPE_OUT    0x40
+
+// variables -------------------------------------------------------------------
+
+// normally owned by main.c and user_lcd.c
+float in_z1  = 0;
+float in_z2  = 0;
+float out_z1 = 0;
+float out_z2 = 0;
+SliderKnob sliderKnobs[NUMBER_OF_SLIDER_BUTTONS];
+
+// band layout, normally defined in audio_usb_nodes.c
+int16_t frequencies[] = {30, 60, 150, 400, 1000, 3000, 8000, 16000};
+int16_t bandwidths[] =  {1,   1,   2,   2,    2,    3,    3,     3};
+
+// private variables -----------------------------------------------------------
+static const int16_t defaultFrequencies[NUMBER_OF_BANDS] = {30, 60, 150, 400, 1000, 3000, 8000, 16000};
+static const int16_t defaultBandwidths[NUMBER_OF_BANDS] =  {1,   1,   2,   2,    2,    3,    3,     3};
+
+static uint32_t loads = 0;
+static uint32_t saves = 0;
+static uint8_t  savedSlot = 0;
+static char     savedName[PRESET_STORE_NAME_LENGTH + 1];
+static int16_t  savedGains[NUMBER_OF_BANDS];
+static uint32_t randomState = 1;
+
+// the SDRAM of the board: FIR spectra and the taps of the requests
+static float    firMemory[DSP_FIR_MEMORY_SIZE / sizeof(float)];
+static float    firTaps[DSP_FIR_MAX_TAPS];
+static uint32_t firLoads = 0;
+static uint8_t  firChannel = 0;
+static uint32_t firCount = 0;
+static float    firLoaded[DSP_FIR_MAX_TAPS];
+static uint32_t configures = 0;
+static AudioUserDspDynamicsSettings configured;
+
+// private function declarations -----------------------------------------------
+static bool     EqControlSim_Info(void);
+static bool     EqControlSim_Stalls(void);
+static bool     EqControlSim_Band(void);
+static bool     EqControlSim_Rejected(void);
+static bool     EqControlSim_Preset(void);
+static bool     EqControlSim_Fir(void);
+static bool     EqControlSim_Dynamics(void);
+static bool     EqControlSim_Fuzz(void);
+static void     EqControlSim_Reset(void);
+static int32_t  EqControlSim_Control(uint8_t requestType, uint8_t request, uint16_t value, uint16_t index, uint16_t length, void* data);
+static uint8_t  EqControlSim_Status(void);
+static bool     EqControlSim_IsBand(uint8_t band, int16_t gain, int16_t frequency, int16_t bandwidth);
+static uint32_t EqControlSim_Random(void);
+
+void __real_AudioUserDsp_LoadCoefficients(const BiquadCoefficients* bank, const int16_t* gains, const int16_t* bandFrequencies, const int16_t* bandBandwidths);
+bool __real_AudioUserDspFir_Load(uint8_t channel, const float* taps, uint32_t count);
+bool __real_AudioUserDspDynamics_Configure(const AudioUserDspDynamicsSettings* settings);
+
+int main(void)
+{
+  bool passed = true;
+
+  AudioUserDspFir_Init(firMemory);
+  EqControl_Init(firTaps);
+
+  passed &= EqControlSim_Info();
+  passed &= EqControlSim_Stalls();
+  passed &= EqControlSim_Band();
+  passed &= EqControlSim_Rejected();
+  passed &= EqControlSim_Preset();
+  passed &= EqControlSim_Fir();
+  passed &= EqControlSim_Dynamics();
+  passed &= EqControlSim_Fuzz();
+
+  printf("%s\n", passed ? "all checks passed" : "CHECK FAILED");
+  return passed ? 0 : 1;
+}
+
+/**
+ * @brief  Reads the info of the build.
+ * @param  None
+ * @retval true if it matches the firmware configuration
+ */
+static bool EqControlSim_Info(void)
+{
+  EqControlInfo info;
+  bool ok = true;
+
+  EqControlSim_Reset();
+  memset(&info, 0xAA, sizeof(info));
+
+  // a host may ask for more than the reply
+  ok &= EqControlSim_Control(REQUEST_TYPE_IN, EQ_CONTROL_REQ_GET_INFO, 0, 0, 64, &info) == sizeof(info);
+  ok &= info.version == EQ_CONTROL_PROTOCOL_VERSION && info.bandCount == NUMBER_OF_BANDS;
+  ok &= info.presetSlots == PRESET_STORE_SLOTS && info.sampleRate == SAMPLE_RATE;
+  ok &= info.firMaxTaps == AudioUserDspFir_GetMaxTaps();
+  ok &= EqControlSim_Status() == EQ_CONTROL_STATUS_IDLE;
+
+  return SimReport_Check("info", ok);
+}
+
+/**
+ * @brief  Sends the requests the firmware must refuse at the setup stage.
+ * @param  None
+ * @retval true if each one stalled and nothing changed
+ */
+static bool EqControlSim_Stalls(void)
+{
+  EqControlBand band = {6, 1000, 2};
+  EqControlPreset preset;
+  uint8_t buffer[64];
+  bool ok = true;
+
+  EqControlSim_Reset();
+  memset(&preset, 0, sizeof(preset));
+
+  ok &= EqControlSim_Control(REQUEST_TYPE_IN, 0x7F, 0, 0, sizeof(buffer), buffer) < 0;
+  ok &= EqControlSim_Control(REQUEST_TYPE_OUT, 0x7F, 0, 0, sizeof(buffer), buffer) < 0;
+  ok &= EqControlSim_Control(REQUEST_TYPE_OUT, EQ_CONTROL_REQ_GET_INFO, 0, 0, sizeof(EqControlInfo), buffer) < 0;
+  ok &= EqControlSim_Control(REQUEST_TYPE_IN, EQ_CONTROL_REQ_SET_BAND, 0, 0, sizeof(band), buffer) < 0;
+  ok &= EqControlSim_Control(REQUEST_TYPE_IN, EQ_CONTROL_REQ_GET_STATUS, 0, 0, 0, buffer) < 0;
+  ok &= EqControlSim_Control(REQUEST_TYPE_IN, EQ_CONTROL_REQ_GET_BAND, 0, NUMBER_OF_BANDS, sizeof(band), buffer) < 0;
+  ok &= EqControlSim_Control(REQUEST_TYPE_OUT, EQ_CONTROL_REQ_SET_BAND, 0, NUMBER_OF_BANDS, sizeof(band), &band) < 0;
+  ok &= EqControlSim_Control(REQUEST_TYPE_OUT, EQ_CONTROL_REQ_SET_BAND, 0, 0, sizeof(band) - 1, &band) < 0;
+  ok &= EqControlSim_Control(REQUEST_TYPE_OUT, EQ_CONTROL_REQ_SET_PRESET, 0, 0, sizeof(preset) + 1, &preset) < 0;
+  ok &= EqControlSim_Control(REQUEST_TYPE_OUT, EQ_CONTROL_REQ_SET_PRESET, PRESET_STORE_SLOTS, 0, sizeof(preset), &preset) < 0;
+  ok &= EqControlSim_Status() == EQ_CONTROL_STATUS_IDLE;
+
+  // the main loop has not run between the two sets
+  ok &= EqControlSim_Control(REQUEST_TYPE_OUT, EQ_CONTROL_REQ_SET_BAND, 0, 2, sizeof(band), &band) == sizeof(band);
+  ok &= EqControlSim_Control(REQUEST_TYPE_OUT, EQ_CONTROL_REQ_SET_BAND, 0, 3, sizeof(band), &band) < 0;
+  ok &= EqControlSim_Status() == EQ_CONTROL_STATUS_PENDING;
+  ok &= EqControl_Process();
+  ok &= EqControlSim_Control(REQUEST_TYPE_OUT, EQ_CONTROL_REQ_SET_BAND, 0, 3, sizeof(band), &band) == sizeof(band);
+  ok &= EqControl_Process();
+  ok &= EqControlSim_IsBand(2, 6, 1000, 2) && EqControlSim_IsBand(3, 6, 1000, 2);
+
+  return SimReport_Check("stalls at the setup stage", ok);
+}
+
+/**
+ * @brief  Sets one band and reads it back.
+ * @param  None
+ * @retval true if only that band changed, after the task ran
+ */
+static bool EqControlSim_Band(void)
+{
+  EqControlBand band = {-9, 2500, 1};
+  EqControlBand readBack;
+  BiquadFilter before[NUMBER_OF_BANDS];
+  bool ok = true;
+
+  EqControlSim_Reset();
+  memcpy(before, biquadFilters, sizeof(before));
+
+  ok &= EqControlSim_Control(REQUEST_TYPE_OUT, EQ_CONTROL_REQ_SET_BAND, 0, 5, sizeof(band), &band) == sizeof(band);
+  // taken by the interrupt, the filters wait for the main loop
+  ok &= memcmp(before, biquadFilters, sizeof(before)) == 0;
+  ok &= EqControl_Process() && !EqControl_Process();
+  ok &= EqControlSim_Status() == EQ_CONTROL_STATUS_APPLIED && loads == 1;
+
+  for(uint8_t i = 0; i < NUMBER_OF_BANDS; i++)
+  {
+    if(i == 5)
+      ok &= EqControlSim_IsBand(i, -9, 2500, 1);
+    else
+      ok &= memcmp(&before[i], &biquadFilters[i], sizeof(BiquadFilter)) == 0;
+  }
+  ok &= frequencies[5] == 2500 && bandwidths[5] == 1 && frequencies[4] == defaultFrequencies[4];
+
+  ok &= EqControlSim_Control(REQUEST_TYPE_IN, EQ_CONTROL_REQ_GET_BAND, 0, 5, sizeof(readBack), &readBack) == sizeof(readBack);
+  ok &= readBack.gain == -9 && readBack.frequency == 2500 && readBack.bandwidth == 1;
+  ok &= saves == 0;
+
+  return SimReport_Check("band set and read back", ok);
+}
+
+/**
+ * @brief  Sends a band and a preset with a value out of range.
+ * @param  None
+ * @retval true if both were acknowledged, rejected and changed nothing
+ */
+static bool EqControlSim_Rejected(void)
+{
+  EqControlBand band = {EQ_CONTROL_GAIN_MAX + 1, 1000, 2};
+  EqControlPreset preset;
+  BiquadFilter before[NUMBER_OF_BANDS];
+  bool ok = true;
+
+  EqControlSim_Reset();
+  memcpy(before, biquadFilters, sizeof(before));
+
+  ok &= EqControlSim_Control(REQUEST_TYPE_OUT, EQ_CONTROL_REQ_SET_BAND, 0, 0, sizeof(band), &band) == sizeof(band);
+  ok &= EqControlSim_Status() == EQ_CONTROL_STATUS_REJECTED && !EqControl_Process();
+
+  memset(&preset, 0, sizeof(preset));
+  preset.version = EQ_CONTROL_PROTOCOL_VERSION;
+  preset.bandCount = EQ_CONTROL_BANDS;
+  for(uint8_t i = 0; i < EQ_CONTROL_BANDS; i++)
+    preset.bands[i] = (EqControlBand){3, defaultFrequencies[i], defaultBandwidths[i]};
+  preset.bands[7].frequency = EQ_CONTROL_FREQUENCY_MAX + 1;
+  ok &= EqControlSim_Control(REQUEST_TYPE_OUT, EQ_CONTROL_REQ_SET_PRESET, 1, 0, sizeof(preset), &preset) == sizeof(preset);
+  ok &= EqControlSim_Status() == EQ_CONTROL_STATUS_REJECTED && !EqControl_Process();
+
+  preset.bands[7].frequency = defaultFrequencies[7];
+  preset.version = EQ_CONTROL_PROTOCOL_VERSION + 1;
+  ok &= EqControlSim_Control(REQUEST_TYPE_OUT, EQ_CONTROL_REQ_SET_PRESET, 1, 0, sizeof(preset), &preset) == sizeof(preset);
+  ok &= EqControlSim_Status() == EQ_CONTROL_STATUS_REJECTED && !EqControl_Process();
+
+  ok &= memcmp(before, biquadFilters, sizeof(before)) == 0 && loads == 0 && saves == 0;
+
+  return SimReport_Check("out of range sets rejected", ok);
+}
+
+/**
+ * @brief  Sends a whole preset, applied only, then saved to a slot.
+ * @param  None
+ * @retval true if every band changed in one load and the save got the preset
+ */
+static bool EqControlSim_Preset(void)
+{
+  static const int16_t gains[NUMBER_OF_BANDS] = {12, 9, 6, 3, -3, -6, -9, -12};
+  EqControlPreset preset;
+  bool ok = true;
+
+  EqControlSim_Reset();
+  memset(&preset, 0, sizeof(preset));
+  preset.version = EQ_CONTROL_PROTOCOL_VERSION;
+  preset.bandCount = EQ_CONTROL_BANDS;
+  memcpy(preset.name, "vocal boost", 11);
+  for(uint8_t i = 0; i < EQ_CONTROL_BANDS; i++)
+    preset.bands[i] = (EqControlBand){gains[i], defaultFrequencies[i] + 10, 4 - i / 3};
+
+  ok &= EqControlSim_Control(REQUEST_TYPE_OUT, EQ_CONTROL_REQ_SET_PRESET, 0, 0, sizeof(preset), &preset) == sizeof(preset);
+  ok &= EqControl_Process();
+  ok &= loads == 1 && saves == 0;
+  for(uint8_t i = 0; i < NUMBER_OF_BANDS; i++)
+  {
+    ok &= EqControlSim_IsBand(i, gains[i], defaultFrequencies[i] + 10, 4 - i / 3);
+    ok &= frequencies[i] == defaultFrequencies[i] + 10 && bandwidths[i] == 4 - i / 3;
+  }
+
+  // a full name is sent without a terminator
+  memcpy(preset.name, "twelve chars", PRESET_STORE_NAME_LENGTH);
+  ok &= EqControlSim_Control(REQUEST_TYPE_OUT, EQ_CONTROL_REQ_SET_PRESET, 4, 0, sizeof(preset), &preset) == sizeof(preset);
+  ok &= EqControl_Process();
+  ok &= loads == 2 && saves == 1 && savedSlot == 4;
+  ok &= strcmp(savedName, "twelve chars") == 0 && memcmp(savedGains, gains, sizeof(gains)) == 0;
+
+  return SimReport_Check("preset loaded whole and saved", ok);
+}
+
+/**
+ * @brief  Sends a filter in chunks and loads it, then the loads that must be
+ *         refused.
+ * @param  None
+ * @retval true if the filter reached the FIR as sent, once the task ran, and
+ *         nothing else did
+ */
+static bool EqControlSim_Fir(void)
+{
+  EqControlFirTaps chunk;
+  EqControlFir fir = { .version = EQ_CONTROL_PROTOCOL_VERSION, .channel = 1, .tapCount = FIR_TAPS };
+  float sent[FIR_TAPS];
+  uint8_t before;
+  bool ok = true;
+
+  EqControlSim_Reset();
+  before = EqControlSim_Status();
+  for(uint32_t n = 0; n < FIR_TAPS; n++)
+    sent[n] = (float)EqControlSim_Random() / 4294967296.0f - 0.5f;
+
+  // a chunk starts on a chunk and ends in the buffer
+  ok &= EqControlSim_Control(REQUEST_TYPE_OUT, EQ_CONTROL_REQ_SET_FIR_TAPS, 0, 1, sizeof(chunk), &chunk) < 0;
+  ok &= EqControlSim_Control(REQUEST_TYPE_OUT, EQ_CONTROL_REQ_SET_FIR_TAPS, 0, DSP_FIR_MAX_TAPS, sizeof(chunk), &chunk) < 0;
+  ok &= EqControlSim_Control(REQUEST_TYPE_OUT, EQ_CONTROL_REQ_SET_FIR_TAPS, 0, 0, sizeof(chunk) - 1, &chunk) < 0;
+
+  for(uint32_t first = 0; first < FIR_TAPS; first += EQ_CONTROL_FIR_CHUNK_TAPS)
+  {
+    uint32_t count = (FIR_TAPS - first < EQ_CONTROL_FIR_CHUNK_TAPS) ? FIR_TAPS - first : EQ_CONTROL_FIR_CHUNK_TAPS;
+
+    memset(&chunk, 0, sizeof(chunk));
+    memcpy(chunk.taps, &sent[first], count * sizeof(float));
+    ok &= EqControlSim_Control(REQUEST_TYPE_OUT, EQ_CONTROL_REQ_SET_FIR_TAPS, 0, first, sizeof(chunk), &chunk) == sizeof(chunk);
+  }
+  // the chunks leave the status alone
+  ok &= EqControlSim_Status() == before;
+
+  ok &= EqControlSim_Control(REQUEST_TYPE_OUT, EQ_CONTROL_REQ_LOAD_FIR, 0, 0, sizeof(fir), &fir) == sizeof(fir);
+  ok &= EqControlSim_Status() == EQ_CONTROL_STATUS_PENDING && firLoads == 0;
+  // the main loop has not read the buffer yet
+  ok &= EqControlSim_Control(REQUEST_TYPE_OUT, EQ_CONTROL_REQ_SET_FIR_TAPS, 0, 0, sizeof(chunk), &chunk) < 0;
+  ok &= !EqControl_Process() && EqControlSim_Status() == EQ_CONTROL_STATUS_APPLIED;
+  ok &= firLoads == 1 && firChannel == 1 && firCount == FIR_TAPS && memcmp(firLoaded, sent, sizeof(sent)) == 0;
+  ok &= loads == 0;
+
+  fir.tapCount = AudioUserDspFir_GetMaxTaps() + 1;
+  ok &= EqControlSim_Control(REQUEST_TYPE_OUT, EQ_CONTROL_REQ_LOAD_FIR, 0, 0, sizeof(fir), &fir) == sizeof(fir);
+  ok &= EqControlSim_Status() == EQ_CONTROL_STATUS_REJECTED;
+  fir.tapCount = 0;
+  fir.channel = EQ_CONTROL_CHANNELS;
+  ok &= EqControlSim_Control(REQUEST_TYPE_OUT, EQ_CONTROL_REQ_LOAD_FIR, 0, 0, sizeof(fir), &fir) == sizeof(fir);
+  ok &= EqControlSim_Status() == EQ_CONTROL_STATUS_REJECTED;
+  ok &= !EqControl_Process() && firLoads == 1;
+
+  // no taps removes the filter
+  fir.channel = 1;
+  ok &= EqControlSim_Control(REQUEST_TYPE_OUT, EQ_CONTROL_REQ_LOAD_FIR, 0, 0, sizeof(fir), &fir) == sizeof(fir);
+  ok &= !EqControl_Process() && EqControlSim_Status() == EQ_CONTROL_STATUS_APPLIED;
+  ok &= firLoads == 2 && firCount == 0;
+
+  printf("  (%u taps in %u chunks, loaded on the right channel)\n", FIR_TAPS,
+         (FIR_TAPS + EQ_CONTROL_FIR_CHUNK_TAPS - 1) / EQ_CONTROL_FIR_CHUNK_TAPS);
+  return SimReport_Check("fir taps loaded from the main loop", ok);
+}
+
+/**
+ * @brief  Reads the boot dynamics, turns the limiter on, then sends sets
+ *         out of range and turns it off.
+ * @param  None
+ * @retval true if each set was configured as sent, once the task ran, and
+ *         the rejected ones configured nothing
+ */
+static bool EqControlSim_Dynamics(void)
+{
+  EqControlDynamics set = {
+    .flags = EQ_CONTROL_DYNAMICS_LIMITER, .ceiling = -10, .limiterRelease = 80, .threshold = -180,
+    .ratio = 40, .attack = 3, .release = 150, .makeup = 20,
+  };
+  EqControlDynamics readBack;
+  bool ok = true;
+
+  EqControlSim_Reset();
+
+  ok &= EqControlSim_Control(REQUEST_TYPE_IN, EQ_CONTROL_REQ_GET_DYNAMICS, 0, 0, sizeof(readBack), &readBack) == sizeof(readBack);
+  ok &= readBack.flags == 0 && readBack.ceiling == DSP_LIMITER_CEILING_DB * 10 && readBack.ratio == DSP_COMPRESSOR_RATIO * 10;
+
+  ok &= EqControlSim_Control(REQUEST_TYPE_OUT, EQ_CONTROL_REQ_SET_DYNAMICS, 0, 0, sizeof(set), &set) == sizeof(set);
+  ok &= EqControlSim_Status() == EQ_CONTROL_STATUS_PENDING && configures == 0;
+  ok &= EqControlSim_Control(REQUEST_TYPE_OUT, EQ_CONTROL_REQ_SET_DYNAMICS, 0, 0, sizeof(set), &set) < 0;
+  ok &= !EqControl_Process() && EqControlSim_Status() == EQ_CONTROL_STATUS_APPLIED && configures == 1;
+  ok &= configured.limiter && !configured.compressor && configured.ceilingDb == -1.0f;
+  ok &= configured.limiterReleaseMs == 80.0f && configured.thresholdDb == -18.0f && configured.ratio == 4.0f;
+  ok &= configured.attackMs == 3.0f && configured.releaseMs == 150.0f && configured.makeupDb == 2.0f;
+  ok &= EqControlSim_Control(REQUEST_TYPE_IN, EQ_CONTROL_REQ_GET_DYNAMICS, 0, 0, sizeof(readBack), &readBack) == sizeof(readBack);
+  ok &= memcmp(&readBack, &set, sizeof(set)) == 0;
+
+  // below 1:1, a stage that does not exist, no release
+  EqControlDynamics bad[3] = { set, set, set };
+  bad[0].ratio = EQ_CONTROL_RATIO_MIN - 1;
+  bad[1].flags = 0x04;
+  bad[2].limiterRelease = 0;
+  for(uint32_t i = 0; i < 3; i++)
+  {
+    ok &= EqControlSim_Control(REQUEST_TYPE_OUT, EQ_CONTROL_REQ_SET_DYNAMICS, 0, 0, sizeof(set), &bad[i]) == sizeof(set);
+    ok &= EqControlSim_Status() == EQ_CONTROL_STATUS_REJECTED && !EqControl_Process();
+  }
+  ok &= configures == 1;
+
+  set.flags = 0;
+  ok &= EqControlSim_Control(REQUEST_TYPE_OUT, EQ_CONTROL_REQ_SET_DYNAMICS, 0, 0, sizeof(set), &set) == sizeof(set);
+  ok &= !EqControl_Process() && configures == 2 && !configured.limiter && !configured.compressor;
+  ok &= loads == 0 && firLoads == 0;
+
+  return SimReport_Check("dynamics set from the main loop", ok);
+}
+
+/**
+ * @brief  Sends random requests with random data, running the main loop
+ *         task between some of them.
+ * @param  None
+ * @retval true if every band stayed in range and each applied set loaded
+ *         once
+ */
+static bool EqControlSim_Fuzz(void)
+{
+  EqControlPreset preset;
+  uint32_t applied = 0;
+  bool ok = true;
+
+  EqControlSim_Reset();
+  for(uint32_t n = 0; n < FUZZ_REQUESTS && ok; n++)
+  {
+    uint32_t random = EqControlSim_Random();
+    uint8_t requestType = (random & 1) ? REQUEST_TYPE_IN : REQUEST_TYPE_OUT;
+    uint8_t request = (random >> 1) % 4 + ((random >> 3) & 1) * 0x10;
+    uint16_t value = (random >> 4) % (PRESET_STORE_SLOTS + 1);
+    uint16_t index = (random >> 8) % (NUMBER_OF_BANDS + 1);
+    uint16_t length = (random >> 12) % (sizeof(preset) + 2);
+
+    // half of the sets the right length, with values around the limits
+    if((random >> 20) & 1)
+      length = (request == EQ_CONTROL_REQ_SET_BAND) ? sizeof(EqControlBand) : sizeof(preset);
+
+    preset.version = (EqControlSim_Random() % 4) ? EQ_CONTROL_PROTOCOL_VERSION : EqControlSim_Random();
+    preset.bandCount = (EqControlSim_Random() % 4) ? EQ_CONTROL_BANDS : EqControlSim_Random();
+    for(uint8_t i = 0; i < EQ_CONTROL_BANDS; i++)
+    {
+      preset.bands[i].gain = (int16_t)(EqControlSim_Random() % 33) - 16;
+      preset.bands[i].frequency = (int16_t)(EqControlSim_Random() % 20100) - 50;
+      preset.bands[i].bandwidth = (int16_t)(EqControlSim_Random() % 6);
+    }
+    if(request == EQ_CONTROL_REQ_SET_BAND)
+      memcpy(&preset, &preset.bands[(random >> 21) % EQ_CONTROL_BANDS], sizeof(EqControlBand));
+
+    EqControlSim_Control(requestType, request, value, index, length, &preset);
+    if((random >> 24) & 1)
+      applied += EqControl_Process();
+
+    for(uint8_t i = 0; i < NUMBER_OF_BANDS; i++)
+    {
+      EqControlBand band = { biquadFilters[i].gain, biquadFilters[i].frequency, biquadFilters[i].bandwidth };
+      ok &= EqControlRequest_IsValidBand(&band);
+    }
+  }
+
+  ok &= applied > 0 && loads == applied;
+  printf("  (%u applied of %u requests)\n", applied, FUZZ_REQUESTS);
+
+  return SimReport_Check("random requests keep the bands in range", ok);
+}
+
+/**
+ * @brief  Back to the boot state: default layout and gains 0, nothing
+ *         pending, counters cleared.
+ * @param  None
+ * @retval None
+ */
+static void EqControlSim_Reset(void)
+{
+  memcpy(frequencies, defaultFrequencies, sizeof(defaultFrequencies));
+  memcpy(bandwidths, defaultBandwidths, sizeof(defaultBandwidths));
+  for(uint8_t i = 0; i < NUMBER_OF_BANDS; i++)
+    AudioUserDsp_BiquadFilterConfig(&biquadFilters[i], 0, frequencies[i], bandwidths[i]);
+
+  // takes a set left pending by a previous check
+  EqControl_Process();
+
+  loads = 0;
+  saves = 0;
+  firLoads = 0;
+  configures = 0;
+}
+
+/**
+ * @brief  One vendor request as usbd_audio.c runs it: the setup stage, the
+ *         data stage in the direction of the request, and the end of the
+ *         data stage of a set.
+ * @param  requestType: bmRequestType
+ * @param  request: bRequest
+ * @param  value: wValue
+ * @param  index: wIndex
+ * @param  length: wLength
+ * @param  data: sent for a set, received for a get
+ * @retval bytes of the data stage, -1 if the request stalled
+ */
+static int32_t EqControlSim_Control(uint8_t requestType, uint8_t request, uint16_t value, uint16_t index, uint16_t length, void* data)
+{
+  bool deviceToHost = (requestType & 0x80) != 0;
+  uint8_t* buffer;
+  int32_t count = EqControl_Setup(request, deviceToHost, value, index, length, &buffer);
+
+  if(count == EQ_CONTROL_STALL)
+    return -1;
+
+  if(deviceToHost)
+    memcpy(data, buffer, count);
+  else
+  {
+    memcpy(buffer, data, count);
+    EqControl_DataReceived();
+  }
+
+  return count;
+}
+
+static uint8_t EqControlSim_Status(void)
+{
+  uint8_t status = 0xFF;
+
+  EqControlSim_Control(REQUEST_TYPE_IN, EQ_CONTROL_REQ_GET_STATUS, 0, 0, 1, &status);
+  return status;
+}
+
+/**
+ * @brief  Tells whether a live filter holds a band, coefficients included.
+ * @param  band: index
+ * @param  gain: in dB
+ * @param  frequency: in Hz
+ * @param  bandwidth: in octaves
+ * @retval true if it does
+ */
+static bool EqControlSim_IsBand(uint8_t band, int16_t gain, int16_t frequency, int16_t bandwidth)
+{
+  const BiquadFilter* filter = &biquadFilters[band];
+  BiquadCoefficients expected;
+
+  AudioUserDsp_BiquadCoefficients(&expected, gain, frequency, bandwidth, SAMPLE_RATE);
+
+  return filter->gain == gain && filter->frequency == frequency && filter->bandwidth == bandwidth &&
+         memcmp(&filter->coefficients, &expected, sizeof(expected)) == 0;
+}
+
+// xorshift32, the same requests on every run
+static uint32_t EqControlSim_Random(void)
+{
+  randomState ^= randomState << 13;
+  randomState ^= randomState >> 17;
+  randomState ^= randomState << 5;
+  return randomState;
+}
+
+// counts the loads, each one is done with the interrupts masked
+void __wrap_AudioUserDsp_LoadCoefficients(const BiquadCoefficients* bank, const int16_t* gains, const int16_t* bandFrequencies, const int16_t* bandBandwidths)
+{
+  loads++;
+  __real_AudioUserDsp_LoadCoefficients(bank, gains, bandFrequencies, bandBandwidths);
+}
+
+// keeps what the FIR is given, then loads it
+bool __wrap_AudioUserDspFir_Load(uint8_t channel, const float* taps, uint32_t count)
+{
+  firLoads++;
+  firChannel = channel;
+  firCount = count;
+  memcpy(firLoaded, taps, count * sizeof(float));
+  return __real_AudioUserDspFir_Load(channel, taps, count);
+}
+
+// keeps the settings the dynamics are given, then configures them
+bool __wrap_AudioUserDspDynamics_Configure(const AudioUserDspDynamicsSettings* settings)
+{
+  configures++;
+  configured = *settings;
+  return __real_AudioUserDspDynamics_Configure(settings);
+}
+
+// stand-in for preset_store.c ------------------------------------------------
+
+bool PresetStore_Save(uint8_t slot, const char* name, const int16_t* gains)
+{
+  saves++;
+  savedSlot = slot;
+  memset(savedName, 0, sizeof(savedName));
+  for(uint32_t i = 0; i < PRESET_STORE_NAME_LENGTH && name[i] != '\0'; i++)
+    savedName[i] = name[i];
+  memcpy(savedGains, gains, sizeof(savedGains));
+  return true;
+}
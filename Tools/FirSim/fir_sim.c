@@ -0,0 +1,553 @@
+/**
+  ******************************************************************************
+  * @file    fir_sim.c
+  * @brief   Checks the partitioned FIR convolution of the EQ input against
+  *          direct convolution on the host, and measures its throughput.
+  *          The SDRAM is a static array here. Checks:
+  *          - fft: the real FFT matches a direct DFT in double, and the
+  *            inverse gives the input back times DSP_FFT_SIZE;
+  *          - convolution: random filters with a decaying tail, from one tap
+  *            to DSP_FIR_MAX_TAPS, around the partition size and with a
+  *            different length on each channel, filter noise in calls of
+  *            random length within TOLERANCE_DB of the output rms of a direct
+  *            convolution in double, DSP_FIR_DELAY_FRAMES late;
+  *          - reload: loading a filter while the other channel runs starts
+  *            the channel from silence and leaves the other one exact;
+  *          - arguments: too many taps, a third channel are refused;
+  *          - packet path: packets of 47, 48 and 49 frames, as the feedback
+  *            of the playback makes the host send, through a random filter
+  *            and the flat EQ come out as the direct convolution,
+  *            DSP_FIR_DELAY_FRAMES late, within the rounding of the output;
+  *          - budget: AudioUserDspFir_Calibrate timed with a nanosecond clock
+  *            against BUDGET_NS leaves no filter, refuses a filter past the
+  *            cap, and a packet through filters at the cap on both channels
+  *            takes at most BUDGET_MARGIN times the budget.
+  *
+  *          Then, for a few filter lengths, the time per packet of both
+  *          channels against the 1 ms the packet lasts, and against the
+  *          same convolution done directly in float.
+  *
+  *          build (from Tools, the sources are listed in its Makefile):
+  *            make build/fir_sim
+  *
+  *          usage:
+  *            ./fir_sim   (exit status 1 if a check fails)
+  ******************************************************************************
+  */
+
+#include "audio_user_dsp.h"
+#include "audio_user_dsp_fir.h"
+#include "usb_audio.h"
+#include "sim_report.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// private defines -------------------------------------------------------------
+#define SAMPLE_RATE         USB_AUDIO_CONFIG_PLAY_DEF_FREQ
+#define PACKET_SIZE         AUDIO_MS_PACKET_SIZE(SAMPLE_RATE, USB_AUDIO_CONFIG_PLAY_CHANNEL_COUNT, USB_AUDIO_CONFIG_PLAY_RES_BYTE)
+#define FRAMES_PER_PACKET   (PACKET_SIZE / 4)
+#define BLOCK               DSP_FIR_BLOCK_FRAMES
+#define DELAY               DSP_FIR_DELAY_FRAMES
+// longest call of the FIR in the checks of the engine alone
+#define MAX_CHUNK           100
+// packets run past the length of the filter, so its whole tail is checked
+#define EXTRA_PACKETS       50
+#define MAX_PACKETS         (DSP_FIR_PARTITIONS + EXTRA_PACKETS)
+#define MAX_FRAMES          (MAX_PACKETS * BLOCK)
+#define FULL_SCALE          32767.0
+// error against the direct convolution, relative to the rms of its output
+#define TOLERANCE_DB        (-100.0)
+#define FFT_TOLERANCE       1e-5
+#define FFT_RUNS            100
+#define RELOAD_PACKET       100
+// filter of the packet path, scaled to keep the output off full scale
+#define PACKET_TAPS         1000
+#define PACKET_TAPS_GAIN    0.05
+#define PACKET_LEVEL        8000.0
+// share of the packets a frame longer or shorter than the nominal 48
+#define PACKET_ODD_SHARE    0.3
+#define BENCH_PACKETS       2000
+// budget of the calibration, ns per packet: small enough for any host to cap
+// the filters, BUDGET_MARGIN for the other processes of the host
+#define BUDGET_NS           20000
+#define BUDGET_MARGIN       1.5
+#define BUDGET_PACKETS      101
+#define DIRECT_PACKETS      50
+
+// variables -------------------------------------------------------------------
+
+// normally owned by main.c
+float in_z1  = 0;
+float in_z2  = 0;
+float out_z1 = 0;
+float out_z2 = 0;
+
+// band layout, normally defined in audio_usb_nodes.c
+int16_t frequencies[] = {30, 60, 150, 400, 1000, 3000, 8000, 16000};
+int16_t bandwidths[] =  {1,   1,   2,   2,    2,    3,    3,     3};
+
+// private variables -----------------------------------------------------------
+// the SDRAM of the board
+static float    memory[DSP_FIR_MEMORY_SIZE / sizeof(float)];
+static float    taps[DSP_CHANNELS][DSP_FIR_MAX_TAPS];
+static float    input[2 * MAX_FRAMES];
+static float    output[2 * MAX_FRAMES];
+static uint32_t randomState = 1;
+
+// taps of each check, left and right
+static const uint32_t lengths[][DSP_CHANNELS] = {
+  { 1, 1 }, { 47, 48 }, { 49, 96 }, { 97, 0 }, { 1000, 333 }, { 4096, 4000 }, { DSP_FIR_MAX_TAPS, 8192 },
+};
+static const uint32_t benchLengths[] = { 1024, 4096, 8192, DSP_FIR_MAX_TAPS };
+
+// private function declarations -----------------------------------------------
+static bool     FirSim_Fft(void);
+static bool     FirSim_Convolution(void);
+static bool     FirSim_Reload(void);
+static bool     FirSim_Arguments(void);
+static bool     FirSim_Packets(void);
+static bool     FirSim_Budget(void);
+static void     FirSim_Benchmark(void);
+static void     FirSim_Filter(uint8_t channel, uint32_t count);
+static void     FirSim_Noise(uint32_t frames);
+static void     FirSim_Run(uint32_t from, uint32_t frames);
+static double   FirSim_ErrorDb(uint8_t channel, uint32_t count, uint32_t from, uint32_t to);
+static double   FirSim_Seconds(const struct timespec* start, const struct timespec* end);
+static uint32_t FirSim_Nanoseconds(void);
+static int      FirSim_Compare(const void* a, const void* b);
+static double   FirSim_Uniform(void);
+
+int main(void)
+{
+  bool passed = true;
+
+  AudioUserDspFir_Init(memory);
+
+  passed &= FirSim_Fft();
+  passed &= FirSim_Convolution();
+  passed &= FirSim_Reload();
+  passed &= FirSim_Arguments();
+  passed &= FirSim_Packets();
+  passed &= FirSim_Budget();
+  FirSim_Benchmark();
+
+  printf("%s\n", passed ? "all checks passed" : "CHECK FAILED");
+  return passed ? 0 : 1;
+}
+
+/**
+ * @brief  Random data through the real FFT, against a direct DFT and back.
+ * @param  None
+ * @retval true if both errors are within FFT_TOLERANCE of the largest value
+ */
+static bool FirSim_Fft(void)
+{
+  double forward = 0, inverse = 0;
+
+  for(uint32_t run = 0; run < FFT_RUNS; run++)
+  {
+    float data[DSP_FFT_SIZE];
+    double x[DSP_FFT_SIZE];
+    double peak = 0, error = 0;
+
+    for(uint32_t n = 0; n < DSP_FFT_SIZE; n++)
+      data[n] = (float)(x[n] = 2.0 * FirSim_Uniform() - 1.0);
+
+    AudioUserDspFft_Forward(data);
+
+    for(uint32_t k = 0; k <= DSP_FFT_HALF; k++)
+    {
+      double re = 0, im = 0;
+      for(uint32_t n = 0; n < DSP_FFT_SIZE; n++)
+      {
+        double angle = 2.0 * M_PI * k * n / DSP_FFT_SIZE;
+        re += x[n] * cos(angle);
+        im -= x[n] * sin(angle);
+      }
+      peak = fmax(peak, hypot(re, im));
+
+      if(k == 0)
+        error = fmax(error, fabs(data[0] - re));
+      else if(k == DSP_FFT_HALF)
+        error = fmax(error, fabs(data[1] - re));
+      else
+        error = fmax(error, hypot(data[2 * k] - re, data[2 * k + 1] - im));
+    }
+    forward = fmax(forward, error / peak);
+
+    AudioUserDspFft_Inverse(data);
+    for(uint32_t n = 0; n < DSP_FFT_SIZE; n++)
+      inverse = fmax(inverse, fabs(data[n] / DSP_FFT_SIZE - x[n]));
+  }
+
+  printf("  fft: %u points, forward error %.2e, round trip error %.2e\n", DSP_FFT_SIZE, forward, inverse);
+  return SimReport_Check("fft", forward < FFT_TOLERANCE && inverse < FFT_TOLERANCE);
+}
+
+/**
+ * @brief  Noise through filters of every length in lengths, each channel
+ *         against a direct convolution of its own.
+ * @param  None
+ * @retval true if every error is under TOLERANCE_DB
+ */
+static bool FirSim_Convolution(void)
+{
+  bool ok = true;
+
+  for(uint32_t i = 0; i < sizeof(lengths) / sizeof(lengths[0]); i++)
+  {
+    uint32_t longest = (lengths[i][0] > lengths[i][1]) ? lengths[i][0] : lengths[i][1];
+    uint32_t frames = (longest / BLOCK + EXTRA_PACKETS) * BLOCK;
+    double error[DSP_CHANNELS];
+
+    for(uint8_t channel = 0; channel < DSP_CHANNELS; channel++)
+      FirSim_Filter(channel, lengths[i][channel]);
+    AudioUserDspFir_Reset();
+
+    FirSim_Noise(frames);
+    FirSim_Run(0, frames);
+
+    for(uint8_t channel = 0; channel < DSP_CHANNELS; channel++)
+    {
+      error[channel] = FirSim_ErrorDb(channel, lengths[i][channel], 0, frames);
+      ok &= error[channel] < TOLERANCE_DB;
+    }
+    printf("  convolution: %5u and %5u taps, error %.1f and %.1f dB\n", lengths[i][0], lengths[i][1], error[0], error[1]);
+  }
+
+  return SimReport_Check("convolution", ok);
+}
+
+/**
+ * @brief  Loads a new left filter after RELOAD_PACKET packets.
+ * @param  None
+ * @retval true if the left channel matches its new filter over the input
+ *         since the reload, and the right one its filter over all of it
+ */
+static bool FirSim_Reload(void)
+{
+  const uint32_t count = 2000;
+  const uint32_t reload = RELOAD_PACKET * BLOCK;
+  uint32_t frames = reload + (count / BLOCK + EXTRA_PACKETS) * BLOCK;
+  double left, right;
+
+  FirSim_Filter(0, count);
+  FirSim_Filter(1, count);
+  AudioUserDspFir_Reset();
+  FirSim_Noise(frames);
+
+  FirSim_Run(0, reload);
+  FirSim_Filter(0, count);
+  FirSim_Run(reload, frames - reload);
+
+  left = FirSim_ErrorDb(0, count, reload, frames);
+  right = FirSim_ErrorDb(1, count, 0, frames);
+
+  printf("  reload: error %.1f dB on the reloaded channel, %.1f dB on the other\n", left, right);
+  return SimReport_Check("reload", left < TOLERANCE_DB && right < TOLERANCE_DB);
+}
+
+/**
+ * @brief  Out of range filters.
+ * @param  None
+ * @retval true if they are refused
+ */
+static bool FirSim_Arguments(void)
+{
+  bool tooLong = AudioUserDspFir_Load(0, taps[0], DSP_FIR_MAX_TAPS + 1);
+  bool thirdChannel = AudioUserDspFir_Load(DSP_CHANNELS, taps[0], 1);
+
+  printf("  arguments: %u taps %s, channel %u %s\n", DSP_FIR_MAX_TAPS + 1, tooLong ? "taken" : "refused",
+         DSP_CHANNELS, thirdChannel ? "taken" : "refused");
+  return SimReport_Check("arguments", !tooLong && !thirdChannel);
+}
+
+/**
+ * @brief  Noise packets of 47, 48 and 49 frames through
+ *         AudioUserDsp_ProcessPacket with the bands at 0 dB, no dither, and
+ *         a random filter on each channel.
+ * @param  None
+ * @retval true if every output sample is the direct convolution of the
+ *         packets sent, DSP_FIR_DELAY_FRAMES earlier, within 1 lsb
+ */
+static bool FirSim_Packets(void)
+{
+  static int16_t sent[2 * MAX_FRAMES];
+  static int16_t received[2 * MAX_FRAMES];
+  uint32_t frames = 0, odd = 0;
+  int32_t worst = 0;
+
+  for(uint8_t channel = 0; channel < DSP_CHANNELS; channel++)
+  {
+    for(uint32_t n = 0; n < PACKET_TAPS; n++)
+      taps[channel][n] = (float)(PACKET_TAPS_GAIN * (2.0 * FirSim_Uniform() - 1.0) * exp(-4.0 * n / PACKET_TAPS));
+    AudioUserDspFir_Load(channel, taps[channel], PACKET_TAPS);
+  }
+  AudioUserDspFir_Reset();
+
+  AudioUserDsp_SetDither(DSP_DITHER_OFF);
+  for(uint8_t i = 0; i < NUMBER_OF_BANDS; i++)
+  {
+    biquadFilters[i].isInitialized = false;
+    AudioUserDsp_BiquadFilterConfig(&biquadFilters[i], 0, frequencies[i], bandwidths[i]);
+  }
+
+  while(frames + FRAMES_PER_PACKET + 1 <= MAX_FRAMES)
+  {
+    uint8_t packet[PACKET_SIZE + 4];
+    uint32_t length = FRAMES_PER_PACKET;
+
+    if(FirSim_Uniform() < PACKET_ODD_SHARE)
+    {
+      length += (FirSim_Uniform() < 0.5) ? 1 : -1;
+      odd++;
+    }
+
+    for(uint32_t f = 0; f < length; f++)
+    {
+      int16_t* frame = &sent[2 * (frames + f)];
+      frame[0] = (int16_t)(PACKET_LEVEL * (2.0 * FirSim_Uniform() - 1.0));
+      frame[1] = (int16_t)(PACKET_LEVEL * (2.0 * FirSim_Uniform() - 1.0));
+      AudioUserDsp_SamplesToFrame(packet + 4 * f, &frame[0], &frame[1]);
+    }
+
+    AudioUserDsp_ProcessPacket(packet, 4 * length);
+
+    for(uint32_t f = 0; f < length; f++)
+      AudioUserDsp_FrameToSamples(packet + 4 * f, &received[2 * (frames + f)], &received[2 * (frames + f) + 1]);
+    frames += length;
+  }
+
+  for(uint32_t n = 0; n + DELAY < frames; n++)
+    for(uint8_t channel = 0; channel < DSP_CHANNELS; channel++)
+    {
+      double wanted = 0;
+      for(uint32_t m = 0; m < PACKET_TAPS && m <= n; m++)
+        wanted += (double)taps[channel][m] * sent[2 * (n - m) + channel];
+
+      int32_t difference = abs(received[2 * (n + DELAY) + channel] - (int32_t)lrint(wanted));
+      worst = (difference > worst) ? difference : worst;
+    }
+
+  AudioUserDspFir_Load(0, NULL, 0);
+  AudioUserDspFir_Load(1, NULL, 0);
+
+  printf("  packet path: %u frames in %u packets of 47 or 49 frames and the rest of 48, largest difference %d lsb\n",
+         frames, odd, worst);
+  return SimReport_Check("packet path", worst <= 1);
+}
+
+/**
+ * @brief  Calibrates against BUDGET_NS, then runs packets through filters of
+ *         the taps it allows. Leaves the full range to the benchmark.
+ * @param  None
+ * @retval true if the filters are gone after the calibration, the cap is
+ *         enforced and the median packet keeps to the budget
+ */
+static bool FirSim_Budget(void)
+{
+  uint32_t times[BUDGET_PACKETS];
+  float block[2 * BLOCK];
+  bool passThrough = true, overCap = false, atCap = true;
+  uint32_t cap;
+
+  FirSim_Filter(0, DSP_FIR_MAX_TAPS);
+  cap = AudioUserDspFir_Calibrate(FirSim_Nanoseconds, BUDGET_NS);
+
+  // no filter: not delayed, not changed
+  FirSim_Noise(BLOCK);
+  memcpy(block, input, sizeof(block));
+  AudioUserDspFir_Process(block, BLOCK);
+  passThrough = memcmp(block, input, sizeof(block)) == 0;
+
+  if(cap < DSP_FIR_MAX_TAPS)
+    overCap = AudioUserDspFir_Load(0, taps[0], cap + 1);
+  if(cap > 0)
+  {
+    FirSim_Filter(0, cap);
+    FirSim_Filter(1, cap);
+    atCap = AudioUserDspFir_GetMaxTaps() == cap;
+  }
+
+  FirSim_Noise(BLOCK * BUDGET_PACKETS);
+  for(uint32_t p = 0; p < BUDGET_PACKETS; p++)
+  {
+    memcpy(block, &input[2 * p * BLOCK], sizeof(block));
+    uint32_t start = FirSim_Nanoseconds();
+    AudioUserDspFir_Process(block, BLOCK);
+    times[p] = FirSim_Nanoseconds() - start;
+  }
+  qsort(times, BUDGET_PACKETS, sizeof(times[0]), FirSim_Compare);
+
+  printf("  budget: %u ns allows %u taps, %u partitions; median packet %u ns; past the cap %s\n", BUDGET_NS, cap,
+         cap / BLOCK, times[BUDGET_PACKETS / 2], overCap ? "taken" : "refused");
+
+  AudioUserDspFir_Init(memory);
+  return SimReport_Check("budget", cap > 0 && passThrough && !overCap && atCap &&
+                                   times[BUDGET_PACKETS / 2] <= BUDGET_MARGIN * BUDGET_NS);
+}
+
+/**
+ * @brief  Times BENCH_PACKETS packets of both channels through filters of
+ *         each length in benchLengths, and DIRECT_PACKETS of a direct float
+ *         convolution of the same length.
+ * @param  None
+ * @retval None
+ */
+static void FirSim_Benchmark(void)
+{
+  float block[2 * BLOCK];
+
+  for(uint32_t i = 0; i < sizeof(benchLengths) / sizeof(benchLengths[0]); i++)
+  {
+    uint32_t count = benchLengths[i];
+    struct timespec start, end;
+    double partitioned, direct;
+    volatile float sink = 0;
+
+    FirSim_Filter(0, count);
+    FirSim_Filter(1, count);
+    AudioUserDspFir_Reset();
+    FirSim_Noise(count + BLOCK);
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for(uint32_t p = 0; p < BENCH_PACKETS; p++)
+    {
+      memcpy(block, &input[2 * ((p * BLOCK) % count)], sizeof(block));
+      AudioUserDspFir_Process(block, BLOCK);
+      sink += block[0];
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    partitioned = FirSim_Seconds(&start, &end) / BENCH_PACKETS;
+
+    // each output sample over the count input samples before it
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for(uint32_t p = 0; p < DIRECT_PACKETS; p++)
+      for(uint32_t f = 0; f < BLOCK; f++)
+        for(uint8_t channel = 0; channel < DSP_CHANNELS; channel++)
+        {
+          const float* x = &input[2 * (count + f) + channel];
+          float y = 0;
+          for(uint32_t m = 0; m < count; m++)
+            y += taps[channel][m] * x[-2 * (int32_t)m];
+          sink += y;
+        }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    direct = FirSim_Seconds(&start, &end) / DIRECT_PACKETS;
+
+    printf("  throughput: %5u taps, %3u partitions, %7.2f us per packet, %5.2f%% of a packet, %6.1fx direct\n",
+           count, (count + BLOCK - 1) / BLOCK, 1e6 * partitioned, 100.0 * partitioned * SAMPLE_RATE / BLOCK,
+           direct / partitioned);
+  }
+
+  AudioUserDspFir_Load(0, NULL, 0);
+  AudioUserDspFir_Load(1, NULL, 0);
+}
+
+/**
+ * @brief  Loads a random filter with an exponential tail, like a room.
+ * @param  channel: 0 left, 1 right
+ * @param  count: taps
+ * @retval None
+ */
+static void FirSim_Filter(uint8_t channel, uint32_t count)
+{
+  for(uint32_t n = 0; n < count; n++)
+    taps[channel][n] = (float)((2.0 * FirSim_Uniform() - 1.0) * exp(-4.0 * n / count));
+  AudioUserDspFir_Load(channel, taps[channel], count);
+}
+
+/**
+ * @brief  Fills the input with white noise at half of full scale.
+ * @param  frames: stereo frames
+ * @retval None
+ */
+static void FirSim_Noise(uint32_t frames)
+{
+  for(uint32_t i = 0; i < 2 * frames; i++)
+    input[i] = (float)(0.5 * FULL_SCALE * (2.0 * FirSim_Uniform() - 1.0));
+}
+
+/**
+ * @brief  Copies input frames to the output and filters them there, in
+ *         calls of random length.
+ * @param  from: first frame
+ * @param  frames: to filter
+ * @retval None
+ */
+static void FirSim_Run(uint32_t from, uint32_t frames)
+{
+  memcpy(&output[2 * from], &input[2 * from], 2 * frames * sizeof(float));
+
+  for(uint32_t f = from; f < from + frames;)
+  {
+    uint32_t chunk = 1 + (uint32_t)(FirSim_Uniform() * MAX_CHUNK);
+
+    if(chunk > from + frames - f)
+      chunk = from + frames - f;
+    AudioUserDspFir_Process(&output[2 * f], chunk);
+    f += chunk;
+  }
+}
+
+/**
+ * @brief  Compares a channel of the output with the direct convolution, in
+ *         double, of its taps with the input from a frame on, DELAY frames
+ *         earlier.
+ * @param  channel: 0 left, 1 right
+ * @param  count: taps, 0 compares with the input
+ * @param  from: first frame of the input and of the comparison
+ * @param  to: frame after the last output frame
+ * @retval largest error relative to the rms of the convolution, dB
+ */
+static double FirSim_ErrorDb(uint8_t channel, uint32_t count, uint32_t from, uint32_t to)
+{
+  double power = 0, worst = 0;
+
+  for(uint32_t n = from; n + DELAY < to; n++)
+  {
+    double wanted = 0;
+
+    if(count == 0)
+      wanted = input[2 * n + channel];
+    for(uint32_t m = 0; m < count && m <= n - from; m++)
+      wanted += (double)taps[channel][m] * input[2 * (n - m) + channel];
+
+    power += wanted * wanted;
+    worst = fmax(worst, fabs(output[2 * (n + DELAY) + channel] - wanted));
+  }
+
+  return 20.0 * log10(worst / sqrt(power / (to - DELAY - from)) + 1e-30);
+}
+
+static double FirSim_Seconds(const struct timespec* start, const struct timespec* end)
+{
+  return (end->tv_sec - start->tv_sec) + (end->tv_nsec - start->tv_nsec) * 1e-9;
+}
+
+// the clock of the calibration
+static uint32_t FirSim_Nanoseconds(void)
+{
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint32_t)(now.tv_sec * 1000000000ull + now.tv_nsec);
+}
+
+static int FirSim_Compare(const void* a, const void* b)
+{
+  uint32_t x = *(const uint32_t*)a, y = *(const uint32_t*)b;
+
+  return (x > y) - (x < y);
+}
+
+static double FirSim_Uniform(void)
+{
+  randomState ^= randomState << 13;
+  randomState ^= randomState >> 17;
+  randomState ^= randomState << 5;
+  return randomState / 4294967296.0;
+}
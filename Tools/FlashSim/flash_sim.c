@@ -0,0 +1,689 @@
+/**
+  ******************************************************************************
+  * @file    flash_sim.c
+  * @brief   Runs the flash journal on two simulated sectors with NOR rules:
+  *          erase sets every bit, programming only clears bits. Checks:
+  *          - wear: a long run of saves, with the erases of each sector, the
+  *            saves per erase and the flash stall against the old format,
+  *            which erased the sector at every save;
+  *          - power loss: the power is cut at every flash operation of a run
+  *            that fills the sector and collects it. The cut operation is
+  *            left half done: a word with some of its bits programmed, a
+  *            sector partly erased. After each cut the journal must restore
+  *            the last completed save or the one in flight, then keep saving;
+  *          - random cuts: the same over long runs, cut at random, twice in
+  *            a row some of the time, a quarter of them in a collection;
+  *          - corruption: a flipped bit in the newest record brings back the
+  *            one before;
+  *          - background: the flash takes time, as on the board, and the
+  *            main loop calls FlashJournal_Process every 10 ms while saves
+  *            come faster than the flash erases. Saves queue instead of
+  *            waiting, and the audio interrupt, every 1 ms, is late only by
+  *            what the flash stalls: nothing in dual bank mode, the rest of
+  *            the word or of the erase in progress in single bank mode;
+  *          - stream hold: the same in single bank mode with a stream open,
+  *            the erases held: saves go on until both sectors are full, the
+  *            audio interrupt is never late by more than a word, and the
+  *            erases and the collection run once the stream stops.
+  *
+  *          Apart from the background check the flash finishes each
+  *          operation when it is started. The stall times are datasheet
+  *          estimates for a 256 KB sector at x32 parallelism; change them
+  *          below to match a measurement.
+  *
+  *          build (from Tools, the sources are listed in its Makefile):
+  *            make build/flash_sim
+  *
+  *          usage:
+  *            ./flash_sim [-s saves] [-r seed]   (exit status 1 if a check fails)
+  ******************************************************************************
+  */
+
+#include "flash_journal.h"
+#include <setjmp.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+// private defines -------------------------------------------------------------
+#define WORD_PROGRAM_US     16
+#define SECTOR_ERASE_MS     1000
+// words the old format programmed at each save
+#define LEGACY_WORDS        8
+#define BANDS               8
+#define RANDOM_RUNS         1000
+#define RANDOM_SAVES        3000
+#define BACKGROUND_SECONDS  1000
+// long enough to fill both sectors
+#define STREAM_SECONDS      1000
+#define MAIN_LOOP_PERIOD_MS 10
+// far more often than anyone presses save, to go through collections
+#define SAVE_INTERVAL_MS    50
+
+// private typedefs ------------------------------------------------------------
+typedef struct Preset
+{
+  uint16_t knobY[BANDS];
+} Preset;
+
+// private variables -----------------------------------------------------------
+static uint8_t  flash[FLASH_JOURNAL_SECTORS][FLASH_JOURNAL_SECTOR_SIZE];
+static uint32_t erases[FLASH_JOURNAL_SECTORS];
+static uint64_t programs = 0;
+static uint64_t operations = 0;
+static uint64_t cutAt = 0;                      // operation that loses the power, 0 for none
+static uint32_t erasesCut = 0;
+static jmp_buf  powerLoss;
+static uint32_t randomState = 1;
+
+// operation in progress when the flash takes time
+static bool            timed = false;
+static uint64_t        nowUs = 0;
+static uint64_t        operationEndUs = 0;
+static int8_t          eraseSector = -1;
+static uint8_t         programSector;
+static uint32_t        programOffset;
+static const uint32_t* programWords = NULL;
+static uint32_t        programCount = 0;
+
+// private function declarations -----------------------------------------------
+static bool     FlashSim_Wear(uint32_t saves);
+static bool     FlashSim_PowerLoss(void);
+static bool     FlashSim_RandomCuts(void);
+static bool     FlashSim_Corruption(void);
+static bool     FlashSim_Background(void);
+static bool     FlashSim_StreamHold(void);
+static void     FlashSim_RunUntil(uint64_t us);
+static void     FlashSim_Format(void);
+static bool     FlashSim_Save(const Preset* preset);
+static bool     FlashSim_Restore(Preset* preset);
+static bool     FlashSim_CutSave(const Preset* preset, uint64_t operation);
+static bool     FlashSim_CheckAfterCut(const Preset* done, const Preset* inFlight);
+static void     FlashSim_MakePreset(Preset* preset, uint32_t number);
+static bool     FlashSim_Tick(void);
+static uint32_t FlashSim_Random(void);
+
+int main(int argc, char** argv)
+{
+  uint32_t saves = 100000;
+  int option;
+  bool passed = true;
+
+  while((option = getopt(argc, argv, "s:r:h")) != -1)
+  {
+    if(option == 's')
+      saves = strtoul(optarg, NULL, 0);
+    else if(option == 'r')
+      randomState = strtoul(optarg, NULL, 0) | 1;
+    else
+    {
+      fprintf(stderr, "usage: %s [-s saves] [-r seed]\n", argv[0]);
+      return 1;
+    }
+  }
+
+  passed &= FlashSim_Wear(saves);
+  passed &= FlashSim_PowerLoss();
+  passed &= FlashSim_RandomCuts();
+  passed &= FlashSim_Corruption();
+  passed &= FlashSim_Background();
+  passed &= FlashSim_StreamHold();
+
+  printf("%s\n", passed ? "all checks passed" : "CHECK FAILED");
+  return passed ? 0 : 1;
+}
+
+/**
+ * @brief  Saves many presets, checking each against a fresh restore now and
+ *         then, and compares the wear and the stall with the old format.
+ * @param  saves: number of saves
+ * @retval true if every save came back
+ */
+static bool FlashSim_Wear(uint32_t saves)
+{
+  FlashJournalStats stats;
+  Preset preset, restored;
+  uint64_t stallUs;
+  bool ok = true;
+
+  FlashSim_Format();
+  FlashJournal_Init();
+
+  for(uint32_t i = 0; i < saves && ok; i++)
+  {
+    FlashSim_MakePreset(&preset, i);
+    ok = FlashSim_Save(&preset);
+    if(ok && i % 997 == 0)
+      ok = FlashSim_Restore(&restored) && memcmp(&preset, &restored, sizeof(preset)) == 0;
+  }
+  ok = ok && FlashSim_Restore(&restored) && memcmp(&preset, &restored, sizeof(preset)) == 0;
+
+  FlashJournal_GetStats(&stats);
+  stallUs = programs * WORD_PROGRAM_US + (uint64_t)(erases[0] + erases[1]) * SECTOR_ERASE_MS * 1000;
+
+  printf("wear, %u saves of %u bytes:\n", saves, (unsigned)sizeof(Preset));
+  printf("  erases                %u + %u (old format: %u on one sector)\n", erases[0], erases[1], saves);
+  printf("  saves per erase       %.0f\n", (double)saves / (erases[0] + erases[1] ? erases[0] + erases[1] : 1));
+  printf("  active sector         %d, %u KB used\n", stats.activeSector, stats.usedBytes / 1024);
+  printf("  flash stall per save  %.1f us (old format: %u ms)\n", (double)stallUs / saves,
+    SECTOR_ERASE_MS + LEGACY_WORDS * WORD_PROGRAM_US / 1000);
+  bool countsOk = stats.eraseCount[0] == erases[0] && stats.eraseCount[1] == erases[1];
+
+  printf("  erase counts kept     %u / %u  %s\n", stats.eraseCount[0], stats.eraseCount[1], countsOk ? "ok" : "MISMATCH");
+  printf("  restores              %s\n", ok ? "ok" : "FAILED");
+
+  return ok && countsOk;
+}
+
+/**
+ * @brief  Cuts the power at every flash operation of a run through a full
+ *         sector, the collection and the saves after it, from a snapshot
+ *         taken just before. The first format of a blank journal too.
+ * @param  None
+ * @retval true if every cut restored a save that completed or was in flight
+ */
+static bool FlashSim_PowerLoss(void)
+{
+  static uint8_t snapshot[FLASH_JOURNAL_SECTORS][FLASH_JOURNAL_SECTOR_SIZE];
+  const uint32_t before = FLASH_JOURNAL_SECTOR_SIZE / FLASH_JOURNAL_SLOT_SIZE - 8;
+  const uint32_t run = 24;
+  Preset preset, done;
+  uint32_t cuts = 0, blankCuts = 0, failures = 0;
+
+  FlashSim_Format();
+  FlashJournal_Init();
+  for(uint32_t i = 0; i < before; i++)
+  {
+    FlashSim_MakePreset(&done, i);
+    FlashSim_Save(&done);
+  }
+  memcpy(snapshot, flash, sizeof(flash));
+
+  // operations of the run without cuts, the cut points to try
+  operations = 0;
+  for(uint32_t i = 0; i < run; i++)
+  {
+    FlashSim_MakePreset(&preset, before + i);
+    FlashSim_Save(&preset);
+  }
+  uint64_t total = operations;
+
+  for(uint64_t cut = 1; cut <= total; cut++)
+  {
+    Preset last = done;
+
+    memcpy(flash, snapshot, sizeof(flash));
+    FlashJournal_Init();
+    operations = 0;
+
+    for(uint32_t i = 0; i < run; i++)
+    {
+      FlashSim_MakePreset(&preset, before + i);
+      if(!FlashSim_CutSave(&preset, cut))
+      {
+        cuts++;
+        failures += !FlashSim_CheckAfterCut(&last, &preset);
+        break;
+      }
+      last = preset;
+    }
+  }
+
+  // blank flash, cut during the first save
+  for(uint64_t cut = 1; cut < 32; cut++)
+  {
+    Preset none = {{0}};
+
+    FlashSim_Format();
+    FlashJournal_Init();
+    operations = 0;
+    FlashSim_MakePreset(&preset, 1);
+    if(!FlashSim_CutSave(&preset, cut))
+    {
+      blankCuts++;
+      failures += !FlashSim_CheckAfterCut(&none, &preset);
+    }
+  }
+
+  printf("power loss: %u cuts around a collection, %u in the first save, %u bad restores  %s\n", cuts,
+    blankCuts, failures, failures ? "FAILED" : "ok");
+  return failures == 0 && cuts == total;
+}
+
+/**
+ * @brief  Long runs cut at random points, some of them cut again during the
+ *         first save after the restore.
+ * @param  None
+ * @retval true if every cut restored a save that completed or was in flight
+ */
+static bool FlashSim_RandomCuts(void)
+{
+  Preset preset, last = {{0}};
+  uint32_t cuts = 0, failures = 0, number = 0;
+
+  FlashSim_Format();
+  FlashJournal_Init();
+  erasesCut = 0;
+
+  for(uint32_t r = 0; r < RANDOM_RUNS && failures == 0; r++)
+  {
+    uint64_t cut = 1 + FlashSim_Random() % (RANDOM_SAVES * 4);
+    FlashJournalStats stats;
+
+    // one run in four fills the sector first and is cut in the collection
+    FlashJournal_GetStats(&stats);
+    while(r % 4 == 0 && stats.usedBytes + FLASH_JOURNAL_SLOT_SIZE <= FLASH_JOURNAL_SECTOR_SIZE)
+    {
+      FlashSim_MakePreset(&last, ++number);
+      FlashSim_Save(&last);
+      FlashJournal_GetStats(&stats);
+      cut = 1 + FlashSim_Random() % 24;
+    }
+
+    operations = 0;
+    for(uint32_t i = 0; i < RANDOM_SAVES; i++)
+    {
+      FlashSim_MakePreset(&preset, ++number);
+      if(FlashSim_CutSave(&preset, cut))
+      {
+        last = preset;
+        continue;
+      }
+
+      cuts++;
+      if(!FlashSim_CheckAfterCut(&last, &preset))
+      {
+        failures++;
+        break;
+      }
+      FlashSim_Restore(&last);
+
+      // and again, early in the first save after the restore
+      if(FlashSim_Random() % 4 == 0)
+      {
+        operations = 0;
+        FlashSim_MakePreset(&preset, ++number);
+        if(!FlashSim_CutSave(&preset, 1 + FlashSim_Random() % 4))
+        {
+          cuts++;
+          failures += !FlashSim_CheckAfterCut(&last, &preset);
+          FlashSim_Restore(&last);
+        }
+        else
+          last = preset;
+      }
+      break;
+    }
+  }
+
+  printf("random cuts: %u cuts in %u saves, %u of them in an erase, %u bad restores  %s\n", cuts, number,
+    erasesCut, failures, failures ? "FAILED" : "ok");
+  return failures == 0;
+}
+
+/**
+ * @brief  Flips one payload bit of the newest record: the restore must skip
+ *         it and return the save before.
+ * @param  None
+ * @retval true if it did
+ */
+static bool FlashSim_Corruption(void)
+{
+  Preset first, second, restored;
+  FlashJournalStats stats;
+
+  FlashSim_Format();
+  FlashJournal_Init();
+  FlashSim_MakePreset(&first, 1);
+  FlashSim_MakePreset(&second, 2);
+  FlashSim_Save(&first);
+  FlashSim_Save(&second);
+
+  // slot 0 is the sector header, then the two records
+  flash[0][3 * FLASH_JOURNAL_SLOT_SIZE - 8] ^= 0x04;
+
+  bool ok = FlashSim_Restore(&restored) && memcmp(&first, &restored, sizeof(first)) == 0;
+  FlashJournal_GetStats(&stats);
+  ok &= stats.skipped == 1;
+
+  printf("corruption: flipped bit skipped, save before restored  %s\n", ok ? "ok" : "FAILED");
+  return ok;
+}
+
+/**
+ * @brief  Saves every 1 to SAVE_INTERVAL_MS ms with a flash that takes its
+ *         time, calls FlashJournal_Process from a 10 ms main loop task and
+ *         measures how late a 1 ms audio interrupt would come, then lets the
+ *         queue drain and restores.
+ * @param  None
+ * @retval true if the last save came back, saves queued while the flash was
+ *         busy and no interrupt waited in dual bank mode
+ */
+static bool FlashSim_Background(void)
+{
+  FlashJournalStats stats;
+  Preset preset = {{0}}, restored;
+  uint32_t saves = 0, busyMs = 0;
+  uint64_t singleBankLateUs = 0, dualBankLateUs = 0, blockedUs = 0;
+  uint64_t nextSaveMs = 1;
+
+  FlashSim_Format();
+  FlashJournal_Init();
+  timed = true;
+  nowUs = 0;
+
+  for(uint64_t ms = 1; ms <= BACKGROUND_SECONDS * 1000 || !FlashJournal_IsIdle(); ms++)
+  {
+    FlashSim_RunUntil(ms * 1000);
+
+    // the audio interrupt: a fetch waits for the word or the erase in
+    // progress in single bank mode, never in dual bank mode
+    if(FlashJournalBackend_IsBusy())
+    {
+      busyMs++;
+      if(operationEndUs - nowUs > singleBankLateUs)
+        singleBankLateUs = operationEndUs - nowUs;
+    }
+
+    if(ms == nextSaveMs && ms <= BACKGROUND_SECONDS * 1000)
+    {
+      uint64_t before = nowUs;
+
+      FlashSim_MakePreset(&preset, ++saves);
+      FlashSim_Save(&preset);
+      nextSaveMs += 1 + FlashSim_Random() % SAVE_INTERVAL_MS;
+      if(nowUs - before > blockedUs)
+        blockedUs = nowUs - before;
+    }
+
+    if(ms % MAIN_LOOP_PERIOD_MS == 0)
+      FlashJournal_Process();
+  }
+
+  timed = false;
+  FlashJournal_GetStats(&stats);
+  bool restoredOk = FlashSim_Restore(&restored) && memcmp(&preset, &restored, sizeof(preset)) == 0;
+  bool ok = restoredOk && stats.coalesced > 0 && stats.appends + stats.coalesced == saves &&
+    dualBankLateUs == 0 && blockedUs == 0 && stats.failures == 0;
+
+  printf("background, %u s with a save every 1 to %u ms:\n", BACKGROUND_SECONDS, SAVE_INTERVAL_MS);
+  printf("  saves                 %u: %u written, %u replaced by a newer one while queued\n", saves,
+    stats.appends, stats.coalesced);
+  printf("  collections           %u, erases %u + %u, flash busy %.1f%% of the time\n", stats.collections,
+    erases[0], erases[1], 100.0 * busyMs / (BACKGROUND_SECONDS * 1000));
+  printf("  audio interrupt late  %llu us in dual bank mode, %llu us in single bank mode\n",
+    (unsigned long long)dualBankLateUs, (unsigned long long)singleBankLateUs);
+  printf("  main loop waited      %llu us (blocking backend: %u ms per erase)\n", (unsigned long long)blockedUs,
+    SECTOR_ERASE_MS);
+  printf("  restore               %s\n", restoredOk ? "ok" : "FAILED");
+  printf("  %s\n", ok ? "ok" : "FAILED");
+
+  return ok;
+}
+
+/**
+ * @brief  Saves as in the background check with the erases held, as
+ *         flash_persistence.c does while a stream is open in single bank
+ *         mode, then lets them go and runs until the journal is idle.
+ * @param  None
+ * @retval true if nothing was erased during the stream, the interrupt was
+ *         late by a word at most, saves went on past the first sector, and
+ *         the last one came back once the erases ran
+ */
+static bool FlashSim_StreamHold(void)
+{
+  FlashJournalStats stats;
+  Preset preset = {{0}}, restored;
+  uint32_t saves = 0, streamErases, streamAppends, streamCollections;
+  uint64_t lateUs = 0, ms;
+  uint64_t nextSaveMs = 1;
+
+  FlashSim_Format();
+  FlashJournal_Init();
+  FlashJournal_HoldErase(true);
+  timed = true;
+  nowUs = 0;
+
+  for(ms = 1; ms <= STREAM_SECONDS * 1000; ms++)
+  {
+    FlashSim_RunUntil(ms * 1000);
+
+    if(FlashJournalBackend_IsBusy() && operationEndUs - nowUs > lateUs)
+      lateUs = operationEndUs - nowUs;
+
+    if(ms == nextSaveMs)
+    {
+      FlashSim_MakePreset(&preset, ++saves);
+      FlashSim_Save(&preset);
+      nextSaveMs += 1 + FlashSim_Random() % SAVE_INTERVAL_MS;
+    }
+
+    if(ms % MAIN_LOOP_PERIOD_MS == 0)
+      FlashJournal_Process();
+  }
+
+  FlashJournal_GetStats(&stats);
+  streamErases = erases[0] + erases[1] + (eraseSector >= 0);
+  streamAppends = stats.appends;
+  streamCollections = stats.collections;
+
+  // the stream stops
+  FlashJournal_HoldErase(false);
+  for(; !FlashJournal_IsIdle(); ms++)
+  {
+    FlashSim_RunUntil(ms * 1000);
+    if(ms % MAIN_LOOP_PERIOD_MS == 0)
+      FlashJournal_Process();
+  }
+
+  timed = false;
+  FlashJournal_GetStats(&stats);
+  bool restoredOk = FlashSim_Restore(&restored) && memcmp(&preset, &restored, sizeof(preset)) == 0;
+  bool ok = restoredOk && streamErases == 0 && lateUs <= WORD_PROGRAM_US &&
+    streamAppends > FLASH_JOURNAL_SECTOR_SIZE / FLASH_JOURNAL_SLOT_SIZE && erases[0] + erases[1] > 0 &&
+    stats.collections > streamCollections && stats.failures == 0;
+
+  printf("stream hold, %u s in single bank mode with a save every 1 to %u ms:\n", STREAM_SECONDS, SAVE_INTERVAL_MS);
+  printf("  during the stream     %u saves, %u written, %u collections, %u erases, interrupt late %llu us\n", saves,
+    streamAppends, streamCollections, streamErases, (unsigned long long)lateUs);
+  printf("  after it stopped      %u collections, erases %u + %u, idle %.1f s later\n", stats.collections,
+    erases[0], erases[1], (ms - STREAM_SECONDS * 1000) / 1000.0);
+  printf("  restore               %s\n", restoredOk ? "ok" : "FAILED");
+  printf("  %s\n", ok ? "ok" : "FAILED");
+
+  return ok;
+}
+
+static void FlashSim_Format(void)
+{
+  timed = false;
+  eraseSector = -1;
+  programWords = NULL;
+  memset(flash, 0xFF, sizeof(flash));
+  memset(erases, 0, sizeof(erases));
+  programs = 0;
+  operations = 0;
+  cutAt = 0;
+}
+
+static bool FlashSim_Save(const Preset* preset)
+{
+  return FlashJournal_Append(0, preset, sizeof(*preset));
+}
+
+// reboots: scans the journal again and reads the preset
+static bool FlashSim_Restore(Preset* preset)
+{
+  FlashJournal_Init();
+  return FlashJournal_Read(0, preset, sizeof(*preset)) == sizeof(*preset);
+}
+
+/**
+ * @brief  Saves with the power cut at an operation.
+ * @param  preset: to save
+ * @param  operation: operation number that is cut, counted from the last
+ *         reset of operations
+ * @retval false if the power was cut during the save
+ */
+static bool FlashSim_CutSave(const Preset* preset, uint64_t operation)
+{
+  cutAt = operation;
+  if(setjmp(powerLoss) != 0)
+  {
+    cutAt = 0;
+    return false;
+  }
+
+  FlashSim_Save(preset);
+  cutAt = 0;
+  return true;
+}
+
+/**
+ * @brief  After a cut: the restore returns the last completed save or the one
+ *         in flight, and saving works again.
+ * @param  done: last completed save, all zero if none
+ * @param  inFlight: the save that was cut
+ * @retval true if so
+ */
+static bool FlashSim_CheckAfterCut(const Preset* done, const Preset* inFlight)
+{
+  static const Preset none = {{0}};
+  Preset restored = {{0}}, next;
+
+  if(!FlashSim_Restore(&restored) && memcmp(done, &none, sizeof(none)) != 0)
+    return false;
+
+  if(memcmp(&restored, done, sizeof(restored)) != 0 && memcmp(&restored, inFlight, sizeof(restored)) != 0)
+    return false;
+
+  FlashSim_MakePreset(&next, 0xBEEF);
+  return FlashSim_Save(&next) && FlashSim_Restore(&restored) && memcmp(&restored, &next, sizeof(next)) == 0 &&
+    FlashSim_Save(done) && FlashSim_Restore(&restored);
+}
+
+static void FlashSim_MakePreset(Preset* preset, uint32_t number)
+{
+  for(uint8_t i = 0; i < BANDS; i++)
+    preset->knobY[i] = 25 + (number * 7 + i * 53) % 400;
+}
+
+// counts an operation; true if it is the one that loses the power
+static bool FlashSim_Tick(void)
+{
+  operations++;
+  return cutAt != 0 && operations == cutAt;
+}
+
+static uint32_t FlashSim_Random(void)
+{
+  randomState ^= randomState << 13;
+  randomState ^= randomState >> 17;
+  randomState ^= randomState << 5;
+  return randomState;
+}
+
+const uint8_t* FlashJournalBackend_Sector(uint8_t sector)
+{
+  return flash[sector];
+}
+
+/**
+ * @brief  Lets the flash run: finishes the erase in progress, or programs the
+ *         words due, the next one started by the interrupt of the last.
+ * @param  us: time to run to
+ * @retval None
+ */
+static void FlashSim_RunUntil(uint64_t us)
+{
+  while(FlashJournalBackend_IsBusy() && operationEndUs <= us)
+  {
+    nowUs = operationEndUs;
+    if(eraseSector >= 0)
+    {
+      memset(flash[eraseSector], 0xFF, FLASH_JOURNAL_SECTOR_SIZE);
+      erases[eraseSector]++;
+      eraseSector = -1;
+      continue;
+    }
+
+    uint32_t* word = (uint32_t*)&flash[programSector][programOffset];
+    *word &= *programWords++;
+    programs++;
+    programOffset += 4;
+    if(--programCount == 0)
+      programWords = NULL;
+    else
+      operationEndUs += WORD_PROGRAM_US;
+  }
+
+  nowUs = us;
+}
+
+bool FlashJournalBackend_IsBusy(void)
+{
+  return eraseSector >= 0 || programWords != NULL;
+}
+
+/**
+ * @brief  Erases a sector, at once or when timed, after SECTOR_ERASE_MS. Cut,
+ *         it is left erased up to a random point.
+ * @param  sector: 0 or 1
+ * @retval None
+ */
+void FlashJournalBackend_StartErase(uint8_t sector)
+{
+  if(timed)
+  {
+    eraseSector = sector;
+    operationEndUs = nowUs + SECTOR_ERASE_MS * 1000;
+    return;
+  }
+
+  if(FlashSim_Tick())
+  {
+    erasesCut++;
+    memset(flash[sector], 0xFF, FlashSim_Random() % FLASH_JOURNAL_SECTOR_SIZE);
+    longjmp(powerLoss, 1);
+  }
+
+  memset(flash[sector], 0xFF, FLASH_JOURNAL_SECTOR_SIZE);
+  erases[sector]++;
+}
+
+/**
+ * @brief  Programs words, clearing bits only, at once or when timed, one per
+ *         WORD_PROGRAM_US. A cut word gets a random part of its zero bits.
+ * @param  sector: 0 or 1
+ * @param  offset: in the sector
+ * @param  words: data
+ * @param  count: number of words
+ * @retval None
+ */
+void FlashJournalBackend_StartProgram(uint8_t sector, uint32_t offset, const uint32_t* words, uint32_t count)
+{
+  if(timed)
+  {
+    programSector = sector;
+    programOffset = offset;
+    programWords = words;
+    programCount = count;
+    operationEndUs = nowUs + WORD_PROGRAM_US;
+    return;
+  }
+
+  for(uint32_t i = 0; i < count; i++)
+  {
+    uint32_t* word = (uint32_t*)&flash[sector][offset + 4 * i];
+
+    if(FlashSim_Tick())
+    {
+      *word &= words[i] | FlashSim_Random();
+      longjmp(powerLoss, 1);
+    }
+
+    *word &= words[i];
+    programs++;
+  }
+}
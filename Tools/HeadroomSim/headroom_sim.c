@@ -0,0 +1,278 @@
+/**
+  ******************************************************************************
+  * @file    headroom_sim.c
+  * @brief   Plays full scale signals through the EQ with the worst presets the
+  *          sliders allow and counts the clipped output samples:
+  *          - bands: the eight bands one at a time, each saturating to 16
+  *            bits, the packet path before the headroom; a sample counts
+  *            once for every band that clipped it;
+  *          - no headroom: the packet path, in float between the bands and
+  *            saturating once, at 0 dB;
+  *          - headroom: the same with the pre-gain the main loop derives from
+  *            the peak of the magnitude response.
+  *          The signals are a log sweep from 20 Hz to 20 kHz and a tone at the
+  *          frequency of the peak, both at -0.1 dBFS. With the headroom no
+  *          preset may clip, the tone must still come out within 1 dB of
+  *          full scale and a boost must clip without it.
+  *
+  *          The cycle cost of the single saturation path against the bands
+  *          one at a time is the process_packet case of Tools/DspBench
+  *          against apply_filter with 8 bands in stereo.
+  *
+  *          build (from Tools, the sources are listed in its Makefile):
+  *            make build/headroom_sim
+  *
+  *          usage:
+  *            ./headroom_sim   (exit status 1 if a check fails)
+  ******************************************************************************
+  */
+
+#include "audio_user_dsp.h"
+#include "audio_user_dsp_response.h"
+#include "usb_audio.h"
+#include "sim_report.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// private defines -------------------------------------------------------------
+#define SAMPLE_RATE         USB_AUDIO_CONFIG_PLAY_DEF_FREQ
+#define PACKET_SIZE         AUDIO_MS_PACKET_SIZE(SAMPLE_RATE, USB_AUDIO_CONFIG_PLAY_CHANNEL_COUNT, USB_AUDIO_CONFIG_PLAY_RES_BYTE)
+#define FRAMES_PER_PACKET   (PACKET_SIZE / 4)
+#define SWEEP_PACKETS       3000
+#define TONE_PACKETS        500
+#define FRAMES              (SWEEP_PACKETS * FRAMES_PER_PACKET)
+#define INPUT_LEVEL_DB      (-0.1)
+#define SWEEP_START         20.0
+#define SWEEP_END           20000.0
+#define PI                  3.14159265358979323846
+// the tone with the headroom may not come out lower than this
+#define TONE_MIN_LEVEL_DB   (-1.0)
+
+// private typedefs ------------------------------------------------------------
+typedef enum HeadroomSimPath
+{
+  PATH_BANDS,
+  PATH_NO_HEADROOM,
+  PATH_HEADROOM,
+  PATHS
+} HeadroomSimPath;
+
+typedef struct HeadroomSimPreset
+{
+  const char* name;
+  int16_t     gains[NUMBER_OF_BANDS];
+} HeadroomSimPreset;
+
+// clipped samples and peak of the output of one run
+typedef struct HeadroomSimResult
+{
+  uint32_t clipped;
+  int32_t  peak;
+} HeadroomSimResult;
+
+// variables -------------------------------------------------------------------
+
+// normally owned by main.c
+float in_z1  = 0;
+float in_z2  = 0;
+float out_z1 = 0;
+float out_z2 = 0;
+
+// band layout, normally defined in audio_usb_nodes.c
+int16_t frequencies[] = {30, 60, 150, 400, 1000, 3000, 8000, 16000};
+int16_t bandwidths[] =  {1,   1,   2,   2,    2,    3,    3,     3};
+
+// private variables -----------------------------------------------------------
+static int16_t input[2 * FRAMES];
+
+static const HeadroomSimPreset presets[] = {
+  { "flat",        {  0,   0,   0,   0,   0,   0,   0,   0 } },
+  { "all boost",   { 15,  15,  15,  15,  15,  15,  15,  15 } },
+  { "bass boost",  { 15,  15,  15,  15,   0,   0,   0,   0 } },
+  { "treble boost",{  0,   0,   0,   0,  15,  15,  15,  15 } },
+  { "alternating", { 15, -15,  15, -15,  15, -15,  15, -15 } },
+  { "smile",       { 15,  10,   0,  -5,  -5,   0,  10,  15 } },
+};
+
+static const char* pathNames[PATHS] = { "bands", "no headroom", "headroom" };
+
+// private function declarations -----------------------------------------------
+static bool HeadroomSim_Preset(const HeadroomSimPreset* preset);
+static void HeadroomSim_Configure(const int16_t* gains);
+static void HeadroomSim_Sweep(void);
+static void HeadroomSim_Tone(double frequency);
+static void HeadroomSim_Run(HeadroomSimPath path, float peakDb, uint32_t packets, HeadroomSimResult* result);
+static void HeadroomSim_Count(const uint8_t* packet, uint32_t* clipped, int32_t* peak);
+
+int main(void)
+{
+  bool passed = true;
+
+  AudioUserDspResponse_Init(SAMPLE_RATE);
+  for(uint32_t i = 0; i < sizeof(presets) / sizeof(presets[0]); i++)
+    passed &= HeadroomSim_Preset(&presets[i]);
+
+  printf("%s\n", passed ? "all checks passed" : "CHECK FAILED");
+  return passed ? 0 : 1;
+}
+
+/**
+ * @brief  Plays the sweep and the tone through every path with one preset
+ *         and prints the peak of the response, the clipped samples and the
+ *         level of the output.
+ * @param  preset: gains of the bands
+ * @retval true if nothing clips with the headroom, the tone keeps its level
+ *         and a boost does clip without it
+ */
+static bool HeadroomSim_Preset(const HeadroomSimPreset* preset)
+{
+  HeadroomSimResult sweep[PATHS];
+  HeadroomSimResult tone[PATHS];
+  uint16_t peakPoint = 0;
+
+  HeadroomSim_Configure(preset->gains);
+  AudioUserDspResponse_Update();
+  float peakDb = AudioUserDspResponse_Peak();
+  const float* magnitude = AudioUserDspResponse_Magnitude();
+
+  for(uint16_t p = 1; p < DSP_RESPONSE_POINTS; p++)
+  {
+    if(magnitude[p] > magnitude[peakPoint])
+      peakPoint = p;
+  }
+
+  HeadroomSim_Sweep();
+  for(uint8_t path = 0; path < PATHS; path++)
+    HeadroomSim_Run(path, peakDb, SWEEP_PACKETS, &sweep[path]);
+
+  HeadroomSim_Tone(AudioUserDspResponse_Frequency(peakPoint));
+  for(uint8_t path = 0; path < PATHS; path++)
+    HeadroomSim_Run(path, peakDb, TONE_PACKETS, &tone[path]);
+
+  double toneLevel = 20.0 * log10(tone[PATH_HEADROOM].peak / 32768.0);
+
+  printf("  %s: response peak %+.2f dB at %.0f Hz\n", preset->name, peakDb, AudioUserDspResponse_Frequency(peakPoint));
+  for(uint8_t path = 0; path < PATHS; path++)
+  {
+    printf("    %-12s clipped %7u in the sweep, %6u in the tone, peaks %+.2f / %+.2f dBFS\n", pathNames[path],
+           sweep[path].clipped, tone[path].clipped,
+           20.0 * log10(sweep[path].peak / 32768.0), 20.0 * log10(tone[path].peak / 32768.0));
+  }
+
+  bool ok = sweep[PATH_HEADROOM].clipped == 0 && tone[PATH_HEADROOM].clipped == 0;
+  // a cut must not be made louder, a boost must be brought back to full scale
+  ok &= toneLevel >= TONE_MIN_LEVEL_DB + ((peakDb < 0) ? peakDb : 0);
+  // the signals are loud enough to show the clipping the headroom removes
+  if(peakDb > 1.0f)
+    ok &= tone[PATH_BANDS].clipped > 0 && tone[PATH_NO_HEADROOM].clipped > 0;
+
+  return SimReport_Check(preset->name, ok);
+}
+
+/**
+ * @brief  Sets the gain of every band and clears the filter state.
+ * @param  gains: gain of each band in dB
+ * @retval None
+ */
+static void HeadroomSim_Configure(const int16_t* gains)
+{
+  for(uint8_t i = 0; i < NUMBER_OF_BANDS; i++)
+  {
+    AudioUserDsp_BiquadFilterConfig(&biquadFilters[i], gains[i], frequencies[i], bandwidths[i]);
+    memset(biquadFilters[i].state, 0, sizeof(biquadFilters[i].state));
+  }
+}
+
+// exponential sine sweep over the whole input, the same on both channels
+static void HeadroomSim_Sweep(void)
+{
+  double amplitude = 32767.0 * pow(10.0, INPUT_LEVEL_DB / 20.0);
+  double duration = (double)FRAMES / SAMPLE_RATE;
+  double rate = log(SWEEP_END / SWEEP_START);
+
+  for(uint32_t n = 0; n < FRAMES; n++)
+  {
+    double t = (double)n / SAMPLE_RATE;
+    double phase = 2.0 * PI * SWEEP_START * duration / rate * (exp(t * rate / duration) - 1.0);
+
+    input[2 * n] = input[2 * n + 1] = (int16_t)(amplitude * sin(phase));
+  }
+}
+
+// steady tone over the whole input, the same on both channels
+static void HeadroomSim_Tone(double frequency)
+{
+  double amplitude = 32767.0 * pow(10.0, INPUT_LEVEL_DB / 20.0);
+
+  for(uint32_t n = 0; n < FRAMES; n++)
+    input[2 * n] = input[2 * n + 1] = (int16_t)(amplitude * sin(2.0 * PI * frequency * n / SAMPLE_RATE));
+}
+
+/**
+ * @brief  Filters the input packet by packet through one path from cleared
+ *         state.
+ * @param  path: how the packets are filtered
+ * @param  peakDb: peak of the response, for the headroom
+ * @param  packets: how many
+ * @param  result: clipped samples and largest magnitude of the output
+ * @retval None
+ */
+static void HeadroomSim_Run(HeadroomSimPath path, float peakDb, uint32_t packets, HeadroomSimResult* result)
+{
+  uint8_t packet[PACKET_SIZE];
+
+  for(uint8_t i = 0; i < NUMBER_OF_BANDS; i++)
+  {
+    memset(biquadFilters[i].state, 0, sizeof(biquadFilters[i].state));
+  }
+  AudioUserDsp_SetHeadroom((path == PATH_HEADROOM) ? peakDb : 0.0f);
+  AudioUserDsp_SettleVolume();
+  memset(result, 0, sizeof(*result));
+
+  for(uint32_t p = 0; p < packets; p++)
+  {
+    for(uint32_t f = 0; f < FRAMES_PER_PACKET; f++)
+      AudioUserDsp_SamplesToFrame(&packet[4 * f], &input[2 * (p * FRAMES_PER_PACKET + f)], &input[2 * (p * FRAMES_PER_PACKET + f) + 1]);
+
+    if(path == PATH_BANDS)
+    {
+      for(uint8_t i = 0; i < NUMBER_OF_BANDS; i++)
+      {
+        AudioUserDsp_ApplyFilterToSamples(packet, PACKET_SIZE, AudioUserDsp_BiquadFilter, AudioUserDsp_BiquadFilterRight, i);
+        // a cut after a clipping boost hides it from the output
+        if(i < NUMBER_OF_BANDS - 1)
+          HeadroomSim_Count(packet, &result->clipped, NULL);
+      }
+    }
+    else
+      AudioUserDsp_ProcessPacket(packet, PACKET_SIZE);
+
+    HeadroomSim_Count(packet, &result->clipped, &result->peak);
+  }
+}
+
+/**
+ * @brief  Counts the samples of a packet at the limits of 16 bits.
+ * @param  packet: 16 bit stereo frames
+ * @param  clipped: incremented for each one
+ * @param  peak: raised to the largest magnitude, unless empty
+ * @retval None
+ */
+static void HeadroomSim_Count(const uint8_t* packet, uint32_t* clipped, int32_t* peak)
+{
+  int16_t samples[2];
+
+  for(uint32_t f = 0; f < FRAMES_PER_PACKET; f++)
+  {
+    AudioUserDsp_FrameToSamples((uint8_t*)&packet[4 * f], &samples[0], &samples[1]);
+    for(uint8_t c = 0; c < 2; c++)
+    {
+      if(samples[c] == 32767 || samples[c] == -32768)
+        (*clipped)++;
+      if(peak && abs(samples[c]) > *peak)
+        *peak = abs(samples[c]);
+    }
+  }
+}
@@ -0,0 +1,473 @@
+/**
+  ******************************************************************************
+  * @file    image_asset.c
+  * @brief   Converts a PNG into a C header holding an LcdImage for the
+  *          compositor: palette-indexed L8 or L4, which DMA2D expands through
+  *          its CLUT while blitting, or L8 run-length encoded (RLE8), which
+  *          LcdCompositor_UnpackImage expands into the atlas at startup.
+  *
+  *          Images are opaque: transparent pixels are blended over the
+  *          background color (-b). Above 256 (L8, RLE8) or 16 (L4) colors the
+  *          palette is chosen by median cut. The flash footprint of each
+  *          format is printed, against raw RGB565 and ARGB8888 arrays.
+  *
+  *          RLE8 packets: a control byte c below 128 is followed by c + 1
+  *          literal indices, c from 128 is followed by one index repeated
+  *          c - 126 times. Runs go across lines.
+  *
+  *          L4 lines hold an even number of pixels, the first one in the low
+  *          nibble, so that every line starts on a byte.
+  *
+  *          build (from Tools, the sources are listed in its Makefile):
+  *            make build/image_asset
+  *
+  *          usage:
+  *            ./image_asset [-f l8|l4|rle8] [-b rrggbb] -n name input.png output.h
+  ******************************************************************************
+  */
+
+#include <ctype.h>
+#include <errno.h>
+#include <png.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+// private defines -------------------------------------------------------------
+#define RLE_MAX_LITERAL     128
+#define RLE_MIN_RUN         2
+#define RLE_MAX_RUN         129
+#define BYTES_PER_LINE      16
+
+// private typedefs ------------------------------------------------------------
+typedef enum AssetFormat
+{
+  ASSET_L8,
+  ASSET_L4,
+  ASSET_RLE8
+} AssetFormat;
+
+// colors of the image, then the boxes of the median cut
+typedef struct ColorCount
+{
+  uint32_t color;
+  uint32_t count;
+} ColorCount;
+
+typedef struct ColorBox
+{
+  uint32_t first;
+  uint32_t length;
+} ColorBox;
+
+// private variables -----------------------------------------------------------
+static const char* formatNames[] = { "LCD_IMAGE_L8", "LCD_IMAGE_L4", "LCD_IMAGE_RLE8" };
+
+// private function declarations -----------------------------------------------
+static uint32_t* ImageAsset_ReadPng(const char* path, uint32_t background, uint32_t* width, uint32_t* height);
+static uint32_t  ImageAsset_BuildPalette(const uint32_t* pixels, uint32_t count, uint32_t maxColors, uint32_t* palette);
+static uint8_t   ImageAsset_Nearest(uint32_t color, const uint32_t* palette, uint32_t paletteSize);
+static uint32_t  ImageAsset_PackL4(const uint8_t* indices, uint32_t width, uint32_t height, uint8_t* out);
+static uint32_t  ImageAsset_EncodeRle(const uint8_t* indices, uint32_t count, uint8_t* out);
+static void      ImageAsset_WriteBytes(FILE* file, const uint8_t* bytes, uint32_t count);
+static int       ImageAsset_CompareCount(const void* a, const void* b);
+static void      ImageAsset_Usage(const char* program);
+
+int main(int argc, char** argv)
+{
+  AssetFormat format = ASSET_RLE8;
+  uint32_t background = 0xFFFFFF;
+  const char* name = NULL;
+  int option;
+
+  while((option = getopt(argc, argv, "f:b:n:h")) != -1)
+  {
+    if(option == 'f' && strcmp(optarg, "l8") == 0)
+      format = ASSET_L8;
+    else if(option == 'f' && strcmp(optarg, "l4") == 0)
+      format = ASSET_L4;
+    else if(option == 'f' && strcmp(optarg, "rle8") == 0)
+      format = ASSET_RLE8;
+    else if(option == 'b')
+      background = strtoul(optarg, NULL, 16) & 0xFFFFFF;
+    else if(option == 'n')
+      name = optarg;
+    else
+    {
+      ImageAsset_Usage(argv[0]);
+      return 1;
+    }
+  }
+
+  if(name == NULL || optind + 2 != argc)
+  {
+    ImageAsset_Usage(argv[0]);
+    return 1;
+  }
+
+  uint32_t width, height;
+  uint32_t* pixels = ImageAsset_ReadPng(argv[optind], background, &width, &height);
+  if(pixels == NULL)
+    return 1;
+
+  uint32_t count = width * height;
+  uint32_t palette[256];
+  uint32_t maxColors = (format == ASSET_L4) ? 16 : 256;
+  uint32_t paletteSize = ImageAsset_BuildPalette(pixels, count, maxColors, palette);
+  uint8_t* indices = malloc(count);
+  uint8_t* packedL4 = malloc(count / 2 + height + 1);
+  uint8_t* rle = malloc(count + count / RLE_MAX_LITERAL + 1);
+  uint32_t mismatches = 0;
+
+  for(uint32_t i = 0; i < count; i++)
+  {
+    indices[i] = ImageAsset_Nearest(pixels[i], palette, paletteSize);
+    for(uint8_t shift = 0; shift < 24; shift += 8)
+    {
+      int32_t difference = (int32_t)((pixels[i] >> shift) & 0xFF) - (int32_t)((palette[indices[i]] >> shift) & 0xFF);
+      mismatches += (difference != 0);
+    }
+  }
+
+  uint32_t clutBytes = paletteSize * 4;
+  uint32_t l4Bytes = ImageAsset_PackL4(indices, width, height, packedL4);
+  uint32_t rleBytes = ImageAsset_EncodeRle(indices, count, rle);
+  const uint8_t* data = (format == ASSET_L8) ? indices : (format == ASSET_L4) ? packedL4 : rle;
+  uint32_t dataBytes = (format == ASSET_L8) ? count : (format == ASSET_L4) ? l4Bytes : rleBytes;
+
+  printf("%s: %ux%u, %u colors%s\n", argv[optind], width, height, paletteSize,
+    mismatches ? " (quantized)" : "");
+  printf("  ARGB8888 %7u B\n", count * 4);
+  printf("  RGB565   %7u B\n", count * 2);
+  if(format != ASSET_L4)
+  {
+    printf("  L8       %7u B  (%u CLUT)\n", count + clutBytes, clutBytes);
+    printf("  RLE8     %7u B  (%u CLUT), %u B of atlas once unpacked\n", rleBytes + clutBytes, clutBytes, count);
+  }
+  else
+    printf("  L4       %7u B  (%u CLUT)\n", l4Bytes + clutBytes, clutBytes);
+  printf("  written %s: %u B, %.1f%% of RGB565\n", formatNames[format] + 10, dataBytes + clutBytes,
+    100.0 * (dataBytes + clutBytes) / (count * 2));
+
+  FILE* file = fopen(argv[optind + 1], "w");
+  if(file == NULL)
+  {
+    fprintf(stderr, "cannot create %s: %s\n", argv[optind + 1], strerror(errno));
+    return 1;
+  }
+
+  // guard and size macros from the name: utfprLogo gives UTFPR_LOGO_...
+  char macro[128];
+  uint32_t length = 0;
+  for(const char* c = name; *c && length < sizeof(macro) - 2; c++)
+  {
+    if(isupper((unsigned char)*c) && length > 0)
+      macro[length++] = '_';
+    macro[length++] = toupper((unsigned char)*c);
+  }
+  macro[length] = '\0';
+
+  fprintf(file, "// generated by Tools/ImageAsset from %s, do not edit\n", argv[optind]);
+  fprintf(file, "#ifndef __%s_H__\n#define __%s_H__\n\n", macro, macro);
+  fprintf(file, "#include \"lcd_compositor.h\"\n\n");
+  fprintf(file, "#define %s_WIDTH (%u)\n#define %s_HEIGHT (%u)\n\n", macro, width, macro, height);
+  fprintf(file, "static const uint32_t %sClut[%u] =\n{", name, paletteSize);
+  for(uint32_t i = 0; i < paletteSize; i++)
+    fprintf(file, "%s0x%08X%s", (i % 8) ? " " : "\n  ", palette[i], (i + 1 < paletteSize) ? "," : "");
+  fprintf(file, "\n};\n\n");
+  fprintf(file, "static const uint8_t %sData[%u] =\n{", name, dataBytes);
+  ImageAsset_WriteBytes(file, data, dataBytes);
+  fprintf(file, "\n};\n\n");
+  fprintf(file, "const LcdImage %s =\n{\n", name);
+  fprintf(file, "  .format = %s,\n", formatNames[format]);
+  fprintf(file, "  .width = %u,\n  .height = %u,\n", width, height);
+  fprintf(file, "  .clut = %sClut,\n  .clutSize = %u,\n", name, paletteSize);
+  fprintf(file, "  .data = %sData,\n  .dataSize = %u\n};\n\n", name, dataBytes);
+  fprintf(file, "#endif // __%s_H__\n", macro);
+  fclose(file);
+
+  free(pixels);
+  free(indices);
+  free(packedL4);
+  free(rle);
+  return 0;
+}
+
+/**
+ * @brief  Reads a PNG as opaque 0xFFRRGGBB pixels.
+ * @param  path: PNG file
+ * @param  background: RGB the transparent pixels are blended over
+ * @param  width, height: receive the size
+ * @retval pixels, NULL on error
+ */
+static uint32_t* ImageAsset_ReadPng(const char* path, uint32_t background, uint32_t* width, uint32_t* height)
+{
+  png_image image;
+  png_color backgroundColor = { background >> 16, (background >> 8) & 0xFF, background & 0xFF };
+
+  memset(&image, 0, sizeof(image));
+  image.version = PNG_IMAGE_VERSION;
+  if(!png_image_begin_read_from_file(&image, path))
+  {
+    fprintf(stderr, "%s: %s\n", path, image.message);
+    return NULL;
+  }
+
+  // BGRA bytes are 0xAARRGGBB words on a little endian host
+  image.format = PNG_FORMAT_BGRA;
+  uint32_t* pixels = malloc(PNG_IMAGE_SIZE(image));
+  if(pixels == NULL || !png_image_finish_read(&image, &backgroundColor, pixels, 0, NULL))
+  {
+    fprintf(stderr, "%s: %s\n", path, image.message);
+    free(pixels);
+    return NULL;
+  }
+
+  for(uint32_t i = 0; i < image.width * image.height; i++)
+  {
+    uint32_t alpha = pixels[i] >> 24;
+    uint32_t color = 0xFF000000;
+
+    for(uint8_t shift = 0; shift < 24; shift += 8)
+    {
+      uint32_t channel = (((pixels[i] >> shift) & 0xFF) * alpha + ((background >> shift) & 0xFF) * (255 - alpha) + 127) / 255;
+      color |= channel << shift;
+    }
+    pixels[i] = color;
+  }
+
+  *width = image.width;
+  *height = image.height;
+  return pixels;
+}
+
+/**
+ * @brief  Picks the palette: the colors of the image if there are few
+ *         enough, otherwise the pixel weighted means of the boxes of a median
+ *         cut along the widest channel.
+ * @param  pixels: opaque pixels
+ * @param  count: number of pixels
+ * @param  maxColors: palette size limit
+ * @param  palette: receives the colors
+ * @retval palette size
+ */
+static uint32_t ImageAsset_BuildPalette(const uint32_t* pixels, uint32_t count, uint32_t maxColors, uint32_t* palette)
+{
+  ColorCount* colors = malloc(count * sizeof(ColorCount));
+  uint32_t colorCount = 0;
+
+  for(uint32_t i = 0; i < count; i++)
+    colors[i] = (ColorCount){ pixels[i], 1 };
+  qsort(colors, count, sizeof(ColorCount), ImageAsset_CompareCount);
+  for(uint32_t i = 0; i < count; i++)
+  {
+    if(colorCount > 0 && colors[colorCount - 1].color == colors[i].color)
+      colors[colorCount - 1].count++;
+    else
+      colors[colorCount++] = colors[i];
+  }
+
+  ColorBox boxes[256] = { { 0, colorCount } };
+  uint32_t boxCount = 1;
+
+  // few enough colors: one box each, the palette is exact
+  if(colorCount <= maxColors)
+  {
+    for(boxCount = 0; boxCount < colorCount; boxCount++)
+      boxes[boxCount] = (ColorBox){ boxCount, 1 };
+  }
+
+  while(boxCount < maxColors && colorCount > maxColors)
+  {
+    // splits the box with the widest channel range
+    uint32_t widest = 0, widestRange = 0, widestShift = 0;
+    for(uint32_t b = 0; b < boxCount; b++)
+    {
+      for(uint8_t shift = 0; shift < 24; shift += 8)
+      {
+        uint32_t low = 255, high = 0;
+        for(uint32_t i = boxes[b].first; i < boxes[b].first + boxes[b].length; i++)
+        {
+          uint32_t channel = (colors[i].color >> shift) & 0xFF;
+          low = (channel < low) ? channel : low;
+          high = (channel > high) ? channel : high;
+        }
+        if(boxes[b].length > 1 && high - low > widestRange)
+        {
+          widest = b;
+          widestRange = high - low;
+          widestShift = shift;
+        }
+      }
+    }
+
+    if(widestRange == 0)
+      break;
+
+    // sorts the box along that channel and cuts it at the pixel median
+    ColorBox* box = &boxes[widest];
+    for(uint32_t i = box->first + 1; i < box->first + box->length; i++)
+    {
+      ColorCount key = colors[i];
+      uint32_t j = i;
+      while(j > box->first && ((colors[j - 1].color >> widestShift) & 0xFF) > ((key.color >> widestShift) & 0xFF))
+      {
+        colors[j] = colors[j - 1];
+        j--;
+      }
+      colors[j] = key;
+    }
+
+    uint64_t total = 0, below = 0;
+    for(uint32_t i = box->first; i < box->first + box->length; i++)
+      total += colors[i].count;
+
+    uint32_t cut = box->first + 1;
+    for(uint32_t i = box->first; i < box->first + box->length - 1; i++)
+    {
+      below += colors[i].count;
+      cut = i + 1;
+      if(2 * below >= total)
+        break;
+    }
+
+    boxes[boxCount++] = (ColorBox){ cut, box->first + box->length - cut };
+    box->length = cut - box->first;
+  }
+
+  for(uint32_t b = 0; b < boxCount; b++)
+  {
+    uint64_t sum[3] = { 0 }, weight = 0;
+
+    for(uint32_t i = boxes[b].first; i < boxes[b].first + boxes[b].length; i++)
+    {
+      for(uint8_t c = 0; c < 3; c++)
+        sum[c] += (uint64_t)((colors[i].color >> (8 * c)) & 0xFF) * colors[i].count;
+      weight += colors[i].count;
+    }
+
+    palette[b] = 0xFF000000;
+    for(uint8_t c = 0; c < 3; c++)
+      palette[b] |= (uint32_t)((sum[c] + weight / 2) / weight) << (8 * c);
+  }
+
+  free(colors);
+  return boxCount;
+}
+
+static uint8_t ImageAsset_Nearest(uint32_t color, const uint32_t* palette, uint32_t paletteSize)
+{
+  uint32_t best = 0, bestDistance = UINT32_MAX;
+
+  for(uint32_t i = 0; i < paletteSize && bestDistance > 0; i++)
+  {
+    uint32_t distance = 0;
+    for(uint8_t shift = 0; shift < 24; shift += 8)
+    {
+      int32_t difference = (int32_t)((color >> shift) & 0xFF) - (int32_t)((palette[i] >> shift) & 0xFF);
+      distance += difference * difference;
+    }
+    if(distance < bestDistance)
+    {
+      best = i;
+      bestDistance = distance;
+    }
+  }
+
+  return best;
+}
+
+/**
+ * @brief  Packs indices below 16 two per byte, lines padded to an even width.
+ * @param  indices: one per pixel
+ * @param  width, height: image size
+ * @param  out: receives the bytes
+ * @retval bytes written
+ */
+static uint32_t ImageAsset_PackL4(const uint8_t* indices, uint32_t width, uint32_t height, uint8_t* out)
+{
+  uint32_t length = 0;
+
+  for(uint32_t y = 0; y < height; y++)
+  {
+    for(uint32_t x = 0; x < width; x += 2)
+    {
+      uint8_t second = (x + 1 < width) ? indices[y * width + x + 1] : 0;
+      out[length++] = (indices[y * width + x] & 0x0F) | (second << 4);
+    }
+  }
+
+  return length;
+}
+
+/**
+ * @brief  Run-length encodes the indices, see the file header for packets.
+ * @param  indices: one per pixel
+ * @param  count: number of pixels
+ * @param  out: receives the packets
+ * @retval bytes written
+ */
+static uint32_t ImageAsset_EncodeRle(const uint8_t* indices, uint32_t count, uint8_t* out)
+{
+  uint32_t length = 0;
+  uint32_t literalStart = 0;
+  uint32_t i = 0;
+
+  while(i <= count)
+  {
+    uint32_t run = 1;
+    while(i < count && i + run < count && indices[i + run] == indices[i] && run < RLE_MAX_RUN)
+      run++;
+
+    // literals end at a run, at the end, or when the packet is full
+    if(i == count || run >= RLE_MIN_RUN + 1 || i - literalStart == RLE_MAX_LITERAL)
+    {
+      while(literalStart < i)
+      {
+        uint32_t literal = i - literalStart;
+        if(literal > RLE_MAX_LITERAL)
+          literal = RLE_MAX_LITERAL;
+        out[length++] = literal - 1;
+        memcpy(&out[length], &indices[literalStart], literal);
+        length += literal;
+        literalStart += literal;
+      }
+    }
+
+    if(i == count)
+      break;
+
+    if(run >= RLE_MIN_RUN + 1)
+    {
+      out[length++] = 128 + run - RLE_MIN_RUN;
+      out[length++] = indices[i];
+      i += run;
+      literalStart = i;
+    }
+    else
+      i++;
+  }
+
+  return length;
+}
+
+static void ImageAsset_WriteBytes(FILE* file, const uint8_t* bytes, uint32_t count)
+{
+  for(uint32_t i = 0; i < count; i++)
+    fprintf(file, "%s0x%02X%s", (i % BYTES_PER_LINE) ? "" : "\n  ", bytes[i], (i + 1 < count) ? "," : "");
+}
+
+static int ImageAsset_CompareCount(const void* a, const void* b)
+{
+  uint32_t first = ((const ColorCount*)a)->color;
+  uint32_t second = ((const ColorCount*)b)->color;
+
+  return (first > second) - (first < second);
+}
+
+static void ImageAsset_Usage(const char* program)
+{
+  fprintf(stderr, "usage: %s [-f l8|l4|rle8] [-b rrggbb] -n name input.png output.h\n", program);
+}
@@ -0,0 +1,20 @@
+/**
+  ******************************************************************************
+  * @file    main.h
+  * @brief   Host stand-in for the firmware main.h, with what touchscreen.c
+  *          takes from it.
+  ******************************************************************************
+  */
+
+#ifndef __MAIN_H
+#define __MAIN_H
+
+#include "stm32f7xx_hal.h"
+#include "stm32f769i_discovery_lcd.h"
+#include "stm32f769i_discovery_ts.h"
+#include "touchscreen.h"
+#include "audio_user_dsp.h"
+
+void Error_Handler(void);
+
+#endif // __MAIN_H
@@ -0,0 +1,115 @@
+/**
+  ******************************************************************************
+  * @file    stm32f769i_discovery_lcd.h
+  * @brief   Host stand-in for the LCD BSP: colors, fonts and the functions
+  *          user_lcd.c calls. The frame buffers live in hostSdram (lcd_host.c).
+  ******************************************************************************
+  */
+
+#ifndef __STM32F769I_DISCOVERY_LCD_H
+#define __STM32F769I_DISCOVERY_LCD_H
+
+#include "fonts.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define LCD_OK         0x00
+#define LCD_ERROR      0x01
+
+// two 800x480 ARGB8888 layers followed by the compositor staging area and
+// sprite atlas
+#define HOST_SDRAM_WORDS      (2 * 800 * 480 + 64 * 1024 + 128 * 1024)
+extern uint32_t hostSdram[HOST_SDRAM_WORDS];
+
+#define LCD_FB_START_ADDRESS  ((uintptr_t)hostSdram)
+
+#define LCD_COLOR_BLUE          ((uint32_t) 0xFF0000FF)
+#define LCD_COLOR_GREEN         ((uint32_t) 0xFF00FF00)
+#define LCD_COLOR_RED           ((uint32_t) 0xFFFF0000)
+#define LCD_COLOR_CYAN          ((uint32_t) 0xFF00FFFF)
+#define LCD_COLOR_MAGENTA       ((uint32_t) 0xFFFF00FF)
+#define LCD_COLOR_YELLOW        ((uint32_t) 0xFFFFFF00)
+#define LCD_COLOR_UTFPRYELLOW   ((uint32_t) 0xFFF6C500)
+#define LCD_COLOR_LIGHTBLUE     ((uint32_t) 0xFF8080FF)
+#define LCD_COLOR_LIGHTGREEN    ((uint32_t) 0xFF80FF80)
+#define LCD_COLOR_LIGHTRED      ((uint32_t) 0xFFFF8080)
+#define LCD_COLOR_LIGHTCYAN     ((uint32_t) 0xFF80FFFF)
+#define LCD_COLOR_LIGHTMAGENTA  ((uint32_t) 0xFFFF80FF)
+#define LCD_COLOR_LIGHTYELLOW   ((uint32_t) 0xFFFFFF80)
+#define LCD_COLOR_DARKBLUE      ((uint32_t) 0xFF000080)
+#define LCD_COLOR_DARKGREEN     ((uint32_t) 0xFF008000)
+#define LCD_COLOR_DARKRED       ((uint32_t) 0xFF800000)
+#define LCD_COLOR_DARKCYAN      ((uint32_t) 0xFF008080)
+#define LCD_COLOR_DARKMAGENTA   ((uint32_t) 0xFF800080)
+#define LCD_COLOR_DARKYELLOW    ((uint32_t) 0xFF808000)
+#define LCD_COLOR_WHITE         ((uint32_t) 0xFFFFFFFF)
+#define LCD_COLOR_LIGHTGRAY     ((uint32_t) 0xFFD3D3D3)
+#define LCD_COLOR_GRAY          ((uint32_t) 0xFF808080)
+#define LCD_COLOR_DARKGRAY      ((uint32_t) 0xFF404040)
+#define LCD_COLOR_BLACK         ((uint32_t) 0xFF000000)
+#define LCD_COLOR_BROWN         ((uint32_t) 0xFFA52A2A)
+#define LCD_COLOR_ORANGE        ((uint32_t) 0xFFFFA500)
+#define LCD_COLOR_TRANSPARENT   ((uint32_t) 0xFF000000)
+#define LCD_COLOR_MINT_GREEN    ((uint32_t) 0xFF98FB98)
+#define LCD_COLOR_OLIVE_GREEN   ((uint32_t) 0xFF6B8E23)
+#define LCD_COLOR_MAROON        ((uint32_t) 0xFF800000)
+#define LCD_COLOR_BURGUNDY      ((uint32_t) 0xFF800020)
+
+typedef enum
+{
+  CENTER_MODE             = 0x01,
+  RIGHT_MODE              = 0x02,
+  LEFT_MODE               = 0x03
+} Text_AlignModeTypdef;
+
+#define LTDC_PIXEL_FORMAT_ARGB8888    0
+#define LTDC_BLENDING_FACTOR1_PAxCA   0x00000600U
+#define LTDC_BLENDING_FACTOR2_PAxCA   0x00000007U
+
+typedef struct
+{
+  uint8_t Blue;
+  uint8_t Green;
+  uint8_t Red;
+} LTDC_ColorTypeDef;
+
+typedef struct
+{
+  uint32_t WindowX0;
+  uint32_t WindowX1;
+  uint32_t WindowY0;
+  uint32_t WindowY1;
+  uint32_t PixelFormat;
+  uint32_t Alpha;
+  uint32_t Alpha0;
+  uint32_t BlendingFactor1;
+  uint32_t BlendingFactor2;
+  uintptr_t FBStartAdress;
+  uint32_t ImageWidth;
+  uint32_t ImageHeight;
+  LTDC_ColorTypeDef Backcolor;
+} LCD_LayerCfgTypeDef;
+
+typedef struct
+{
+  LCD_LayerCfgTypeDef LayerCfg[2];
+} LTDC_HandleTypeDef;
+
+int      HAL_LTDC_ConfigLayer(LTDC_HandleTypeDef* hltdc, LCD_LayerCfgTypeDef* pLayerCfg, uint32_t LayerIdx);
+
+uint8_t  BSP_LCD_Init(void);
+uint32_t BSP_LCD_GetXSize(void);
+uint32_t BSP_LCD_GetYSize(void);
+void     BSP_LCD_LayerDefaultInit(uint16_t LayerIndex, uint32_t FB_Address);
+void     BSP_LCD_SelectLayer(uint32_t LayerIndex);
+void     BSP_LCD_SetTextColor(uint32_t Color);
+void     BSP_LCD_SetBackColor(uint32_t Color);
+void     BSP_LCD_SetFont(sFONT* fonts);
+void     BSP_LCD_Clear(uint32_t Color);
+void     BSP_LCD_FillRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height);
+void     BSP_LCD_DrawRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height);
+void     BSP_LCD_FillCircle(uint16_t Xpos, uint16_t Ypos, uint16_t Radius);
+void     BSP_LCD_DisplayStringAt(uint16_t Xpos, uint16_t Ypos, uint8_t* Text, Text_AlignModeTypdef Mode);
+
+#endif // __STM32F769I_DISCOVERY_LCD_H
@@ -0,0 +1,33 @@
+/**
+  ******************************************************************************
+  * @file    stm32f769i_discovery_ts.h
+  * @brief   Host stand-in for the touch screen BSP, single touch: the demo
+  *          code of touchscreen.c builds but only the touch input of
+  *          touch_host.c reports touches.
+  ******************************************************************************
+  */
+
+#ifndef __STM32F769I_DISCOVERY_TS_H
+#define __STM32F769I_DISCOVERY_TS_H
+
+#include <stdint.h>
+
+#define TS_MULTI_TOUCH_SUPPORTED  0
+#define TS_MAX_NB_TOUCH           2
+
+#define TS_OK                     0x00
+#define TS_ERROR                  0x01
+#define TS_TIMEOUT                0x02
+
+typedef struct
+{
+  uint8_t  touchDetected;
+  uint16_t touchX[TS_MAX_NB_TOUCH];
+  uint16_t touchY[TS_MAX_NB_TOUCH];
+} TS_StateTypeDef;
+
+uint8_t BSP_TS_Init(uint16_t ts_SizeX, uint16_t ts_SizeY);
+uint8_t BSP_TS_GetState(TS_StateTypeDef* TS_State);
+uint8_t BSP_TS_ResetTouchData(TS_StateTypeDef* TS_State);
+
+#endif // __STM32F769I_DISCOVERY_TS_H
@@ -0,0 +1,18 @@
+/**
+  ******************************************************************************
+  * @file    stm32f7xx_hal.h
+  * @brief   Host stand-in for the HAL: the tick and the delay, on the virtual
+  *          clock of touch_host.c.
+  ******************************************************************************
+  */
+
+#ifndef __STM32F7xx_HAL_H
+#define __STM32F7xx_HAL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+uint32_t HAL_GetTick(void);
+void     HAL_Delay(uint32_t Delay);
+
+#endif // __STM32F7xx_HAL_H
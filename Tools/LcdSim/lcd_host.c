@@ -0,0 +1,424 @@
+/**
+  ******************************************************************************
+  * @file    lcd_host.c
+  * @brief   Host frame buffers for the LCD code. The BSP functions used
+  *          before the compositor takes over draw into the layer 0 buffer,
+  *          the compositor ops are executed synchronously in software with the
+  *          arithmetic DMA2D uses and presenting a buffer swaps at once. Also
+  *          what the host tools share: PNG snapshots, the cost table of an
+  *          interaction and the full redraw check.
+  ******************************************************************************
+  */
+
+#include "lcd_host.h"
+#include <errno.h>
+#include <stdlib.h>
+#include <time.h>
+
+// private defines -------------------------------------------------------------
+#define SCREEN_PIXELS       (LCD_COMPOSITOR_WIDTH * LCD_COMPOSITOR_HEIGHT)
+#define REFRESH_RATE        60
+// LTDC reads the shown buffer once per refresh
+#define SCANOUT_BYTES       (SCREEN_PIXELS * 4 * REFRESH_RATE)
+// FMC SDRAM clock at SYSCLK / 2 on a 32 bit bus
+#define SDRAM_PEAK_BYTES    (100000000 * 4)
+// PNG rows: filter byte then RGB; zlib stored blocks hold up to 65535 bytes
+#define PNG_ROW_BYTES       (1 + 3 * LCD_COMPOSITOR_WIDTH)
+#define PNG_RAW_BYTES       (PNG_ROW_BYTES * LCD_COMPOSITOR_HEIGHT)
+#define PNG_BLOCK_BYTES     65535
+
+// variables -------------------------------------------------------------------
+uint32_t hostSdram[HOST_SDRAM_WORDS];
+LTDC_HandleTypeDef hltdc_discovery;
+
+// private variables -----------------------------------------------------------
+static uint32_t  textColor = LCD_COLOR_BLACK;
+// layer 0 starts on the first buffer, user_lcd.c passes addresses as 32 bit
+static uint32_t* shownBuffer = hostSdram;
+// time spent emulating DMA2D, which costs the CPU nothing on the board
+static uint64_t  backendNanoseconds = 0;
+
+// private function declarations -----------------------------------------------
+static uint64_t LcdHost_Now(void);
+static void     LcdHost_WritePngChunk(FILE* file, const char* type, const uint8_t* data, uint32_t length);
+static uint32_t LcdHost_Crc32(uint32_t crc, const uint8_t* data, uint32_t length);
+static void     LcdHost_PutBigEndian(uint8_t* bytes, uint32_t value);
+
+/**
+ * @brief  Visible frame buffer, the one layer 0 scans out.
+ * @param  None
+ * @retval 800x480 ARGB8888 pixels
+ */
+uint32_t* LcdHost_FrameBuffer(void)
+{
+  return shownBuffer;
+}
+
+/**
+ * @brief  Time spent executing ops, to subtract from measurements of the
+ *         compositor so that only the work left to the CPU counts.
+ * @param  None
+ * @retval nanoseconds since start
+ */
+uint64_t LcdHost_BackendNanoseconds(void)
+{
+  return backendNanoseconds;
+}
+
+/**
+ * @brief  Saves the frame buffer as an RGB PNG image, uncompressed: zlib
+ *         stored blocks, so no zlib is needed.
+ * @param  path: output file
+ * @retval false on error
+ */
+bool LcdHost_WritePng(const char* path)
+{
+  static const uint8_t signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+  uint32_t blocks = (PNG_RAW_BYTES + PNG_BLOCK_BYTES - 1) / PNG_BLOCK_BYTES;
+  uint32_t length = 2 + blocks * 5 + PNG_RAW_BYTES + 4;
+  uint8_t header[13] = {0};
+  uint8_t* raw = malloc(PNG_RAW_BYTES);
+  uint8_t* data = malloc(length);
+  const uint32_t* pixels = LcdHost_FrameBuffer();
+  FILE* file = fopen(path, "wb");
+
+  if(!file || !raw || !data)
+  {
+    fprintf(stderr, "cannot create %s: %s\n", path, strerror(errno));
+    free(raw);
+    free(data);
+    if(file)
+      fclose(file);
+    return false;
+  }
+
+  for(uint32_t y = 0; y < LCD_COMPOSITOR_HEIGHT; y++)
+  {
+    uint8_t* row = raw + y * PNG_ROW_BYTES;
+
+    row[0] = 0;
+    for(uint32_t x = 0; x < LCD_COMPOSITOR_WIDTH; x++)
+    {
+      uint32_t pixel = pixels[y * LCD_COMPOSITOR_WIDTH + x];
+      row[1 + 3 * x] = (uint8_t)(pixel >> 16);
+      row[2 + 3 * x] = (uint8_t)(pixel >> 8);
+      row[3 + 3 * x] = (uint8_t)pixel;
+    }
+  }
+
+  // zlib header, no compression, then stored blocks and the Adler-32 of the rows
+  uint8_t* out = data;
+  uint32_t adlerA = 1, adlerB = 0;
+  *out++ = 0x78;
+  *out++ = 0x01;
+  for(uint32_t offset = 0; offset < PNG_RAW_BYTES; offset += PNG_BLOCK_BYTES)
+  {
+    uint32_t size = (PNG_RAW_BYTES - offset < PNG_BLOCK_BYTES) ? PNG_RAW_BYTES - offset : PNG_BLOCK_BYTES;
+
+    *out++ = (offset + size == PNG_RAW_BYTES);
+    *out++ = size & 0xFF;
+    *out++ = size >> 8;
+    *out++ = ~size & 0xFF;
+    *out++ = (~size >> 8) & 0xFF;
+    memcpy(out, raw + offset, size);
+    out += size;
+
+    for(uint32_t i = 0; i < size; i++)
+    {
+      adlerA = (adlerA + raw[offset + i]) % 65521;
+      adlerB = (adlerB + adlerA) % 65521;
+    }
+  }
+  LcdHost_PutBigEndian(out, (adlerB << 16) | adlerA);
+
+  LcdHost_PutBigEndian(header, LCD_COMPOSITOR_WIDTH);
+  LcdHost_PutBigEndian(header + 4, LCD_COMPOSITOR_HEIGHT);
+  header[8] = 8;                      // bits per channel
+  header[9] = 2;                      // RGB
+
+  fwrite(signature, 1, sizeof(signature), file);
+  LcdHost_WritePngChunk(file, "IHDR", header, sizeof(header));
+  LcdHost_WritePngChunk(file, "IDAT", data, length);
+  LcdHost_WritePngChunk(file, "IEND", NULL, 0);
+
+  free(raw);
+  free(data);
+  return fclose(file) == 0;
+}
+
+/**
+ * @brief  Prints the SDRAM budget and the header of the table that
+ *         LcdHost_PrintStats fills.
+ * @param  None
+ * @retval None
+ */
+void LcdHost_PrintStatsHeader(void)
+{
+  printf("SDRAM: scanout %.1f MB/s of %.1f MB/s peak\n", SCANOUT_BYTES / 1e6, SDRAM_PEAK_BYTES / 1e6);
+  printf("%-26s %6s %6s %9s %5s %9s %7s %8s %8s %9s\n", "interaction", "frames", "rects", "dirty px", "ops",
+    "written", "screen", "sync px", "SDRAM KB", "MB/s@60Hz");
+}
+
+/**
+ * @brief  Prints what the compositor did between two snapshots of its
+ *         counters as one row of the table.
+ * @param  name: label of the interaction
+ * @param  before, after: counters around it
+ * @retval None
+ */
+void LcdHost_PrintStats(const char* name, const LcdCompositorStats* before, const LcdCompositorStats* after)
+{
+  uint32_t frames = after->frames - before->frames;
+  uint32_t written = after->pixelsWritten - before->pixelsWritten;
+  uint32_t bytes = after->sdramBytes - before->sdramBytes;
+  // bandwidth if the interaction repeated at every refresh, like a drag
+  double perSecond = frames ? (double)bytes / frames * REFRESH_RATE : 0;
+
+  printf("%-26s %6u %6u %9u %5u %9u %6.1f%% %8u %8u %9.1f\n", name,
+    frames, after->rects - before->rects, after->dirtyPixels - before->dirtyPixels,
+    after->ops - before->ops, written, 100.0 * written / SCREEN_PIXELS,
+    after->syncPixels - before->syncPixels, bytes / 1024, perSecond / 1e6);
+}
+
+/**
+ * @brief  Redraws the whole screen into the back buffer and compares it with
+ *         the shown one, which only ever got the incremental updates.
+ * @param  None
+ * @retval true if they are identical
+ */
+bool LcdHost_MatchesFullRedraw(void)
+{
+  static uint32_t shown[SCREEN_PIXELS];
+
+  memcpy(shown, LcdHost_FrameBuffer(), sizeof(shown));
+  LcdCompositor_InvalidateAll();
+  LcdCompositor_Flush();
+
+  return memcmp(shown, LcdHost_FrameBuffer(), sizeof(shown)) == 0;
+}
+
+void LcdCompositorBackend_Init(void)
+{
+}
+
+/**
+ * @brief  Executes one op.
+ * @param  op: fill or blit
+ * @retval true, the op is done on return
+ */
+bool LcdCompositorBackend_Start(const LcdCompositorOp* op)
+{
+  uint64_t start = LcdHost_Now();
+
+  for(uint16_t row = 0; row < op->height; row++)
+  {
+    uint32_t* destination = op->destination + row * op->destinationPitch;
+
+    for(uint16_t column = 0; column < op->width; column++)
+    {
+      uint32_t index = row * op->sourcePitch + column;
+
+      switch(op->type)
+      {
+        case LCD_COMPOSITOR_FILL:
+          destination[column] = op->color;
+          break;
+
+        case LCD_COMPOSITOR_COPY:
+          destination[column] = ((const uint32_t*)op->source)[index];
+          break;
+
+        case LCD_COMPOSITOR_CONVERT_RGB565:
+        {
+          const uint8_t* pixel = (const uint8_t*)op->source + 2 * index;
+          uint16_t value = pixel[0] | (pixel[1] << 8);
+          // DMA2D expands 5 and 6 bit channels by replicating the top bits
+          uint8_t red = (value >> 11) & 0x1F, green = (value >> 5) & 0x3F, blue = value & 0x1F;
+          destination[column] = 0xFF000000 | ((uint32_t)((red << 3) | (red >> 2)) << 16) | ((uint32_t)((green << 2) | (green >> 4)) << 8) | ((blue << 3) | (blue >> 2));
+          break;
+        }
+
+        case LCD_COMPOSITOR_CONVERT_L8:
+          destination[column] = op->clut[((const uint8_t*)op->source)[index]];
+          break;
+
+        case LCD_COMPOSITOR_CONVERT_L4:
+        {
+          // first pixel of a byte in the low nibble, the op starts on a byte
+          uint8_t pair = ((const uint8_t*)op->source)[index / 2];
+          destination[column] = op->clut[(index & 1) ? pair >> 4 : pair & 0x0F];
+          break;
+        }
+
+        case LCD_COMPOSITOR_BLEND:
+        {
+          // DMA2D blending, which also keeps sprites transparent where both are
+          uint32_t foreground = ((const uint32_t*)op->source)[index];
+          uint32_t background = destination[column];
+          uint32_t alpha = foreground >> 24;
+          uint32_t backgroundAlpha = (background >> 24) * (255 - alpha) / 255;
+          uint32_t resultAlpha = alpha + backgroundAlpha;
+          uint32_t result = resultAlpha << 24;
+          for(uint8_t shift = 0; shift < 24 && resultAlpha; shift += 8)
+          {
+            uint32_t channel = (((foreground >> shift) & 0xFF) * alpha + ((background >> shift) & 0xFF) * backgroundAlpha) / resultAlpha;
+            result |= channel << shift;
+          }
+          destination[column] = result;
+          break;
+        }
+      }
+    }
+  }
+
+  backendNanoseconds += LcdHost_Now() - start;
+  return true;
+}
+
+/**
+ * @brief  Shows a buffer, there is no vertical blanking to wait for.
+ * @param  buffer: frame buffer for layer 0
+ * @retval true, the swap is done on return
+ */
+bool LcdCompositorBackend_Present(uint32_t* buffer)
+{
+  shownBuffer = buffer;
+  return true;
+}
+
+void LcdCompositor_Dma2dIrqHandler(void)
+{
+}
+
+void LcdCompositor_LtdcIrqHandler(void)
+{
+}
+
+int HAL_LTDC_ConfigLayer(LTDC_HandleTypeDef* hltdc, LCD_LayerCfgTypeDef* pLayerCfg, uint32_t LayerIdx)
+{
+  hltdc->LayerCfg[LayerIdx] = *pLayerCfg;
+  return 0;
+}
+
+uint8_t BSP_LCD_Init(void)
+{
+  return LCD_OK;
+}
+
+uint32_t BSP_LCD_GetXSize(void)
+{
+  return LCD_COMPOSITOR_WIDTH;
+}
+
+uint32_t BSP_LCD_GetYSize(void)
+{
+  return LCD_COMPOSITOR_HEIGHT;
+}
+
+void BSP_LCD_LayerDefaultInit(uint16_t LayerIndex, uint32_t FB_Address)
+{
+}
+
+void BSP_LCD_SelectLayer(uint32_t LayerIndex)
+{
+}
+
+void BSP_LCD_SetTextColor(uint32_t Color)
+{
+  textColor = Color;
+}
+
+void BSP_LCD_SetBackColor(uint32_t Color)
+{
+}
+
+void BSP_LCD_SetFont(sFONT* fonts)
+{
+}
+
+void BSP_LCD_Clear(uint32_t Color)
+{
+  uint32_t* pixels = LcdHost_FrameBuffer();
+
+  for(uint32_t i = 0; i < LCD_COMPOSITOR_WIDTH * LCD_COMPOSITOR_HEIGHT; i++)
+    pixels[i] = Color;
+}
+
+void BSP_LCD_FillRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height)
+{
+  uint32_t* pixels = LcdHost_FrameBuffer();
+
+  for(uint16_t y = Ypos; y < Ypos + Height && y < LCD_COMPOSITOR_HEIGHT; y++)
+    for(uint16_t x = Xpos; x < Xpos + Width && x < LCD_COMPOSITOR_WIDTH; x++)
+      pixels[y * LCD_COMPOSITOR_WIDTH + x] = textColor;
+}
+
+void BSP_LCD_DrawRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height)
+{
+  BSP_LCD_FillRect(Xpos, Ypos, Width, 1);
+  BSP_LCD_FillRect(Xpos, Ypos + Height, Width, 1);
+  BSP_LCD_FillRect(Xpos, Ypos, 1, Height);
+  BSP_LCD_FillRect(Xpos + Width, Ypos, 1, Height);
+}
+
+void BSP_LCD_FillCircle(uint16_t Xpos, uint16_t Ypos, uint16_t Radius)
+{
+  for(int32_t dy = -Radius; dy <= Radius; dy++)
+  {
+    int32_t dx = 0;
+    while((dx + 1) * (dx + 1) + dy * dy <= Radius * Radius)
+      dx++;
+    if(Ypos + dy >= 0 && Xpos >= dx)
+      BSP_LCD_FillRect(Xpos - dx, Ypos + dy, 2 * dx + 1, 1);
+  }
+}
+
+// text outside the compositor is only drawn by unused demo code
+void BSP_LCD_DisplayStringAt(uint16_t Xpos, uint16_t Ypos, uint8_t* Text, Text_AlignModeTypdef Mode)
+{
+}
+
+static uint64_t LcdHost_Now(void)
+{
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint64_t)now.tv_sec * 1000000000u + now.tv_nsec;
+}
+
+static void LcdHost_WritePngChunk(FILE* file, const char* type, const uint8_t* data, uint32_t length)
+{
+  uint8_t word[4];
+  uint32_t crc = LcdHost_Crc32(0, (const uint8_t*)type, 4);
+
+  crc = LcdHost_Crc32(crc, data, length);
+
+  LcdHost_PutBigEndian(word, length);
+  fwrite(word, 1, 4, file);
+  fwrite(type, 1, 4, file);
+  if(length)
+    fwrite(data, 1, length, file);
+  LcdHost_PutBigEndian(word, crc);
+  fwrite(word, 1, 4, file);
+}
+
+// CRC-32 of PNG chunks, bitwise; snapshots are not timed
+static uint32_t LcdHost_Crc32(uint32_t crc, const uint8_t* data, uint32_t length)
+{
+  crc = ~crc;
+  for(uint32_t i = 0; i < length; i++)
+  {
+    crc ^= data[i];
+    for(uint8_t bit = 0; bit < 8; bit++)
+      crc = (crc >> 1) ^ (0xEDB88320u & -(crc & 1));
+  }
+  return ~crc;
+}
+
+static void LcdHost_PutBigEndian(uint8_t* bytes, uint32_t value)
+{
+  bytes[0] = value >> 24;
+  bytes[1] = value >> 16;
+  bytes[2] = value >> 8;
+  bytes[3] = value;
+}
@@ -0,0 +1,25 @@
+/**
+  ******************************************************************************
+  * @file    lcd_host.h
+  * @brief   Host frame buffer for the LCD code: BSP stand-ins, a software
+  *          backend for the compositor that executes each DMA2D op in place,
+  *          and the PNG snapshots and redraw cost rows of the host tools.
+  ******************************************************************************
+  */
+
+// define to prevent recursive inclusion ---------------------------------------
+#ifndef __LCD_HOST_H__
+#define __LCD_HOST_H__
+
+// includes --------------------------------------------------------------------
+#include "lcd_compositor.h"
+
+// function prototypes ---------------------------------------------------------
+uint32_t* LcdHost_FrameBuffer(void);
+bool      LcdHost_WritePng(const char* path);
+uint64_t  LcdHost_BackendNanoseconds(void);
+void      LcdHost_PrintStatsHeader(void);
+void      LcdHost_PrintStats(const char* name, const LcdCompositorStats* before, const LcdCompositorStats* after);
+bool      LcdHost_MatchesFullRedraw(void);
+
+#endif // __LCD_HOST_H__
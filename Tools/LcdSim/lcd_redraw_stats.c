@@ -0,0 +1,301 @@
+/**
+  ******************************************************************************
+  * @file    lcd_redraw_stats.c
+  * @brief   Runs user_lcd.c and the compositor on host frame buffers and
+  *          reports how much each UI interaction redraws: frames, dirty
+  *          rectangles, fills and blits, pixels written, pixels copied to keep
+  *          the back buffer current, and the SDRAM traffic of all that. A
+  *          slider drag is then replayed event by event to get the cost of
+  *          one drag event, including the CPU time of rendering it (the host
+  *          stand-in for DMA2D is not counted). The last line checks that the
+  *          shown buffer matches a full redraw, with the EQ response curve
+  *          moved, with the spectrum bars moved and after closing the
+  *          spectrum screen.
+  *
+  *          build (from Tools, the sources are listed in its Makefile):
+  *            make build/lcd_redraw_stats
+  *
+  *          usage:
+  *            ./lcd_redraw_stats [-o prefix]   (-o saves prefix-<n>.png after each step)
+  ******************************************************************************
+  */
+
+#include "lcd_host.h"
+#include "user_lcd.h"
+#include "audio_user_dsp_response.h"
+#include "spectrum.h"
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+// private defines -------------------------------------------------------------
+// drag benchmark: knob 3 swept over the slider and back, one event per step
+#define DRAG_KNOB           3
+#define DRAG_STEP           4
+#define DRAG_SWEEPS         50
+
+// EQ response fed to the curve: a peak this high at this point, falling off
+// by the slope in dB per point
+#define CURVE_PEAK_POINT    100
+#define CURVE_PEAK_DB       9.0f
+#define CURVE_PEAK_SLOPE    0.3f
+
+// spectrum fed to the bars: falling by this many dB per bar from the first,
+// like music
+#define SPECTRUM_SLOPE_DB   1.8f
+
+// private variables -----------------------------------------------------------
+static const char* snapshotPrefix = NULL;
+static uint32_t    watchdogCounter = 0;
+static int         stepNumber = 0;
+
+// private function declarations -----------------------------------------------
+static void LcdStats_Step(const char* name, void (*interaction)(void));
+static void LcdStats_OpenEq(void);
+static void LcdStats_CloseEq(void);
+static void LcdStats_Watchdog(void);
+static void LcdStats_NudgeKnob(void);
+static void LcdStats_DragKnob(void);
+static void LcdStats_DragTwoKnobs(void);
+static void LcdStats_PressSave(void);
+static void LcdStats_Reset(void);
+static void LcdStats_MoveCurve(void);
+static void LcdStats_OpenSpectrum(void);
+static void LcdStats_CloseSpectrum(void);
+static void LcdStats_MoveSpectrum(void);
+static void LcdStats_SelectButton(RectangleButton* selected);
+static void LcdStats_DragBenchmark(void);
+static uint64_t LcdStats_Now(void);
+
+int main(int argc, char** argv)
+{
+  int option;
+
+  while((option = getopt(argc, argv, "o:h")) != -1)
+  {
+    if(option != 'o')
+    {
+      fprintf(stderr, "usage: %s [-o snapshot-prefix]\n", argv[0]);
+      return 1;
+    }
+    snapshotPrefix = optarg;
+  }
+
+  LcdHost_PrintStatsHeader();
+  LcdStats_Step("boot", LCD_Init);
+  LcdStats_Step("watchdog tick", LcdStats_Watchdog);
+  LcdStats_Step("open EQ screen", LcdStats_OpenEq);
+  LcdStats_Step("knob 1 px", LcdStats_NudgeKnob);
+  LcdStats_Step("knob drag 60 px", LcdStats_DragKnob);
+  LcdStats_Step("two knobs in one frame", LcdStats_DragTwoKnobs);
+  LcdStats_DragBenchmark();
+  LcdStats_Step("save button", LcdStats_PressSave);
+  LcdStats_Step("reset all bands", LcdStats_Reset);
+  LcdStats_Step("EQ curve, one band", LcdStats_MoveCurve);
+  bool curveMatches = LcdHost_MatchesFullRedraw();
+  LcdStats_Step("close EQ screen", LcdStats_CloseEq);
+  LcdStats_Step("open spectrum screen", LcdStats_OpenSpectrum);
+  LcdStats_Step("spectrum frame", LcdStats_MoveSpectrum);
+  bool spectrumMatches = LcdHost_MatchesFullRedraw();
+  LcdStats_Step("close spectrum screen", LcdStats_CloseSpectrum);
+
+  bool matches = curveMatches && spectrumMatches && LcdHost_MatchesFullRedraw();
+  printf("shown buffer matches a full redraw: %s\n", matches ? "yes" : "NO");
+
+  return matches ? 0 : 1;
+}
+
+/**
+ * @brief  Runs one interaction, flushes until the compositor has nothing left
+ *         and prints what it cost.
+ * @param  name: label
+ * @param  interaction: changes the UI state like touchscreen.c does
+ * @retval None
+ */
+static void LcdStats_Step(const char* name, void (*interaction)(void))
+{
+  LcdCompositorStats before, after;
+
+  LcdCompositor_GetStats(&before);
+  interaction();
+  while(LcdCompositor_Flush())
+  {
+  }
+  LcdCompositor_GetStats(&after);
+  LcdHost_PrintStats(name, &before, &after);
+
+  stepNumber++;
+  if(snapshotPrefix)
+  {
+    char path[256];
+    snprintf(path, sizeof(path), "%s-%d.png", snapshotPrefix, stepNumber);
+    LcdHost_WritePng(path);
+  }
+}
+
+static void LcdStats_OpenEq(void)
+{
+  LCD_UpdateButton(0, true, false);
+}
+
+static void LcdStats_CloseEq(void)
+{
+  LCD_UpdateButton(0, false, false);
+}
+
+static void LcdStats_Watchdog(void)
+{
+  LCD_UpdateWatchdog(&watchdogCounter);
+}
+
+static void LcdStats_NudgeKnob(void)
+{
+  LCD_DisplayKnob(3, sliderKnobs[3].knobY + 1);
+}
+
+static void LcdStats_DragKnob(void)
+{
+  LCD_DisplayKnob(3, sliderKnobs[3].knobY + 60);
+}
+
+static void LcdStats_DragTwoKnobs(void)
+{
+  LCD_DisplayKnob(0, sliderKnobs[0].knobY - 20);
+  LCD_DisplayKnob(7, sliderKnobs[7].knobY + 20);
+}
+
+static void LcdStats_PressSave(void)
+{
+  LcdStats_SelectButton(&saveButton);
+}
+
+static void LcdStats_Reset(void)
+{
+  static const float flat[DSP_RESPONSE_POINTS] = {0};
+
+  LcdStats_SelectButton(&resetButton);
+  for(uint8_t i = 0; i < NUMBER_OF_SLIDER_BUTTONS; i++)
+    LCD_DisplayKnob(i, LCD_TranslateGainToKnobPosition(i, 0));
+  LCD_UpdateResponseCurve(flat);
+}
+
+/**
+ * @brief  Raises one band, as the curve task does once the USB interrupt
+ *         configured it.
+ * @param  None
+ * @retval None
+ */
+static void LcdStats_MoveCurve(void)
+{
+  float magnitude[DSP_RESPONSE_POINTS];
+
+  for(int32_t i = 0; i < DSP_RESPONSE_POINTS; i++)
+  {
+    float distance = (i > CURVE_PEAK_POINT) ? i - CURVE_PEAK_POINT : CURVE_PEAK_POINT - i;
+    float level = CURVE_PEAK_DB - CURVE_PEAK_SLOPE * distance;
+    magnitude[i] = (level > 0) ? level : 0;
+  }
+
+  LCD_UpdateResponseCurve(magnitude);
+}
+
+static void LcdStats_OpenSpectrum(void)
+{
+  LCD_UpdateButton(1, true, true);
+}
+
+static void LcdStats_CloseSpectrum(void)
+{
+  LCD_UpdateButton(1, false, true);
+}
+
+/**
+ * @brief  Feeds one analyzer frame to the bars, as the spectrum task does.
+ * @param  None
+ * @retval None
+ */
+static void LcdStats_MoveSpectrum(void)
+{
+  float bars[SPECTRUM_BARS];
+
+  for(uint8_t i = 0; i < SPECTRUM_BARS; i++)
+    bars[i] = -6.0f - SPECTRUM_SLOPE_DB * i;
+
+  LCD_UpdateSpectrum(bars);
+}
+
+/**
+ * @brief  Activates one of the option buttons and clears the others, as the
+ *         touch handler does.
+ * @param  selected: button pressed
+ * @retval None
+ */
+static void LcdStats_SelectButton(RectangleButton* selected)
+{
+  RectangleButton* buttons[] = { &saveButton, &undoButton, &resetButton };
+
+  for(uint8_t i = 0; i < 3; i++)
+  {
+    buttons[i]->isPressed = (buttons[i] == selected);
+    buttons[i]->isActive = (buttons[i] == selected);
+    LCD_UpdateRectangleButton(buttons[i]);
+  }
+}
+
+/**
+ * @brief  Replays a slider drag, one knob move and one flush per event as the
+ *         touch handler and the main loop do, and prints the mean cost of an
+ *         event. The best sweep is taken for the CPU time.
+ * @param  None
+ * @retval None
+ */
+static void LcdStats_DragBenchmark(void)
+{
+  SliderKnob* knob = &sliderKnobs[DRAG_KNOB];
+  uint16_t top = knob->sliderY + 10;
+  uint16_t bottom = knob->sliderY + knob->sliderHeight - 10;
+  uint16_t start = knob->knobY;
+  LcdCompositorStats before, after;
+  uint64_t best = UINT64_MAX;
+  uint32_t events = 0;
+
+  LcdCompositor_GetStats(&before);
+  for(uint16_t sweep = 0; sweep < DRAG_SWEEPS; sweep++)
+  {
+    uint64_t cpu = 0;
+    uint32_t sweepEvents = 0;
+
+    for(int32_t y = top; y <= 2 * bottom - top; y += DRAG_STEP)
+    {
+      uint16_t knobY = (y <= bottom) ? y : 2 * bottom - y;
+      uint64_t backend = LcdHost_BackendNanoseconds();
+      uint64_t begin = LcdStats_Now();
+
+      LCD_DisplayKnob(DRAG_KNOB, knobY);
+      LcdCompositor_Flush();
+
+      cpu += (LcdStats_Now() - begin) - (LcdHost_BackendNanoseconds() - backend);
+      sweepEvents++;
+    }
+
+    events += sweepEvents;
+    if(cpu / sweepEvents < best)
+      best = cpu / sweepEvents;
+  }
+  LcdCompositor_GetStats(&after);
+
+  printf("%-26s %6u events, per event: %u ops, %u px written, %u px synced, %u B SDRAM, %.2f us CPU\n",
+    "slider drag", events, (after.ops - before.ops) / events, (after.pixelsWritten - before.pixelsWritten) / events,
+    (after.syncPixels - before.syncPixels) / events, (after.sdramBytes - before.sdramBytes) / events, best / 1e3);
+
+  LCD_DisplayKnob(DRAG_KNOB, start);
+  LcdCompositor_Flush();
+}
+
+static uint64_t LcdStats_Now(void)
+{
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint64_t)now.tv_sec * 1000000000u + now.tv_nsec;
+}
@@ -0,0 +1,93 @@
+/**
+  ******************************************************************************
+  * @file    touch_host.c
+  * @brief   Host stand-ins for the HAL tick, the touch screen BSP and the
+  *          FT6x06 backend of the touch input. Time only moves when the tool
+  *          advances it, so a replay gives the same result on every run.
+  *          A report carries the tick in place of the cycle counter.
+  ******************************************************************************
+  */
+
+#include "touch_host.h"
+#include "stm32f7xx_hal.h"
+#include "stm32f769i_discovery_ts.h"
+#include <string.h>
+
+// private variables -----------------------------------------------------------
+static uint32_t tick = 0;
+
+/**
+ * @brief  Moves the virtual clock.
+ * @param  ms: milliseconds to add
+ * @retval None
+ */
+void TouchHost_AdvanceTime(uint32_t ms)
+{
+  tick += ms;
+}
+
+/**
+ * @brief  Posts a report as the I2C interrupt does, timestamped now.
+ * @param  points: fingers in contact, up to TOUCH_MAX_POINTS
+ * @param  point: their touch IDs and screen positions
+ * @retval false if the report was dropped
+ */
+bool TouchHost_Report(uint8_t points, const TouchPoint* point)
+{
+  TouchReport report = {0};
+
+  report.points = (points > TOUCH_MAX_POINTS) ? TOUCH_MAX_POINTS : points;
+  memcpy(report.point, point, report.points * sizeof(TouchPoint));
+  report.timestamp = tick;
+  report.cycles = tick;
+
+  return TouchInput_PostReport(&report);
+}
+
+uint32_t HAL_GetTick(void)
+{
+  return tick;
+}
+
+void HAL_Delay(uint32_t Delay)
+{
+  tick += Delay;
+}
+
+uint8_t BSP_TS_Init(uint16_t ts_SizeX, uint16_t ts_SizeY)
+{
+  (void)ts_SizeX;
+  (void)ts_SizeY;
+  return TS_OK;
+}
+
+// the polling demo code only ever sees an untouched screen
+uint8_t BSP_TS_GetState(TS_StateTypeDef* TS_State)
+{
+  memset(TS_State, 0, sizeof(*TS_State));
+  return TS_OK;
+}
+
+uint8_t BSP_TS_ResetTouchData(TS_StateTypeDef* TS_State)
+{
+  memset(TS_State, 0, sizeof(*TS_State));
+  return TS_OK;
+}
+
+bool TouchInput_Init(void)
+{
+  TouchInput_Reset();
+  return true;
+}
+
+// reports are posted directly, nothing waits for the bus
+void TouchInput_Process(void)
+{
+}
+
+// called by the polling demo of touchscreen.c, which the firmware never runs
+// and its linker drops with the unused sections
+void Touchscreen_DrawBackground_Circles(uint8_t state)
+{
+  (void)state;
+}
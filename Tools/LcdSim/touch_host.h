@@ -0,0 +1,21 @@
+/**
+  ******************************************************************************
+  * @file    touch_host.h
+  * @brief   Host touch input for the UI code: a virtual millisecond clock
+  *          behind HAL_GetTick and reports posted as the FT6x06 backend
+  *          posts them, so touchscreen.c runs unchanged.
+  ******************************************************************************
+  */
+
+// define to prevent recursive inclusion ---------------------------------------
+#ifndef __TOUCH_HOST_H__
+#define __TOUCH_HOST_H__
+
+// includes --------------------------------------------------------------------
+#include "touch_input.h"
+
+// function prototypes ---------------------------------------------------------
+void     TouchHost_AdvanceTime(uint32_t ms);
+bool     TouchHost_Report(uint8_t points, const TouchPoint* point);
+
+#endif // __TOUCH_HOST_H__
@@ -0,0 +1,395 @@
+/**
+  ******************************************************************************
+  * @file    ui_replay.c
+  * @brief   Replays a scripted touch session through the firmware UI on the
+  *          host frame buffer: user_lcd.c, touchscreen.c, the touch input,
+  *          the touch map and the compositor run unchanged, with the main
+  *          loop tasks and the USB interrupt played on a virtual clock:
+  *          every millisecond the USB frame takes the moved knobs and the LCD
+  *          task flushes, every TOUCH_TASK_PERIOD_MS the touch task runs
+  *          Touchscreen_ButtonHandler and every CURVE_TASK_PERIOD_MS the EQ
+  *          curve follows the gains. Fingers in contact are reported every
+  *          REPORT_PERIOD_MS, like the FT6x06.
+  *
+  *          Each step of the script gets a row of redraw cost (frames,
+  *          rectangles, DMA2D fills and blits, pixels written and synced,
+  *          SDRAM traffic); the end gives the gains, the flash writes, the
+  *          touch to EQ latency and whether the shown buffer matches a full
+  *          redraw.
+  *
+  *          script, one command per line, # starts a comment:
+  *            step <name>              starts a new row of the table
+  *            touch x y [x y]          fingers down, or moved at once
+  *            drag ms x y [x y]        moves the fingers there in a straight
+  *                                     line, one report per REPORT_PERIOD_MS
+  *            lift                     lifts all fingers, waits the debounce
+  *            wait ms                  lets time pass, fingers stay as they are
+  *            snapshot file.png        saves the shown buffer
+  *
+  *          build (from Tools, the sources are listed in its Makefile):
+  *            make build/ui_replay
+  *
+  *          usage:
+  *            ./ui_replay script.txt   (exit status 1 on a script error or if
+  *                                      the shown buffer is not a full redraw)
+  ******************************************************************************
+  */
+
+#include "lcd_host.h"
+#include "touch_host.h"
+#include "main.h"
+#include "user_lcd.h"
+#include "audio_user_dsp_response.h"
+#include "flash_persistence.h"
+#include <ctype.h>
+#include <math.h>
+#include <stdlib.h>
+
+// private defines -------------------------------------------------------------
+// as in main.c
+#define TOUCH_TASK_PERIOD_MS    10
+#define CURVE_TASK_PERIOD_MS    33
+// reports of a touched FT6x06, about 100 per second
+#define REPORT_PERIOD_MS        10
+#define SAMPLE_RATE             48000
+#define LINE_LENGTH             256
+#define STEP_NAME_LENGTH        64
+
+// private variables -----------------------------------------------------------
+static TouchPoint         fingers[TOUCH_MAX_POINTS];
+static uint8_t            fingerCount = 0;
+static uint8_t            nextId = 0;
+static uint32_t           lastReport = 0;
+
+static char               stepName[STEP_NAME_LENGTH] = "";
+static LcdCompositorStats stepStart;
+
+static uint16_t           flashPositions[NUMBER_OF_SLIDER_BUTTONS];
+static uint32_t           flashWrites = 0;
+
+// variables -------------------------------------------------------------------
+// band layout, normally defined in audio_usb_nodes.c
+int16_t      frequencies[] = {30, 60, 150, 400, 1000, 3000, 8000, 16000};
+int16_t      bandwidths[] =  {1,   1,   2,   2,    2,    3,    3,     3};
+BiquadFilter biquadFilters[NUMBER_OF_BANDS];
+
+// private function declarations -----------------------------------------------
+static void UiReplay_Boot(void);
+static bool UiReplay_Command(char* line, uint32_t lineNumber);
+static void UiReplay_EndStep(void);
+static void UiReplay_Run(uint32_t ms);
+static void UiReplay_UsbFrame(void);
+static void UiReplay_Touch(uint8_t count, const uint16_t* position);
+
+int main(int argc, char** argv)
+{
+  char line[LINE_LENGTH];
+  uint32_t lineNumber = 0;
+  bool ok = true;
+  FILE* script;
+
+  if(argc != 2)
+  {
+    fprintf(stderr, "usage: %s script.txt\n", argv[0]);
+    return 1;
+  }
+
+  script = fopen(argv[1], "r");
+  if(!script)
+  {
+    fprintf(stderr, "cannot open %s\n", argv[1]);
+    return 1;
+  }
+
+  LcdHost_PrintStatsHeader();
+  UiReplay_Boot();
+
+  while(ok && fgets(line, sizeof(line), script))
+    ok = UiReplay_Command(line, ++lineNumber);
+  fclose(script);
+
+  UiReplay_Run(0);
+  UiReplay_EndStep();
+  if(!ok)
+    return 1;
+
+  printf("gains (dB):");
+  for(uint8_t i = 0; i < NUMBER_OF_BANDS; i++)
+    printf(" %d", (int)biquadFilters[i].gain);
+  printf("\nflash writes: %u\n", flashWrites);
+  printf("touch to EQ: %u updates, mean %.1f ms, max %.1f ms\n", touchLatencyStats.updates,
+    touchLatencyStats.updates ? touchLatencyStats.totalUs / 1e3 / touchLatencyStats.updates : 0.0,
+    touchLatencyStats.maxUs / 1e3);
+  printf("touch input: %u dropped, %u bounces, %u unassigned\n", touchInputStats.dropped,
+    touchInputStats.bounces, touchInputStats.unassigned);
+
+  bool matches = LcdHost_MatchesFullRedraw();
+  printf("shown buffer matches a full redraw: %s\n", matches ? "yes" : "NO");
+
+  return matches ? 0 : 1;
+}
+
+/**
+ * @brief  Starts the UI as main.c does, with flat gains stored in flash.
+ * @param  None
+ * @retval None
+ */
+static void UiReplay_Boot(void)
+{
+  strcpy(stepName, "boot");
+  LcdCompositor_GetStats(&stepStart);
+
+  // main.c waits a second before the UI starts
+  HAL_Delay(1000);
+  LCD_Init();
+  Touchscreen_Init();
+
+  for(uint8_t i = 0; i < NUMBER_OF_SLIDER_BUTTONS; i++)
+  {
+    LCD_DisplayKnob(i, LCD_TranslateGainToKnobPosition(i, 0));
+    flashPositions[i] = sliderKnobs[i].knobY;
+    AudioUserDsp_BiquadFilterConfig(&biquadFilters[i], AudioUserDsp_CalculateGain(i, &sliderKnobs[i]),
+      frequencies[i], bandwidths[i]);
+  }
+
+  AudioUserDspResponse_Init(SAMPLE_RATE);
+  UiReplay_Run(1);
+}
+
+/**
+ * @brief  Runs one line of the script.
+ * @param  line: text of the line, changed in place
+ * @param  lineNumber: for the error message
+ * @retval false on an error
+ */
+static bool UiReplay_Command(char* line, uint32_t lineNumber)
+{
+  char* command;
+  char* argument;
+  long value[1 + 2 * TOUCH_MAX_POINTS];
+  uint8_t values = 0;
+
+  line[strcspn(line, "#\r\n")] = '\0';
+  command = strtok(line, " \t");
+  if(!command)
+    return true;
+  argument = strtok(NULL, "");
+  while(argument && isspace((unsigned char)*argument))
+    argument++;
+
+  if(strcmp(command, "step") == 0 && argument && *argument)
+  {
+    UiReplay_EndStep();
+    snprintf(stepName, sizeof(stepName), "%s", argument);
+    LcdCompositor_GetStats(&stepStart);
+    return true;
+  }
+
+  if(strcmp(command, "snapshot") == 0 && argument && *argument)
+    return LcdHost_WritePng(argument);
+
+  for(char* text = argument; text && values < sizeof(value) / sizeof(value[0]); values++)
+  {
+    char* end;
+    value[values] = strtol(text, &end, 10);
+    if(end == text)
+      break;
+    text = end;
+  }
+
+  if(strcmp(command, "lift") == 0 && values == 0)
+  {
+    UiReplay_Touch(0, NULL);
+    UiReplay_Run(REPORT_PERIOD_MS + TOUCH_DEBOUNCE_MS + TOUCH_TASK_PERIOD_MS);
+    return true;
+  }
+
+  if(strcmp(command, "wait") == 0 && values == 1 && value[0] >= 0)
+  {
+    UiReplay_Run(value[0]);
+    return true;
+  }
+
+  if(strcmp(command, "touch") == 0 && values >= 2 && values % 2 == 0)
+  {
+    uint16_t position[2 * TOUCH_MAX_POINTS];
+    for(uint8_t i = 0; i < values; i++)
+      position[i] = value[i];
+    UiReplay_Touch(values / 2, position);
+    UiReplay_Run(REPORT_PERIOD_MS);
+    return true;
+  }
+
+  if(strcmp(command, "drag") == 0 && values == 1 + 2 * fingerCount && fingerCount > 0 && value[0] > 0)
+  {
+    uint32_t duration = value[0];
+    TouchPoint from[TOUCH_MAX_POINTS];
+    memcpy(from, fingers, sizeof(from));
+
+    for(uint32_t elapsed = REPORT_PERIOD_MS; ; elapsed += REPORT_PERIOD_MS)
+    {
+      uint16_t position[2 * TOUCH_MAX_POINTS];
+      uint32_t done = (elapsed < duration) ? elapsed : duration;
+
+      for(uint8_t i = 0; i < fingerCount; i++)
+      {
+        position[2 * i] = from[i].x + ((long)value[1 + 2 * i] - from[i].x) * (long)done / (long)duration;
+        position[2 * i + 1] = from[i].y + ((long)value[2 + 2 * i] - from[i].y) * (long)done / (long)duration;
+      }
+      UiReplay_Touch(fingerCount, position);
+      UiReplay_Run(REPORT_PERIOD_MS);
+
+      if(done == duration)
+        return true;
+    }
+  }
+
+  fprintf(stderr, "line %u: cannot run '%s'\n", lineNumber, command);
+  return false;
+}
+
+/**
+ * @brief  Prints the redraw cost of the step since it started.
+ * @param  None
+ * @retval None
+ */
+static void UiReplay_EndStep(void)
+{
+  LcdCompositorStats stepEnd;
+
+  LcdCompositor_GetStats(&stepEnd);
+  LcdHost_PrintStats(stepName, &stepStart, &stepEnd);
+}
+
+/**
+ * @brief  Lets time pass, one millisecond at a time, running what the board
+ *         runs in it.
+ * @param  ms: milliseconds
+ * @retval None
+ */
+static void UiReplay_Run(uint32_t ms)
+{
+  for(uint32_t i = 0; i < ms; i++)
+  {
+    TouchHost_AdvanceTime(1);
+    uint32_t now = HAL_GetTick();
+
+    if(fingerCount > 0 && now - lastReport >= REPORT_PERIOD_MS)
+    {
+      TouchHost_Report(fingerCount, fingers);
+      lastReport = now;
+    }
+
+    UiReplay_UsbFrame();
+    if(now % TOUCH_TASK_PERIOD_MS == 0)
+      Touchscreen_ButtonHandler();
+    if(now % CURVE_TASK_PERIOD_MS == 0 && AudioUserDspResponse_Update() != 0)
+      LCD_UpdateResponseCurve(AudioUserDspResponse_Magnitude());
+    LCD_Process();
+  }
+
+  LCD_Process();
+}
+
+/**
+ * @brief  What the USB interrupt does with the knobs at each frame, as in
+ *         audio_usb_nodes.c. The latency is in ms of the virtual clock.
+ * @param  None
+ * @retval None
+ */
+static void UiReplay_UsbFrame(void)
+{
+  for(uint8_t i = 0; i < NUMBER_OF_SLIDER_BUTTONS; i++)
+  {
+    if(sliderKnobs[i].isPressed)
+    {
+      sliderKnobs[i].isPressed = false;
+      int16_t newGain = AudioUserDsp_CalculateGain(i, &sliderKnobs[i]);
+      if(newGain != biquadFilters[i].gain)
+      {
+        AudioUserDsp_BiquadFilterConfig(&biquadFilters[i], newGain, biquadFilters[i].frequency, biquadFilters[i].bandwidth);
+        TouchInput_RecordLatency((HAL_GetTick() - sliderKnobs[i].touchCycles) * 1000);
+      }
+    }
+  }
+}
+
+/**
+ * @brief  Sets the fingers in contact and reports them at once. Fingers keep
+ *         their touch ID while the count stays the same.
+ * @param  count: fingers in contact, 0 lifts them all
+ * @param  position: x and y of each
+ * @retval None
+ */
+static void UiReplay_Touch(uint8_t count, const uint16_t* position)
+{
+  if(count > TOUCH_MAX_POINTS)
+    count = TOUCH_MAX_POINTS;
+
+  for(uint8_t i = 0; i < count; i++)
+  {
+    if(count != fingerCount)
+      fingers[i].id = nextId++ & 0x0F;
+    fingers[i].x = position[2 * i];
+    fingers[i].y = position[2 * i + 1];
+  }
+
+  fingerCount = count;
+  TouchHost_Report(fingerCount, fingers);
+  lastReport = HAL_GetTick();
+}
+
+// gain of the knob position, as in audio_user_dsp.c
+int16_t AudioUserDsp_CalculateGain(uint16_t sliderY, SliderKnob* sliderKnob)
+{
+  double inputMin = sliderKnob->sliderY;
+  double inputMax = sliderKnob->sliderY + sliderKnob->sliderHeight;
+
+  (void)sliderY;
+  return 15 + (sliderKnob->knobY - inputMin) * (-15 - 15) / (inputMax - inputMin);
+}
+
+// peaking biquad of the band, as in audio_user_dsp.c, for the EQ curve
+void AudioUserDsp_BiquadFilterConfig(BiquadFilter* filter, int16_t gain, int16_t frequency, int16_t bandwidth)
+{
+  double A = pow(10.0, gain / 40.0);
+  double omega = 2.0 * M_PI * frequency / SAMPLE_RATE;
+  double alpha = sin(omega) * sinh(log(2) / 2.0 * bandwidth * omega / sin(omega));
+  double a0 = 1.0 + alpha / A;
+
+  filter->coefficients.b0 = (float)((1.0 + alpha * A) / a0);
+  filter->coefficients.b1 = (float)(-2.0 * cos(omega) / a0);
+  filter->coefficients.b2 = (float)((1.0 - alpha * A) / a0);
+  filter->coefficients.a1 = filter->coefficients.b1;
+  filter->coefficients.a2 = (float)((1.0 - alpha / A) / a0);
+  filter->gain = gain;
+  filter->frequency = frequency;
+  filter->bandwidth = bandwidth;
+  filter->isInitialized = true;
+}
+
+// the flash keeps the knob positions; the real write queues journal records
+void FlashPersistence_Write(void)
+{
+  for(uint8_t i = 0; i < NUMBER_OF_SLIDER_BUTTONS; i++)
+    flashPositions[i] = sliderKnobs[i].knobY;
+  flashWrites++;
+}
+
+uint16_t FlashPersistence_Read(uint8_t position)
+{
+  return flashPositions[position];
+}
+
+// the real one copies the saved coefficients, the curve is the same
+void FlashPersistence_RecallCoefficients(void)
+{
+  for(uint8_t i = 0; i < NUMBER_OF_BANDS; i++)
+    AudioUserDsp_BiquadFilterConfig(&biquadFilters[i], AudioUserDsp_CalculateGain(i, &sliderKnobs[i]), frequencies[i], bandwidths[i]);
+}
+
+void Error_Handler(void)
+{
+  fprintf(stderr, "Error_Handler called\n");
+  exit(1);
+}
@@ -0,0 +1,13 @@
+/**
+  ******************************************************************************
+  * @file    stm32f7xx.h
+  * @brief   Host stand-in for the CMSIS device header.
+  ******************************************************************************
+  */
+
+#ifndef __STM32F7xx_H
+#define __STM32F7xx_H
+
+#include "stm32f7xx_hal.h"
+
+#endif // __STM32F7xx_H
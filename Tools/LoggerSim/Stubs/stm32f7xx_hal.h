@@ -0,0 +1,33 @@
+/**
+  ******************************************************************************
+  * @file    stm32f7xx_hal.h
+  * @brief   Host stand-in for the STM32 HAL, only what the USART modules
+  *          touch.
+  ******************************************************************************
+  */
+
+// define to prevent recursive inclusion ---------------------------------------
+#ifndef __STM32F7xx_HAL_H
+#define __STM32F7xx_HAL_H
+
+// includes --------------------------------------------------------------------
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// defines ---------------------------------------------------------------------
+#define __IO    volatile
+#define __DMB() __sync_synchronize()
+// no data cache on the host
+#define SCB_CleanDCache_by_Addr(address, size)
+
+// typedefs --------------------------------------------------------------------
+typedef struct { uint32_t instance; } UART_HandleTypeDef;
+
+// variables -------------------------------------------------------------------
+extern uint32_t SystemCoreClock;
+
+// function prototypes ---------------------------------------------------------
+uint32_t HAL_GetTick(void);
+
+#endif // __STM32F7xx_HAL_H
@@ -0,0 +1,277 @@
+/**
+  ******************************************************************************
+  * @file    logger_sim.c
+  * @brief   Runs the logger on the host against a mock of the USART1 DMA,
+  *          which appends what it is given to a capture and can refuse
+  *          transfers like a busy line. Producers are threads, so they
+  *          preempt each other and the drain far more often than interrupts
+  *          do on the board. Checks:
+  *          - fifo: one producer, drained often enough never to drop, comes
+  *            out as written, byte for byte;
+  *          - producers: PRODUCERS threads writing as fast as they can, the
+  *            main thread draining; each producer's messages come out in
+  *            order, every accepted message comes out once, and the drop
+  *            notices add up to the refused writes and the drop counter;
+  *          - refused transfers: the same with one transfer in REFUSE_EVERY
+  *            refused; nothing more is lost and each refusal is retried;
+  *          - truncated: a message longer than the transmit buffer is cut
+  *            and counted.
+  *
+  *          build (from Tools, the sources are listed in its Makefile):
+  *            make build/logger_sim
+  *
+  *          usage:
+  *            ./logger_sim   (exit status 1 if a check fails)
+  ******************************************************************************
+  */
+
+#include "logger.h"
+#include "usart.h"
+#include "sim_report.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// private defines -------------------------------------------------------------
+#define PRODUCERS           4
+#define MESSAGES            20000
+#define FIFO_MESSAGES       10000
+// messages between drains, fewer than the ring holds
+#define FIFO_BATCH          (LOGGER_RING_SIZE / 2)
+#define REFUSE_EVERY        3
+#define CAPTURE_SIZE        (16 * 1024 * 1024)
+#define LONG_MESSAGE        (2 * LOGGER_TX_BUFFER_SIZE)
+
+// private typedefs ------------------------------------------------------------
+typedef struct Producer
+{
+  pthread_t thread;
+  uint32_t  id;
+  uint32_t  accepted;
+  uint32_t  refused;
+} Producer;
+
+// private variables -----------------------------------------------------------
+static char     capture[CAPTURE_SIZE];
+static uint32_t captureLength;
+static uint32_t transfers;
+static uint32_t refuseEvery;
+static uint32_t refusedTransfers;
+static uint32_t tick;
+static char     longMessage[LONG_MESSAGE + 1];
+
+// private function declarations -----------------------------------------------
+static bool  LoggerSim_Fifo(void);
+static bool  LoggerSim_Producers(const char* name, uint32_t refuse);
+static bool  LoggerSim_Truncated(void);
+static void* LoggerSim_Produce(void* argument);
+static void  LoggerSim_Start(uint32_t refuse);
+static void  LoggerSim_Drain(void);
+
+int main(void)
+{
+  bool passed = true;
+
+  passed &= LoggerSim_Fifo();
+  passed &= LoggerSim_Producers("producers", 0);
+  passed &= LoggerSim_Producers("refused transfers", REFUSE_EVERY);
+  passed &= LoggerSim_Truncated();
+
+  printf("%s\n", passed ? "all checks passed" : "CHECK FAILED");
+  return passed ? 0 : 1;
+}
+
+// mock of usart.c: the transfer completes at once, or is refused
+bool USART1_TransmitDMA(uint8_t* data, uint16_t length)
+{
+  if(refuseEvery != 0 && ++transfers % refuseEvery == 0)
+  {
+    refusedTransfers++;
+    return false;
+  }
+
+  if(captureLength + length <= CAPTURE_SIZE)
+  {
+    memcpy(capture + captureLength, data, length);
+    captureLength += length;
+  }
+  return true;
+}
+
+bool USART1_IsTransmitting(void)
+{
+  return false;
+}
+
+uint32_t HAL_GetTick(void)
+{
+  return tick++;
+}
+
+/**
+ * @brief  Numbered messages from one producer, drained every FIFO_BATCH.
+ * @param  None
+ * @retval true if the capture is the messages in order and none dropped
+ */
+static bool LoggerSim_Fifo(void)
+{
+  static char expected[CAPTURE_SIZE];
+  uint32_t expectedLength = 0;
+  LoggerStats stats;
+
+  LoggerSim_Start(0);
+  for(uint32_t i = 0; i < FIFO_MESSAGES; i++)
+  {
+    LOG("message %u of %u\r\n", i, FIFO_MESSAGES);
+    expectedLength += sprintf(expected + expectedLength, "message %u of %u\r\n", i, FIFO_MESSAGES);
+    if(i % FIFO_BATCH == FIFO_BATCH - 1)
+      LoggerSim_Drain();
+  }
+  LoggerSim_Drain();
+  Logger_GetStats(&stats);
+
+  bool same = captureLength == expectedLength && memcmp(capture, expected, expectedLength) == 0;
+  printf("  fifo: %u messages, %u bytes, %s, %u dropped\n", stats.written, captureLength, same ? "as written" : "different", stats.dropped);
+  return SimReport_Check("fifo", same && stats.written == FIFO_MESSAGES && stats.dropped == 0);
+}
+
+/**
+ * @brief  PRODUCERS threads of MESSAGES each against the drain.
+ * @param  name: of the check
+ * @param  refuse: refuse one transfer in this many, 0 none
+ * @retval true if order and accounting hold
+ */
+static bool LoggerSim_Producers(const char* name, uint32_t refuse)
+{
+  Producer producers[PRODUCERS];
+  uint32_t next[PRODUCERS] = { 0 };
+  uint32_t received[PRODUCERS] = { 0 };
+  uint32_t accepted = 0, refused = 0, notices = 0, outOfOrder = 0, unknown = 0;
+  LoggerStats stats;
+
+  LoggerSim_Start(refuse);
+  for(uint32_t p = 0; p < PRODUCERS; p++)
+  {
+    producers[p] = (Producer){ .id = p };
+    pthread_create(&producers[p].thread, NULL, LoggerSim_Produce, &producers[p]);
+  }
+
+  // the main loop of the board: drains until every producer is done
+  for(uint32_t done = 0; done < PRODUCERS;)
+  {
+    Logger_Process();
+    sched_yield();
+    done = 0;
+    for(uint32_t p = 0; p < PRODUCERS; p++)
+      done += __atomic_load_n(&producers[p].accepted, __ATOMIC_RELAXED) + __atomic_load_n(&producers[p].refused, __ATOMIC_RELAXED) == MESSAGES;
+  }
+  for(uint32_t p = 0; p < PRODUCERS; p++)
+  {
+    pthread_join(producers[p].thread, NULL);
+    accepted += producers[p].accepted;
+    refused += producers[p].refused;
+  }
+  LoggerSim_Drain();
+  Logger_GetStats(&stats);
+
+  capture[captureLength < CAPTURE_SIZE ? captureLength : CAPTURE_SIZE - 1] = '\0';
+  for(char* cursor = capture; *cursor != '\0';)
+  {
+    unsigned id, index, count;
+    int used = 0;
+
+    if(sscanf(cursor, "<%u:%u>%n", &id, &index, &used) == 2 && used > 0 && id < PRODUCERS)
+    {
+      outOfOrder += index < next[id];
+      next[id] = index + 1;
+      received[id]++;
+      cursor += used;
+    }
+    else if(sscanf(cursor, "\r\n[logger] %u messages dropped\r\n%n", &count, &used) == 1 && used > 0)
+    {
+      notices += count;
+      cursor += used;
+    }
+    else
+    {
+      unknown++;
+      cursor++;
+    }
+  }
+
+  bool complete = true;
+  for(uint32_t p = 0; p < PRODUCERS; p++)
+    complete &= received[p] == producers[p].accepted;
+
+  printf("  %s: %u accepted, %u dropped, %u in the notices, %u out of order, %u transfers refused, %u retried\n",
+         name, accepted, refused, notices, outOfOrder, refusedTransfers, stats.retried);
+  return SimReport_Check(name, complete && outOfOrder == 0 && unknown == 0 && stats.written == accepted &&
+                               stats.dropped == refused && notices == refused && stats.retried == refusedTransfers &&
+                               (refuse == 0 || refusedTransfers > 0));
+}
+
+/**
+ * @brief  One message longer than the transmit buffer.
+ * @param  None
+ * @retval true if it comes out cut to the buffer and is counted
+ */
+static bool LoggerSim_Truncated(void)
+{
+  LoggerStats stats;
+
+  memset(longMessage, 'x', LONG_MESSAGE);
+  LoggerSim_Start(0);
+  // its own format, the host pointers do not fit the 32 bit arguments
+  LOG(longMessage);
+  LoggerSim_Drain();
+  Logger_GetStats(&stats);
+
+  printf("  truncated: %u bytes out of %u, %u counted\n", captureLength, LONG_MESSAGE, stats.truncated);
+  return SimReport_Check("truncated", captureLength == LOGGER_TX_BUFFER_SIZE - 1 && stats.truncated == 1);
+}
+
+// writes MESSAGES numbered messages, counting the refused ones; yields after
+// one, or the producers would only fill the ring and drop the rest
+static void* LoggerSim_Produce(void* argument)
+{
+  Producer* producer = argument;
+
+  for(uint32_t i = 0; i < MESSAGES; i++)
+  {
+    if(LOG("<%u:%u>", producer->id, i))
+    {
+      __atomic_fetch_add(&producer->accepted, 1, __ATOMIC_RELAXED);
+    }
+    else
+    {
+      __atomic_fetch_add(&producer->refused, 1, __ATOMIC_RELAXED);
+      sched_yield();
+    }
+  }
+  return NULL;
+}
+
+// empties the logger and the capture, refusing one transfer in refuse
+static void LoggerSim_Start(uint32_t refuse)
+{
+  Logger_Init();
+  captureLength = 0;
+  transfers = 0;
+  refusedTransfers = 0;
+  refuseEvery = refuse;
+}
+
+// drains until a pass sends nothing, the drop notice included
+static void LoggerSim_Drain(void)
+{
+  uint32_t before;
+
+  do
+  {
+    before = captureLength;
+    Logger_Process();
+    Logger_Process();
+  } while(captureLength != before);
+}
@@ -0,0 +1,13 @@
+/**
+  ******************************************************************************
+  * @file    hal_usb_ex.h
+  * @brief   Host stand-in, the simulation has no USB peripheral.
+  ******************************************************************************
+  */
+
+#ifndef __HAL_USB_EX_H
+#define __HAL_USB_EX_H
+
+#include "stm32f7xx_hal.h"
+
+#endif // __HAL_USB_EX_H
@@ -0,0 +1,38 @@
+/**
+  ******************************************************************************
+  * @file    stm32f769i_discovery_audio_ex.h
+  * @brief   Host stand-in for the BSP audio output, implemented by the virtual
+  *          codec in sim_hal.c.
+  ******************************************************************************
+  */
+
+#ifndef __STM32F769I_DISCOVERY_AUDIO_EX_H
+#define __STM32F769I_DISCOVERY_AUDIO_EX_H
+
+#include "stm32f7xx_hal.h"
+
+#define OUTPUT_DEVICE_AUTO  ((uint16_t)0x0004)
+#define CODEC_PDWN_SW       2
+
+#define AUDIO_OK            ((uint8_t)0)
+#define AUDIO_ERROR         ((uint8_t)1)
+
+#define AUDIO_MUTE_ON       1
+#define AUDIO_MUTE_OFF      0
+
+extern SAI_HandleTypeDef haudio_out_sai;
+
+uint8_t BSP_AUDIO_OUT_Init_Ext(uint16_t OutputDevice, uint8_t Volume, uint32_t AudioFreq, uint8_t AudioResolution);
+void    BSP_AUDIO_OUT_DeInit(void);
+uint8_t BSP_AUDIO_OUT_Play(uint16_t* pBuffer, uint32_t Size);
+void    BSP_AUDIO_OUT_ChangeBuffer(uint16_t *pData, uint16_t Size);
+uint8_t BSP_AUDIO_OUT_Stop(uint32_t Option);
+uint8_t BSP_AUDIO_OUT_SetVolume(uint8_t Volume);
+void    BSP_AUDIO_OUT_SetFrequency(uint32_t AudioFreq);
+uint8_t BSP_AUDIO_OUT_SetMute(uint32_t Cmd);
+
+void    BSP_AUDIO_OUT_TransferComplete_CallBack(void);
+void    BSP_AUDIO_OUT_HalfTransfer_CallBack(void);
+void    BSP_AUDIO_OUT_Error_CallBack(void);
+
+#endif // __STM32F769I_DISCOVERY_AUDIO_EX_H
@@ -0,0 +1,25 @@
+/**
+  ******************************************************************************
+  * @file    stm32f769i_discovery_lcd.h
+  * @brief   Host stand-in, only the types user_lcd.h needs.
+  ******************************************************************************
+  */
+
+#ifndef __STM32F769I_DISCOVERY_LCD_H
+#define __STM32F769I_DISCOVERY_LCD_H
+
+#include "stm32f7xx_hal.h"
+
+#define LCD_FB_START_ADDRESS ((uint32_t)0xC0000000)
+
+// named by the lcd_compositor.h prototypes only
+typedef struct _tFont sFONT;
+
+typedef enum
+{
+  CENTER_MODE = 0x01,
+  RIGHT_MODE  = 0x02,
+  LEFT_MODE   = 0x03
+} Text_AlignModeTypdef;
+
+#endif // __STM32F769I_DISCOVERY_LCD_H
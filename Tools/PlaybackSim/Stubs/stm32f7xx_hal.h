@@ -0,0 +1,59 @@
+/**
+  ******************************************************************************
+  * @file    stm32f7xx_hal.h
+  * @brief   Host stand-in for the STM32 HAL, only what the streaming and DSP
+  *          modules touch. The DMA counter and DWT reads are routed to the
+  *          simulated codec and host clock (sim_hal.c).
+  ******************************************************************************
+  */
+
+// define to prevent recursive inclusion ---------------------------------------
+#ifndef __STM32F7xx_HAL_H
+#define __STM32F7xx_HAL_H
+
+// includes --------------------------------------------------------------------
+#include <assert.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+// defines ---------------------------------------------------------------------
+#define __IO    volatile
+#define __DMB() __sync_synchronize()
+// USE_FULL_ASSERT on the host: a broken invariant stops the tool
+#define assert_param(expr) assert(expr)
+// the host runs one thread, nothing to mask
+#define __disable_irq()
+#define __enable_irq()
+
+#define __HAL_DMA_GET_COUNTER(handle) SimHal_GetDmaCounter(handle)
+#define DWT                           SimHal_Dwt()
+
+// typedefs --------------------------------------------------------------------
+typedef struct { uint32_t instance; } UART_HandleTypeDef;
+typedef struct { uint32_t instance; } TIM_HandleTypeDef;
+typedef struct { uint32_t instance; } DFSDM_Filter_HandleTypeDef;
+typedef struct { uint32_t instance; } DMA_HandleTypeDef;
+
+typedef struct
+{
+  DMA_HandleTypeDef* hdmatx;
+  uint16_t           XferSize;  // length of the running transfer, in half words
+} SAI_HandleTypeDef;
+
+typedef struct
+{
+  volatile uint32_t CYCCNT;
+} SimHal_DwtTypeDef;
+
+// variables -------------------------------------------------------------------
+extern uint32_t SystemCoreClock;
+
+// function prototypes ---------------------------------------------------------
+uint32_t           HAL_GetTick(void);
+uint32_t           SimHal_GetDmaCounter(DMA_HandleTypeDef* handle);
+SimHal_DwtTypeDef* SimHal_Dwt(void);
+
+#endif // __STM32F7xx_HAL_H
@@ -0,0 +1,497 @@
+/**
+  ******************************************************************************
+  * @file    playback_sim.c
+  * @brief   Host simulation of the USB playback pipeline. Runs the firmware
+  *          USB input node, playback session, speaker node and EQ unchanged,
+  *          driven by a virtual USB host (SOF every 1 ms, one isochronous packet
+  *          per frame sized from the feedback endpoint, arrival jitter) and a
+  *          virtual codec draining the SAI DMA at a ppm offset from the SOF
+  *          clock. Reports latency, overruns/underruns, feedback behaviour and
+  *          the host cost of the DSP per packet.
+  *
+  *          The streaming code passes node and session pointers as uint32_t,
+  *          so every handle must live below 4 GB: build 32-bit (-m32) or, on a
+  *          64-bit host, non-PIE (static objects and the small heap stay low).
+  *
+  *          build (from Tools, the sources are listed in its Makefile):
+  *            make build/playback_sim
+  *
+  *          another ring size:
+  *            make -B build/playback_sim CFLAGS="-O2 -DUSB_AUDIO_CONFIG_PLAY_BUFFER_SIZE=<bytes>"
+  *
+  *          usage:
+  *            ./playback_sim [-t seconds] [-c codec_ppm] [-j jitter_us] [-r host_rate_hz]
+  *                           [-n] [-g gain_db] [-w warmup_s] [-o trace.csv] [-i trace_ms]
+  *                           [-x] [-s seed] [-v] [-q]
+  ******************************************************************************
+  */
+
+#include "sim_hal.h"
+#include "stm32f769i_discovery_audio_ex.h"
+#include "usb_audio.h"
+#include "audio_sessions_usb.h"
+#include "audio_user_dsp.h"
+#include <math.h>
+#include <stdio.h>
+#include <time.h>
+#include <unistd.h>
+
+// private defines -------------------------------------------------------------
+#define SOF_PERIOD_S          0.001
+#define FEEDBACK_PERIOD_MS    (1u << USB_AUDIO_CONFIG_PLAY_FEEDBACK_REFRESH)
+#define BYTES_PER_FRAME       (USB_AUDIO_CONFIG_PLAY_CHANNEL_COUNT * USB_AUDIO_CONFIG_PLAY_RES_BYTE)
+#define TEST_TONE_HZ          997.0
+#define TEST_TONE_AMPLITUDE   16384.0
+
+// private typedefs ------------------------------------------------------------
+typedef struct Options
+{
+  double      duration;     // simulated seconds
+  double      codecPpm;     // codec clock offset from the SOF clock
+  double      jitterUs;     // max delay of a packet after its SOF
+  uint32_t    hostRate;     // rate the host sends at until it reads the feedback
+  bool        feedback;     // host follows the feedback endpoint
+  int16_t     gain;         // EQ gain of every band (dB)
+  double      warmup;       // seconds ignored by the statistics
+  const char* tracePath;
+  uint32_t    traceMs;
+  uint32_t    seed;
+  bool        bypassDsp;    // skip the EQ to simulate long runs faster
+  bool        quiet;
+} Options;
+
+typedef struct VirtualHost
+{
+  double   samplesPerFrame; // current rate, from the last feedback read
+  double   accumulator;     // fractional samples carried to the next frame
+  uint64_t frames;          // samples sent, for the test tone phase
+  bool     packetPending;
+  double   packetTime;
+  uint16_t packetLength;
+  double   lastArrival;
+  uint8_t  packet[USBD_AUDIO_CONFIG_PLAY_MAX_PACKET_SIZE];
+} VirtualHost;
+
+typedef struct Statistics
+{
+  double   latencyMin, latencyMax, latencySum;
+  uint32_t latencyCount;
+  uint32_t feedbackMin, feedbackMax;
+  uint32_t fillMin, fillMax;
+  uint32_t fillAfterWarmup;
+  double   estimateTime;    // first time the session knew the codec frequency
+  uint32_t overrunsAtWarmup, underrunsAtWarmup;
+  uint64_t packets;
+  uint64_t bytes;
+} Statistics;
+
+// external variables ----------------------------------------------------------
+extern int16_t frequencies[];
+extern int16_t bandwidths[];
+
+// private variables -----------------------------------------------------------
+static AUDIO_USBSession_t             playbackSession;
+static USBD_AUDIO_AS_InterfaceTypeDef streamingInterface;
+static USBD_AUDIO_ControlTypeDef      controls[USBD_AUDIO_MAX_AS_INTERFACE];
+static VirtualHost                    host;
+static Statistics                     statistics;
+static bool                           bypassDsp = false;
+
+// private function declarations -----------------------------------------------
+static void     PlaybackSim_PrintUsage(const char* program);
+static bool     PlaybackSim_ParseOptions(int argc, char** argv, Options* options);
+static double   PlaybackSim_Random(void);
+static void     PlaybackSim_ReadFeedback(void);
+static void     PlaybackSim_SchedulePacket(const Options* options, double sofTime);
+static void     PlaybackSim_DeliverPacket(uint8_t** rxBuffer);
+static void     PlaybackSim_CompleteTransfer(void);
+static uint32_t PlaybackSim_QueuedBytes(void);
+static void     PlaybackSim_Sample(const Options* options, FILE* trace, uint64_t sofIndex);
+static void     PlaybackSim_PrintSummary(const Options* options, double hostSeconds);
+
+void __real_AudioUserDsp_ProcessPacket(uint8_t* dataPointer, uint32_t dataLength);
+
+int main(int argc, char** argv)
+{
+  Options options = { 3600, 30, 100, USB_AUDIO_CONFIG_PLAY_DEF_FREQ, true, 0, 2, NULL, 100, 1, false, false };
+  uint8_t controlCount = 0;
+  FILE* trace = NULL;
+
+  if(!PlaybackSim_ParseOptions(argc, argv, &options))
+  {
+    PlaybackSim_PrintUsage(argv[0]);
+    return 1;
+  }
+
+  if((uintptr_t)&playbackSession > UINT32_MAX)
+  {
+    fprintf(stderr, "session handles do not fit in 32 bits, build with -m32 or -no-pie\n");
+    return 1;
+  }
+
+  if(options.tracePath)
+  {
+    trace = fopen(options.tracePath, "w");
+    if(!trace)
+    {
+      perror(options.tracePath);
+      return 1;
+    }
+    fprintf(trace, "time_s,fill_bytes,latency_ms,feedback_hz,codec_estimate_hz,host_samples_per_frame,overruns,underruns\n");
+  }
+
+  srand(options.seed);
+  simCodecPpm = options.codecPpm;
+  bypassDsp = options.bypassDsp;
+
+  for(int i = 0; i < NUMBER_OF_BANDS; i++)
+    AudioUserDsp_BiquadFilterConfig(&biquadFilters[i], options.gain, frequencies[i], bandwidths[i]);
+
+  // enumeration: the class builds the session, then the host selects the streaming alternate
+  AUDIO_PlaybackSessionInit(&streamingInterface, controls, &controlCount, (uint32_t)&playbackSession);
+  streamingInterface.SetAS_Alternate(1, streamingInterface.private_data);
+
+  USBD_AUDIO_EP_DataTypeDef* dataEp = &streamingInterface.data_ep;
+  uint16_t maxLength;
+  uint8_t* rxBuffer = dataEp->GetBuffer(dataEp->private_data, &maxLength);
+
+  host.samplesPerFrame = options.hostRate / 1000.0;
+  statistics.latencyMin = INFINITY;
+  statistics.feedbackMin = UINT32_MAX;
+  statistics.fillMin = UINT32_MAX;
+  statistics.estimateTime = -1;
+
+  struct timespec wallStart, wallEnd;
+  clock_gettime(CLOCK_MONOTONIC, &wallStart);
+
+  uint64_t sofIndex = 0;
+  uint32_t overruns = 0, underruns = 0;
+  for(;;)
+  {
+    double sofTime = sofIndex * SOF_PERIOD_S;
+    double dmaTime = SimHal_CodecCompletionTime();
+    double packetTime = host.packetPending ? host.packetTime : INFINITY;
+
+    if(dmaTime < 0)
+      dmaTime = INFINITY;
+
+    // the DMA interrupt wins ties, as it has the highest priority on the board
+    if(dmaTime <= sofTime && dmaTime <= packetTime)
+    {
+      simTime = dmaTime;
+      PlaybackSim_CompleteTransfer();
+    }
+    else if(sofTime <= packetTime)
+    {
+      if(sofTime >= options.duration)
+        break;
+
+      simTime = sofTime;
+      if(options.feedback && sofIndex % FEEDBACK_PERIOD_MS == 0)
+        PlaybackSim_ReadFeedback();
+      streamingInterface.SofReceived(streamingInterface.private_data);
+      PlaybackSim_SchedulePacket(&options, sofTime);
+      PlaybackSim_Sample(&options, trace, sofIndex);
+      sofIndex++;
+    }
+    else
+    {
+      simTime = packetTime;
+      PlaybackSim_DeliverPacket(&rxBuffer);
+    }
+
+    if(!options.quiet && (simStats.overruns != overruns || simStats.underruns != underruns))
+    {
+      printf("[%10.3f s] %s, buffer %u bytes\n", simTime, (simStats.overruns != overruns) ? "overrun" : "underrun",
+             AUDIO_BUFFER_FILLED_SIZE(&playbackSession.buffer));
+      overruns = simStats.overruns;
+      underruns = simStats.underruns;
+    }
+  }
+
+  clock_gettime(CLOCK_MONOTONIC, &wallEnd);
+  double hostSeconds = (wallEnd.tv_sec - wallStart.tv_sec) + (wallEnd.tv_nsec - wallStart.tv_nsec) * 1e-9;
+
+  if(trace)
+    fclose(trace);
+
+  PlaybackSim_PrintSummary(&options, hostSeconds);
+
+  return (simStats.overruns != statistics.overrunsAtWarmup || simStats.underruns != statistics.underrunsAtWarmup) ? 3 : 0;
+}
+
+/**
+ * @brief  Prints the command line help.
+ * @param  program: argv[0]
+ * @retval None
+ */
+static void PlaybackSim_PrintUsage(const char* program)
+{
+  fprintf(stderr,
+    "usage: %s [options]\n"
+    "  -t seconds   simulated time (default 3600)\n"
+    "  -c ppm       codec clock offset from the USB SOF clock (default 30)\n"
+    "  -j us        max arrival delay of a packet after its SOF, < 1000 (default 100)\n"
+    "  -r hz        host sample rate before the first feedback read (default %d)\n"
+    "  -n           host ignores the feedback endpoint\n"
+    "  -g db        EQ gain of every band (default 0)\n"
+    "  -w seconds   warm-up excluded from the statistics (default 2)\n"
+    "  -o file      CSV trace of the buffer state\n"
+    "  -i ms        trace period (default 100)\n"
+    "  -x           bypass the EQ (timing only, much faster)\n"
+    "  -s seed      jitter random seed (default 1)\n"
+    "  -v           print the firmware log messages\n"
+    "  -q           only print the summary\n"
+    "exit status is 3 when an overrun or underrun happens after the warm-up\n",
+    program, USB_AUDIO_CONFIG_PLAY_DEF_FREQ);
+}
+
+/**
+ * @brief  Reads the command line.
+ * @param  argc, argv: from main
+ * @param  options: filled with the parsed values
+ * @retval false on invalid arguments
+ */
+static bool PlaybackSim_ParseOptions(int argc, char** argv, Options* options)
+{
+  int option;
+
+  while((option = getopt(argc, argv, "t:c:j:r:ng:w:o:i:xs:vqh")) != -1)
+  {
+    switch(option)
+    {
+      case 't': options->duration = atof(optarg); break;
+      case 'c': options->codecPpm = atof(optarg); break;
+      case 'j': options->jitterUs = atof(optarg); break;
+      case 'r': options->hostRate = (uint32_t)strtoul(optarg, NULL, 10); break;
+      case 'n': options->feedback = false; break;
+      case 'g': options->gain = (int16_t)atoi(optarg); break;
+      case 'w': options->warmup = atof(optarg); break;
+      case 'o': options->tracePath = optarg; break;
+      case 'i': options->traceMs = (uint32_t)strtoul(optarg, NULL, 10); break;
+      case 'x': options->bypassDsp = true; break;
+      case 's': options->seed = (uint32_t)strtoul(optarg, NULL, 10); break;
+      case 'v': simVerbose = true; break;
+      case 'q': options->quiet = true; break;
+      default:  return false;
+    }
+  }
+
+  return options->duration > 0 && options->jitterUs >= 0 && options->jitterUs < 1000
+      && options->hostRate > 0 && options->traceMs > 0;
+}
+
+/**
+ * @brief  Uniform random number.
+ * @param  None
+ * @retval value in [0, 1)
+ */
+static double PlaybackSim_Random(void)
+{
+  return rand() / ((double)RAND_MAX + 1.0);
+}
+
+/**
+ * @brief  Called by the input node instead of the EQ (linked with --wrap), so
+ *         the filters can be skipped without touching the firmware sources.
+ * @param  see AudioUserDsp_ProcessPacket
+ * @retval None
+ */
+void __wrap_AudioUserDsp_ProcessPacket(uint8_t* dataPointer, uint32_t dataLength)
+{
+  if(!bypassDsp)
+    __real_AudioUserDsp_ProcessPacket(dataPointer, dataLength);
+}
+
+/**
+ * @brief  Reads the feedback endpoint the way the class encodes it (10.14
+ *         samples per frame on full speed) and adopts it as the host rate.
+ * @param  None
+ * @retval None
+ */
+static void PlaybackSim_ReadFeedback(void)
+{
+  uint32_t rate = streamingInterface.synch_ep.GetFeedback(streamingInterface.synch_ep.private_data);
+  uint32_t feedback = (((rate << 13) + 62) / 125) >> 2;
+
+  host.samplesPerFrame = feedback / 16384.0;
+
+  if(simTime >= 0 && rate)
+  {
+    if(rate < statistics.feedbackMin)
+      statistics.feedbackMin = rate;
+    if(rate > statistics.feedbackMax)
+      statistics.feedbackMax = rate;
+  }
+}
+
+/**
+ * @brief  Builds the packet of the frame that starts at sofTime.
+ * @param  options: simulation options
+ * @param  sofTime: start of the frame
+ * @retval None
+ */
+static void PlaybackSim_SchedulePacket(const Options* options, double sofTime)
+{
+  host.accumulator += host.samplesPerFrame;
+  uint32_t frames = (uint32_t)host.accumulator;
+  host.accumulator -= frames;
+
+  if(frames * BYTES_PER_FRAME > sizeof(host.packet))
+    frames = sizeof(host.packet) / BYTES_PER_FRAME;
+
+  int16_t* samples = (int16_t*)host.packet;
+  for(uint32_t i = 0; i < frames; i++, host.frames++)
+  {
+    double phase = 2.0 * M_PI * TEST_TONE_HZ * (double)host.frames / USB_AUDIO_CONFIG_PLAY_DEF_FREQ;
+    int16_t value = (int16_t)(TEST_TONE_AMPLITUDE * sin(phase));
+    samples[2 * i] = value;
+    samples[2 * i + 1] = value;
+  }
+
+  // packets stay in order, each one lands within its own frame
+  double arrival = sofTime + PlaybackSim_Random() * options->jitterUs * 1e-6;
+  if(arrival < host.lastArrival)
+    arrival = host.lastArrival;
+
+  host.packetLength = frames * BYTES_PER_FRAME;
+  host.packetTime = arrival;
+  host.lastArrival = arrival;
+  host.packetPending = true;
+}
+
+/**
+ * @brief  Hands the pending packet to the input node, as USBD_AUDIO_DataOut does.
+ * @param  rxBuffer: buffer given by the last GetBuffer call, updated
+ * @retval None
+ */
+static void PlaybackSim_DeliverPacket(uint8_t** rxBuffer)
+{
+  USBD_AUDIO_EP_DataTypeDef* dataEp = &streamingInterface.data_ep;
+  uint16_t maxLength;
+
+  memcpy(*rxBuffer, host.packet, host.packetLength);
+  dataEp->DataReceived(host.packetLength, dataEp->private_data);
+  *rxBuffer = dataEp->GetBuffer(dataEp->private_data, &maxLength);
+  host.packetPending = false;
+
+  statistics.packets++;
+  statistics.bytes += host.packetLength;
+  if(simTime >= 0)
+  {
+    simStats.dspNsTotal += dspPacketCycles;
+    simStats.dspPackets++;
+    if(dspPacketCycles > simStats.dspNsMax)
+      simStats.dspNsMax = dspPacketCycles;
+  }
+}
+
+/**
+ * @brief  Raises the SAI DMA transfer complete interrupt.
+ * @param  None
+ * @retval None
+ */
+static void PlaybackSim_CompleteTransfer(void)
+{
+  double completion = SimHal_CodecCompletionTime();
+
+  BSP_AUDIO_OUT_TransferComplete_CallBack();
+
+  // the speaker did not queue anything: the DMA stops
+  if(SimHal_CodecCompletionTime() == completion)
+    simCodec.running = false;
+}
+
+/**
+ * @brief  Audio written by USB but not played yet.
+ * @param  None
+ * @retval bytes
+ */
+static uint32_t PlaybackSim_QueuedBytes(void)
+{
+  return AUDIO_BUFFER_FILLED_SIZE(&playbackSession.buffer) + SimHal_CodecPendingHalfWords() * USB_AUDIO_CONFIG_PLAY_RES_BYTE;
+}
+
+/**
+ * @brief  Updates the statistics and the trace once per SOF.
+ * @param  options: simulation options
+ * @param  trace: CSV file or NULL
+ * @param  sofIndex: frame number
+ * @retval None
+ */
+static void PlaybackSim_Sample(const Options* options, FILE* trace, uint64_t sofIndex)
+{
+  uint32_t fill = AUDIO_BUFFER_FILLED_SIZE(&playbackSession.buffer);
+  double latency = 1000.0 * PlaybackSim_QueuedBytes() / (BYTES_PER_FRAME * simCodec.frameRate);
+
+  if(statistics.estimateTime < 0 && simStats.lastEstimatedFrequency)
+    statistics.estimateTime = simTime;
+
+  if(simTime < options->warmup)
+  {
+    statistics.overrunsAtWarmup = simStats.overruns;
+    statistics.underrunsAtWarmup = simStats.underruns;
+    statistics.fillAfterWarmup = fill;
+  }
+  else
+  {
+    if(latency < statistics.latencyMin)
+      statistics.latencyMin = latency;
+    if(latency > statistics.latencyMax)
+      statistics.latencyMax = latency;
+    statistics.latencySum += latency;
+    statistics.latencyCount++;
+    if(fill < statistics.fillMin)
+      statistics.fillMin = fill;
+    if(fill > statistics.fillMax)
+      statistics.fillMax = fill;
+  }
+
+  if(trace && sofIndex % options->traceMs == 0)
+  {
+    fprintf(trace, "%.3f,%u,%.3f,%u,%u,%.5f,%u,%u\n", simTime, fill, latency, simStats.lastFeedback,
+            simStats.lastEstimatedFrequency, host.samplesPerFrame, simStats.overruns, simStats.underruns);
+  }
+}
+
+/**
+ * @brief  Prints the run summary.
+ * @param  options: simulation options
+ * @param  hostSeconds: wall clock time of the run
+ * @retval None
+ */
+static void PlaybackSim_PrintSummary(const Options* options, double hostSeconds)
+{
+  uint32_t fillEnd = AUDIO_BUFFER_FILLED_SIZE(&playbackSession.buffer);
+
+  printf("simulated %.1f s in %.2f s (%.0fx real time)\n", options->duration, hostSeconds, options->duration / hostSeconds);
+  printf("codec %+.1f ppm, jitter %.0f us, feedback %s, ring %u bytes, EQ gain %d dB\n",
+         options->codecPpm, options->jitterUs, options->feedback ? "on" : "off",
+         playbackSession.buffer.size, options->gain);
+  printf("packets %llu, %llu bytes, codec transfers %u\n",
+         (unsigned long long)statistics.packets, (unsigned long long)statistics.bytes, simCodec.transfers);
+  printf("overruns %u, underruns %u (%u / %u after the %.1f s warm-up)\n",
+         simStats.overruns, simStats.underruns,
+         simStats.overruns - statistics.overrunsAtWarmup, simStats.underruns - statistics.underrunsAtWarmup, options->warmup);
+
+  if(statistics.latencyCount)
+  {
+    printf("latency ms: min %.3f, avg %.3f, max %.3f\n", statistics.latencyMin,
+           statistics.latencySum / statistics.latencyCount, statistics.latencyMax);
+    printf("ring fill bytes: min %u, max %u, drift %+d since the warm-up\n", statistics.fillMin, statistics.fillMax,
+           (int)fillEnd - (int)statistics.fillAfterWarmup);
+  }
+
+  if(statistics.feedbackMax)
+    printf("feedback Hz: min %u, max %u, last %u\n", statistics.feedbackMin, statistics.feedbackMax, simStats.lastFeedback);
+  if(statistics.estimateTime >= 0)
+    printf("codec estimate %u Hz (true %.2f Hz), first known at %.3f s\n", simStats.lastEstimatedFrequency,
+           simCodec.frameRate, statistics.estimateTime);
+  else
+    printf("codec estimate never available\n");
+
+  if(simStats.dspPackets && !options->bypassDsp)
+    printf("DSP host ns/packet: avg %.0f, max %u (%.2f%% of a 1 ms frame on this host)\n",
+           (double)simStats.dspNsTotal / simStats.dspPackets, simStats.dspNsMax,
+           (double)simStats.dspNsTotal / simStats.dspPackets / 1e4);
+}
@@ -0,0 +1,247 @@
+/**
+  ******************************************************************************
+  * @file    sim_hal.c
+  * @brief   Host implementation of the HAL, BSP and application services used
+  *          by Application/Streaming and Application/DSP. The codec drains its
+  *          DMA buffer at a fixed frame rate in simulated time, so the speaker
+  *          node sees the same transfer complete callbacks and DMA counters as
+  *          on the board.
+  ******************************************************************************
+  */
+
+#include "sim_hal.h"
+#include "stm32f769i_discovery_audio_ex.h"
+#include "user_lcd.h"
+#include "logger.h"
+#include "telemetry.h"
+#include "boot_time.h"
+#include "flash_persistence.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <time.h>
+
+// variables -------------------------------------------------------------------
+double      simTime = 0;
+SimHalCodec simCodec;
+SimHalStats simStats;
+bool        simVerbose = false;
+double      simCodecPpm = 0;
+
+uint32_t SystemCoreClock = 200000000;
+
+SAI_HandleTypeDef  haudio_out_sai;
+UART_HandleTypeDef UART1_Handle;
+
+// normally owned by main.c and user_lcd.c, the simulation never touches the UI
+float in_z1  = 0;
+float in_z2  = 0;
+float out_z1 = 0;
+float out_z2 = 0;
+CircleButtonTypeDef circleButtons[NUMBER_OF_CIRCLE_BUTTONS];
+SliderKnob          sliderKnobs[NUMBER_OF_SLIDER_BUTTONS];
+
+// private variables -----------------------------------------------------------
+static DMA_HandleTypeDef saiDma;
+static SimHal_DwtTypeDef dwt;
+
+// private function declarations -----------------------------------------------
+static void SimHal_StartTransfer(uint16_t* data, uint32_t halfWords);
+
+/**
+ * @brief  HAL tick, derived from the simulated time.
+ * @param  None
+ * @retval milliseconds since the start of the simulation
+ */
+uint32_t HAL_GetTick(void)
+{
+  return (uint32_t)(simTime * 1000.0);
+}
+
+/**
+ * @brief  Cycle counter stand-in: counts host nanoseconds, so the DSP cost
+ *         measured by the input node is the host cost of the real filter code.
+ * @param  None
+ * @retval DWT registers
+ */
+SimHal_DwtTypeDef* SimHal_Dwt(void)
+{
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  dwt.CYCCNT = (uint32_t)((uint64_t)now.tv_sec * 1000000000ull + now.tv_nsec);
+  return &dwt;
+}
+
+/**
+ * @brief  Half words left in the running SAI transfer.
+ * @param  handle: DMA handle (only the SAI one exists)
+ * @retval NDTR
+ */
+uint32_t SimHal_GetDmaCounter(DMA_HandleTypeDef* handle)
+{
+  if(!simCodec.running)
+    return 0;
+
+  double played = (simTime - simCodec.startTime) * simCodec.frameRate * 2;
+  if(played >= simCodec.halfWords)
+    return 0;
+  if(played < 0)
+    return simCodec.halfWords;
+
+  return simCodec.halfWords - (uint32_t)played;
+}
+
+/**
+ * @brief  Simulated time at which the running transfer completes.
+ * @param  None
+ * @retval seconds, negative if the codec is stopped
+ */
+double SimHal_CodecCompletionTime(void)
+{
+  if(!simCodec.running)
+    return -1;
+
+  return simCodec.startTime + simCodec.halfWords / (2 * simCodec.frameRate);
+}
+
+/**
+ * @brief  Half words queued in the DMA but not played yet.
+ * @param  None
+ * @retval half words
+ */
+uint32_t SimHal_CodecPendingHalfWords(void)
+{
+  return SimHal_GetDmaCounter(&saiDma);
+}
+
+uint8_t BSP_AUDIO_OUT_Init_Ext(uint16_t OutputDevice, uint8_t Volume, uint32_t AudioFreq, uint8_t AudioResolution)
+{
+  haudio_out_sai.hdmatx = &saiDma;
+  BSP_AUDIO_OUT_SetFrequency(AudioFreq);
+  return AUDIO_OK;
+}
+
+void BSP_AUDIO_OUT_DeInit(void)
+{
+  simCodec.running = false;
+}
+
+uint8_t BSP_AUDIO_OUT_Play(uint16_t* pBuffer, uint32_t Size)
+{
+  SimHal_StartTransfer(pBuffer, Size / 2);
+  return AUDIO_OK;
+}
+
+void BSP_AUDIO_OUT_ChangeBuffer(uint16_t* pData, uint16_t Size)
+{
+  SimHal_StartTransfer(pData, Size / 2);
+}
+
+uint8_t BSP_AUDIO_OUT_Stop(uint32_t Option)
+{
+  simCodec.running = false;
+  return AUDIO_OK;
+}
+
+uint8_t BSP_AUDIO_OUT_SetVolume(uint8_t Volume)
+{
+  return AUDIO_OK;
+}
+
+void BSP_AUDIO_OUT_SetFrequency(uint32_t AudioFreq)
+{
+  simCodec.frameRate = AudioFreq * (1.0 + simCodecPpm * 1e-6);
+}
+
+uint8_t BSP_AUDIO_OUT_SetMute(uint32_t Cmd)
+{
+  return AUDIO_OK;
+}
+
+/**
+ * @brief  Arms the next transfer, as HAL_SAI_Transmit_DMA does in normal mode.
+ * @param  data: samples to play
+ * @param  halfWords: transfer length
+ * @retval None
+ */
+static void SimHal_StartTransfer(uint16_t* data, uint32_t halfWords)
+{
+  if(simCodec.running)
+    simCodec.transfers++;
+
+  simCodec.data = data;
+  simCodec.halfWords = halfWords;
+  simCodec.startTime = simTime;
+  simCodec.running = true;
+  haudio_out_sai.XferSize = halfWords;
+}
+
+void Error_Handler(void)
+{
+  fprintf(stderr, "Error_Handler() at t=%.3f s\n", simTime);
+  exit(2);
+}
+
+bool Logger_Write(const char* format, uint8_t argCount, ...)
+{
+  uint32_t args[LOGGER_MAX_ARGS] = { 0 };
+  va_list list;
+
+  va_start(list, argCount);
+  for(uint8_t i = 0; i < argCount && i < LOGGER_MAX_ARGS; i++)
+    args[i] = va_arg(list, uint32_t);
+  va_end(list);
+
+  // arguments are 32-bit values, pointers included (see the build note in playback_sim.c)
+  if(simVerbose)
+  {
+    fprintf(stderr, "[%10.3f s] ", simTime);
+    fprintf(stderr, format, (uintptr_t)args[0], (uintptr_t)args[1], (uintptr_t)args[2], (uintptr_t)args[3]);
+  }
+  return true;
+}
+
+bool Logger_RateLimitAllows(uint32_t* nextTick, uint32_t periodMs)
+{
+  uint32_t tick = HAL_GetTick();
+
+  if((int32_t)(tick - *nextTick) < 0)
+    return false;
+
+  *nextTick = tick + periodMs;
+  return true;
+}
+
+/**
+ * @brief  Collects what the session would stream over USART1.
+ * @param  sample: playback state at this SOF
+ * @retval None
+ */
+void Telemetry_PublishPlayback(const TelemetryPlaybackSample* sample)
+{
+  simStats.overruns = sample->overruns;
+  simStats.underruns = sample->underruns;
+  simStats.lastFeedback = sample->feedback;
+  simStats.lastEstimatedFrequency = sample->estimatedCodecFrequency;
+  simStats.samples++;
+}
+
+/**
+ * @brief  The startup is not simulated.
+ * @param  mark: step
+ * @retval None
+ */
+void BootTime_Mark(BootTimeMark mark)
+{
+  (void)mark;
+}
+
+/**
+ * @brief  The flash is not simulated.
+ * @param  streaming: stream open
+ * @retval None
+ */
+void FlashPersistence_SetStreaming(bool streaming)
+{
+  (void)streaming;
+}
@@ -0,0 +1,50 @@
+/**
+  ******************************************************************************
+  * @file    sim_hal.h
+  * @brief   Simulated clock, codec and firmware services used by the playback
+  *          simulation in place of the HAL, BSP and application modules.
+  ******************************************************************************
+  */
+
+// define to prevent recursive inclusion ---------------------------------------
+#ifndef __SIM_HAL_H__
+#define __SIM_HAL_H__
+
+// includes --------------------------------------------------------------------
+#include "stm32f7xx_hal.h"
+
+// typedefs --------------------------------------------------------------------
+typedef struct SimHalCodec
+{
+  double    frameRate;        // frames per second actually drawn by the codec
+  bool      running;
+  uint16_t* data;             // buffer of the running DMA transfer
+  uint32_t  halfWords;        // length of the running transfer
+  double    startTime;        // simulated time (s) the transfer started
+  uint32_t  transfers;        // completed transfers
+} SimHalCodec;
+
+typedef struct SimHalStats
+{
+  uint32_t overruns;
+  uint32_t underruns;
+  uint32_t samples;           // telemetry samples published (one per SOF)
+  uint32_t lastFeedback;
+  uint32_t lastEstimatedFrequency;
+  uint64_t dspNsTotal;
+  uint32_t dspNsMax;
+  uint32_t dspPackets;
+} SimHalStats;
+
+// variables -------------------------------------------------------------------
+extern double      simTime;
+extern double      simCodecPpm;
+extern SimHalCodec simCodec;
+extern SimHalStats simStats;
+extern bool        simVerbose;
+
+// function prototypes ---------------------------------------------------------
+double   SimHal_CodecCompletionTime(void);
+uint32_t SimHal_CodecPendingHalfWords(void);
+
+#endif // __SIM_HAL_H__
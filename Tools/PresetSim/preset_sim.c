@@ -0,0 +1,479 @@
+/**
+  ******************************************************************************
+  * @file    preset_sim.c
+  * @brief   Runs the preset store, the flash journal and FlashPersistence on
+  *          two sectors in RAM, with the firmware EQ math. Checks:
+  *          - roundtrip: named presets in every slot come back after a
+  *            reboot with their names, gains and the coefficients computed
+  *            at save, bit for bit, and the recall calls no sinh;
+  *          - migration, each followed by a reboot that must recall the
+  *            record as written back, without math:
+  *            - a save from before the presets, only the knob record, and
+  *              one cut between the knob record and the preset;
+  *            - the words of the old format at the start of the sector;
+  *            - a preset computed for other sample rates;
+  *            - a preset computed for another band layout;
+  *          - a preset from a newer version, or cut short, reads as empty
+  *            and is not overwritten.
+  *
+  *          The math is counted by wrapping sinh, which every coefficient
+  *          computation calls once per band.
+  *
+  *          build (from Tools, the sources are listed in its Makefile):
+  *            make build/preset_sim
+  *
+  *          usage:
+  *            ./preset_sim   (exit status 1 if a check fails)
+  ******************************************************************************
+  */
+
+#include "preset_store.h"
+#include "flash_journal.h"
+#include "flash_persistence.h"
+#include "logger.h"
+#include "sim_report.h"
+#include <math.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// private defines -------------------------------------------------------------
+#define SAMPLE_RATE         USB_AUDIO_CONFIG_PLAY_DEF_FREQ
+#define HEADER_SIZE         offsetof(Preset, coefficients)
+
+// variables -------------------------------------------------------------------
+
+// normally owned by main.c and user_lcd.c, slider geometry of user_lcd.c
+float in_z1  = 0;
+float in_z2  = 0;
+float out_z1 = 0;
+float out_z2 = 0;
+SliderKnob sliderKnobs[NUMBER_OF_SLIDER_BUTTONS] = {
+  { 200 + 50,  25, 60, 400, 0, 160, 20, false},
+  { 200 + 110, 25, 60, 400, 0, 160, 20, false},
+  { 200 + 170, 25, 60, 400, 0, 160, 20, false},
+  { 200 + 230, 25, 60, 400, 0, 160, 20, false},
+  { 200 + 290, 25, 60, 400, 0, 160, 20, false},
+  { 200 + 350, 25, 60, 400, 0, 160, 20, false},
+  { 200 + 410, 25, 60, 400, 0, 160, 20, false},
+  { 200 + 470, 25, 60, 400, 0, 160, 20, false}
+};
+
+// band layout, normally defined in audio_usb_nodes.c
+int16_t frequencies[] = {30, 60, 150, 400, 1000, 3000, 8000, 16000};
+int16_t bandwidths[] =  {1,   1,   2,   2,    2,    3,    3,     3};
+
+// private variables -----------------------------------------------------------
+static uint8_t  flash[FLASH_JOURNAL_SECTORS][FLASH_JOURNAL_SECTOR_SIZE];
+static uint32_t sinhCalls = 0;
+static uint32_t logs = 0;
+static uint32_t randomState = 1;
+
+// private function declarations -----------------------------------------------
+static bool     PresetSim_Roundtrip(void);
+static bool     PresetSim_KnobRecord(void);
+static bool     PresetSim_LegacyWords(void);
+static bool     PresetSim_OtherRates(void);
+static bool     PresetSim_OtherLayout(void);
+static bool     PresetSim_Unreadable(void);
+static void     PresetSim_Format(void);
+static void     PresetSim_Reboot(void);
+static void     PresetSim_Flush(void);
+static void     PresetSim_Write(uint8_t slot, const Preset* record, uint16_t length);
+static Preset*  PresetSim_Make(const int16_t* gains, uint16_t rateCount, const uint32_t* rates);
+static bool     PresetSim_IsLoaded(const int16_t* gains, uint32_t sampleRate);
+static uint32_t PresetSim_Random(void);
+
+double __real_sinh(double x);
+
+int main(void)
+{
+  bool passed = true;
+
+  passed &= PresetSim_Roundtrip();
+  passed &= PresetSim_KnobRecord();
+  passed &= PresetSim_LegacyWords();
+  passed &= PresetSim_OtherRates();
+  passed &= PresetSim_OtherLayout();
+  passed &= PresetSim_Unreadable();
+
+  printf("%s\n", passed ? "all checks passed" : "CHECK FAILED");
+  return passed ? 0 : 1;
+}
+
+/**
+ * @brief  Saves a named preset with random gains in every slot, reboots and
+ *         recalls each one.
+ * @param  None
+ * @retval true if every preset came back as saved, without math
+ */
+static bool PresetSim_Roundtrip(void)
+{
+  int16_t gains[PRESET_STORE_SLOTS][NUMBER_OF_BANDS];
+  int16_t recalled[NUMBER_OF_BANDS];
+  char name[PRESET_STORE_NAME_LENGTH + 1];
+  Preset preset;
+  bool ok = true;
+
+  PresetSim_Format();
+  for(uint8_t slot = 0; slot < PRESET_STORE_SLOTS; slot++)
+  {
+    for(uint8_t i = 0; i < NUMBER_OF_BANDS; i++)
+      gains[slot][i] = (int16_t)(PresetSim_Random() % 31) - 15;
+    snprintf(name, sizeof(name), "preset %u", slot);
+    ok &= PresetStore_Save(slot, name, gains[slot]);
+  }
+  PresetSim_Flush();
+  PresetSim_Reboot();
+
+  for(uint8_t slot = 0; slot < PRESET_STORE_SLOTS; slot++)
+  {
+    snprintf(name, sizeof(name), "preset %u", slot);
+    sinhCalls = 0;
+    ok &= PresetStore_Recall(slot, SAMPLE_RATE, recalled) == PRESET_STORE_RECALLED;
+    ok &= sinhCalls == 0 && memcmp(recalled, gains[slot], sizeof(recalled)) == 0;
+    ok &= PresetSim_IsLoaded(gains[slot], SAMPLE_RATE);
+    ok &= PresetStore_Read(slot, &preset) && strncmp(preset.name, name, PRESET_STORE_NAME_LENGTH) == 0;
+  }
+  ok &= !PresetStore_Save(PRESET_STORE_SLOTS, "", gains[0]);
+
+  return SimReport_Check("roundtrip of every slot, recall without sinh", ok);
+}
+
+/**
+ * @brief  Boots on a save made before the presets, then on one cut between
+ *         its knob record and its preset.
+ * @param  None
+ * @retval true if the working preset was computed once and then recalled
+ */
+static bool PresetSim_KnobRecord(void)
+{
+  uint16_t knobY[NUMBER_OF_BANDS] = {25, 65, 105, 185, 225, 265, 345, 425};
+  int16_t gains[NUMBER_OF_BANDS];
+  bool ok = true;
+
+  PresetSim_Format();
+  FlashJournal_Append(FLASH_PERSISTENCE_KEY_KNOBS, knobY, sizeof(knobY));
+  PresetSim_Flush();
+
+  PresetSim_Reboot();
+  FlashPersistence_Restore();
+  for(uint8_t i = 0; i < NUMBER_OF_BANDS; i++)
+  {
+    ok &= sliderKnobs[i].knobY == knobY[i];
+    gains[i] = AudioUserDsp_CalculateGain(i, &sliderKnobs[i]);
+  }
+  ok &= logs == 1 && PresetSim_IsLoaded(gains, SAMPLE_RATE);
+  PresetSim_Flush();
+
+  PresetSim_Reboot();
+  FlashPersistence_Restore();
+  ok &= logs == 0 && sinhCalls == 0 && PresetSim_IsLoaded(gains, SAMPLE_RATE);
+
+  // the knobs moved and saved, the preset lost to a power cut
+  knobY[0] = 425;
+  FlashJournal_Append(FLASH_PERSISTENCE_KEY_KNOBS, knobY, sizeof(knobY));
+  PresetSim_Flush();
+  gains[0] = -15;
+
+  PresetSim_Reboot();
+  FlashPersistence_Restore();
+  ok &= logs == 1 && PresetSim_IsLoaded(gains, SAMPLE_RATE);
+  PresetSim_Flush();
+
+  PresetSim_Reboot();
+  FlashPersistence_Restore();
+  ok &= logs == 0 && sinhCalls == 0 && PresetSim_IsLoaded(gains, SAMPLE_RATE);
+
+  return SimReport_Check("migration of a knob record, and of a save cut in two", ok);
+}
+
+/**
+ * @brief  Boots on the 8 words of the old format at the start of the first
+ *         sector, with no journal.
+ * @param  None
+ * @retval true if the knobs and the filters follow the words
+ */
+static bool PresetSim_LegacyWords(void)
+{
+  uint32_t words[NUMBER_OF_BANDS] = {425, 385, 345, 265, 225, 145, 65, 25};
+  int16_t gains[NUMBER_OF_BANDS];
+  bool ok = true;
+
+  PresetSim_Format();
+  memcpy(flash[0], words, sizeof(words));
+
+  PresetSim_Reboot();
+  FlashPersistence_Restore();
+  for(uint8_t i = 0; i < NUMBER_OF_BANDS; i++)
+  {
+    ok &= sliderKnobs[i].knobY == words[i];
+    gains[i] = AudioUserDsp_CalculateGain(i, &sliderKnobs[i]);
+  }
+  ok &= logs == 1 && PresetSim_IsLoaded(gains, SAMPLE_RATE);
+
+  // the next save goes into the journal, the words stay behind
+  FlashPersistence_Write();
+  PresetSim_Flush();
+
+  PresetSim_Reboot();
+  FlashPersistence_Restore();
+  ok &= logs == 0 && sinhCalls == 0 && PresetSim_IsLoaded(gains, SAMPLE_RATE);
+
+  return SimReport_Check("migration of the old format words", ok);
+}
+
+/**
+ * @brief  Recalls a preset saved by a build playing other sample rates.
+ * @param  None
+ * @retval true if it was recomputed for this build and written back once
+ */
+static bool PresetSim_OtherRates(void)
+{
+  const uint32_t rates[] = {USB_AUDIO_CONFIG_FREQ_44_1_K, USB_AUDIO_CONFIG_FREQ_96_K};
+  const int16_t gains[NUMBER_OF_BANDS] = {3, -6, 9, -12, 15, -15, 0, 6};
+  int16_t recalled[NUMBER_OF_BANDS];
+  Preset preset;
+  bool ok = true;
+
+  PresetSim_Format();
+  PresetSim_Write(2, PresetSim_Make(gains, 2, rates), HEADER_SIZE + 2 * sizeof(PresetCoefficients));
+
+  PresetSim_Reboot();
+  ok &= PresetStore_Recall(2, SAMPLE_RATE, recalled) == PRESET_STORE_MIGRATED;
+  ok &= memcmp(recalled, gains, sizeof(recalled)) == 0 && PresetSim_IsLoaded(gains, SAMPLE_RATE);
+  PresetSim_Flush();
+
+  PresetSim_Reboot();
+  ok &= PresetStore_Recall(2, SAMPLE_RATE, recalled) == PRESET_STORE_RECALLED;
+  ok &= sinhCalls == 0 && PresetSim_IsLoaded(gains, SAMPLE_RATE);
+  ok &= PresetStore_Read(2, &preset) && preset.rateCount == PRESET_STORE_RATES &&
+        strncmp(preset.name, "other rates", PRESET_STORE_NAME_LENGTH) == 0;
+
+  return SimReport_Check("migration of a preset for other sample rates", ok);
+}
+
+/**
+ * @brief  Recalls a preset saved when the bands had other centers.
+ * @param  None
+ * @retval true if it was recomputed for the current bands, gains kept
+ */
+static bool PresetSim_OtherLayout(void)
+{
+  const uint32_t rates[] = {SAMPLE_RATE};
+  const int16_t gains[NUMBER_OF_BANDS] = {-3, -3, 0, 0, 6, 6, 12, 12};
+  int16_t recalled[NUMBER_OF_BANDS];
+  Preset* record;
+  bool ok = true;
+
+  PresetSim_Format();
+  frequencies[7] = 12000;
+  record = PresetSim_Make(gains, 1, rates);
+  frequencies[7] = 16000;
+  PresetSim_Write(PRESET_STORE_WORKING, record, HEADER_SIZE + sizeof(PresetCoefficients));
+
+  PresetSim_Reboot();
+  ok &= PresetStore_Recall(PRESET_STORE_WORKING, SAMPLE_RATE, recalled) == PRESET_STORE_MIGRATED;
+  ok &= memcmp(recalled, gains, sizeof(recalled)) == 0 && PresetSim_IsLoaded(gains, SAMPLE_RATE);
+  ok &= biquadFilters[7].frequency == 16000;
+  PresetSim_Flush();
+
+  PresetSim_Reboot();
+  ok &= PresetStore_Recall(PRESET_STORE_WORKING, SAMPLE_RATE, recalled) == PRESET_STORE_RECALLED;
+  ok &= sinhCalls == 0 && PresetSim_IsLoaded(gains, SAMPLE_RATE);
+
+  return SimReport_Check("migration of a preset for another band layout", ok);
+}
+
+/**
+ * @brief  Recalls a preset from a newer version and one cut short.
+ * @param  None
+ * @retval true if both read as empty and stay in the journal as they are
+ */
+static bool PresetSim_Unreadable(void)
+{
+  const uint32_t rates[] = {SAMPLE_RATE};
+  const int16_t gains[NUMBER_OF_BANDS] = {1, 2, 3, 4, 5, 6, 7, 8};
+  int16_t recalled[NUMBER_OF_BANDS];
+  FlashJournalStats stats;
+  Preset* record;
+  Preset stored;
+  bool ok = true;
+
+  PresetSim_Format();
+  record = PresetSim_Make(gains, 1, rates);
+  record->version = PRESET_STORE_VERSION + 1;
+  PresetSim_Write(3, record, HEADER_SIZE + sizeof(PresetCoefficients));
+  record->version = PRESET_STORE_VERSION;
+  PresetSim_Write(4, record, HEADER_SIZE - 2);
+
+  PresetSim_Reboot();
+  ok &= PresetStore_Recall(3, SAMPLE_RATE, recalled) == PRESET_STORE_EMPTY;
+  ok &= PresetStore_Recall(4, SAMPLE_RATE, recalled) == PRESET_STORE_EMPTY;
+  ok &= !PresetStore_Read(3, &stored) && !PresetStore_Read(5, &stored);
+  FlashJournal_GetStats(&stats);
+  ok &= stats.appends == 0 && FlashJournal_IsIdle();
+  ok &= FlashJournal_Read(PRESET_STORE_FIRST_KEY + 3, &stored, sizeof(stored)) == HEADER_SIZE + sizeof(PresetCoefficients) &&
+        stored.version == PRESET_STORE_VERSION + 1;
+
+  return SimReport_Check("newer version and cut record left alone", ok);
+}
+
+// both sectors erased, the journal started on them
+static void PresetSim_Format(void)
+{
+  memset(flash, 0xFF, sizeof(flash));
+  FlashJournal_Init();
+}
+
+/**
+ * @brief  Starts over from what the flash holds, as after a power cycle:
+ *         filters unconfigured, counters cleared.
+ * @param  None
+ * @retval None
+ */
+static void PresetSim_Reboot(void)
+{
+  memset(biquadFilters, 0, sizeof(BiquadFilter) * NUMBER_OF_BANDS);
+  FlashJournal_Init();
+  sinhCalls = 0;
+  logs = 0;
+}
+
+// lets the journal write everything queued
+static void PresetSim_Flush(void)
+{
+  while(!FlashJournal_IsIdle())
+    FlashJournal_Process();
+}
+
+// a record as some other build wrote it
+static void PresetSim_Write(uint8_t slot, const Preset* record, uint16_t length)
+{
+  FlashJournal_Append(PRESET_STORE_FIRST_KEY + slot, record, length);
+  PresetSim_Flush();
+}
+
+/**
+ * @brief  Builds a record for a list of sample rates and the current band
+ *         layout, the way another build would.
+ * @param  gains: gain of each band in dB
+ * @param  rateCount: number of sets, up to 2
+ * @param  rates: their sample rates
+ * @retval the record, valid until the next call
+ */
+static Preset* PresetSim_Make(const int16_t* gains, uint16_t rateCount, const uint32_t* rates)
+{
+  // room for two sets whatever this build plays
+  static uint32_t record[(HEADER_SIZE + 2 * sizeof(PresetCoefficients) + 3) / 4];
+  Preset* header = (Preset*)record;
+  PresetCoefficients* sets = (PresetCoefficients*)((uint8_t*)record + HEADER_SIZE);
+
+  memset(record, 0, sizeof(record));
+  header->version = PRESET_STORE_VERSION;
+  header->rateCount = rateCount;
+  strncpy(header->name, rateCount > 1 ? "other rates" : "old layout", PRESET_STORE_NAME_LENGTH);
+  memcpy(header->gains, gains, sizeof(header->gains));
+  memcpy(header->frequencies, frequencies, sizeof(header->frequencies));
+  memcpy(header->bandwidths, bandwidths, sizeof(header->bandwidths));
+
+  for(uint16_t r = 0; r < rateCount; r++)
+  {
+    sets[r].sampleRate = rates[r];
+    for(uint8_t i = 0; i < NUMBER_OF_BANDS; i++)
+      AudioUserDsp_BiquadCoefficients(&sets[r].bands[i], gains[i], frequencies[i], bandwidths[i], rates[r]);
+  }
+
+  return header;
+}
+
+/**
+ * @brief  Compares the live filters with coefficients computed for the gains.
+ * @param  gains: gain of each band in dB
+ * @param  sampleRate: in Hz
+ * @retval true if every band matches bit for bit
+ */
+static bool PresetSim_IsLoaded(const int16_t* gains, uint32_t sampleRate)
+{
+  BiquadCoefficients expected;
+  uint32_t calls = sinhCalls;
+  bool ok = true;
+
+  for(uint8_t i = 0; i < NUMBER_OF_BANDS; i++)
+  {
+    AudioUserDsp_BiquadCoefficients(&expected, gains[i], frequencies[i], bandwidths[i], sampleRate);
+    ok &= memcmp(&expected, &biquadFilters[i].coefficients, sizeof(expected)) == 0;
+    ok &= biquadFilters[i].isInitialized && biquadFilters[i].gain == gains[i];
+  }
+
+  sinhCalls = calls;
+  return ok;
+}
+
+// xorshift32, the same gains on every run
+static uint32_t PresetSim_Random(void)
+{
+  randomState ^= randomState << 13;
+  randomState ^= randomState >> 17;
+  randomState ^= randomState << 5;
+  return randomState;
+}
+
+// counts the coefficient computations, one call per band
+double __wrap_sinh(double x)
+{
+  sinhCalls++;
+  return __real_sinh(x);
+}
+
+// stand-ins for user_lcd.c and logger.c --------------------------------------
+
+int16_t LCD_TranslateGainToKnobPosition(uint8_t knobIndex, int16_t gain)
+{
+  SliderKnob* knob = &sliderKnobs[knobIndex];
+  double outputMin = knob->sliderY;
+  double outputMax = knob->sliderY + knob->sliderHeight;
+
+  return outputMax + (gain + 15.0) * (outputMin - outputMax) / 30.0;
+}
+
+bool Logger_Write(const char* format, uint8_t argCount, ...)
+{
+  (void)argCount;
+  if(strstr(format, "preset") != NULL)
+    logs++;
+  return true;
+}
+
+// flash backend: RAM, each operation done when started ------------------------
+
+bool FlashJournalBackend_Init(void)
+{
+  return true;
+}
+
+const uint8_t* FlashJournalBackend_Sector(uint8_t sector)
+{
+  return flash[sector];
+}
+
+void FlashJournalBackend_StartErase(uint8_t sector)
+{
+  memset(flash[sector], 0xFF, FLASH_JOURNAL_SECTOR_SIZE);
+}
+
+void FlashJournalBackend_StartProgram(uint8_t sector, uint32_t offset, const uint32_t* words, uint32_t count)
+{
+  for(uint32_t i = 0; i < count; i++)
+    *(uint32_t*)&flash[sector][offset + 4 * i] &= words[i];
+}
+
+bool FlashJournalBackend_IsBusy(void)
+{
+  return false;
+}
+
+void FlashJournalBackend_IrqHandler(void)
+{
+}
@@ -0,0 +1,195 @@
+/**
+  ******************************************************************************
+  * @file    scheduler_sim.c
+  * @brief   Runs the firmware scheduler on a virtual clock with the task table
+  *          of main.c and reports the idle time and the release jitter of
+  *          each task. The task bodies only advance the clock by their cost.
+  *          Interrupts are the 1 ms SysTick, which wakes the sleeping core,
+  *          and the USB audio interrupt, which also steals its cost from
+  *          whatever runs. With -d the user drags a slider: every touch task
+  *          moves a knob and the LCD renders a frame each refresh.
+  *
+  *          The costs are estimates for the board at 200 MHz; change them
+  *          below to match a measurement.
+  *
+  *          build (from Tools, the sources are listed in its Makefile):
+  *            make build/scheduler_sim
+  *
+  *          usage:
+  *            ./scheduler_sim [-t seconds] [-d]
+  ******************************************************************************
+  */
+
+#include "scheduler.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+// private defines -------------------------------------------------------------
+// task periods, as in main.c
+#define TOUCH_TASK_PERIOD_MS      10
+#define WATCHDOG_TASK_PERIOD_MS   500
+#define TELEMETRY_TASK_PERIOD_MS  5
+
+// interrupts: USB audio packet every ms, after the SysTick
+#define USB_IRQ_OFFSET_US         300
+#define USB_IRQ_COST_US           90
+#define SYSTICK_COST_US           1
+
+// task costs in us
+#define LCD_IDLE_COST_US          1
+#define LCD_FRAME_COST_US         400     // queueing a drag frame, DMA2D draws it
+#define LCD_FRAME_PERIOD_US       16667
+#define LOGGER_COST_US            1
+#define TOUCH_IDLE_COST_US        2
+#define TOUCH_DRAG_COST_US        60
+#define TELEMETRY_COST_US         4       // frame encoded on average every 10 runs
+#define WATCHDOG_COST_US          10
+
+// private variables -----------------------------------------------------------
+static uint64_t clockUs = 0;
+static uint64_t lastFrameUs = 0;
+static int      dragging = 0;
+
+// private function declarations -----------------------------------------------
+static void SchedulerSim_Spend(uint32_t us);
+static void SchedulerSim_Lcd(void);
+static void SchedulerSim_Logger(void);
+static void SchedulerSim_Touch(void);
+static void SchedulerSim_Telemetry(void);
+static void SchedulerSim_Watchdog(void);
+
+int main(int argc, char** argv)
+{
+  double seconds = 10;
+  int option;
+
+  while((option = getopt(argc, argv, "t:dh")) != -1)
+  {
+    if(option == 't')
+      seconds = atof(optarg);
+    else if(option == 'd')
+      dragging = 1;
+    else
+    {
+      fprintf(stderr, "usage: %s [-t seconds] [-d]\n", argv[0]);
+      return 1;
+    }
+  }
+
+  Scheduler_Init();
+  Scheduler_AddBackground("lcd", SchedulerSim_Lcd);
+  Scheduler_AddBackground("logger", SchedulerSim_Logger);
+  Scheduler_AddPeriodic("touch", SchedulerSim_Touch, TOUCH_TASK_PERIOD_MS, 0);
+  Scheduler_AddPeriodic("telemetry", SchedulerSim_Telemetry, TELEMETRY_TASK_PERIOD_MS, 0);
+  Scheduler_AddPeriodic("watchdog", SchedulerSim_Watchdog, WATCHDOG_TASK_PERIOD_MS, 0);
+
+  uint64_t endUs = (uint64_t)(seconds * 1e6);
+  while(clockUs < endUs)
+    Scheduler_Run();
+
+  SchedulerStats stats;
+  SchedulerTaskStats task;
+
+  Scheduler_GetStats(&stats);
+  printf("%.1f s %s: idle %.1f%%, %u passes, %u sleeps\n", seconds, dragging ? "dragging" : "idle UI",
+    100.0 * stats.idleUs / stats.totalUs, stats.passes, stats.sleeps);
+  printf("%-10s %8s %12s %11s %11s %9s\n", "task", "runs", "jitter mean", "jitter max", "run max", "overruns");
+
+  for(int8_t i = 0; i < SCHEDULER_MAX_TASKS; i++)
+  {
+    if(!Scheduler_GetTaskStats(i, &task))
+      continue;
+
+    if(task.type == SCHEDULER_TASK_BACKGROUND)
+      printf("%-10s %8u %12s %11s %8u us %9s\n", task.name, task.runs, "-", "-", task.runMaxUs, "-");
+    else
+      printf("%-10s %8u %9u us %8u us %8u us %9u\n", task.name, task.runs, task.runs ? task.jitterTotalUs / task.runs : 0,
+        task.jitterMaxUs, task.runMaxUs, task.overruns);
+  }
+
+  return 0;
+}
+
+uint32_t SchedulerBackend_Now(void)
+{
+  return (uint32_t)clockUs;
+}
+
+/**
+ * @brief  Sleeps until the next SysTick or USB interrupt and runs it.
+ * @param  None
+ * @retval None
+ */
+void SchedulerBackend_Sleep(void)
+{
+  uint64_t phase = clockUs % 1000;
+
+  if(phase < USB_IRQ_OFFSET_US)
+  {
+    clockUs += USB_IRQ_OFFSET_US - phase;
+    SchedulerSim_Spend(USB_IRQ_COST_US);
+  }
+  else
+  {
+    clockUs += 1000 - phase;
+    SchedulerSim_Spend(SYSTICK_COST_US);
+  }
+}
+
+/**
+ * @brief  Advances the clock by a cost, plus the interrupts that come in the
+ *         meantime.
+ * @param  us: cost
+ * @retval None
+ */
+static void SchedulerSim_Spend(uint32_t us)
+{
+  while(us > 0)
+  {
+    uint64_t phase = clockUs % 1000;
+    uint64_t toInterrupt = (phase < USB_IRQ_OFFSET_US) ? USB_IRQ_OFFSET_US - phase : 1000 - phase;
+
+    if(us < toInterrupt)
+    {
+      clockUs += us;
+      return;
+    }
+
+    clockUs += toInterrupt;
+    us -= toInterrupt;
+    us += (phase < USB_IRQ_OFFSET_US) ? USB_IRQ_COST_US : SYSTICK_COST_US;
+  }
+}
+
+static void SchedulerSim_Lcd(void)
+{
+  if(dragging && clockUs - lastFrameUs >= LCD_FRAME_PERIOD_US)
+  {
+    lastFrameUs = clockUs;
+    SchedulerSim_Spend(LCD_FRAME_COST_US);
+    return;
+  }
+
+  SchedulerSim_Spend(LCD_IDLE_COST_US);
+}
+
+static void SchedulerSim_Logger(void)
+{
+  SchedulerSim_Spend(LOGGER_COST_US);
+}
+
+static void SchedulerSim_Touch(void)
+{
+  SchedulerSim_Spend(dragging ? TOUCH_DRAG_COST_US : TOUCH_IDLE_COST_US);
+}
+
+static void SchedulerSim_Telemetry(void)
+{
+  SchedulerSim_Spend(TELEMETRY_COST_US);
+}
+
+static void SchedulerSim_Watchdog(void)
+{
+  SchedulerSim_Spend(WATCHDOG_COST_US);
+}
@@ -0,0 +1,286 @@
+/**
+  ******************************************************************************
+  * @file    spectrum_bench.c
+  * @brief   Checks the spectrum analyzer code against a double precision DFT
+  *          and times it on the host.
+  *
+  *          - FFT: noise, a sine and an impulse through SpectrumFft_Forward,
+  *            compared bin by bin with the DFT of the same input divided by
+  *            N; the error is given in dB below full scale.
+  *          - bars: a sine, two tones and noise fed packet by packet
+  *            through Spectrum_TapWrite and Spectrum_Process, each bar
+  *            compared with the peak of the reference DFT over its bins.
+  *          - timing: median of the FFT alone and of a whole frame (copy,
+  *            window, FFT, bars).
+  *
+  *          build (from Tools, the sources are listed in its Makefile):
+  *            make build/spectrum_bench
+  *
+  *          usage:
+  *            ./spectrum_bench        (exit status 1 if a check fails)
+  ******************************************************************************
+  */
+
+#include "spectrum.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// private defines -------------------------------------------------------------
+#define SAMPLE_RATE         48000
+#define PACKET_FRAMES       48            // one USB packet, 1 ms
+#define REPETITIONS         201
+#define PI                  3.14159265358979323846
+
+// limits of the checks
+#define FFT_MAX_ERROR_DB    (-100.0)      // worst bin error relative to full scale
+#define BAR_MAX_ERROR_DB    0.1           // bars above BAR_CHECK_FLOOR_DB
+#define BAR_CHECK_FLOOR_DB  (-60.0)
+
+// private variables -----------------------------------------------------------
+static SpectrumComplex data[SPECTRUM_FFT_SIZE];
+static double          referenceRe[SPECTRUM_FFT_SIZE];
+static double          referenceIm[SPECTRUM_FFT_SIZE];
+static uint64_t        times[REPETITIONS];
+static uint32_t        xorshiftState = 0x2545F491u;
+
+// private function declarations -----------------------------------------------
+static double   SpectrumBench_CheckFft(const char* name, double (*signal)(uint32_t n));
+static double   SpectrumBench_CheckBars(const char* name, double (*signal)(uint32_t n));
+static void     SpectrumBench_Dft(const double* input);
+static double   SpectrumBench_Noise(uint32_t n);
+static double   SpectrumBench_Sine(uint32_t n);
+static double   SpectrumBench_Impulse(uint32_t n);
+static double   SpectrumBench_TwoTones(uint32_t n);
+static uint32_t SpectrumBench_Random(void);
+static uint64_t SpectrumBench_Now(void);
+static uint64_t SpectrumBench_Median(void);
+
+int main(void)
+{
+  bool passed = true;
+  double worst;
+
+  Spectrum_Init(SAMPLE_RATE);
+
+  printf("FFT %u points, %u stages, error of the worst bin vs double DFT / N:\n", SPECTRUM_FFT_SIZE, SPECTRUM_FFT_STAGES);
+  worst = SpectrumBench_CheckFft("noise", SpectrumBench_Noise);
+  worst = fmax(worst, SpectrumBench_CheckFft("sine 1 kHz", SpectrumBench_Sine));
+  worst = fmax(worst, SpectrumBench_CheckFft("impulse", SpectrumBench_Impulse));
+  passed &= worst < FFT_MAX_ERROR_DB;
+
+  printf("bars, error of the worst bar above %.0f dBFS vs peak of the double DFT:\n", BAR_CHECK_FLOOR_DB);
+  worst = SpectrumBench_CheckBars("sine 1 kHz", SpectrumBench_Sine);
+  worst = fmax(worst, SpectrumBench_CheckBars("100 Hz + 5 kHz", SpectrumBench_TwoTones));
+  worst = fmax(worst, SpectrumBench_CheckBars("noise", SpectrumBench_Noise));
+  passed &= worst < BAR_MAX_ERROR_DB;
+
+  for(uint32_t r = 0; r < REPETITIONS; r++)
+  {
+    for(uint32_t n = 0; n < SPECTRUM_FFT_SIZE; n++)
+      data[n] = (SpectrumComplex){ (int32_t)(SpectrumBench_Noise(n) * 0x40000000), 0 };
+
+    uint64_t start = SpectrumBench_Now();
+    SpectrumFft_Forward(data);
+    times[r] = SpectrumBench_Now() - start;
+  }
+  printf("timing: FFT %.2f us", SpectrumBench_Median() / 1e3);
+
+  uint8_t packet[PACKET_FRAMES * SPECTRUM_TAP_FRAME_SIZE] = {0};
+  Spectrum_SetEnabled(true);
+  for(uint32_t r = 0; r < REPETITIONS; r++)
+  {
+    // a new packet each time so the frame is never idle
+    Spectrum_TapWrite(packet, sizeof(packet));
+
+    uint64_t start = SpectrumBench_Now();
+    Spectrum_Process();
+    times[r] = SpectrumBench_Now() - start;
+  }
+  Spectrum_SetEnabled(false);
+  printf(", frame %.2f us (median of %u)\n", SpectrumBench_Median() / 1e3, REPETITIONS);
+
+  printf("%s\n", passed ? "all checks passed" : "CHECK FAILED");
+  return passed ? 0 : 1;
+}
+
+/**
+ * @brief  Transforms one signal with the FFT and with the reference.
+ * @param  name: label
+ * @param  signal: samples in -1..1
+ * @retval worst bin error in dB relative to full scale
+ */
+static double SpectrumBench_CheckFft(const char* name, double (*signal)(uint32_t n))
+{
+  static double input[SPECTRUM_FFT_SIZE];
+  double worst = 0;
+
+  for(uint32_t n = 0; n < SPECTRUM_FFT_SIZE; n++)
+  {
+    data[n].re = (int32_t)lround(signal(n) * 2147483647.0);
+    data[n].im = 0;
+    input[n] = data[n].re / 2147483648.0;
+  }
+
+  SpectrumFft_Forward(data);
+  SpectrumBench_Dft(input);
+
+  for(uint32_t k = 0; k < SPECTRUM_FFT_SIZE; k++)
+  {
+    double errorRe = data[k].re / 2147483648.0 - referenceRe[k] / SPECTRUM_FFT_SIZE;
+    double errorIm = data[k].im / 2147483648.0 - referenceIm[k] / SPECTRUM_FFT_SIZE;
+    worst = fmax(worst, sqrt(errorRe * errorRe + errorIm * errorIm));
+  }
+
+  worst = 20.0 * log10(fmax(worst, 1e-20));
+  printf("  %-16s %7.1f dB\n", name, worst);
+  return worst;
+}
+
+/**
+ * @brief  Feeds a signal through the tap as stereo packets, runs one frame
+ *         from cleared bars and compares the bars with the reference.
+ * @param  name: label
+ * @param  signal: samples in -1..1
+ * @retval worst bar error in dB
+ */
+static double SpectrumBench_CheckBars(const char* name, double (*signal)(uint32_t n))
+{
+  static double input[SPECTRUM_FFT_SIZE];
+  uint8_t packet[PACKET_FRAMES * SPECTRUM_TAP_FRAME_SIZE];
+  // whole packets, at least a transform of history before the last one
+  uint32_t total = (2 * SPECTRUM_FFT_SIZE + PACKET_FRAMES - 1) / PACKET_FRAMES * PACKET_FRAMES;
+  double worst = 0;
+  int16_t sample = 0;
+
+  Spectrum_Init(SAMPLE_RATE);
+  Spectrum_SetEnabled(true);
+
+  for(uint32_t n = 0; n < total; n++)
+  {
+    sample = (int16_t)lround(signal(n) * 32767.0);
+    uint32_t offset = (n % PACKET_FRAMES) * SPECTRUM_TAP_FRAME_SIZE;
+    packet[offset] = packet[offset + 2] = (uint16_t)sample & 0xFF;
+    packet[offset + 1] = packet[offset + 3] = (uint16_t)sample >> 8;
+
+    if(n % PACKET_FRAMES == PACKET_FRAMES - 1)
+      Spectrum_TapWrite(packet, sizeof(packet));
+
+    // the last FFT worth, windowed like the analyzer does
+    if(n >= total - SPECTRUM_FFT_SIZE)
+    {
+      uint32_t i = n - (total - SPECTRUM_FFT_SIZE);
+      input[i] = sample / 32768.0 * (0.5 - 0.5 * cos(2.0 * PI * i / SPECTRUM_FFT_SIZE));
+    }
+  }
+
+  Spectrum_Process();
+  Spectrum_SetEnabled(false);
+  SpectrumBench_Dft(input);
+
+  const float* bars = Spectrum_Bars();
+  double binsPerHz = (double)SPECTRUM_FFT_SIZE / SAMPLE_RATE;
+  double ratio = SPECTRUM_MAX_FREQUENCY / SPECTRUM_MIN_FREQUENCY;
+
+  printf("  %-16s", name);
+  for(uint8_t b = 0; b < SPECTRUM_BARS; b++)
+  {
+    long first = lround(SPECTRUM_MIN_FREQUENCY * pow(ratio, (double)b / SPECTRUM_BARS) * binsPerHz);
+    long end = lround(SPECTRUM_MIN_FREQUENCY * pow(ratio, (double)(b + 1) / SPECTRUM_BARS) * binsPerHz);
+    double peak = 0;
+
+    first = (first < 1) ? 1 : first;
+    end = (end <= first) ? first + 1 : end;
+    for(long k = first; k < end && k <= SPECTRUM_FFT_SIZE / 2; k++)
+      peak = fmax(peak, referenceRe[k] * referenceRe[k] + referenceIm[k] * referenceIm[k]);
+
+    // full scale sine: amplitude N / 4 after the window
+    double level = 10.0 * log10(fmax(peak, 1e-30) / (SPECTRUM_FFT_SIZE / 4.0 * SPECTRUM_FFT_SIZE / 4.0));
+    level = fmax(level, SPECTRUM_MIN_DB);
+
+    if(level > BAR_CHECK_FLOOR_DB)
+      worst = fmax(worst, fabs(bars[b] - level));
+  }
+  printf(" %7.3f dB\n", worst);
+
+  return worst;
+}
+
+/**
+ * @brief  Direct DFT in double precision, X[k] = sum x[n] e^(-j 2 pi k n / N).
+ * @param  input: real samples
+ * @retval None
+ */
+static void SpectrumBench_Dft(const double* input)
+{
+  for(uint32_t k = 0; k < SPECTRUM_FFT_SIZE; k++)
+  {
+    double re = 0, im = 0;
+
+    for(uint32_t n = 0; n < SPECTRUM_FFT_SIZE; n++)
+    {
+      double angle = 2.0 * PI * (double)((k * n) % SPECTRUM_FFT_SIZE) / SPECTRUM_FFT_SIZE;
+      re += input[n] * cos(angle);
+      im -= input[n] * sin(angle);
+    }
+
+    referenceRe[k] = re;
+    referenceIm[k] = im;
+  }
+}
+
+static double SpectrumBench_Noise(uint32_t n)
+{
+  // uniform in -0.5..0.5, like music at -6 dBFS peaks
+  return (double)SpectrumBench_Random() / 4294967296.0 - 0.5;
+}
+
+static double SpectrumBench_Sine(uint32_t n)
+{
+  return 0.9 * sin(2.0 * PI * 1000.0 * n / SAMPLE_RATE);
+}
+
+static double SpectrumBench_Impulse(uint32_t n)
+{
+  return (n == 3) ? 0.99 : 0.0;
+}
+
+static double SpectrumBench_TwoTones(uint32_t n)
+{
+  return 0.5 * sin(2.0 * PI * 100.0 * n / SAMPLE_RATE) + 0.05 * sin(2.0 * PI * 5000.0 * n / SAMPLE_RATE);
+}
+
+static uint32_t SpectrumBench_Random(void)
+{
+  xorshiftState ^= xorshiftState << 13;
+  xorshiftState ^= xorshiftState >> 17;
+  xorshiftState ^= xorshiftState << 5;
+  return xorshiftState;
+}
+
+static uint64_t SpectrumBench_Now(void)
+{
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint64_t)now.tv_sec * 1000000000u + now.tv_nsec;
+}
+
+static uint64_t SpectrumBench_Median(void)
+{
+  for(uint32_t i = 1; i < REPETITIONS; i++)
+  {
+    uint64_t value = times[i];
+    uint32_t j = i;
+    while(j > 0 && times[j - 1] > value)
+    {
+      times[j] = times[j - 1];
+      j--;
+    }
+    times[j] = value;
+  }
+
+  return times[REPETITIONS / 2];
+}
@@ -0,0 +1,338 @@
+/**
+  ******************************************************************************
+  * @file    horoscope_telemetry.c
+  * @brief   Linux decoder for the telemetry stream sent on USART1 (ST-LINK VCP).
+  *          Prints each playback frame, optionally records them to a CSV file
+  *          and draws a live plot of the buffer fill and DSP load. Log text
+  *          sent between frames is printed as is.
+  *
+  *          build (from Tools, the sources are listed in its Makefile):
+  *            make build/horoscope_telemetry
+  *
+  *          usage:
+  *            ./horoscope_telemetry [-d /dev/ttyACM0] [-b 115200] [-o record.csv] [-p] [-q]
+  ******************************************************************************
+  */
+
+#define _DEFAULT_SOURCE
+
+#include "telemetry_frame.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+
+// private defines -------------------------------------------------------------
+#define DEFAULT_DEVICE      "/dev/ttyACM0"
+#define DEFAULT_BAUD_RATE   115200
+#define CHUNK_CAPACITY      512
+#define PLOT_WIDTH          50
+
+// private typedefs ------------------------------------------------------------
+typedef struct Options
+{
+  const char* device;
+  unsigned    baudRate;
+  const char* recordPath;
+  bool        plot;
+  bool        quiet;
+} Options;
+
+typedef struct DecoderState
+{
+  uint8_t  chunk[CHUNK_CAPACITY];
+  uint32_t chunkLength;
+  bool     chunkOverflow;
+  bool     hasSequence;
+  uint16_t expectedSequence;
+  uint32_t frames;
+  uint32_t lostFrames;
+  uint32_t badFrames;
+  FILE*    record;
+} DecoderState;
+
+// private function declarations -----------------------------------------------
+static void    Telemetry_PrintUsage(const char* program);
+static bool    Telemetry_ParseOptions(int argc, char** argv, Options* options);
+static speed_t Telemetry_BaudToSpeed(unsigned baudRate);
+static int     Telemetry_OpenPort(const char* device, unsigned baudRate);
+static void    Telemetry_HandleChunk(DecoderState* state, const Options* options);
+static void    Telemetry_HandlePlayback(DecoderState* state, const Options* options, uint16_t sequence, const TelemetryPlaybackSample* sample);
+static void    Telemetry_DrawBar(const char* label, double ratio);
+
+int main(int argc, char** argv)
+{
+  Options options = { DEFAULT_DEVICE, DEFAULT_BAUD_RATE, NULL, false, false };
+  DecoderState state;
+
+  if(!Telemetry_ParseOptions(argc, argv, &options))
+  {
+    Telemetry_PrintUsage(argv[0]);
+    return 1;
+  }
+
+  int port = Telemetry_OpenPort(options.device, options.baudRate);
+  if(port < 0)
+    return 1;
+
+  memset(&state, 0, sizeof(state));
+  if(options.recordPath)
+  {
+    state.record = fopen(options.recordPath, "w");
+    if(!state.record)
+    {
+      fprintf(stderr, "cannot open %s: %s\n", options.recordPath, strerror(errno));
+      close(port);
+      return 1;
+    }
+    fprintf(state.record, "sequence,tick_ms,feedback_hz,codec_hz,buffer_fill,buffer_size,overruns,underruns,dsp_cycles,dsp_cycles_max,cycles_per_packet\n");
+  }
+
+  uint8_t input[256];
+  for(;;)
+  {
+    ssize_t count = read(port, input, sizeof(input));
+    if(count < 0)
+    {
+      if(errno == EINTR)
+        continue;
+      fprintf(stderr, "read failed: %s\n", strerror(errno));
+      break;
+    }
+
+    for(ssize_t i = 0; i < count; i++)
+    {
+      if(input[i] == TELEMETRY_FRAME_DELIMITER)
+      {
+        Telemetry_HandleChunk(&state, &options);
+        continue;
+      }
+
+      if(state.chunkLength < CHUNK_CAPACITY)
+        state.chunk[state.chunkLength++] = input[i];
+      else
+        state.chunkOverflow = true;
+    }
+  }
+
+  if(state.record)
+    fclose(state.record);
+  close(port);
+  return 0;
+}
+
+/**
+ * @brief  Prints the command line help.
+ * @param  program: argv[0]
+ * @retval None
+ */
+static void Telemetry_PrintUsage(const char* program)
+{
+  fprintf(stderr,
+    "usage: %s [-d device] [-b baud] [-o record.csv] [-p] [-q]\n"
+    "  -d  serial device (default " DEFAULT_DEVICE ")\n"
+    "  -b  baud rate, must match USART1_BAUD_RATE (default %d)\n"
+    "  -o  append every playback frame to a CSV file\n"
+    "  -p  live plot of the buffer fill and DSP load\n"
+    "  -q  do not print frames, only log text and errors\n",
+    program, DEFAULT_BAUD_RATE);
+}
+
+/**
+ * @brief  Reads the command line.
+ * @param  argc, argv: from main
+ * @param  options: filled with the parsed values
+ * @retval false on invalid arguments
+ */
+static bool Telemetry_ParseOptions(int argc, char** argv, Options* options)
+{
+  int option;
+
+  while((option = getopt(argc, argv, "d:b:o:pqh")) != -1)
+  {
+    switch(option)
+    {
+      case 'd': options->device = optarg; break;
+      case 'b': options->baudRate = (unsigned)strtoul(optarg, NULL, 10); break;
+      case 'o': options->recordPath = optarg; break;
+      case 'p': options->plot = true; break;
+      case 'q': options->quiet = true; break;
+      default:  return false;
+    }
+  }
+
+  return Telemetry_BaudToSpeed(options->baudRate) != B0;
+}
+
+/**
+ * @brief  Converts a baud rate to its termios constant.
+ * @param  baudRate: bits per second
+ * @retval speed, B0 if unsupported
+ */
+static speed_t Telemetry_BaudToSpeed(unsigned baudRate)
+{
+  switch(baudRate)
+  {
+    case 115200:  return B115200;
+    case 230400:  return B230400;
+    case 460800:  return B460800;
+    case 921600:  return B921600;
+    case 1000000: return B1000000;
+    case 2000000: return B2000000;
+    default:      return B0;
+  }
+}
+
+/**
+ * @brief  Opens the serial port in raw mode.
+ * @param  device: tty path
+ * @param  baudRate: bits per second
+ * @retval file descriptor, -1 on error
+ */
+static int Telemetry_OpenPort(const char* device, unsigned baudRate)
+{
+  struct termios tty;
+
+  int port = open(device, O_RDONLY | O_NOCTTY);
+  if(port < 0)
+  {
+    fprintf(stderr, "cannot open %s: %s\n", device, strerror(errno));
+    return -1;
+  }
+
+  if(tcgetattr(port, &tty) != 0)
+  {
+    fprintf(stderr, "%s is not a serial port: %s\n", device, strerror(errno));
+    close(port);
+    return -1;
+  }
+
+  cfmakeraw(&tty);
+  cfsetispeed(&tty, Telemetry_BaudToSpeed(baudRate));
+  cfsetospeed(&tty, Telemetry_BaudToSpeed(baudRate));
+  tty.c_cflag |= CLOCAL | CREAD;
+  tty.c_cc[VMIN]  = 1;
+  tty.c_cc[VTIME] = 0;
+  tcsetattr(port, TCSANOW, &tty);
+  tcflush(port, TCIFLUSH);
+
+  return port;
+}
+
+/**
+ * @brief  Handles the bytes received since the previous delimiter: either a
+ *         frame or log text printed by the firmware.
+ * @param  state: decoder state
+ * @param  options: command line options
+ * @retval None
+ */
+static void Telemetry_HandleChunk(DecoderState* state, const Options* options)
+{
+  TelemetryFrameHeader header;
+  uint8_t payload[TELEMETRY_MAX_PAYLOAD_SIZE];
+
+  if(state->chunkLength == 0)
+    return;
+
+  int32_t payloadLength = -1;
+  if(!state->chunkOverflow)
+    payloadLength = TelemetryFrame_Decode(state->chunk, state->chunkLength, &header, payload, sizeof(payload));
+
+  if(payloadLength < 0)
+  {
+    // plain text from the logger, anything else is a corrupted frame
+    bool printable = !state->chunkOverflow;
+    for(uint32_t i = 0; i < state->chunkLength && printable; i++)
+      printable = state->chunk[i] >= 0x20 || state->chunk[i] == '\r' || state->chunk[i] == '\n' || state->chunk[i] == '\t';
+
+    if(printable)
+      fwrite(state->chunk, 1, state->chunkLength, stdout);
+    else
+      state->badFrames++;
+  }
+  else if(header.type == TELEMETRY_TYPE_PLAYBACK && payloadLength == sizeof(TelemetryPlaybackSample))
+  {
+    TelemetryPlaybackSample sample;
+    memcpy(&sample, payload, sizeof(sample));
+    Telemetry_HandlePlayback(state, options, header.sequence, &sample);
+  }
+  else
+  {
+    state->badFrames++;
+  }
+
+  fflush(stdout);
+  state->chunkLength = 0;
+  state->chunkOverflow = false;
+}
+
+/**
+ * @brief  Prints, records and plots one playback frame.
+ * @param  state: decoder state
+ * @param  options: command line options
+ * @param  sequence: frame sequence number
+ * @param  sample: decoded payload
+ * @retval None
+ */
+static void Telemetry_HandlePlayback(DecoderState* state, const Options* options, uint16_t sequence, const TelemetryPlaybackSample* sample)
+{
+  if(state->hasSequence && sequence != state->expectedSequence)
+    state->lostFrames += (uint16_t)(sequence - state->expectedSequence);
+  state->expectedSequence = sequence + 1;
+  state->hasSequence = true;
+  state->frames++;
+
+  double load    = sample->cyclesPerPacket ? 100.0 * sample->dspCycles / sample->cyclesPerPacket : 0.0;
+  double loadMax = sample->cyclesPerPacket ? 100.0 * sample->dspCyclesMax / sample->cyclesPerPacket : 0.0;
+  double fill    = sample->bufferSize ? (double)sample->bufferFill / sample->bufferSize : 0.0;
+
+  if(state->record)
+  {
+    fprintf(state->record, "%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u\n",
+      sequence, sample->tick, sample->feedback, sample->estimatedCodecFrequency,
+      sample->bufferFill, sample->bufferSize, sample->overruns, sample->underruns,
+      sample->dspCycles, sample->dspCyclesMax, sample->cyclesPerPacket);
+    fflush(state->record);
+  }
+
+  if(options->plot)
+  {
+    // redraws in place at the top of the terminal
+    printf("\033[H\033[J");
+    printf("horoscope telemetry  frames %u  lost %u  bad %u\n\n", state->frames, state->lostFrames, state->badFrames);
+    Telemetry_DrawBar("buffer  ", fill);
+    Telemetry_DrawBar("dsp     ", load / 100.0);
+    Telemetry_DrawBar("dsp max ", loadMax / 100.0);
+    printf("\nfeedback %u Hz  codec %u Hz  overruns %u  underruns %u\n",
+      sample->feedback, sample->estimatedCodecFrequency, sample->overruns, sample->underruns);
+  }
+  else if(!options->quiet)
+  {
+    printf("#%05u t=%8u ms  fill %5u/%5u  fb %5u Hz  codec %5u Hz  dsp %5.1f%% (max %5.1f%%)  ovr %u  udr %u  lost %u\n",
+      sequence, sample->tick, sample->bufferFill, sample->bufferSize, sample->feedback,
+      sample->estimatedCodecFrequency, load, loadMax, sample->overruns, sample->underruns, state->lostFrames);
+  }
+}
+
+/**
+ * @brief  Draws a horizontal bar for a 0..1 ratio.
+ * @param  label: text printed before the bar
+ * @param  ratio: filled fraction, clamped to 0..1
+ * @retval None
+ */
+static void Telemetry_DrawBar(const char* label, double ratio)
+{
+  if(ratio < 0.0)
+    ratio = 0.0;
+  if(ratio > 1.0)
+    ratio = 1.0;
+
+  int filled = (int)(ratio * PLOT_WIDTH + 0.5);
+  printf("%s[", label);
+  for(int i = 0; i < PLOT_WIDTH; i++)
+    putchar(i < filled ? '#' : ' ');
+  printf("] %5.1f%%\n", ratio * 100.0);
+}
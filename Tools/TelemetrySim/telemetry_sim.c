@@ -0,0 +1,238 @@
+/**
+  ******************************************************************************
+  * @file    telemetry_sim.c
+  * @brief   Runs telemetry.c on the host against a mock of the USART1 DMA that
+  *          decodes each frame it is given. Checks:
+  *          - seqlock: a timer signal publishing, standing for the audio
+  *            interrupt, preempts the main loop sending frames wherever it
+  *            is; every field of a sample is derived from one counter, so a
+  *            sample read while it was being written shows, and the samples
+  *            sent only go forward. Statistical: the window is the copy
+  *            of the sample, a reader without the sequence check is only
+  *            caught now and then;
+  *          - worst packet: the frame carries the largest dspCycles since the
+  *            previous frame, and the next one starts over;
+  *          - refused frame: the worst packet of a frame the USART refused
+  *            goes out with the next one.
+  *
+  *          build (from Tools, the sources are listed in its Makefile):
+  *            make build/telemetry_sim
+  *
+  *          usage:
+  *            ./telemetry_sim   (exit status 1 if a check fails)
+  ******************************************************************************
+  */
+
+#include "telemetry.h"
+#include "usart.h"
+#include "sim_report.h"
+#include <signal.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/time.h>
+
+// private defines -------------------------------------------------------------
+#define SEQLOCK_SAMPLES     100000
+#define INTERRUPT_PERIOD_US 5
+#define SIM_CORE_CLOCK      216000000
+
+// private variables -----------------------------------------------------------
+uint32_t SystemCoreClock = SIM_CORE_CLOCK;
+
+static uint32_t tick;
+static bool     refuse;
+static volatile uint32_t published;
+// decoded by the mock, reset by each check
+static uint32_t frames;
+static uint32_t corrupt;
+static uint32_t torn;
+static uint32_t backwards;
+static uint32_t lastCounter;
+static TelemetryPlaybackSample lastSample;
+
+// private function declarations -----------------------------------------------
+static bool  TelemetrySim_Seqlock(void);
+static bool  TelemetrySim_WorstPacket(void);
+static bool  TelemetrySim_RefusedFrame(void);
+static void  TelemetrySim_Interrupt(int signal);
+static void  TelemetrySim_Sample(uint32_t counter, TelemetryPlaybackSample* sample);
+static void  TelemetrySim_PublishCycles(uint32_t cycles);
+static void  TelemetrySim_Start(void);
+static void  TelemetrySim_Frame(void);
+
+int main(void)
+{
+  bool passed = true;
+
+  passed &= TelemetrySim_Seqlock();
+  passed &= TelemetrySim_WorstPacket();
+  passed &= TelemetrySim_RefusedFrame();
+
+  printf("%s\n", passed ? "all checks passed" : "CHECK FAILED");
+  return passed ? 0 : 1;
+}
+
+// mock of usart.c: decodes the frame and checks its sample is whole
+bool USART1_TransmitDMA(uint8_t* data, uint16_t length)
+{
+  TelemetryFrameHeader header;
+  TelemetryPlaybackSample sample, expected;
+
+  if(refuse)
+    return false;
+
+  // the frame between its two delimiters
+  if(length < 2 || TelemetryFrame_Decode(data + 1, length - 2, &header, &sample, sizeof(sample)) != sizeof(sample))
+  {
+    corrupt++;
+    return true;
+  }
+
+  TelemetrySim_Sample(sample.tick, &expected);
+  expected.dspCyclesMax = sample.dspCyclesMax;
+  expected.cyclesPerPacket = SystemCoreClock / 1000;
+  torn += memcmp(&sample, &expected, sizeof(sample)) != 0;
+  backwards += frames > 0 && sample.tick < lastCounter;
+
+  lastCounter = sample.tick;
+  lastSample = sample;
+  frames++;
+  return true;
+}
+
+bool USART1_IsTransmitting(void)
+{
+  return false;
+}
+
+uint32_t HAL_GetTick(void)
+{
+  return tick++;
+}
+
+/**
+ * @brief  The timer signal publishing against the main loop sending frames.
+ * @param  None
+ * @retval true if no frame holds a torn sample or goes back in time
+ */
+static bool TelemetrySim_Seqlock(void)
+{
+  struct itimerval timer = { { 0, INTERRUPT_PERIOD_US }, { 0, INTERRUPT_PERIOD_US } };
+  struct itimerval off = { { 0, 0 }, { 0, 0 } };
+
+  TelemetrySim_Start();
+  signal(SIGALRM, TelemetrySim_Interrupt);
+  setitimer(ITIMER_REAL, &timer, NULL);
+
+  while(published < SEQLOCK_SAMPLES)
+    TelemetrySim_Frame();
+
+  setitimer(ITIMER_REAL, &off, NULL);
+  signal(SIGALRM, SIG_DFL);
+
+  printf("  seqlock: %u frames up to sample %u, %u corrupt, %u torn, %u backwards\n", frames, lastCounter, corrupt, torn, backwards);
+  return SimReport_Check("seqlock", corrupt == 0 && torn == 0 && backwards == 0 && frames > 0);
+}
+
+/**
+ * @brief  Packets of known cycles between two frames, then a quieter stretch.
+ * @param  None
+ * @retval true if each frame carries the largest of its own stretch
+ */
+static bool TelemetrySim_WorstPacket(void)
+{
+  uint32_t first, second;
+
+  TelemetrySim_Start();
+  TelemetrySim_PublishCycles(5000);
+  TelemetrySim_PublishCycles(90000);
+  TelemetrySim_PublishCycles(7000);
+  TelemetrySim_Frame();
+  first = lastSample.dspCyclesMax;
+
+  TelemetrySim_PublishCycles(3000);
+  TelemetrySim_PublishCycles(2000);
+  TelemetrySim_Frame();
+  second = lastSample.dspCyclesMax;
+
+  printf("  worst packet: %u then %u, of 90000 then 3000\n", first, second);
+  return SimReport_Check("worst packet", frames == 2 && corrupt + torn == 0 && first == 90000 && second == 3000);
+}
+
+/**
+ * @brief  A frame the USART refuses, then a quieter packet.
+ * @param  None
+ * @retval true if the next frame still carries the refused maximum
+ */
+static bool TelemetrySim_RefusedFrame(void)
+{
+  TelemetrySim_Start();
+  TelemetrySim_PublishCycles(50000);
+  refuse = true;
+  TelemetrySim_Frame();
+  refuse = false;
+  TelemetrySim_PublishCycles(10000);
+  TelemetrySim_Frame();
+
+  printf("  refused frame: %u sent, worst packet %u of 50000\n", frames, lastSample.dspCyclesMax);
+  return SimReport_Check("refused frame", frames == 1 && corrupt + torn == 0 && lastSample.dspCyclesMax == 50000);
+}
+
+// the audio interrupt: publishes the next numbered sample
+static void TelemetrySim_Interrupt(int signal)
+{
+  TelemetryPlaybackSample sample;
+
+  (void)signal;
+  TelemetrySim_Sample(++published, &sample);
+  Telemetry_PublishPlayback(&sample);
+}
+
+// every field of sample number counter, the maximum and the clock left to the
+// telemetry
+static void TelemetrySim_Sample(uint32_t counter, TelemetryPlaybackSample* sample)
+{
+  *sample = (TelemetryPlaybackSample){
+    .tick = counter,
+    .feedback = 48000 + counter % 7,
+    .estimatedCodecFrequency = counter * 3,
+    .overruns = counter ^ 0x5a5a5a5a,
+    .underruns = ~counter,
+    .dspCycles = counter % 100000,
+    .bufferFill = (uint16_t)counter,
+    .bufferSize = (uint16_t)(counter >> 16),
+  };
+}
+
+// publishes one packet that took cycles
+static void TelemetrySim_PublishCycles(uint32_t cycles)
+{
+  TelemetryPlaybackSample sample;
+
+  TelemetrySim_Sample(cycles, &sample);
+  Telemetry_PublishPlayback(&sample);
+}
+
+// the fastest rate, the worst packet of the previous check sent and the counts
+// cleared
+static void TelemetrySim_Start(void)
+{
+  Telemetry_Init();
+  Telemetry_SetRate(TELEMETRY_MAX_RATE_HZ);
+  TelemetrySim_Frame();
+  published = 0;
+  refuse = false;
+  frames = 0;
+  corrupt = 0;
+  torn = 0;
+  backwards = 0;
+  lastCounter = 0;
+  memset(&lastSample, 0, sizeof(lastSample));
+}
+
+// runs the main loop until a frame has been offered to the USART
+static void TelemetrySim_Frame(void)
+{
+  tick += 1000 / TELEMETRY_MAX_RATE_HZ;
+  Telemetry_Process();
+}
@@ -0,0 +1,454 @@
+/**
+  ******************************************************************************
+  * @file    touch_sim.c
+  * @brief   Runs the touch input and the touch map on synthetic FT6x06
+  *          reports and checks them.
+  *
+  *          - map: every pixel of the screen looked up on the touch map
+  *            filled by LCD_AddTouchWidgets, against a linear scan with the
+  *            tests the touch handler used before the map; then the cost of
+  *            both per lookup.
+  *          - traces: one and two finger touch traces, each report posted
+  *            like the I2C interrupt does and the events routed like the
+  *            touch task does, with the knobs moved as Touchscreen_MoveSlider
+  *            moves them. Each trace checks where the knobs end, which
+  *            fingers were released and the input counters.
+  *
+  *          build (from Tools, the sources are listed in its Makefile):
+  *            make build/touch_sim
+  *
+  *          usage:
+  *            ./touch_sim [-v]   (-v prints every event; exit status 1 if a
+  *                                check fails)
+  ******************************************************************************
+  */
+
+#include "touch_map.h"
+#include "user_lcd.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+// private defines -------------------------------------------------------------
+// reports of a touched FT6x06, about 100 per second
+#define REPORT_PERIOD_MS    10
+#define TASK_PERIOD_MS      10              // touch task of main.c
+#define LOOKUP_REPETITIONS  20
+// as in touchscreen.c
+#define SLIDER_TOUCH_MARGIN 10
+
+// private typedefs ------------------------------------------------------------
+typedef struct Trace
+{
+  const char* name;
+  void        (*run)(void);
+} Trace;
+
+// private variables -----------------------------------------------------------
+static bool     verbose = false;
+static uint32_t now = 0;
+static uint16_t knobY[NUMBER_OF_SLIDER_BUTTONS];
+static uint32_t releases[TOUCH_MAX_POINTS];
+static uint32_t buttonPresses = 0;
+static bool     traceFailed = false;
+
+// private function declarations -----------------------------------------------
+static bool            TouchSim_CheckMap(void);
+static int             TouchSim_LinearFind(uint16_t x, uint16_t y, TouchWidgetType* type);
+static uint64_t        TouchSim_Now(void);
+static void            TouchSim_StartTrace(void);
+static void            TouchSim_Report(uint8_t points, uint8_t id0, uint16_t x0, uint16_t y0, uint8_t id1, uint16_t x1, uint16_t y1);
+static void            TouchSim_Idle(uint32_t milliseconds);
+static void            TouchSim_RunTask(void);
+static void            TouchSim_Expect(bool condition, const char* what);
+static uint16_t        TouchSim_SliderX(uint8_t slider);
+static uint16_t        TouchSim_Clamp(uint8_t slider, uint16_t y);
+static void            TouchSim_TwoSliders(void);
+static void            TouchSim_SwappedPoints(void);
+static void            TouchSim_LeaveTrack(void);
+static void            TouchSim_LiftOne(void);
+static void            TouchSim_Bounce(void);
+static void            TouchSim_LostLift(void);
+static void            TouchSim_ButtonThenSlider(void);
+
+static const Trace traces[] = {
+  { "two fingers, sliders 1 and 5",      TouchSim_TwoSliders },
+  { "points swap places in the report",  TouchSim_SwappedPoints },
+  { "finger leaves its track",           TouchSim_LeaveTrack },
+  { "one finger lifts, one drags on",    TouchSim_LiftOne },
+  { "lift shorter than the debounce",    TouchSim_Bounce },
+  { "lift report lost",                  TouchSim_LostLift },
+  { "button, then slider with another",  TouchSim_ButtonThenSlider },
+};
+
+int main(int argc, char** argv)
+{
+  bool passed;
+
+  verbose = (argc > 1 && strcmp(argv[1], "-v") == 0);
+
+  passed = TouchSim_CheckMap();
+
+  printf("traces:\n");
+  for(uint8_t i = 0; i < sizeof(traces) / sizeof(traces[0]); i++)
+  {
+    TouchSim_StartTrace();
+    traces[i].run();
+    printf("  %-36s %s (%u bounces, %u unassigned)\n", traces[i].name, traceFailed ? "FAILED" : "ok",
+      touchInputStats.bounces, touchInputStats.unassigned);
+    passed &= !traceFailed;
+  }
+
+  printf("%s\n", passed ? "all checks passed" : "CHECK FAILED");
+  return passed ? 0 : 1;
+}
+
+/**
+ * @brief  Looks up every pixel on the map and with the linear scan, then
+ *         times both over the whole screen.
+ * @param  None
+ * @retval true if they agree everywhere
+ */
+static bool TouchSim_CheckMap(void)
+{
+  uint32_t mismatches = 0;
+  uint32_t hits = 0;
+  volatile uintptr_t sink = 0;
+
+  if(!LCD_AddTouchWidgets())
+  {
+    printf("map: a widget did not fit\n");
+    return false;
+  }
+
+  for(uint16_t y = 0; y < TOUCH_MAP_HEIGHT; y++)
+  {
+    for(uint16_t x = 0; x < TOUCH_MAP_WIDTH; x++)
+    {
+      TouchWidgetType type = TOUCH_WIDGET_CIRCLE_BUTTON;
+      int index = TouchSim_LinearFind(x, y, &type);
+      const TouchWidget* widget = TouchMap_Find(x, y);
+
+      if(index < 0 ? widget != NULL : (widget == NULL || widget->type != type || widget->index != index))
+      {
+        if(mismatches++ < 5)
+          printf("map: mismatch at %u,%u\n", x, y);
+      }
+      hits += (index >= 0);
+    }
+  }
+
+  uint64_t start = TouchSim_Now();
+  for(uint32_t r = 0; r < LOOKUP_REPETITIONS; r++)
+    for(uint16_t y = 0; y < TOUCH_MAP_HEIGHT; y++)
+      for(uint16_t x = 0; x < TOUCH_MAP_WIDTH; x++)
+        sink += (uintptr_t)TouchMap_Find(x, y);
+  double mapNs = (double)(TouchSim_Now() - start) / LOOKUP_REPETITIONS / (TOUCH_MAP_WIDTH * TOUCH_MAP_HEIGHT);
+
+  start = TouchSim_Now();
+  for(uint32_t r = 0; r < LOOKUP_REPETITIONS; r++)
+  {
+    for(uint16_t y = 0; y < TOUCH_MAP_HEIGHT; y++)
+    {
+      for(uint16_t x = 0; x < TOUCH_MAP_WIDTH; x++)
+      {
+        TouchWidgetType type;
+        sink += TouchSim_LinearFind(x, y, &type);
+      }
+    }
+  }
+  double linearNs = (double)(TouchSim_Now() - start) / LOOKUP_REPETITIONS / (TOUCH_MAP_WIDTH * TOUCH_MAP_HEIGHT);
+
+  printf("map: %u pixels on widgets, %u mismatches with the linear scan\n", hits, mismatches);
+  printf("map: %.1f ns per lookup, linear scan %.1f ns (host)\n", mapNs, linearNs);
+  return mismatches == 0;
+}
+
+/**
+ * @brief  Widget under a point with the tests of the touch handler before the
+ *         map, every widget in turn.
+ * @param  x, y: screen coordinates
+ * @param  type: receives the kind of widget
+ * @retval index of the widget in the array of its type, -1 if none
+ */
+static int TouchSim_LinearFind(uint16_t x, uint16_t y, TouchWidgetType* type)
+{
+  RectangleButton* buttons[] = { &saveButton, &undoButton, &resetButton };
+
+  for(uint8_t i = 0; i < NUMBER_OF_CIRCLE_BUTTONS; i++)
+  {
+    CircleButtonTypeDef* button = &circleButtons[i];
+    if(y > button->y - button->radius && y < button->y + button->radius &&
+       x > button->x - button->radius && x < button->x + button->radius)
+    {
+      *type = TOUCH_WIDGET_CIRCLE_BUTTON;
+      return i;
+    }
+  }
+
+  for(uint8_t i = 0; i < 3; i++)
+  {
+    if(y > buttons[i]->y && y < buttons[i]->y + buttons[i]->height && x > buttons[i]->x && x < buttons[i]->x + buttons[i]->width)
+    {
+      *type = TOUCH_WIDGET_RECTANGLE_BUTTON;
+      return i;
+    }
+  }
+
+  for(uint8_t i = 0; i < NUMBER_OF_SLIDER_BUTTONS; i++)
+  {
+    SliderKnob* knob = &sliderKnobs[i];
+    if(y > knob->sliderY + 10 && y < knob->sliderY + knob->sliderHeight - 10 &&
+       x > knob->sliderX && x < knob->sliderX + knob->sliderWidth)
+    {
+      *type = TOUCH_WIDGET_SLIDER;
+      return i;
+    }
+  }
+
+  return -1;
+}
+
+/**
+ * @brief  Two fingers land on sliders 1 and 5 in the same report and drag
+ *         them in opposite directions at once.
+ */
+static void TouchSim_TwoSliders(void)
+{
+  uint16_t x1 = TouchSim_SliderX(1), x5 = TouchSim_SliderX(5);
+
+  for(uint16_t step = 0; step <= 20; step++)
+    TouchSim_Report(2, 0, x1, 100 + 10 * step, 1, x5, 350 - 10 * step);
+  TouchSim_Report(0, 0, 0, 0, 0, 0, 0);
+  TouchSim_Idle(100);
+
+  TouchSim_Expect(knobY[1] == 300, "slider 1 at the first finger");
+  TouchSim_Expect(knobY[5] == 150, "slider 5 at the second finger");
+  TouchSim_Expect(releases[0] == 1 && releases[1] == 1, "both fingers released");
+}
+
+/**
+ * @brief  The controller lists the second finger first halfway through; the
+ *         touch IDs keep each point on its slider.
+ */
+static void TouchSim_SwappedPoints(void)
+{
+  uint16_t x2 = TouchSim_SliderX(2), x6 = TouchSim_SliderX(6);
+
+  for(uint16_t step = 0; step <= 20; step++)
+  {
+    if(step < 10)
+      TouchSim_Report(2, 0, x2, 100 + 10 * step, 1, x6, 200);
+    else
+      TouchSim_Report(2, 1, x6, 200 - 5 * (step - 10), 0, x2, 100 + 10 * step);
+  }
+  TouchSim_Report(0, 0, 0, 0, 0, 0, 0);
+  TouchSim_Idle(100);
+
+  TouchSim_Expect(knobY[2] == 300, "slider 2 follows ID 0");
+  TouchSim_Expect(knobY[6] == 150, "slider 6 follows ID 1");
+}
+
+/**
+ * @brief  A finger presses slider 3 and drags over slider 4 and below the
+ *         track; slider 3 follows, clamped, slider 4 stays.
+ */
+static void TouchSim_LeaveTrack(void)
+{
+  uint16_t x3 = TouchSim_SliderX(3);
+  uint16_t start4 = knobY[4];
+
+  for(uint16_t step = 0; step <= 20; step++)
+    TouchSim_Report(1, 0, x3 + 5 * step, 200 + 15 * step, 0, 0, 0);
+  TouchSim_Report(0, 0, 0, 0, 0, 0, 0);
+  TouchSim_Idle(100);
+
+  TouchSim_Expect(knobY[3] == TouchSim_Clamp(3, 500), "slider 3 clamped to its track");
+  TouchSim_Expect(knobY[4] == start4, "slider 4 untouched");
+}
+
+/**
+ * @brief  The first finger lifts while the second keeps dragging; only the
+ *         first is released, and at the end of the debounce time.
+ */
+static void TouchSim_LiftOne(void)
+{
+  uint16_t x0 = TouchSim_SliderX(0), x7 = TouchSim_SliderX(7);
+
+  for(uint16_t step = 0; step < 5; step++)
+    TouchSim_Report(2, 0, x0, 120, 1, x7, 100 + 10 * step);
+
+  uint32_t liftTime = now;
+  for(uint16_t step = 5; step <= 20; step++)
+  {
+    TouchSim_Report(1, 1, x7, 100 + 10 * step, 0, 0, 0);
+    if(now - liftTime < TOUCH_DEBOUNCE_MS)
+      TouchSim_Expect(releases[0] == 0, "first finger not released before the debounce time");
+  }
+
+  TouchSim_Expect(releases[0] == 1 && releases[1] == 0, "only the first finger released");
+  TouchSim_Report(0, 0, 0, 0, 0, 0, 0);
+  TouchSim_Idle(100);
+
+  TouchSim_Expect(knobY[0] == 120, "slider 0 stays where lifted");
+  TouchSim_Expect(knobY[7] == 300, "slider 7 dragged to the end");
+}
+
+/**
+ * @brief  One report without the finger amid a drag: the drag goes on and
+ *         counts a bounce.
+ */
+static void TouchSim_Bounce(void)
+{
+  uint16_t x2 = TouchSim_SliderX(2);
+
+  for(uint16_t step = 0; step <= 10; step++)
+  {
+    if(step == 5)
+      TouchSim_Report(0, 0, 0, 0, 0, 0, 0);
+    else
+      TouchSim_Report(1, 0, x2, 150 + 10 * step, 0, 0, 0);
+  }
+
+  TouchSim_Expect(releases[0] == 0, "no release for the bounce");
+  TouchSim_Expect(touchInputStats.bounces == 1, "one bounce counted");
+  TouchSim_Report(0, 0, 0, 0, 0, 0, 0);
+  TouchSim_Idle(100);
+  TouchSim_Expect(knobY[2] == 250, "slider 2 dragged to the end");
+}
+
+/**
+ * @brief  The reports stop without a lift; the finger is released after the
+ *         release timeout and the debounce time.
+ */
+static void TouchSim_LostLift(void)
+{
+  uint16_t x5 = TouchSim_SliderX(5);
+
+  for(uint16_t step = 0; step <= 5; step++)
+    TouchSim_Report(1, 0, x5, 200, 0, 0, 0);
+
+  TouchSim_Idle(TOUCH_RELEASE_TIMEOUT_MS - REPORT_PERIOD_MS);
+  TouchSim_Expect(releases[0] == 0, "held until the release timeout");
+  TouchSim_Idle(TOUCH_DEBOUNCE_MS + 2 * TASK_PERIOD_MS);
+  TouchSim_Expect(releases[0] == 1, "released after the timeout");
+}
+
+/**
+ * @brief  One finger presses the save button and stays, another then drags
+ *         a slider; the button press is applied once and the slider moves.
+ */
+static void TouchSim_ButtonThenSlider(void)
+{
+  uint16_t x4 = TouchSim_SliderX(4);
+  uint16_t buttonX = saveButton.x + saveButton.width / 2;
+  uint16_t buttonY = saveButton.y + saveButton.height / 2;
+
+  for(uint16_t step = 0; step < 3; step++)
+    TouchSim_Report(1, 0, buttonX, buttonY, 0, 0, 0);
+  for(uint16_t step = 0; step <= 10; step++)
+    TouchSim_Report(2, 0, buttonX + (step & 1) * 8, buttonY, 1, x4, 300 - 10 * step);
+  TouchSim_Report(0, 0, 0, 0, 0, 0, 0);
+  TouchSim_Idle(100);
+
+  TouchSim_Expect(buttonPresses == 1, "save pressed once");
+  TouchSim_Expect(knobY[4] == 200, "slider 4 dragged by the second finger");
+}
+
+/**
+ * @brief  Clears the input and the map holds, puts the knobs in the middle.
+ */
+static void TouchSim_StartTrace(void)
+{
+  TouchInput_Reset();
+  LCD_AddTouchWidgets();
+
+  for(uint8_t i = 0; i < NUMBER_OF_SLIDER_BUTTONS; i++)
+    knobY[i] = sliderKnobs[i].sliderY + sliderKnobs[i].sliderHeight / 2;
+  memset(releases, 0, sizeof(releases));
+  buttonPresses = 0;
+  traceFailed = false;
+  now += 1000;
+}
+
+/**
+ * @brief  Posts one report as the I2C interrupt does, then runs the touch
+ *         task until the next report is due.
+ */
+static void TouchSim_Report(uint8_t points, uint8_t id0, uint16_t x0, uint16_t y0, uint8_t id1, uint16_t x1, uint16_t y1)
+{
+  TouchReport report = { points, { { id0, x0, y0 }, { id1, x1, y1 } }, now, now * 200000 };
+
+  TouchInput_PostReport(&report);
+  TouchSim_Idle(REPORT_PERIOD_MS);
+}
+
+static void TouchSim_Idle(uint32_t milliseconds)
+{
+  for(uint32_t end = now + milliseconds; now < end; now += TASK_PERIOD_MS)
+    TouchSim_RunTask();
+}
+
+/**
+ * @brief  Touch task: the events routed to the widgets, knobs moved and
+ *         clamped like Touchscreen_MoveSlider does, one press per option
+ *         button like Touchscreen_PressOptionButton does.
+ */
+static void TouchSim_RunTask(void)
+{
+  TouchEvent event;
+  static const char* names[] = { "down", "move", "up" };
+
+  while(TouchInput_GetEvent(&event, now))
+  {
+    const TouchWidget* widget = TouchMap_Route(&event);
+
+    if(verbose)
+      printf("    %5u ms finger %u %-4s %3u,%3u -> %s %d\n", now, event.finger, names[event.type], event.x, event.y,
+        widget ? (widget->type == TOUCH_WIDGET_SLIDER ? "slider" : "button") : "none", widget ? widget->index : -1);
+
+    if(event.type == TOUCH_EVENT_UP)
+    {
+      releases[event.finger]++;
+      continue;
+    }
+
+    if(widget == NULL)
+      continue;
+
+    if(widget->type == TOUCH_WIDGET_SLIDER)
+      knobY[widget->index] = TouchSim_Clamp(widget->index, event.y);
+    else if(widget->type == TOUCH_WIDGET_RECTANGLE_BUTTON && event.type == TOUCH_EVENT_DOWN)
+      buttonPresses++;
+  }
+}
+
+static void TouchSim_Expect(bool condition, const char* what)
+{
+  if(!condition)
+  {
+    printf("    failed: %s\n", what);
+    traceFailed = true;
+  }
+}
+
+static uint16_t TouchSim_SliderX(uint8_t slider)
+{
+  return sliderKnobs[slider].sliderX + sliderKnobs[slider].sliderWidth / 2;
+}
+
+static uint16_t TouchSim_Clamp(uint8_t slider, uint16_t y)
+{
+  uint16_t top = sliderKnobs[slider].sliderY + SLIDER_TOUCH_MARGIN + 1;
+  uint16_t bottom = sliderKnobs[slider].sliderY + sliderKnobs[slider].sliderHeight - SLIDER_TOUCH_MARGIN - 1;
+
+  return (y < top) ? top : (y > bottom) ? bottom : y;
+}
+
+static uint64_t TouchSim_Now(void)
+{
+  struct timespec time;
+
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return (uint64_t)time.tv_sec * 1000000000u + time.tv_nsec;
+}
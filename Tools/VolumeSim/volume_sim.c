@@ -0,0 +1,402 @@
+/**
+  ******************************************************************************
+  * @file    volume_sim.c
+  * @brief   Runs the EQ with the digital volume folded into its last band,
+  *          on the host. Checks:
+  *          - unity: at 0 dB the packets are closer to the eight bands in
+  *            double precision than the bands run one at a time, each
+  *            rounding to 16 bits, get;
+  *          - steady: a settled volume scales the 0 dB output, within the
+  *            rounding of the output;
+  *          - curve: a step of the volume follows the exponential ramp of
+  *            DSP_VOLUME_SMOOTHING_MS frame by frame, as delayed by the
+  *            feedback of the last band, without overshoot, and lands on its
+  *            target;
+  *          - mute: the output ramps to digital silence and stays there, and
+  *            comes back to the volume on unmute;
+  *          - resolution: every 1/256 dB step from -25 dB to 0 dB gives its
+  *            own gain, within a thousandth of a dB.
+  *
+  *          The cycle cost against a separate gain stage is measured by the
+  *          volume cases of Tools/DspBench.
+  *
+  *          build (from Tools, the sources are listed in its Makefile):
+  *            make build/volume_sim
+  *
+  *          usage:
+  *            ./volume_sim   (exit status 1 if a check fails)
+  ******************************************************************************
+  */
+
+#include "audio_user_dsp.h"
+#include "usb_audio.h"
+#include "sim_report.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// private defines -------------------------------------------------------------
+#define SAMPLE_RATE         USB_AUDIO_CONFIG_PLAY_DEF_FREQ
+#define PACKET_SIZE         AUDIO_MS_PACKET_SIZE(SAMPLE_RATE, USB_AUDIO_CONFIG_PLAY_CHANNEL_COUNT, USB_AUDIO_CONFIG_PLAY_RES_BYTE)
+#define FRAMES_PER_PACKET   (PACKET_SIZE / 4)
+#define PACKETS             100
+#define FRAMES              (PACKETS * FRAMES_PER_PACKET)
+// the step of the ramp per frame, as the firmware computes it
+#define SMOOTHING           (1000.0 / (DSP_VOLUME_SMOOTHING_MS * SAMPLE_RATE))
+#define DC_LEVEL            16384
+
+// variables -------------------------------------------------------------------
+
+// normally owned by main.c
+float in_z1  = 0;
+float in_z2  = 0;
+float out_z1 = 0;
+float out_z2 = 0;
+
+// band layout, normally defined in audio_usb_nodes.c
+int16_t frequencies[] = {30, 60, 150, 400, 1000, 3000, 8000, 16000};
+int16_t bandwidths[] =  {1,   1,   2,   2,    2,    3,    3,     3};
+
+// private variables -----------------------------------------------------------
+static int16_t input[2 * FRAMES];
+static int16_t reference[2 * FRAMES];
+static int16_t output[2 * FRAMES];
+static uint32_t randomState = 1;
+
+static const int16_t eqGains[NUMBER_OF_BANDS] = {6, -3, 4, -6, 3, -2, 5, -4};
+static const int16_t flatGains[NUMBER_OF_BANDS] = {0};
+
+// private function declarations -----------------------------------------------
+static bool     VolumeSim_Unity(void);
+static bool     VolumeSim_Steady(void);
+static bool     VolumeSim_Curve(void);
+static bool     VolumeSim_Mute(void);
+static bool     VolumeSim_Resolution(void);
+static void     VolumeSim_Configure(const int16_t* gains);
+static void     VolumeSim_Noise(void);
+static void     VolumeSim_Run(int16_t* target, uint32_t packets);
+static void     VolumeSim_Reference(void);
+static uint32_t VolumeSim_Random(void);
+
+int main(void)
+{
+  bool passed = true;
+
+  // the gain is checked sample by sample, without dither; Tools/DitherSim
+  // measures the dither
+  AudioUserDsp_SetDither(DSP_DITHER_OFF);
+
+  passed &= VolumeSim_Unity();
+  passed &= VolumeSim_Steady();
+  passed &= VolumeSim_Curve();
+  passed &= VolumeSim_Mute();
+  passed &= VolumeSim_Resolution();
+
+  printf("%s\n", passed ? "all checks passed" : "CHECK FAILED");
+  return passed ? 0 : 1;
+}
+
+/**
+ * @brief  Filters noise at 0 dB through the packet path, through the bands
+ *         one at a time with AudioUserDsp_ApplyFilterToSamples and through a
+ *         double precision model of the eight bands.
+ * @param  None
+ * @retval true if the packet path is the closer to the model
+ */
+static bool VolumeSim_Unity(void)
+{
+  uint8_t packet[PACKET_SIZE];
+  int16_t leftSample, rightSample;
+  int32_t worst = 0;
+  int32_t worstBands = 0;
+
+  VolumeSim_Noise();
+  AudioUserDsp_SetMute(false);
+  AudioUserDsp_SetVolume(0);
+  AudioUserDsp_SettleVolume();
+
+  VolumeSim_Configure(eqGains);
+  VolumeSim_Reference();
+  VolumeSim_Run(output, PACKETS);
+
+  for(uint32_t i = 0; i < 2 * FRAMES; i++)
+  {
+    if(abs(output[i] - reference[i]) > worst)
+      worst = abs(output[i] - reference[i]);
+  }
+
+  VolumeSim_Configure(eqGains);
+  for(uint32_t p = 0; p < PACKETS; p++)
+  {
+    memcpy(packet, &input[2 * p * FRAMES_PER_PACKET], PACKET_SIZE);
+    for(uint8_t i = 0; i < NUMBER_OF_BANDS; i++)
+      AudioUserDsp_ApplyFilterToSamples(packet, PACKET_SIZE, AudioUserDsp_BiquadFilter, AudioUserDsp_BiquadFilterRight, i);
+
+    for(uint32_t f = 0; f < FRAMES_PER_PACKET; f++)
+    {
+      uint32_t n = p * FRAMES_PER_PACKET + f;
+
+      AudioUserDsp_FrameToSamples(&packet[4 * f], &leftSample, &rightSample);
+      if(abs(leftSample - reference[2 * n]) > worstBands)
+        worstBands = abs(leftSample - reference[2 * n]);
+      if(abs(rightSample - reference[2 * n + 1]) > worstBands)
+        worstBands = abs(rightSample - reference[2 * n + 1]);
+    }
+  }
+
+  printf("  unity: worst difference from double precision %d lsb, %d lsb band by band\n", (int)worst, (int)worstBands);
+  return SimReport_Check("unity", worst < worstBands);
+}
+
+/**
+ * @brief  Filters noise at a settled -6 dB.
+ * @param  None
+ * @retval true if every sample is the 0 dB one scaled, within 2 lsb
+ */
+static bool VolumeSim_Steady(void)
+{
+  const int32_t volume = -6 * 256;
+  double gain = pow(10.0, volume / (20.0 * 256.0));
+  double worst = 0;
+
+  VolumeSim_Noise();
+  VolumeSim_Configure(eqGains);
+  VolumeSim_Run(reference, PACKETS);
+
+  AudioUserDsp_SetVolume(volume);
+  AudioUserDsp_SettleVolume();
+  VolumeSim_Configure(eqGains);
+  VolumeSim_Run(output, PACKETS);
+
+  for(uint32_t i = 0; i < 2 * FRAMES; i++)
+  {
+    if(fabs(output[i] - gain * reference[i]) > worst)
+      worst = fabs(output[i] - gain * reference[i]);
+  }
+
+  printf("  steady: worst difference %.2f lsb\n", worst);
+  return SimReport_Check("steady", worst <= 2.0);
+}
+
+/**
+ * @brief  Steps the volume from 0 dB to -20 dB under a constant input and
+ *         follows the output frame by frame against the ideal ramp, passed
+ *         through the feedback of the last band in double precision: the
+ *         gain scales its feed forward sum, the feedback delays the ramp by a
+ *         few samples.
+ * @param  None
+ * @retval true if the output is the modelled ramp within 2 lsb, never
+ *         overshoots, falls to 1/e of the step one time constant plus the
+ *         delay of the feedback after the step, within a frame, and settles
+ */
+static bool VolumeSim_Curve(void)
+{
+  const int32_t volume = -20 * 256;
+  double target = pow(10.0, volume / (20.0 * 256.0));
+  const BiquadCoefficients* last = &biquadFilters[NUMBER_OF_BANDS - 1].coefficients;
+  double model = 1.0;
+  double modelOut[2] = { DC_LEVEL, DC_LEVEL };
+  double worst = 0;
+  uint32_t timeConstantFrame = 0;
+  int16_t previous = DC_LEVEL;
+  bool monotonic = true;
+
+  for(uint32_t i = 0; i < 2 * FRAMES; i++)
+    input[i] = DC_LEVEL;
+
+  AudioUserDsp_SetVolume(0);
+  AudioUserDsp_SettleVolume();
+  VolumeSim_Configure(flatGains);
+  // the flat bands pass the level before the step
+  VolumeSim_Run(output, 1);
+
+  AudioUserDsp_SetVolume(volume);
+  VolumeSim_Run(output, PACKETS);
+
+  for(uint32_t n = 0; n < FRAMES; n++)
+  {
+    model += (target - model) * SMOOTHING;
+    double out = model * ((double)last->b0 + last->b1 + last->b2) * DC_LEVEL - last->a1 * modelOut[0] - last->a2 * modelOut[1];
+    double error = fabs(output[2 * n] - out);
+
+    modelOut[1] = modelOut[0];
+    modelOut[0] = out;
+    if(error > worst)
+      worst = error;
+    // a sample may step back up by the rounding, where the ramp crosses it
+    if(output[2 * n] > previous + 1 || output[2 * n] != output[2 * n + 1] || output[2 * n] < (int16_t)(target * DC_LEVEL) - 1)
+      monotonic = false;
+    if(timeConstantFrame == 0 && output[2 * n] - target * DC_LEVEL <= (1.0 - target) * DC_LEVEL / M_E)
+      timeConstantFrame = n + 1;
+    previous = output[2 * n];
+  }
+
+  // group delay of the feedback at DC, in frames
+  double delay = -((double)last->a1 + 2.0 * last->a2) / (1.0 + last->a1 + last->a2);
+  uint32_t expectedFrame = (uint32_t)lround(-1.0 / log(1.0 - SMOOTHING) + delay);
+  bool settled = AudioUserDsp_VolumeGain() == (float)target;
+
+  printf("  curve: worst difference %.2f lsb, 1/e after %u frames (expected %u), settled %s\n",
+         worst, timeConstantFrame, expectedFrame, settled ? "yes" : "no");
+  return SimReport_Check("curve", worst <= 2.0 && monotonic && settled &&
+                         timeConstantFrame + 1 >= expectedFrame && timeConstantFrame <= expectedFrame + 1);
+}
+
+/**
+ * @brief  Mutes and unmutes a stream of noise at -6 dB.
+ * @param  None
+ * @retval true if the output reaches zero within the settling time of the
+ *         ramp and stays there, and unmuting ramps back to the same gain
+ */
+static bool VolumeSim_Mute(void)
+{
+  const int32_t volume = -6 * 256;
+  // from full scale to under one lsb
+  const uint32_t settlingFrames = (uint32_t)ceil(log(DSP_VOLUME_SETTLED) / log(1.0 - SMOOTHING));
+  uint32_t silentFrame = FRAMES;
+  bool ok = true;
+
+  VolumeSim_Noise();
+  AudioUserDsp_SetVolume(volume);
+  AudioUserDsp_SettleVolume();
+  float level = AudioUserDsp_VolumeGain();
+  VolumeSim_Configure(eqGains);
+
+  AudioUserDsp_SetMute(true);
+  VolumeSim_Run(output, PACKETS);
+
+  for(uint32_t n = FRAMES; n > 0; n--)
+  {
+    if(output[2 * n - 2] != 0 || output[2 * n - 1] != 0)
+      break;
+    silentFrame = n - 1;
+  }
+  ok &= silentFrame <= settlingFrames && AudioUserDsp_VolumeGain() == 0.0f;
+
+  // a volume change while muted is kept for the unmute
+  AudioUserDsp_SetVolume(volume);
+  VolumeSim_Run(output, PACKETS);
+  ok &= AudioUserDsp_VolumeGain() == 0.0f;
+
+  AudioUserDsp_SetMute(false);
+  VolumeSim_Run(output, PACKETS);
+  ok &= AudioUserDsp_VolumeGain() == level;
+
+  printf("  mute: silent after %u frames (at most %u)\n", silentFrame, settlingFrames);
+  return SimReport_Check("mute", ok);
+}
+
+/**
+ * @brief  Sets every volume from -25 dB to 0 dB in 1/256 dB steps.
+ * @param  None
+ * @retval true if each gain is above the one before and within a thousandth
+ *         of a dB of its volume
+ */
+static bool VolumeSim_Resolution(void)
+{
+  float previous = 0;
+  double worst = 0;
+  bool increasing = true;
+
+  for(int32_t volume = -25 * 256; volume <= 0; volume++)
+  {
+    AudioUserDsp_SetVolume(volume);
+    AudioUserDsp_SettleVolume();
+    float gain = AudioUserDsp_VolumeGain();
+    double error = fabs(20.0 * log10(gain) - volume / 256.0);
+
+    if(gain <= previous)
+      increasing = false;
+    if(error > worst)
+      worst = error;
+    previous = gain;
+  }
+
+  printf("  resolution: worst error %.5f dB\n", worst);
+  return SimReport_Check("resolution", increasing && worst < 0.001);
+}
+
+/**
+ * @brief  Sets the gain of every band and clears the filter state.
+ * @param  gains: gain of each band in dB
+ * @retval None
+ */
+static void VolumeSim_Configure(const int16_t* gains)
+{
+  for(uint8_t i = 0; i < NUMBER_OF_BANDS; i++)
+  {
+    AudioUserDsp_BiquadFilterConfig(&biquadFilters[i], gains[i], frequencies[i], bandwidths[i]);
+    memset(biquadFilters[i].state, 0, sizeof(biquadFilters[i].state));
+  }
+}
+
+// stereo noise at -12 dBFS, the same on every call
+static void VolumeSim_Noise(void)
+{
+  randomState = 1;
+  for(uint32_t i = 0; i < 2 * FRAMES; i++)
+    input[i] = (int16_t)(VolumeSim_Random() >> 16) / 4;
+}
+
+/**
+ * @brief  Filters the input packet by packet, the way the USB interrupt does.
+ * @param  target: receives the filtered samples
+ * @param  packets: how many
+ * @retval None
+ */
+static void VolumeSim_Run(int16_t* target, uint32_t packets)
+{
+  uint8_t packet[PACKET_SIZE];
+
+  for(uint32_t p = 0; p < packets; p++)
+  {
+    for(uint32_t f = 0; f < FRAMES_PER_PACKET; f++)
+      AudioUserDsp_SamplesToFrame(&packet[4 * f], &input[2 * (p * FRAMES_PER_PACKET + f)], &input[2 * (p * FRAMES_PER_PACKET + f) + 1]);
+
+    AudioUserDsp_ProcessPacket(packet, PACKET_SIZE);
+
+    for(uint32_t f = 0; f < FRAMES_PER_PACKET; f++)
+      AudioUserDsp_FrameToSamples(&packet[4 * f], &target[2 * (p * FRAMES_PER_PACKET + f)], &target[2 * (p * FRAMES_PER_PACKET + f) + 1]);
+  }
+}
+
+/**
+ * @brief  Filters the whole input through the coefficients of the bands in
+ *         double precision into reference, truncated to 16 bits at the end.
+ * @param  None
+ * @retval None
+ */
+static void VolumeSim_Reference(void)
+{
+  double state[NUMBER_OF_BANDS][DSP_CHANNELS][4] = {{{0}}};
+
+  for(uint32_t n = 0; n < 2 * FRAMES; n++)
+  {
+    double sample = input[n];
+
+    for(uint8_t i = 0; i < NUMBER_OF_BANDS; i++)
+    {
+      const BiquadCoefficients* c = &biquadFilters[i].coefficients;
+      double* z = state[i][n % DSP_CHANNELS];
+      double out = c->b0 * sample + c->b1 * z[0] + c->b2 * z[1] - c->a1 * z[2] - c->a2 * z[3];
+
+      z[1] = z[0];
+      z[0] = sample;
+      z[3] = z[2];
+      z[2] = out;
+      sample = out;
+    }
+
+    reference[n] = (int16_t)(sample > 32767 ? 32767 : (sample < -32768 ? -32768 : sample));
+  }
+}
+
+// xorshift32, the same noise on every run
+static uint32_t VolumeSim_Random(void)
+{
+  randomState ^= randomState << 13;
+  randomState ^= randomState >> 17;
+  randomState ^= randomState << 5;
+  return randomState;
+}